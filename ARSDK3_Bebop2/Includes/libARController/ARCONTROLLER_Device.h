@@ -143,6 +143,48 @@ eARCONTROLLER_ERROR ARCONTROLLER_Device_SetVideoStreamCallbacks (ARCONTROLLER_De
  */
 eARCONTROLLER_ERROR ARCONTROLLER_Device_SetVideoStreamMP4Compliant (ARCONTROLLER_Device_t *deviceController, int isMP4Compliant);
 
+/**
+ * @brief Set the decode stage of the video stream.
+ * @note With a decode stage, the frame callback is called on a dedicated thread fed by a bounded queue ; the reception of the stream never waits for the decoding.
+ * @note Taken into account at the next start of the device controller.
+ * @param deviceController The device controller.
+ * @param policy Policy of the decode stage when its queue is full ; ARCONTROLLER_STREAM_DECODE_POLICY_SYNCHRONOUS (default) to call the frame callback on the stream thread.
+ * @param queueSize Number of frames that can wait for the decode stage ; from 1 to ARCONTROLLER_STREAM_DECODE_MAX_QUEUE_SIZE.
+ * @return Executing error.
+ */
+eARCONTROLLER_ERROR ARCONTROLLER_Device_SetVideoStreamDecodeStage (ARCONTROLLER_Device_t *deviceController, eARCONTROLLER_STREAM_DECODE_POLICY policy, int queueSize);
+
+/**
+ * @brief Get the statistics of the decode stage of the video stream.
+ * @param deviceController The device controller.
+ * @param[out] stats The statistics ; reset at each start of the video stream.
+ * @return Executing error.
+ */
+eARCONTROLLER_ERROR ARCONTROLLER_Device_GetVideoStreamDecodeStats (ARCONTROLLER_Device_t *deviceController, ARCONTROLLER_Stream_DecodeStats_t *stats);
+
+/**
+ * @brief Decode the commands received in the network receiver thread.
+ * @note Must be set before ARCONTROLLER_Device_Start(). Saves the copies and the reader thread switch of every command ;
+ * the command received callbacks are then called from the receiver thread and must not block.
+ * @param deviceController The device controller.
+ * @param directDispatch 1 to decode the commands in the receiver thread ; 0 to use one reader thread per buffer (default).
+ * @return Executing error.
+ * @see ARCONTROLLER_Network_SetDirectCommandDispatch()
+ */
+eARCONTROLLER_ERROR ARCONTROLLER_Device_SetDirectCommandDispatch (ARCONTROLLER_Device_t *deviceController, int directDispatch);
+
+/**
+ * @brief Enable the warm start from a cache of the last connection.
+ * @note Must be set once, before ARCONTROLLER_Device_Start(). If the cache matches the connection, the state becomes
+ * ARCONTROLLER_DEVICE_STATE_RUNNING with the cached settings and states, the cached H.264 parameter sets are given to
+ * the video decoder configuration callback, and the initial settings and states are then received in background ;
+ * otherwide the start is unchanged. The cache is written after each connection.
+ * @param deviceController The device controller.
+ * @param cachePath Path of the cache file ; the warm start is disabled by default.
+ * @return Executing error.
+ */
+eARCONTROLLER_ERROR ARCONTROLLER_Device_SetWarmStartCache (ARCONTROLLER_Device_t *deviceController, const char *cachePath);
+
 /**
  * @brief Set callback to receive the audio stream.
  * @param deviceController The device controller.
@@ -172,6 +214,43 @@ eARCONTROLLER_ERROR ARCONTROLLER_Device_AddCommandReceivedCallback (ARCONTROLLER
  */
 eARCONTROLLER_ERROR ARCONTROLLER_Device_RemoveCommandReceivedCallback (ARCONTROLLER_Device_t *deviceController, ARCONTROLLER_DICTIONARY_CALLBACK_t commandReceivedCallback, void *customData);
 
+/**
+ * @brief Add callback of command received information for a set of commands.
+ * @note The callback is only called for the commands given ; it can be added several times for other commands.
+ * @param deviceController The device controller.
+ * @param commandReceivedCallback The callback to call when one of the commands is received.
+ * @param[in] customData custom data given as parameter to the callback.
+ * @param[in] commandKeys Keys of the commands.
+ * @param[in] commandKeysCount Number of keys.
+ * @return executing error.
+ * @see ARCONTROLLER_Device_SetSubscribedCommandsOnly()
+ */
+eARCONTROLLER_ERROR ARCONTROLLER_Device_AddCommandReceivedCallbackForKeys (ARCONTROLLER_Device_t *deviceController, ARCONTROLLER_DICTIONARY_CALLBACK_t commandReceivedCallback, void *customData, const eARCONTROLLER_DICTIONARY_KEY *commandKeys, int commandKeysCount);
+
+/**
+ * @brief Remove callback of command received information for a set of commands.
+ * @param deviceController The device controller.
+ * @param commandReceivedCallback The callback to remove.
+ * @param[in] customData custom data associated to the callback.
+ * @param[in] commandKeys Keys of the commands.
+ * @param[in] commandKeysCount Number of keys.
+ * @return executing error.
+ */
+eARCONTROLLER_ERROR ARCONTROLLER_Device_RemoveCommandReceivedCallbackForKeys (ARCONTROLLER_Device_t *deviceController, ARCONTROLLER_DICTIONARY_CALLBACK_t commandReceivedCallback, void *customData, const eARCONTROLLER_DICTIONARY_KEY *commandKeys, int commandKeysCount);
+
+/**
+ * @brief Build only the commands having a callback.
+ * @note Must be set before ARCONTROLLER_Device_Start(). The elements of a command are only built if a callback
+ * added by ARCONTROLLER_Device_AddCommandReceivedCallback() or ARCONTROLLER_Device_AddCommandReceivedCallbackForKeys()
+ * is called for it, or if the device controller uses it ; ARCONTROLLER_Device_GetCommandElements() then returns
+ * ARCONTROLLER_ERROR_NO_ELEMENT for the other commands. The typed telemetry is always updated.
+ * The features of an extension device build all the commands.
+ * @param deviceController The device controller.
+ * @param subscribedOnly 1 to build only the commands having a callback ; 0 to build all commands (default).
+ * @return Executing error.
+ */
+eARCONTROLLER_ERROR ARCONTROLLER_Device_SetSubscribedCommandsOnly (ARCONTROLLER_Device_t *deviceController, int subscribedOnly);
+
 /**
  * @brief Add callback of Device Controller state changed information.
  * @param deviceController The device controller.
@@ -43,6 +43,8 @@
 
 #define ARCONTROLLER_FRAME_DEFAULT_CAPACITY 60000 /**< Default capacity of a new frame */
 
+struct ARCONTROLLER_StreamPool_t;
+
 /**
  * @brief Frame used to store stream data
  */
@@ -60,6 +62,8 @@ typedef struct
     uint8_t *base; /**< Data not modified */
     uint8_t *metadata;
     int metadataSize;
+    struct ARCONTROLLER_StreamPool_t *pool; /**< Stream pool owning the frame ; NULL if the frame is not pooled ; Do not modify */
+    uint32_t poolIndex; /**< Index of the frame in its pool ; Do not modify */
 }ARCONTROLLER_Frame_t;
 
 /**
@@ -107,6 +111,7 @@ int ARCONTROLLER_Frame_ensureCapacityIsAtLeast (ARCONTROLLER_Frame_t *frame, uin
 
 /**
  * @brief Free a frame.
+ * @note If the frame belongs to a stream pool, it is given back to the pool.
  * @param frame The frame.r.
  * @return error Executing error.
  */
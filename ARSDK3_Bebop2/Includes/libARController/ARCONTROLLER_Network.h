@@ -146,6 +146,34 @@ eARCONTROLLER_ERROR ARCONTROLLER_Network_SetVideoReceiveCallback (ARCONTROLLER_N
  */
 eARCONTROLLER_ERROR ARCONTROLLER_Network_SetVideoStreamMP4Compliant (ARCONTROLLER_Network_t *networkController, int isMP4Compliant);
 
+/**
+ * @brief Set the decode stage of the video stream.
+ * @note Must be called while the video stream is stopped.
+ * @param networkController The network Controller ; must be not NULL.
+ * @param policy Policy of the decode stage when its queue is full.
+ * @param queueSize Number of frames that can wait for the decode stage.
+ * @return Executing error.
+ */
+eARCONTROLLER_ERROR ARCONTROLLER_Network_SetVideoStreamDecodeStage (ARCONTROLLER_Network_t *networkController, eARCONTROLLER_STREAM_DECODE_POLICY policy, int queueSize);
+
+/**
+ * @brief Get the statistics of the decode stage of the video stream.
+ * @param networkController The network Controller ; must be not NULL.
+ * @param[out] stats The statistics.
+ * @return Executing error.
+ */
+eARCONTROLLER_ERROR ARCONTROLLER_Network_GetVideoStreamDecodeStats (ARCONTROLLER_Network_t *networkController, ARCONTROLLER_Stream_DecodeStats_t *stats);
+
+/**
+ * @brief Set how the commands received are decoded.
+ * @note In direct dispatch, the commands are decoded by the network receiver thread from the reception buffer, without the reader threads.
+ * This saves two copies and a thread switch per command ; the commands received while the network controller is paused are dropped.
+ * @param networkController The network Controller ; must be not NULL.
+ * @param directDispatch 1 to decode the commands in the receiver thread ; 0 to read them with one reader thread per buffer.
+ * @return Executing error.
+ */
+eARCONTROLLER_ERROR ARCONTROLLER_Network_SetDirectCommandDispatch (ARCONTROLLER_Network_t *networkController, int directDispatch);
+
 /**
  * @brief Start Video stream.
  * @param networkController The network Controller ; must be not NULL.
@@ -132,6 +132,37 @@ typedef eARCONTROLLER_ERROR (*ARCONTROLLER_Stream_DecoderConfigCallback_t) (ARCO
  */
 typedef void (*ARCONTROLLER_Stream_TimeoutFrameCallback_t) (void *customData);
 
+#define ARCONTROLLER_STREAM_DECODE_DEFAULT_QUEUE_SIZE 3 /**< Default number of frames waiting for the decode stage */
+#define ARCONTROLLER_STREAM_DECODE_MAX_QUEUE_SIZE 16 /**< Maximum number of frames waiting for the decode stage */
+
+/**
+ * @brief Policy of the decode stage when its queue is full.
+ */
+typedef enum
+{
+    ARCONTROLLER_STREAM_DECODE_POLICY_SYNCHRONOUS = 0, /**< No decode stage ; the frame callback is called on the stream thread (default) */
+    ARCONTROLLER_STREAM_DECODE_POLICY_BLOCK, /**< The stream thread waits for the decode stage to free a place in the queue */
+    ARCONTROLLER_STREAM_DECODE_POLICY_DROP_OLDEST, /**< The oldest frame of the queue is dropped ; the following frames may show artifacts until the next IFrame */
+    ARCONTROLLER_STREAM_DECODE_POLICY_SKIP_TO_IFRAME, /**< The queue is flushed and the frames are dropped until the next IFrame */
+    ARCONTROLLER_STREAM_DECODE_POLICY_MAX, /**< Max of the enumeration */
+} eARCONTROLLER_STREAM_DECODE_POLICY;
+
+/**
+ * @brief Statistics of the decode stage.
+ */
+typedef struct
+{
+    uint32_t queuedCount; /**< Number of frames queued to the decode stage */
+    uint32_t decodedCount; /**< Number of frames given to the frame callback */
+    uint32_t droppedCount; /**< Number of frames dropped by the policy or while waiting for an IFrame */
+    uint32_t queueLevel; /**< Number of frames currently waiting in the queue */
+    uint32_t lastLatencyUs; /**< Time from the reception of the last frame to the end of its callback, in microseconds */
+    uint32_t averageLatencyUs; /**< Smoothed latency, in microseconds */
+    uint32_t maxLatencyUs; /**< Highest latency, in microseconds */
+    uint32_t lastDecodeTimeUs; /**< Duration of the last frame callback, in microseconds */
+    uint32_t maxDecodeTimeUs; /**< Longest frame callback, in microseconds */
+}ARCONTROLLER_Stream_DecodeStats_t;
+
 /**
  * @brief Stream controller allow to operate ARStream for receive a stream.
  */
@@ -205,6 +236,25 @@ eARCONTROLLER_ERROR ARCONTROLLER_Stream_Stop (ARCONTROLLER_Stream_t *streamContr
  */
 eARCONTROLLER_ERROR ARCONTROLLER_Stream_SetMP4Compliant (ARCONTROLLER_Stream_t *streamController, int isMP4Compliant);
 
+/**
+ * @brief Set the decode stage of the stream.
+ * @note With a decode stage, the frame callback is called on a dedicated thread fed by a bounded queue, so the reception never waits for the decoding.
+ * @note Must be called while the stream is stopped.
+ * @param streamController The stream controller.
+ * @param policy Policy of the decode stage when its queue is full.
+ * @param queueSize Number of frames that can wait for the decode stage ; from 1 to ARCONTROLLER_STREAM_DECODE_MAX_QUEUE_SIZE.
+ * @return Executing error.
+ */
+eARCONTROLLER_ERROR ARCONTROLLER_Stream_SetDecodeStage (ARCONTROLLER_Stream_t *streamController, eARCONTROLLER_STREAM_DECODE_POLICY policy, int queueSize);
+
+/**
+ * @brief Get the statistics of the decode stage.
+ * @param streamController The stream controller.
+ * @param[out] stats The statistics ; reset at each start of the stream.
+ * @return Executing error.
+ */
+eARCONTROLLER_ERROR ARCONTROLLER_Stream_GetDecodeStats (ARCONTROLLER_Stream_t *streamController, ARCONTROLLER_Stream_DecodeStats_t *stats);
+
 /**
  * @brief Set the callbacks of the frames events.
  * @param streamController The stream controller.
@@ -134,4 +134,22 @@ int ARCONTROLLER_Stream2_IsInitilized (ARCONTROLLER_Stream2_t *stream2Controller
  */
 eARCONTROLLER_ERROR ARCONTROLLER_Stream2_SetMP4Compliant (ARCONTROLLER_Stream2_t *stream2Controller, int isMP4Compliant);
 
+/**
+ * @brief Set the decode stage of the stream.
+ * @note Must be called while the stream is stopped.
+ * @param stream2Controller The stream controller.
+ * @param policy Policy of the decode stage when its queue is full ; ARCONTROLLER_STREAM_DECODE_POLICY_SYNCHRONOUS to call the frame callback on the filter thread.
+ * @param queueSize Number of frames that can wait for the decode stage ; from 1 to ARCONTROLLER_STREAM_DECODE_MAX_QUEUE_SIZE.
+ * @return Executing error.
+ */
+eARCONTROLLER_ERROR ARCONTROLLER_Stream2_SetDecodeStage (ARCONTROLLER_Stream2_t *stream2Controller, eARCONTROLLER_STREAM_DECODE_POLICY policy, int queueSize);
+
+/**
+ * @brief Get the statistics of the decode stage.
+ * @param stream2Controller The stream controller.
+ * @param[out] stats The statistics.
+ * @return Executing error.
+ */
+eARCONTROLLER_ERROR ARCONTROLLER_Stream2_GetDecodeStats (ARCONTROLLER_Stream2_t *stream2Controller, ARCONTROLLER_Stream_DecodeStats_t *stats);
+
 #endif /* _ARCONTROLLER_STREAM2_H_ */
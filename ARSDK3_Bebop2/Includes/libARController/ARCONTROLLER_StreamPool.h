@@ -47,6 +47,18 @@
 
 typedef struct ARCONTROLLER_StreamPool_t ARCONTROLLER_StreamPool_t;
 
+/**
+ * @brief Usage statistics of a Stream Pool.
+ */
+typedef struct
+{
+    uint32_t capacity; /**< Number of frames of the pool */
+    uint32_t inUse; /**< Number of frames currently taken */
+    uint32_t peakInUse; /**< Highest number of frames taken at the same time */
+    uint32_t acquiredCount; /**< Number of frames given since the pool was created */
+    uint32_t exhaustedCount; /**< Number of requests that found no free frame */
+}ARCONTROLLER_StreamPool_Stats_t;
+
 /**
  * @brief Create a new Stream Pool.
  * @warning This function allocate memory.
@@ -67,19 +79,30 @@ ARCONTROLLER_StreamPool_t *ARCONTROLLER_StreamPool_New (uint32_t capacity, eARCO
 void ARCONTROLLER_StreamPool_Delete (ARCONTROLLER_StreamPool_t **streamPool);
 
 /**
- * @brief Return the first free frmae of the pool.
+ * @brief Return a free frame of the pool and mark it as taken.
+ * @note Lock-free and in constant time ; ARCONTROLLER_Frame_SetFree() gives the frame back.
  * @param streamPool The Stream Pool.
- * @param[out] error Executing error.
- * @return The new Stream Pool.
+ * @param[out] error Executing error ; ARCONTROLLER_ERROR_STREAMPOOL_FRAME_NOT_FOUND if the pool is exhausted.
+ * @return The free frame.
  */
 ARCONTROLLER_Frame_t *ARCONTROLLER_StreamPool_GetNextFreeFrame (ARCONTROLLER_StreamPool_t *streamPool, eARCONTROLLER_ERROR *error);
 
 /**
- * @brief Return the first free frmae of the pool.
+ * @brief Return the frame owning a data buffer of the pool.
+ * @note The lookup is done in constant time when frameData is the beginning of the buffer.
  * @param streamPool The Stream Pool.
+ * @param frameData The data buffer.
  * @param[out] error Executing error.
- * @return The new Stream Pool.
+ * @return The frame, or NULL if frameData does not belong to the pool.
  */
 ARCONTROLLER_Frame_t *ARCONTROLLER_StreamPool_GetFrameFromData (ARCONTROLLER_StreamPool_t *streamPool, uint8_t *frameData, eARCONTROLLER_ERROR *error);
 
+/**
+ * @brief Get the usage statistics of the pool.
+ * @param streamPool The Stream Pool.
+ * @param[out] stats The statistics.
+ * @return Executing error.
+ */
+eARCONTROLLER_ERROR ARCONTROLLER_StreamPool_GetStats (ARCONTROLLER_StreamPool_t *streamPool, ARCONTROLLER_StreamPool_Stats_t *stats);
+
 #endif /* _ARCONTROLLER_STREAM_POOL_H_ */
@@ -0,0 +1,105 @@
+/*
+    Copyright (C) 2014 Parrot SA
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions
+    are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the 
+      distribution.
+    * Neither the name of Parrot nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+    "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+    LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+    FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+    COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+    INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+    OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED 
+    AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+    OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+    SUCH DAMAGE.
+*/
+/**
+ * @file ARCONTROLLER_Telemetry.h
+ * @brief Typed snapshots of the periodic states of a device.
+ *
+ * The snapshots are written by the feature controllers as the commands are
+ * decoded and can be read from any thread without locking, field by field
+ * instead of through the string keys of the commands dictionary.
+ */
+
+#ifndef _ARCONTROLLER_TELEMETRY_H_
+#define _ARCONTROLLER_TELEMETRY_H_
+
+#include <stdint.h>
+
+#include <libARController/ARCONTROLLER_Error.h>
+#include <libARController/ARCONTROLLER_Feature.h>
+
+/**
+ * @brief Periodic states of the feature ARDrone3.
+ * @note Each group of fields has its own sequence number, incremented every time the command is received ; the fields are not valid while it is 0.
+ */
+typedef struct
+{
+    uint32_t attitudeSequence; /**< Number of PilotingState.AttitudeChanged received */
+    float roll; /**< Roll value (in radian) */
+    float pitch; /**< Pitch value (in radian) */
+    float yaw; /**< Yaw value (in radian) */
+    
+    uint32_t speedSequence; /**< Number of PilotingState.SpeedChanged received */
+    float speedX; /**< Speed relative to the North (in m/s) */
+    float speedY; /**< Speed relative to the East (in m/s) */
+    float speedZ; /**< Speed on the z axis (in m/s) */
+    
+    uint32_t altitudeSequence; /**< Number of PilotingState.AltitudeChanged received */
+    double altitude; /**< Altitude relative to the take off point (in m) */
+    
+    uint32_t positionSequence; /**< Number of PilotingState.PositionChanged received */
+    double latitude; /**< Latitude ; 500.0 if not available */
+    double longitude; /**< Longitude ; 500.0 if not available */
+    double positionAltitude; /**< GPS altitude (in m) */
+    
+    uint32_t cameraOrientationSequence; /**< Number of CameraState.Orientation received */
+    int8_t tilt; /**< Tilt of the camera */
+    int8_t pan; /**< Pan of the camera */
+} ARCONTROLLER_TELEMETRY_ARDRONE3_t;
+
+/**
+ * @brief Periodic states of the feature Common.
+ * @note Each group of fields has its own sequence number, incremented every time the command is received ; the fields are not valid while it is 0.
+ */
+typedef struct
+{
+    uint32_t batterySequence; /**< Number of CommonState.BatteryStateChanged received */
+    uint8_t batteryPercent; /**< Battery level (in percent) */
+} ARCONTROLLER_TELEMETRY_COMMON_t;
+
+/**
+ * @brief Get a consistent copy of the periodic states of the feature ARDrone3.
+ * @note Lock-free ; can be called from any thread, including the command callbacks.
+ * @param feature The feature controller.
+ * @param[out] snapshot The copy of the states.
+ * @return Executing error.
+ */
+eARCONTROLLER_ERROR ARCONTROLLER_FEATURE_ARDrone3_GetTelemetry (ARCONTROLLER_FEATURE_ARDrone3_t *feature, ARCONTROLLER_TELEMETRY_ARDRONE3_t *snapshot);
+
+/**
+ * @brief Get a consistent copy of the periodic states of the feature Common.
+ * @note Lock-free ; can be called from any thread, including the command callbacks.
+ * @param feature The feature controller.
+ * @param[out] snapshot The copy of the states.
+ * @return Executing error.
+ */
+eARCONTROLLER_ERROR ARCONTROLLER_FEATURE_Common_GetTelemetry (ARCONTROLLER_FEATURE_Common_t *feature, ARCONTROLLER_TELEMETRY_COMMON_t *snapshot);
+
+#endif /* _ARCONTROLLER_TELEMETRY_H_ */
@@ -46,5 +46,6 @@
 #include <libARController/ARCONTROLLER_Feature.h>
 #include <libARController/ARCONTROLLER_Device.h>
 #include <libARController/ARCONTROLLER_Stream.h>
+#include <libARController/ARCONTROLLER_Telemetry.h>
 
 #endif /* _ARCONTROLLER_H_ */
@@ -79,6 +79,16 @@ typedef enum
  */
 typedef eARNETWORK_MANAGER_CALLBACK_RETURN (*ARNETWORK_Manager_Callback_t) (int IoBufferId, uint8_t *dataPtr, void *customData, eARNETWORK_MANAGER_CALLBACK_STATUS status);
 
+/**
+ * @brief callback receiving the data of an output buffer directly from the receiver thread
+ * @warning dataPtr is only valid during the call ; the callback must copy what it keeps
+ * @param[in] IoBufferId identifier of the output buffer
+ * @param[in] dataPtr pointer on the data received
+ * @param[in] dataSize size of the data received
+ * @param[in] customData pointer on a custom data
+ */
+typedef void (*ARNETWORK_Manager_DirectReadCallback_t) (int IoBufferId, uint8_t *dataPtr, int dataSize, void *customData);
+
 /**
  * @brief network manager allow to send and receive data acknowledged or not.
  */
@@ -262,4 +272,17 @@ eARNETWORK_ERROR ARNETWORK_Manager_SetMinimumTimeBetweenSends (ARNETWORK_Manager
 eARNETWORK_ERROR ARNETWORK_Manager_GetInputDataEventFd (ARNETWORK_Manager_t *managerPtr, int *fd);
 
 
+/**
+ * @brief Delivers the data of an output buffer directly from the receiver thread
+ * @details The data received for the buffer are no more copied in it: the callback is called by the thread running ARNETWORK_Manager_ReceivingThreadRun() with the data still in the reception buffer.
+ * The read functions then find the buffer empty.
+ * @warning The callback runs in the receiver thread ; a slow callback delays the reception and the acknowledgements of all buffers
+ * @param managerPtr Pointer to the ARNETWORK_Manager_t
+ * @param[in] outBufferID Identifier of the output buffer
+ * @param[in] callback callback called with each data received ; NULL to copy the data in the buffer again
+ * @param[in] customData custom data given to the callback
+ * @return error eARNETWORK_ERROR type
+ */
+eARNETWORK_ERROR ARNETWORK_Manager_SetDirectReadCallback (ARNETWORK_Manager_t *managerPtr, int outBufferID, ARNETWORK_Manager_DirectReadCallback_t callback, void *customData);
+
 #endif /* _ARNETWORK_MANAGER_H_ */
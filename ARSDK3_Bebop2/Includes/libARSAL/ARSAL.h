@@ -45,5 +45,6 @@
 #include <libARSAL/ARSAL_Socket.h>
 #include <libARSAL/ARSAL_Thread.h>
 #include <libARSAL/ARSAL_Time.h>
+#include <libARSAL/ARSAL_Trace.h>
 
 #endif /* _ARSAL_H_ */
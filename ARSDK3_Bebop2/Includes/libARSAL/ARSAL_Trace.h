@@ -0,0 +1,147 @@
+/*
+    Copyright (C) 2014 Parrot SA
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions
+    are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the 
+      distribution.
+    * Neither the name of Parrot nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+    "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+    LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+    FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+    COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+    INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+    OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED 
+    AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+    OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+    SUCH DAMAGE.
+*/
+/**
+ * @file libARSAL/ARSAL_Trace.h
+ * @brief Latency trace of the video frames, from the RTP reception to the piloting command.
+ */
+#ifndef _ARSAL_TRACE_H_
+#define _ARSAL_TRACE_H_
+
+#include <inttypes.h>
+#include <stdio.h>
+
+/**
+ * @brief Number of records kept by the trace ring ; the oldest ones are overwritten.
+ */
+#define ARSAL_TRACE_RING_SIZE 16384
+
+/**
+ * @brief Stages a frame goes through, in order.
+ * @note The frame ID is the access unit timestamp in microseconds, as computed by the RTP receiver
+ * from the RTP timestamp ; it is carried by ARCONTROLLER_Frame_t::timestamp to the application.
+ */
+typedef enum
+{
+    ARSAL_TRACE_STAGE_RTP_ARRIVAL = 0, /**< First RTP packet of the access unit received */
+    ARSAL_TRACE_STAGE_AU_COMPLETE, /**< Access unit output by the H.264 filter */
+    ARSAL_TRACE_STAGE_DECODED, /**< Picture decoded by the application */
+    ARSAL_TRACE_STAGE_DETECTED, /**< Detection done on the picture */
+    ARSAL_TRACE_STAGE_DECIDED, /**< State decision taken on the detection result */
+    ARSAL_TRACE_STAGE_PCMD_SENT, /**< First piloting command sent after the decision */
+    ARSAL_TRACE_STAGE_MAX, /**< Number of stages */
+} eARSAL_TRACE_STAGE;
+
+/**
+ * @brief One trace record.
+ */
+typedef struct
+{
+    uint64_t frameId; /**< Access unit timestamp of the frame */
+    uint64_t timeUs; /**< Monotonic time of the record in microseconds */
+    uint32_t stage; /**< eARSAL_TRACE_STAGE */
+    uint32_t threadId; /**< Thread that wrote the record */
+} ARSAL_Trace_Record_t;
+
+/**
+ * @brief Enables or disables the trace ; it is disabled by default and then costs a single load per stage.
+ * @param enabled 1 to record, 0 to stop recording.
+ */
+void ARSAL_Trace_SetEnabled (int enabled);
+
+/**
+ * @brief Tells whether the trace is enabled.
+ * @return 1 if the trace records, 0 otherwise.
+ */
+int ARSAL_Trace_IsEnabled (void);
+
+/**
+ * @brief Gets the clock of the trace.
+ * @return The monotonic time in microseconds.
+ */
+uint64_t ARSAL_Trace_GetTimeUs (void);
+
+/**
+ * @brief Records that a frame reached a stage, at the current time.
+ * @note Lock-free, callable from any thread ; does nothing while the trace is disabled.
+ * @param stage The stage.
+ * @param frameId The access unit timestamp of the frame ; 0 is ignored.
+ */
+void ARSAL_Trace_Record (eARSAL_TRACE_STAGE stage, uint64_t frameId);
+
+/**
+ * @brief Marks the frame of the last decision, so that the next piloting command sent is recorded for it.
+ * @param frameId The access unit timestamp of the frame.
+ */
+void ARSAL_Trace_SetPendingCommand (uint64_t frameId);
+
+/**
+ * @brief Records ARSAL_TRACE_STAGE_PCMD_SENT for the frame marked by ARSAL_Trace_SetPendingCommand(), once.
+ * @note Called by the controller looper when it sends the piloting command.
+ */
+void ARSAL_Trace_RecordPendingCommand (void);
+
+/**
+ * @brief Copies the records still in the ring, oldest first.
+ * @note The writers are not stopped ; records overwritten during the copy are skipped.
+ * @param[out] records Array of at least maxCount records.
+ * @param maxCount Capacity of records.
+ * @return The number of records copied.
+ */
+int ARSAL_Trace_Snapshot (ARSAL_Trace_Record_t *records, int maxCount);
+
+/**
+ * @brief Empties the ring.
+ */
+void ARSAL_Trace_Clear (void);
+
+/**
+ * @brief Gets the name of a stage.
+ * @param stage The stage.
+ * @return The name of the stage.
+ */
+const char *ARSAL_Trace_StageToString (eARSAL_TRACE_STAGE stage);
+
+/**
+ * @brief Writes the records as a Chrome trace (chrome://tracing, Perfetto).
+ * @note Every frame is an async track ; each stage is a slice from the previous stage of the frame.
+ * @param file The output file.
+ * @return 0 if no error occured, -1 otherwise.
+ */
+int ARSAL_Trace_WriteChromeJson (FILE *file);
+
+/**
+ * @brief Writes the latency histograms of each stage transition and of the whole path.
+ * @param file The output file.
+ * @return 0 if no error occured, -1 otherwise.
+ */
+int ARSAL_Trace_WriteHistograms (FILE *file);
+
+#endif /* _ARSAL_TRACE_H_ */
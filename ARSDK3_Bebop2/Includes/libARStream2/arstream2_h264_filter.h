@@ -93,7 +93,9 @@ typedef eARSTREAM2_ERROR (*ARSTREAM2_H264Filter_SpsPpsCallback_t)(uint8_t *spsBu
 /**
  * @brief Get access unit buffer callback function
  *
- * The mandatory get AU buffer callback function is called to retreive a buffer to fill with an access unit.
+ * The optional get AU buffer callback function is called to retreive a buffer to fill with an access unit.
+ * The access unit NAL units are gathered into the buffer. Without this callback the access unit is output
+ * directly from the filter buffers.
  *
  * @param auBuffer Pointer to the AU buffer pointer
  * @param auBufferSize Pointer to the AU buffer size in bytes
@@ -104,7 +106,6 @@ typedef eARSTREAM2_ERROR (*ARSTREAM2_H264Filter_SpsPpsCallback_t)(uint8_t *spsBu
  * @return ARSTREAM2_ERROR_RESOURCE_UNAVAILABLE if no buffers are available.
  * @return an eARSTREAM2_ERROR error code if another error occurred.
  *
- * @warning This callback function is mandatory.
  * @warning ARSTREAM2_H264Filter functions must not be called within the callback function.
  */
 typedef eARSTREAM2_ERROR (*ARSTREAM2_H264Filter_GetAuBufferCallback_t)(uint8_t **auBuffer, int *auBufferSize, void **auBufferUserPtr, void *userPtr);
@@ -114,6 +115,8 @@ typedef eARSTREAM2_ERROR (*ARSTREAM2_H264Filter_GetAuBufferCallback_t)(uint8_t *
  * @brief Access unit ready callback function
  *
  * The mandatory AU ready callback function is called to output an access unit.
+ * If no get AU buffer callback is provided, auBuffer belongs to the filter: it is only valid during the call,
+ * must not be modified and auBufferUserPtr is NULL.
  *
  * @param auBuffer Pointer to the AU buffer
  * @param auSize AU size in bytes
@@ -189,7 +192,7 @@ void* ARSTREAM2_H264Filter_RunFilterThread(void *filterHandle);
  * @param filterHandle Instance handle.
  * @param spsPpsCallback Optional SPS/PPS callback function.
  * @param spsPpsCallbackUserPtr Optional SPS/PPS callback user pointer.
- * @param getAuBufferCallback Mandatory get access unit buffer callback function.
+ * @param getAuBufferCallback Optional get access unit buffer callback function (NULL to output the access units without copy).
  * @param getAuBufferCallbackUserPtr Optional get access unit buffer callback user pointer.
  * @param auReadyCallback Mandatory access unit ready callback function.
  * @param auReadyCallbackUserPtr Optional access unit ready callback user pointer.
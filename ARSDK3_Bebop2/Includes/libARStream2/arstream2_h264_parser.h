@@ -80,13 +80,48 @@ eARSTREAM2_ERROR ARSTREAM2_H264Parser_Init(ARSTREAM2_H264Parser_Handle* parserHa
 eARSTREAM2_ERROR ARSTREAM2_H264Parser_Free(ARSTREAM2_H264Parser_Handle parserHandle);
 
 
+/**
+ * @brief Open a file to parse.
+ *
+ * The function opens the file for reading and memory-maps it for ARSTREAM2_H264Parser_ReadNextNalu_file().
+ * The mapping is identified by the file path, size and modification time; only one file is mapped at a time.
+ * The file shall be closed using the ARSTREAM2_H264Parser_CloseFile() function.
+ *
+ * @param parserHandle Instance handle.
+ * @param path Path of the file to open.
+ * @param fp Pointer to the opened file.
+ * @param fileSize Optional pointer to the total file size.
+ *
+ * @return ARSTREAM2_OK if no error occurred.
+ * @return ARSTREAM2_ERROR_NOT_FOUND if the file cannot be opened.
+ * @return an eARSTREAM2_ERROR error code if another error occurred.
+ */
+eARSTREAM2_ERROR ARSTREAM2_H264Parser_OpenFile(ARSTREAM2_H264Parser_Handle parserHandle, const char* path, FILE** fp, unsigned long long *fileSize);
+
+
+/**
+ * @brief Close a file opened with ARSTREAM2_H264Parser_OpenFile().
+ *
+ * The function unmaps the file, then closes it. A NAL unit read from the mapping can no longer be parsed.
+ *
+ * @param parserHandle Instance handle.
+ * @param fp Opened file to close.
+ *
+ * @return ARSTREAM2_OK if no error occurred.
+ * @return an eARSTREAM2_ERROR error code if an error occurred.
+ */
+eARSTREAM2_ERROR ARSTREAM2_H264Parser_CloseFile(ARSTREAM2_H264Parser_Handle parserHandle, FILE* fp);
+
+
 /**
  * @brief Read the next NAL unit from a file.
  *
  * The function finds the next NALU start and end in the file. The NALU shall then be parsed using the ARSTREAM2_H264Parser_ParseNalu() function.
+ * A file opened with ARSTREAM2_H264Parser_OpenFile() is parsed in place from its mapping, which stays valid until the next call;
+ * other files, and files that cannot be mapped, are read instead. In both cases the file position is left at the end of the NALU.
  *
  * @param parserHandle Instance handle.
- * @param fp Opened file to parse.
+ * @param fp Opened file to parse; it must not be written to while it is being parsed.
  * @param fileSize Total file size.
  * @param naluSize Optional pointer to the NAL unit size.
  *
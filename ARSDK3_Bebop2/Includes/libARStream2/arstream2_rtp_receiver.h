@@ -29,6 +29,18 @@ extern "C" {
 #define ARSTREAM2_RTP_RECEIVER_DEFAULT_CLIENT_CONTROL_PORT    (55005)
 
 
+/**
+ * @brief Default reorder window size in packets
+ */
+#define ARSTREAM2_RTP_RECEIVER_DEFAULT_REORDER_WINDOW_PACKETS (32)
+
+
+/**
+ * @brief Default reorder window duration in milliseconds
+ */
+#define ARSTREAM2_RTP_RECEIVER_DEFAULT_REORDER_WINDOW_MS      (20)
+
+
 /**
  * @brief Causes for NAL unit callback function
  */
@@ -112,6 +124,8 @@ typedef struct ARSTREAM2_RtpReceiver_Config_t
     int maxLatencyMs;                               /**< Maximum acceptable total latency in milliseconds (should be provided by the server, can be 0) */
     int maxNetworkLatencyMs;                        /**< Maximum acceptable network latency in milliseconds (should be provided by the server, can be 0) */
     int insertStartCodes;                           /**< Boolean-like (0-1) flag: if active insert a start code prefix before NAL units */
+    int reorderWindowPackets;                       /**< Number of out of order packets held before a gap is skipped (0 means default, negative disables reordering), @see ARSTREAM2_RTP_RECEIVER_DEFAULT_REORDER_WINDOW_PACKETS */
+    int reorderWindowMs;                            /**< Maximum time in milliseconds a missing packet is waited for (0 means default), @see ARSTREAM2_RTP_RECEIVER_DEFAULT_REORDER_WINDOW_MS */
 } ARSTREAM2_RtpReceiver_Config_t;
 
 
@@ -259,6 +273,22 @@ eARSTREAM2_ERROR ARSTREAM2_RtpReceiver_GetMonitoring(ARSTREAM2_RtpReceiver_t *re
                                                      uint32_t *bytesReceived, uint32_t *meanPacketSize, uint32_t *packetSizeStdDev, uint32_t *packetsReceived, uint32_t *packetsMissed);
 
 
+/**
+ * @brief Get the reorder window counters
+ * The counters are cumulated since the receiver creation.
+ * Pointers to counters that are not required can be left NULL.
+ *
+ * @param[in] receiver The receiver instance
+ * @param[out] reorderedPackets Packets received with a sequence number lower than an already received one (optional, can be NULL)
+ * @param[out] recoveredPackets Reordered packets put back in sequence before reassembly (optional, can be NULL)
+ * @param[out] lateDroppedPackets Packets dropped because they arrived after the window was released, or were duplicates (optional, can be NULL)
+ *
+ * @return ARSTREAM2_OK if no error occured.
+ * @return ARSTREAM2_ERROR_BAD_PARAMETERS if the receiver is invalid.
+ */
+eARSTREAM2_ERROR ARSTREAM2_RtpReceiver_GetReorderCounters(ARSTREAM2_RtpReceiver_t *receiver, uint32_t *reorderedPackets, uint32_t *recoveredPackets, uint32_t *lateDroppedPackets);
+
+
 /**
  * @brief Creates a new RtpReceiver RtpResender
  * @warning This function allocates memory. The resender must be deleted by a call to ARSTREAM2_RtpReceiver_Delete() or ARSTREAM2_RtpReceiver_RtpResender_Delete()
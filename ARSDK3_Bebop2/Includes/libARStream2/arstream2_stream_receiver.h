@@ -89,6 +89,8 @@ typedef struct
     int maxBitrate;                                                 /**< Maximum streaming bitrate in bit/s (should be provided by the server, can be 0) */
     int maxLatencyMs;                                               /**< Maximum acceptable total latency in milliseconds (should be provided by the server, can be 0) */
     int maxNetworkLatencyMs;                                        /**< Maximum acceptable network latency in milliseconds (should be provided by the server, can be 0) */
+    int reorderWindowPackets;                                       /**< Reorder window size in packets (0 means default, negative disables reordering) */
+    int reorderWindowMs;                                            /**< Maximum time in milliseconds a missing packet is waited for (0 means default) */
     int waitForSync;                                                /**< if true, wait for SPS/PPS sync before outputting access anits */
     int outputIncompleteAu;                                         /**< if true, output incomplete access units */
     int filterOutSpsPps;                                            /**< if true, filter out SPS and PPS NAL units */
@@ -202,7 +204,7 @@ void* ARSTREAM2_StreamReceiver_RunControlThread(void *streamReceiverHandle);
  * @param streamReceiverHandle Instance handle.
  * @param spsPpsCallback SPS/PPS callback function.
  * @param spsPpsCallbackUserPtr SPS/PPS callback user pointer.
- * @param getAuBufferCallback Get access unit buffer callback function.
+ * @param getAuBufferCallback Get access unit buffer callback function (optional, NULL to output the access units without copy).
  * @param getAuBufferCallbackUserPtr Get access unit buffer callback user pointer.
  * @param auReadyCallback Access unit ready callback function.
  * @param auReadyCallbackUserPtr Access unit ready callback user pointer.
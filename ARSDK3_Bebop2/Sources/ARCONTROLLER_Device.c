@@ -24,6 +24,7 @@
 #include <libARSAL/ARSAL_Mutex.h>
 #include <libARSAL/ARSAL_Sem.h>
 #include <libARSAL/ARSAL_Time.h>
+#include <libARSAL/ARSAL_Trace.h>
 #include <libARController/ARCONTROLLER_Network.h>
 #include <libARController/ARCONTROLLER_Feature.h>
 #include <libARController/ARCONTROLLER_DICTIONARY_Key.h>
@@ -33,6 +34,8 @@
 #include <libARController/ARCONTROLLER_Device.h>
 
 #include "ARCONTROLLER_Device.h"
+#include "ARCONTROLLER_DictionaryPool.h"
+#include "ARCONTROLLER_Feature.h"
 
 #define ARCONTROLLER_DEVICE_TAG "ARCONTROLLER_Device"
 
@@ -60,6 +63,7 @@ ARCONTROLLER_Device_t *ARCONTROLLER_Device_New (ARDISCOVERY_Device_t *discoveryD
     eARCONTROLLER_ERROR localError = ARCONTROLLER_OK;
     eARDISCOVERY_ERROR dicoveryError = ARDISCOVERY_OK;
     ARCONTROLLER_Device_t *deviceController =  NULL;
+    int keyIndex = 0;
     
     // Check parameters
     if (discoveryDevice == NULL)
@@ -68,6 +72,9 @@ ARCONTROLLER_Device_t *ARCONTROLLER_Device_New (ARDISCOVERY_Device_t *discoveryD
     }
     // No Else: the checking parameters sets localError to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    // The features store the decoded commands in elements of the dictionary pool
+    ARCONTROLLER_DictionaryPool_Init ();
+    
     // Allocate the Device Controller
     deviceController = malloc (sizeof(ARCONTROLLER_Device_t));
     if (deviceController != NULL)
@@ -106,11 +113,20 @@ ARCONTROLLER_Device_t *ARCONTROLLER_Device_New (ARDISCOVERY_Device_t *discoveryD
             deviceController->privatePart->state = ARCONTROLLER_DEVICE_STATE_STOPPED;
             deviceController->privatePart->controllerLooperThread = NULL;
             deviceController->privatePart->commandCallbacks = NULL;
+            for (keyIndex = 0; keyIndex < ARCONTROLLER_DICTIONARY_DICTIONARY_KEY_MAX; keyIndex++)
+            {
+                deviceController->privatePart->keyCommandCallbacks[keyIndex] = NULL;
+            }
+            ARCONTROLLER_Device_UpdateSubscribedKeys (deviceController);
+            deviceController->privatePart->subscribedCommandsOnly = 0;
             deviceController->privatePart->stateChangedCallbacks = NULL;
             deviceController->privatePart->startCancelled = 0;
+            deviceController->privatePart->directCommandDispatch = 0;
             // Video Part
             deviceController->privatePart->hasVideo = 0;
             deviceController->privatePart->videoIsMP4Compliant = 0;
+            deviceController->privatePart->videoDecodePolicy = ARCONTROLLER_STREAM_DECODE_POLICY_SYNCHRONOUS;
+            deviceController->privatePart->videoDecodeQueueSize = ARCONTROLLER_STREAM_DECODE_DEFAULT_QUEUE_SIZE;
             deviceController->privatePart->videoDecoderConfigCallback = NULL;
             deviceController->privatePart->videoReceiveCallback = NULL;
             deviceController->privatePart->videoTimeoutCallback = NULL;
@@ -126,6 +142,15 @@ ARCONTROLLER_Device_t *ARCONTROLLER_Device_New (ARDISCOVERY_Device_t *discoveryD
             deviceController->privatePart->extensionStateChangedCallbacks = NULL;
             deviceController->privatePart->extensionName = NULL;
             deviceController->privatePart->extensionProduct = ARDISCOVERY_PRODUCT_MAX;
+            // Warm start part
+            deviceController->privatePart->warmStart = NULL;
+            deviceController->privatePart->warmStartLink.address[0] = '\0';
+            deviceController->privatePart->warmStartLink.productID = 0;
+            deviceController->privatePart->warmStartLink.c2dPort = 0;
+            deviceController->privatePart->warmStartLink.serverStreamPort = 0;
+            deviceController->privatePart->warmStartLink.serverControlPort = 0;
+            deviceController->privatePart->reconcileThread = NULL;
+            deviceController->privatePart->warmStartReconciled = 0;
             
             // Create the mutex/condition 
             if ((ARSAL_Mutex_Init (&(deviceController->privatePart->mutex)) != 0) ||
@@ -419,6 +444,8 @@ void ARCONTROLLER_Device_Delete (ARCONTROLLER_Device_t **deviceController)
 {
     // -- Delete the Device Controller --
     
+    int keyIndex = 0;
+    
     if (deviceController != NULL)
     {
         if ((*deviceController) != NULL)
@@ -438,6 +465,14 @@ void ARCONTROLLER_Device_Delete (ARCONTROLLER_Device_t **deviceController)
                     ARCONTROLLER_Dictionary_DeleteCallbackList(&((*deviceController)->privatePart->commandCallbacks));
                 }
                 
+                for (keyIndex = 0; keyIndex < ARCONTROLLER_DICTIONARY_DICTIONARY_KEY_MAX; keyIndex++)
+                {
+                    if ((*deviceController)->privatePart->keyCommandCallbacks[keyIndex] != NULL)
+                    {
+                        ARCONTROLLER_Dictionary_DeleteCallbackList(&((*deviceController)->privatePart->keyCommandCallbacks[keyIndex]));
+                    }
+                }
+                
                 if ((*deviceController)->privatePart->stateChangedCallbacks != NULL)
                 {
                     // -- Delete all callback in array --
@@ -559,6 +594,9 @@ void ARCONTROLLER_Device_Delete (ARCONTROLLER_Device_t **deviceController)
                         break;
                 }
                 
+                // The restored arguments point into the cache ; it is deleted after the features
+                ARCONTROLLER_WarmStart_Delete (&((*deviceController)->privatePart->warmStart));
+                
                 ARDISCOVERY_Device_Delete (&((*deviceController)->privatePart->discoveryDevice));
                 
                 // free the private part of the Device Controller
@@ -4144,6 +4182,165 @@ eARCONTROLLER_ERROR ARCONTROLLER_Device_SetVideoStreamMP4Compliant (ARCONTROLLER
     return error;
 }
 
+eARCONTROLLER_ERROR ARCONTROLLER_Device_SetVideoStreamDecodeStage (ARCONTROLLER_Device_t *deviceController, eARCONTROLLER_STREAM_DECODE_POLICY policy, int queueSize)
+{
+    // -- Set the decode stage of the video stream. --
+
+    eARCONTROLLER_ERROR error = ARCONTROLLER_OK;
+    int locked = 0;
+
+    // Check parameters
+    if ((deviceController == NULL) ||
+        (deviceController->privatePart == NULL) ||
+        (policy < ARCONTROLLER_STREAM_DECODE_POLICY_SYNCHRONOUS) ||
+        (policy >= ARCONTROLLER_STREAM_DECODE_POLICY_MAX) ||
+        (queueSize < 1) ||
+        (queueSize > ARCONTROLLER_STREAM_DECODE_MAX_QUEUE_SIZE))
+    {
+        error = ARCONTROLLER_ERROR_BAD_PARAMETER;
+    }
+    // No Else: the checking parameters sets localError to ARCONTROLLER_ERROR_BAD_PARAMETER and stop the processing
+
+    if (error == ARCONTROLLER_OK)
+    {
+        ARSAL_Mutex_Lock(&(deviceController->privatePart->mutex));
+        locked = 1;
+    }
+
+    if (error == ARCONTROLLER_OK)
+    {
+        if (deviceController->privatePart->hasVideo)
+        {
+            deviceController->privatePart->videoDecodePolicy = policy;
+            deviceController->privatePart->videoDecodeQueueSize = queueSize;
+        }
+        else
+        {
+            error = ARCONTROLLER_ERROR_NO_VIDEO;
+        }
+    }
+
+    if (locked)
+    {
+        ARSAL_Mutex_Unlock (&(deviceController->privatePart->mutex));
+        locked = 0;
+    }
+
+    return error;
+}
+
+eARCONTROLLER_ERROR ARCONTROLLER_Device_GetVideoStreamDecodeStats (ARCONTROLLER_Device_t *deviceController, ARCONTROLLER_Stream_DecodeStats_t *stats)
+{
+    // -- Get the statistics of the decode stage of the video stream. --
+
+    eARCONTROLLER_ERROR error = ARCONTROLLER_OK;
+
+    // Check parameters
+    if ((deviceController == NULL) ||
+        (deviceController->privatePart == NULL) ||
+        (stats == NULL))
+    {
+        error = ARCONTROLLER_ERROR_BAD_PARAMETER;
+    }
+    // No Else: the checking parameters sets localError to ARCONTROLLER_ERROR_BAD_PARAMETER and stop the processing
+
+    if (error == ARCONTROLLER_OK)
+    {
+        error = ARCONTROLLER_Network_GetVideoStreamDecodeStats (deviceController->privatePart->networkController, stats);
+    }
+
+    return error;
+}
+
+eARCONTROLLER_ERROR ARCONTROLLER_Device_SetDirectCommandDispatch (ARCONTROLLER_Device_t *deviceController, int directDispatch)
+{
+    // -- Decode the commands received in the network receiver thread. --
+
+    eARCONTROLLER_ERROR error = ARCONTROLLER_OK;
+    int locked = 0;
+
+    // Check parameters
+    if ((deviceController == NULL) ||
+        (deviceController->privatePart == NULL))
+    {
+        error = ARCONTROLLER_ERROR_BAD_PARAMETER;
+    }
+    // No Else: the checking parameters sets localError to ARCONTROLLER_ERROR_BAD_PARAMETER and stop the processing
+
+    if (error == ARCONTROLLER_OK)
+    {
+        ARSAL_Mutex_Lock(&(deviceController->privatePart->mutex));
+        locked = 1;
+    }
+
+    if (error == ARCONTROLLER_OK)
+    {
+        deviceController->privatePart->directCommandDispatch = directDispatch;
+    }
+
+    if (locked)
+    {
+        ARSAL_Mutex_Unlock (&(deviceController->privatePart->mutex));
+        locked = 0;
+    }
+
+    return error;
+}
+
+eARCONTROLLER_ERROR ARCONTROLLER_Device_SetWarmStartCache (ARCONTROLLER_Device_t *deviceController, const char *cachePath)
+{
+    // -- Enable the warm start from a cache of the last connection. --
+
+    eARCONTROLLER_ERROR error = ARCONTROLLER_OK;
+    ARCONTROLLER_WarmStart_t *warmStart = NULL;
+    int locked = 0;
+
+    // Check parameters
+    if ((deviceController == NULL) ||
+        (deviceController->privatePart == NULL) ||
+        (cachePath == NULL))
+    {
+        error = ARCONTROLLER_ERROR_BAD_PARAMETER;
+    }
+    // No Else: the checking parameters sets localError to ARCONTROLLER_ERROR_BAD_PARAMETER and stop the processing
+
+    if (error == ARCONTROLLER_OK)
+    {
+        warmStart = ARCONTROLLER_WarmStart_New (cachePath, &error);
+    }
+
+    if (error == ARCONTROLLER_OK)
+    {
+        ARSAL_Mutex_Lock(&(deviceController->privatePart->mutex));
+        locked = 1;
+    }
+
+    if (error == ARCONTROLLER_OK)
+    {
+        // The restored arguments of the current cache are still referenced by the features
+        if ((deviceController->privatePart->state == ARCONTROLLER_DEVICE_STATE_STOPPED) &&
+            (deviceController->privatePart->warmStart == NULL))
+        {
+            deviceController->privatePart->warmStart = warmStart;
+            warmStart = NULL;
+        }
+        else
+        {
+            error = ARCONTROLLER_ERROR_STATE;
+        }
+    }
+
+    if (locked)
+    {
+        ARSAL_Mutex_Unlock (&(deviceController->privatePart->mutex));
+        locked = 0;
+    }
+
+    ARCONTROLLER_WarmStart_Delete (&warmStart);
+
+    return error;
+}
+
 eARCONTROLLER_ERROR ARCONTROLLER_Device_SetAudioStreamCallbacks (ARCONTROLLER_Device_t *deviceController, ARCONTROLLER_Stream_DecoderConfigCallback_t decoderConfigCallback, ARCONTROLLER_Stream_DidReceiveFrameCallback_t receiveFrameCallback, ARCONTROLLER_Stream_TimeoutFrameCallback_t timeoutFrameCallback, void *customData)
 {
     // -- Set audio stream callbacks --
@@ -4214,6 +4411,7 @@ eARCONTROLLER_ERROR ARCONTROLLER_Device_AddCommandReceivedCallback (ARCONTROLLER
     if (error == ARCONTROLLER_OK)
     {
         error = ARCONTROLLER_Dictionary_AddCallbackInList (&(deviceController->privatePart->commandCallbacks), commandReceivedCallback, customData);
+        ARCONTROLLER_Device_UpdateSubscribedKeys (deviceController);
     }
     
     if (locked)
@@ -4249,6 +4447,149 @@ eARCONTROLLER_ERROR ARCONTROLLER_Device_RemoveCommandReceivedCallback (ARCONTROL
     if (error == ARCONTROLLER_OK)
     {
         error = ARCONTROLLER_Dictionary_RemoveCallbackFromList (&(deviceController->privatePart->commandCallbacks), commandReceivedCallback, customData);
+        ARCONTROLLER_Device_UpdateSubscribedKeys (deviceController);
+    }
+    
+    if (locked)
+    {
+        ARSAL_Mutex_Unlock (&(deviceController->privatePart->mutex));
+        locked = 0;
+    }
+    
+    return error;
+}
+
+eARCONTROLLER_ERROR ARCONTROLLER_Device_AddCommandReceivedCallbackForKeys (ARCONTROLLER_Device_t *deviceController, ARCONTROLLER_DICTIONARY_CALLBACK_t commandReceivedCallback, void *customData, const eARCONTROLLER_DICTIONARY_KEY *commandKeys, int commandKeysCount)
+{
+    // -- Add Command received callback for a set of commands --
+    
+    eARCONTROLLER_ERROR error = ARCONTROLLER_OK;
+    int locked = 0;
+    int keyIndex = 0;
+    
+    // Check parameters
+    if ((deviceController == NULL) ||
+        (deviceController->privatePart == NULL) ||
+        (commandReceivedCallback == NULL) ||
+        (commandKeys == NULL) ||
+        (commandKeysCount < 0))
+    {
+        error = ARCONTROLLER_ERROR_BAD_PARAMETER;
+    }
+    // No Else: the checking parameters sets localError to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
+    
+    for (keyIndex = 0; (error == ARCONTROLLER_OK) && (keyIndex < commandKeysCount); keyIndex++)
+    {
+        if ((commandKeys[keyIndex] < 0) || (commandKeys[keyIndex] >= ARCONTROLLER_DICTIONARY_DICTIONARY_KEY_MAX))
+        {
+            error = ARCONTROLLER_ERROR_BAD_PARAMETER;
+        }
+    }
+    
+    if (error == ARCONTROLLER_OK)
+    {
+        ARSAL_Mutex_Lock(&(deviceController->privatePart->mutex));
+        locked = 1;
+    }
+    
+    for (keyIndex = 0; (error == ARCONTROLLER_OK) && (keyIndex < commandKeysCount); keyIndex++)
+    {
+        error = ARCONTROLLER_Dictionary_AddCallbackInList (&(deviceController->privatePart->keyCommandCallbacks[commandKeys[keyIndex]]), commandReceivedCallback, customData);
+    }
+    
+    if (locked)
+    {
+        ARCONTROLLER_Device_UpdateSubscribedKeys (deviceController);
+        ARSAL_Mutex_Unlock (&(deviceController->privatePart->mutex));
+        locked = 0;
+    }
+    
+    return error;
+}
+
+eARCONTROLLER_ERROR ARCONTROLLER_Device_RemoveCommandReceivedCallbackForKeys (ARCONTROLLER_Device_t *deviceController, ARCONTROLLER_DICTIONARY_CALLBACK_t commandReceivedCallback, void *customData, const eARCONTROLLER_DICTIONARY_KEY *commandKeys, int commandKeysCount)
+{
+    // -- Remove Command received callback for a set of commands --
+    
+    eARCONTROLLER_ERROR error = ARCONTROLLER_OK;
+    eARCONTROLLER_ERROR removeError = ARCONTROLLER_OK;
+    int locked = 0;
+    int keyIndex = 0;
+    
+    // Check parameters
+    if ((deviceController == NULL) ||
+        (deviceController->privatePart == NULL) ||
+        (commandKeys == NULL) ||
+        (commandKeysCount < 0))
+    {
+        error = ARCONTROLLER_ERROR_BAD_PARAMETER;
+    }
+    // No Else: the checking parameters sets localError to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
+    
+    if (error == ARCONTROLLER_OK)
+    {
+        ARSAL_Mutex_Lock(&(deviceController->privatePart->mutex));
+        locked = 1;
+    }
+    
+    for (keyIndex = 0; (error == ARCONTROLLER_OK) && (keyIndex < commandKeysCount); keyIndex++)
+    {
+        // Remove from every command, even if one of them was not registered
+        if ((commandKeys[keyIndex] >= 0) && (commandKeys[keyIndex] < ARCONTROLLER_DICTIONARY_DICTIONARY_KEY_MAX))
+        {
+            removeError = ARCONTROLLER_Dictionary_RemoveCallbackFromList (&(deviceController->privatePart->keyCommandCallbacks[commandKeys[keyIndex]]), commandReceivedCallback, customData);
+        }
+        else
+        {
+            removeError = ARCONTROLLER_ERROR_BAD_PARAMETER;
+        }
+    }
+    
+    if (locked)
+    {
+        ARCONTROLLER_Device_UpdateSubscribedKeys (deviceController);
+        ARSAL_Mutex_Unlock (&(deviceController->privatePart->mutex));
+        locked = 0;
+    }
+    
+    if (error == ARCONTROLLER_OK)
+    {
+        error = removeError;
+    }
+    
+    return error;
+}
+
+eARCONTROLLER_ERROR ARCONTROLLER_Device_SetSubscribedCommandsOnly (ARCONTROLLER_Device_t *deviceController, int subscribedOnly)
+{
+    // -- Build only the commands having a callback --
+    
+    eARCONTROLLER_ERROR error = ARCONTROLLER_OK;
+    int locked = 0;
+    
+    // Check parameters
+    if ((deviceController == NULL) ||
+        (deviceController->privatePart == NULL))
+    {
+        error = ARCONTROLLER_ERROR_BAD_PARAMETER;
+    }
+    // No Else: the checking parameters sets localError to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
+    
+    if (error == ARCONTROLLER_OK)
+    {
+        ARSAL_Mutex_Lock(&(deviceController->privatePart->mutex));
+        locked = 1;
+    }
+    
+    if ((error == ARCONTROLLER_OK) && (deviceController->privatePart->state != ARCONTROLLER_DEVICE_STATE_STOPPED))
+    {
+        error = ARCONTROLLER_ERROR_STATE;
+    }
+    
+    if (error == ARCONTROLLER_OK)
+    {
+        deviceController->privatePart->subscribedCommandsOnly = (subscribedOnly != 0);
+        error = ARCONTROLLER_Device_SetSubscribedKeysToFeatures (deviceController, (subscribedOnly) ? deviceController->privatePart->subscribedKeys : NULL);
     }
     
     if (locked)
@@ -4771,6 +5112,7 @@ void *ARCONTROLLER_Device_StartRun (void *data)
     // Local declarations
     ARCONTROLLER_Device_t *deviceController = (ARCONTROLLER_Device_t *) data;
     eARCONTROLLER_ERROR error = ARCONTROLLER_OK;
+    int warmStarted = 0;
     
     // Check parameters
     if ((deviceController == NULL) || (deviceController->privatePart == NULL))
@@ -4794,7 +5136,32 @@ void *ARCONTROLLER_Device_StartRun (void *data)
         error = ARCONTROLLER_Device_RegisterCallbacks (deviceController, NULL);
     }
     
-    if ((error == ARCONTROLLER_OK) && (!deviceController->privatePart->startCancelled))
+    if ((error == ARCONTROLLER_OK) && (!deviceController->privatePart->startCancelled) && (deviceController->privatePart->warmStart != NULL))
+    {
+        // Notify the cached settings and states instead of waiting for them ; a cached video enable starts the stream now
+        ARSAL_Mutex_Lock (&(deviceController->privatePart->mutex));
+        deviceController->privatePart->warmStartReconciled = 0;
+        ARSAL_Mutex_Unlock (&(deviceController->privatePart->mutex));
+        warmStarted = (ARCONTROLLER_WarmStart_Restore (deviceController->privatePart->warmStart, &(deviceController->privatePart->warmStartLink), deviceController->common, deviceController->aRDrone3) == ARCONTROLLER_OK);
+    }
+    
+    if ((error == ARCONTROLLER_OK) && (!deviceController->privatePart->startCancelled) && (warmStarted))
+    {
+        // The decoder can be configured before the first parameter sets of the stream
+        if ((deviceController->privatePart->hasVideo) && (deviceController->privatePart->videoDecoderConfigCallback != NULL))
+        {
+            ARCONTROLLER_WarmStart_ConfigureDecoder (deviceController->privatePart->warmStart, deviceController->privatePart->videoDecoderConfigCallback, deviceController->privatePart->videoReceiveCustomData);
+        }
+        
+        // The initial settings and states are received in background to refresh the cached ones
+        if (ARSAL_Thread_Create (&(deviceController->privatePart->reconcileThread), ARCONTROLLER_Device_ReconcileRun, deviceController) != 0)
+        {
+            ARSAL_PRINT(ARSAL_PRINT_ERROR, ARCONTROLLER_DEVICE_TAG, "Creation of reconcile thread failed.");
+            deviceController->privatePart->reconcileThread = NULL;
+            error = ARCONTROLLER_ERROR_INIT_THREAD;
+        }
+    }
+    else if ((error == ARCONTROLLER_OK) && (!deviceController->privatePart->startCancelled))
     {
         error = ARCONTROLLER_Device_OnStart (deviceController, 0);
     }
@@ -4802,6 +5169,14 @@ void *ARCONTROLLER_Device_StartRun (void *data)
     if ((error == ARCONTROLLER_OK) && (!deviceController->privatePart->startCancelled))
     {
         ARCONTROLLER_Device_SetState (deviceController, ARCONTROLLER_DEVICE_STATE_RUNNING, ARCONTROLLER_OK);
+        
+        if ((!warmStarted) && (deviceController->privatePart->warmStart != NULL))
+        {
+            ARSAL_Mutex_Lock (&(deviceController->privatePart->mutex));
+            deviceController->privatePart->warmStartReconciled = 1;
+            ARSAL_Mutex_Unlock (&(deviceController->privatePart->mutex));
+            ARCONTROLLER_WarmStart_Save (deviceController->privatePart->warmStart, &(deviceController->privatePart->warmStartLink), deviceController->common, deviceController->aRDrone3);
+        }
     }
     else
     {
@@ -4832,6 +5207,7 @@ void *ARCONTROLLER_Device_StopRun (void *data)
     // Local declarations
     ARCONTROLLER_Device_t *deviceController = (ARCONTROLLER_Device_t *) data;
     eARCONTROLLER_ERROR error = ARCONTROLLER_OK;
+    int warmStartReconciled = 0;
     
     // Check parameters
     if ((deviceController == NULL) || (deviceController->privatePart == NULL))
@@ -4840,6 +5216,36 @@ void *ARCONTROLLER_Device_StopRun (void *data)
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if (deviceController->privatePart->reconcileThread != NULL)
+    {
+        // Cancel the initial settings and states still awaited after a warm start
+        ARSAL_Mutex_Lock (&(deviceController->privatePart->mutex));
+        deviceController->privatePart->startCancelled = 1;
+        ARSAL_Sem_Post (&(deviceController->privatePart->initSem));
+        ARSAL_Sem_Post (&(deviceController->privatePart->initSem));
+        ARSAL_Mutex_Unlock (&(deviceController->privatePart->mutex));
+        
+        ARSAL_Thread_Join (deviceController->privatePart->reconcileThread, NULL);
+        ARSAL_Thread_Destroy (&(deviceController->privatePart->reconcileThread));
+        deviceController->privatePart->reconcileThread = NULL;
+        
+        // Consume the posts not awaited, so that the next start waits again
+        while (ARSAL_Sem_Trywait (&(deviceController->privatePart->initSem)) == 0);
+        deviceController->privatePart->startCancelled = 0;
+    }
+    
+    // Taken under the mutex ; the start thread may still be setting it
+    ARSAL_Mutex_Lock (&(deviceController->privatePart->mutex));
+    warmStartReconciled = deviceController->privatePart->warmStartReconciled;
+    deviceController->privatePart->warmStartReconciled = 0;
+    ARSAL_Mutex_Unlock (&(deviceController->privatePart->mutex));
+    
+    if (warmStartReconciled)
+    {
+        // Saved again to keep the video parameter sets received since the start
+        ARCONTROLLER_WarmStart_Save (deviceController->privatePart->warmStart, &(deviceController->privatePart->warmStartLink), deviceController->common, deviceController->aRDrone3);
+    }
+    
     error = ARCONTROLLER_Device_UnregisterCallbacks (deviceController, NULL);
     if (error != ARCONTROLLER_OK)
     {
@@ -5230,7 +5636,12 @@ eARCONTROLLER_ERROR ARCONTROLLER_Device_StartNetwork (ARCONTROLLER_Device_t *dev
     if (error == ARCONTROLLER_OK)
     {
         // If device has video
-        if (deviceController->privatePart->hasVideo)
+        if ((deviceController->privatePart->hasVideo) && (deviceController->privatePart->warmStart != NULL))
+        {
+            // The stream calls back the device controller to keep the parameter sets in the warm start cache
+            error = ARCONTROLLER_Network_SetVideoReceiveCallback (deviceController->privatePart->networkController, ARCONTROLLER_Device_WarmStartDecoderConfigCallback, ARCONTROLLER_Device_WarmStartReceiveFrameCallback, ARCONTROLLER_Device_WarmStartTimeoutFrameCallback, deviceController);
+        }
+        else if (deviceController->privatePart->hasVideo)
         {
             error = ARCONTROLLER_Network_SetVideoReceiveCallback (deviceController->privatePart->networkController, deviceController->privatePart->videoDecoderConfigCallback, deviceController->privatePart->videoReceiveCallback, deviceController->privatePart->videoTimeoutCallback, deviceController->privatePart->videoReceiveCustomData);
         }
@@ -5242,6 +5653,18 @@ eARCONTROLLER_ERROR ARCONTROLLER_Device_StartNetwork (ARCONTROLLER_Device_t *dev
         error = ARCONTROLLER_Network_SetVideoStreamMP4Compliant (deviceController->privatePart->networkController, deviceController->privatePart->videoIsMP4Compliant);
     }
     // No else: skipped by an error
+    
+    if ((error == ARCONTROLLER_OK) && (deviceController->privatePart->hasVideo))
+    {
+        error = ARCONTROLLER_Network_SetVideoStreamDecodeStage (deviceController->privatePart->networkController, deviceController->privatePart->videoDecodePolicy, deviceController->privatePart->videoDecodeQueueSize);
+    }
+    // No else: skipped by an error
+
+    if ((error == ARCONTROLLER_OK) && (deviceController->privatePart->directCommandDispatch))
+    {
+        error = ARCONTROLLER_Network_SetDirectCommandDispatch (deviceController->privatePart->networkController, 1);
+    }
+    // No else: skipped by an error or commands read by the reader threads
 
     if (error == ARCONTROLLER_OK)
     {
@@ -5586,6 +6009,173 @@ eARCONTROLLER_ERROR ARCONTROLLER_Device_SetNetworkControllerToFeatures (ARCONTRO
     return error;
 }
 
+eARCONTROLLER_ERROR ARCONTROLLER_Device_SetSubscribedKeysToFeatures (ARCONTROLLER_Device_t *deviceController, const uint8_t *subscribedKeys)
+{
+    // -- Set the subscribed commands to the Features --
+    
+    eARCONTROLLER_ERROR error = ARCONTROLLER_OK;
+    
+    // Check parameters
+    if ((deviceController == NULL) || (deviceController->privatePart == NULL))
+    {
+        error = ARCONTROLLER_ERROR_BAD_PARAMETER;
+    }
+    // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
+    
+    if ((error == ARCONTROLLER_OK) && (deviceController->generic != NULL))
+    {
+        error = ARCONTROLLER_FEATURE_Generic_SetSubscribedKeys (deviceController->generic, subscribedKeys);
+        if (error != ARCONTROLLER_OK)
+        {
+            ARSAL_PRINT(ARSAL_PRINT_ERROR, ARCONTROLLER_DEVICE_TAG, "Error occured durring setting the subscribed commands to the feature ARCONTROLLER_DICTIONARY_KEY_GENERIC; error :%s", ARCONTROLLER_Error_ToString (error));
+        }
+        
+    }
+    
+    if ((error == ARCONTROLLER_OK) && (deviceController->aRDrone3 != NULL))
+    {
+        error = ARCONTROLLER_FEATURE_ARDrone3_SetSubscribedKeys (deviceController->aRDrone3, subscribedKeys);
+        if (error != ARCONTROLLER_OK)
+        {
+            ARSAL_PRINT(ARSAL_PRINT_ERROR, ARCONTROLLER_DEVICE_TAG, "Error occured durring setting the subscribed commands to the feature ARCONTROLLER_DICTIONARY_KEY_ARDRONE3; error :%s", ARCONTROLLER_Error_ToString (error));
+        }
+        
+    }
+    
+    if ((error == ARCONTROLLER_OK) && (deviceController->common != NULL))
+    {
+        error = ARCONTROLLER_FEATURE_Common_SetSubscribedKeys (deviceController->common, subscribedKeys);
+        if (error != ARCONTROLLER_OK)
+        {
+            ARSAL_PRINT(ARSAL_PRINT_ERROR, ARCONTROLLER_DEVICE_TAG, "Error occured durring setting the subscribed commands to the feature ARCONTROLLER_DICTIONARY_KEY_COMMON; error :%s", ARCONTROLLER_Error_ToString (error));
+        }
+        
+    }
+    
+    if ((error == ARCONTROLLER_OK) && (deviceController->controller_info != NULL))
+    {
+        error = ARCONTROLLER_FEATURE_ControllerInfo_SetSubscribedKeys (deviceController->controller_info, subscribedKeys);
+        if (error != ARCONTROLLER_OK)
+        {
+            ARSAL_PRINT(ARSAL_PRINT_ERROR, ARCONTROLLER_DEVICE_TAG, "Error occured durring setting the subscribed commands to the feature ARCONTROLLER_DICTIONARY_KEY_CONTROLLER_INFO; error :%s", ARCONTROLLER_Error_ToString (error));
+        }
+        
+    }
+    
+    if ((error == ARCONTROLLER_OK) && (deviceController->debug != NULL))
+    {
+        error = ARCONTROLLER_FEATURE_Debug_SetSubscribedKeys (deviceController->debug, subscribedKeys);
+        if (error != ARCONTROLLER_OK)
+        {
+            ARSAL_PRINT(ARSAL_PRINT_ERROR, ARCONTROLLER_DEVICE_TAG, "Error occured durring setting the subscribed commands to the feature ARCONTROLLER_DICTIONARY_KEY_DEBUG; error :%s", ARCONTROLLER_Error_ToString (error));
+        }
+        
+    }
+    
+    if ((error == ARCONTROLLER_OK) && (deviceController->drone_manager != NULL))
+    {
+        error = ARCONTROLLER_FEATURE_DroneManager_SetSubscribedKeys (deviceController->drone_manager, subscribedKeys);
+        if (error != ARCONTROLLER_OK)
+        {
+            ARSAL_PRINT(ARSAL_PRINT_ERROR, ARCONTROLLER_DEVICE_TAG, "Error occured durring setting the subscribed commands to the feature ARCONTROLLER_DICTIONARY_KEY_DRONE_MANAGER; error :%s", ARCONTROLLER_Error_ToString (error));
+        }
+        
+    }
+    
+    if ((error == ARCONTROLLER_OK) && (deviceController->jumpingSumo != NULL))
+    {
+        error = ARCONTROLLER_FEATURE_JumpingSumo_SetSubscribedKeys (deviceController->jumpingSumo, subscribedKeys);
+        if (error != ARCONTROLLER_OK)
+        {
+            ARSAL_PRINT(ARSAL_PRINT_ERROR, ARCONTROLLER_DEVICE_TAG, "Error occured durring setting the subscribed commands to the feature ARCONTROLLER_DICTIONARY_KEY_JUMPINGSUMO; error :%s", ARCONTROLLER_Error_ToString (error));
+        }
+        
+    }
+    
+    if ((error == ARCONTROLLER_OK) && (deviceController->mapper != NULL))
+    {
+        error = ARCONTROLLER_FEATURE_Mapper_SetSubscribedKeys (deviceController->mapper, subscribedKeys);
+        if (error != ARCONTROLLER_OK)
+        {
+            ARSAL_PRINT(ARSAL_PRINT_ERROR, ARCONTROLLER_DEVICE_TAG, "Error occured durring setting the subscribed commands to the feature ARCONTROLLER_DICTIONARY_KEY_MAPPER; error :%s", ARCONTROLLER_Error_ToString (error));
+        }
+        
+    }
+    
+    if ((error == ARCONTROLLER_OK) && (deviceController->miniDrone != NULL))
+    {
+        error = ARCONTROLLER_FEATURE_MiniDrone_SetSubscribedKeys (deviceController->miniDrone, subscribedKeys);
+        if (error != ARCONTROLLER_OK)
+        {
+            ARSAL_PRINT(ARSAL_PRINT_ERROR, ARCONTROLLER_DEVICE_TAG, "Error occured durring setting the subscribed commands to the feature ARCONTROLLER_DICTIONARY_KEY_MINIDRONE; error :%s", ARCONTROLLER_Error_ToString (error));
+        }
+        
+    }
+    
+    if ((error == ARCONTROLLER_OK) && (deviceController->powerup != NULL))
+    {
+        error = ARCONTROLLER_FEATURE_Powerup_SetSubscribedKeys (deviceController->powerup, subscribedKeys);
+        if (error != ARCONTROLLER_OK)
+        {
+            ARSAL_PRINT(ARSAL_PRINT_ERROR, ARCONTROLLER_DEVICE_TAG, "Error occured durring setting the subscribed commands to the feature ARCONTROLLER_DICTIONARY_KEY_POWERUP; error :%s", ARCONTROLLER_Error_ToString (error));
+        }
+        
+    }
+    
+    if ((error == ARCONTROLLER_OK) && (deviceController->pro != NULL))
+    {
+        error = ARCONTROLLER_FEATURE_Pro_SetSubscribedKeys (deviceController->pro, subscribedKeys);
+        if (error != ARCONTROLLER_OK)
+        {
+            ARSAL_PRINT(ARSAL_PRINT_ERROR, ARCONTROLLER_DEVICE_TAG, "Error occured durring setting the subscribed commands to the feature ARCONTROLLER_DICTIONARY_KEY_PRO; error :%s", ARCONTROLLER_Error_ToString (error));
+        }
+        
+    }
+    
+    if ((error == ARCONTROLLER_OK) && (deviceController->rc != NULL))
+    {
+        error = ARCONTROLLER_FEATURE_Rc_SetSubscribedKeys (deviceController->rc, subscribedKeys);
+        if (error != ARCONTROLLER_OK)
+        {
+            ARSAL_PRINT(ARSAL_PRINT_ERROR, ARCONTROLLER_DEVICE_TAG, "Error occured durring setting the subscribed commands to the feature ARCONTROLLER_DICTIONARY_KEY_RC; error :%s", ARCONTROLLER_Error_ToString (error));
+        }
+        
+    }
+    
+    if ((error == ARCONTROLLER_OK) && (deviceController->skyController != NULL))
+    {
+        error = ARCONTROLLER_FEATURE_SkyController_SetSubscribedKeys (deviceController->skyController, subscribedKeys);
+        if (error != ARCONTROLLER_OK)
+        {
+            ARSAL_PRINT(ARSAL_PRINT_ERROR, ARCONTROLLER_DEVICE_TAG, "Error occured durring setting the subscribed commands to the feature ARCONTROLLER_DICTIONARY_KEY_SKYCONTROLLER; error :%s", ARCONTROLLER_Error_ToString (error));
+        }
+        
+    }
+    
+    if ((error == ARCONTROLLER_OK) && (deviceController->unknown_feature_1 != NULL))
+    {
+        error = ARCONTROLLER_FEATURE_UnknownFeature1_SetSubscribedKeys (deviceController->unknown_feature_1, subscribedKeys);
+        if (error != ARCONTROLLER_OK)
+        {
+            ARSAL_PRINT(ARSAL_PRINT_ERROR, ARCONTROLLER_DEVICE_TAG, "Error occured durring setting the subscribed commands to the feature ARCONTROLLER_DICTIONARY_KEY_UNKNOWN_FEATURE_1; error :%s", ARCONTROLLER_Error_ToString (error));
+        }
+        
+    }
+    
+    if ((error == ARCONTROLLER_OK) && (deviceController->wifi != NULL))
+    {
+        error = ARCONTROLLER_FEATURE_Wifi_SetSubscribedKeys (deviceController->wifi, subscribedKeys);
+        if (error != ARCONTROLLER_OK)
+        {
+            ARSAL_PRINT(ARSAL_PRINT_ERROR, ARCONTROLLER_DEVICE_TAG, "Error occured durring setting the subscribed commands to the feature ARCONTROLLER_DICTIONARY_KEY_WIFI; error :%s", ARCONTROLLER_Error_ToString (error));
+        }
+        
+    }
+    
+    
+    return error;
+}
+
 eARCONTROLLER_ERROR ARCONTROLLER_Device_StartControllerLooperThread (ARCONTROLLER_Device_t *deviceController)
 {
     // -- Create the Sending Looper Thread --
@@ -5832,6 +6422,12 @@ void ARCONTROLLER_Device_DictionaryChangedCallback (eARCONTROLLER_DICTIONARY_KEY
     {
         // Notify All Callback
         ARCONTROLLER_DICTIONARY_NotifyAllCallbackInList (&(deviceController->privatePart->commandCallbacks), commandKey, elementDictionary);
+        
+        // Notify the callbacks subscribed to this command
+        if ((commandKey >= 0) && (commandKey < ARCONTROLLER_DICTIONARY_DICTIONARY_KEY_MAX))
+        {
+            ARCONTROLLER_DICTIONARY_NotifyAllCallbackInList (&(deviceController->privatePart->keyCommandCallbacks[commandKey]), commandKey, elementDictionary);
+        }
     }
     
     if (error == ARCONTROLLER_OK)
@@ -5879,6 +6475,30 @@ void ARCONTROLLER_Device_DictionaryChangedCallback (eARCONTROLLER_DICTIONARY_KEY
     
 }
 
+void ARCONTROLLER_Device_UpdateSubscribedKeys (ARCONTROLLER_Device_t *deviceController)
+{
+    // -- Update the table of the subscribed commands --
+    
+    int keyIndex = 0;
+    
+    for (keyIndex = 0; keyIndex < ARCONTROLLER_DICTIONARY_DICTIONARY_KEY_MAX; keyIndex++)
+    {
+        // A callback for all the commands subscribes to each of them
+        deviceController->privatePart->subscribedKeys[keyIndex] = ((deviceController->privatePart->commandCallbacks != NULL) || (deviceController->privatePart->keyCommandCallbacks[keyIndex] != NULL));
+    }
+    
+    // Commands used by ARCONTROLLER_Device_DictionaryChangedCallback()
+    deviceController->privatePart->subscribedKeys[ARCONTROLLER_DICTIONARY_KEY_COMMON_COMMONSTATE_ALLSTATESCHANGED] = 1;
+    deviceController->privatePart->subscribedKeys[ARCONTROLLER_DICTIONARY_KEY_SKYCONTROLLER_COMMONSTATE_ALLSTATESCHANGED] = 1;
+    deviceController->privatePart->subscribedKeys[ARCONTROLLER_DICTIONARY_KEY_COMMON_SETTINGSSTATE_ALLSETTINGSCHANGED] = 1;
+    deviceController->privatePart->subscribedKeys[ARCONTROLLER_DICTIONARY_KEY_SKYCONTROLLER_SETTINGSSTATE_ALLSETTINGSCHANGED] = 1;
+    deviceController->privatePart->subscribedKeys[ARCONTROLLER_DICTIONARY_KEY_SKYCONTROLLER_DEVICESTATE_CONNEXIONCHANGED] = 1;
+    deviceController->privatePart->subscribedKeys[ARCONTROLLER_DICTIONARY_KEY_ARDRONE3_MEDIASTREAMINGSTATE_VIDEOENABLECHANGED] = 1;
+    deviceController->privatePart->subscribedKeys[ARCONTROLLER_DICTIONARY_KEY_JUMPINGSUMO_MEDIASTREAMINGSTATE_VIDEOENABLECHANGED] = 1;
+    deviceController->privatePart->subscribedKeys[ARCONTROLLER_DICTIONARY_KEY_POWERUP_MEDIASTREAMINGSTATE_VIDEOENABLECHANGED] = 1;
+    deviceController->privatePart->subscribedKeys[ARCONTROLLER_DICTIONARY_KEY_COMMON_AUDIOSTATE_AUDIOSTREAMINGRUNNING] = 1;
+}
+
 void ARCONTROLLER_Device_OnAllStatesEnd (ARCONTROLLER_Device_t *deviceController)
 {
     // -- End of receiving of initial all States --
@@ -6067,6 +6687,82 @@ void ARCONTROLLER_Device_OnSkyControllerConnectionChangedReceived (ARCONTROLLER_
         ARSAL_PRINT(ARSAL_PRINT_ERROR, ARCONTROLLER_DEVICE_TAG, "Error ARController_Device_OnSkyControllerConnectionChangedReceived : %s", ARCONTROLLER_Error_ToString (error));
     }
 }
+void *ARCONTROLLER_Device_ReconcileRun (void *data)
+{
+    // -- Thread Run of the reconciliation after a warm start --
+    
+    // Local declarations
+    ARCONTROLLER_Device_t *deviceController = (ARCONTROLLER_Device_t *) data;
+    eARCONTROLLER_ERROR error = ARCONTROLLER_OK;
+    
+    // Check parameters
+    if ((deviceController == NULL) || (deviceController->privatePart == NULL))
+    {
+        return NULL;
+    }
+    // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
+    
+    error = ARCONTROLLER_Device_OnStart (deviceController, 0);
+    
+    if ((error == ARCONTROLLER_OK) && (!deviceController->privatePart->startCancelled))
+    {
+        ARSAL_Mutex_Lock (&(deviceController->privatePart->mutex));
+        deviceController->privatePart->warmStartReconciled = 1;
+        ARSAL_Mutex_Unlock (&(deviceController->privatePart->mutex));
+        ARCONTROLLER_WarmStart_Save (deviceController->privatePart->warmStart, &(deviceController->privatePart->warmStartLink), deviceController->common, deviceController->aRDrone3);
+    }
+    else if (!deviceController->privatePart->startCancelled)
+    {
+        ARSAL_PRINT(ARSAL_PRINT_ERROR, ARCONTROLLER_DEVICE_TAG, "Reconcile fail error :%s", ARCONTROLLER_Error_ToString (error));
+    }
+    
+    return NULL;
+}
+
+eARCONTROLLER_ERROR ARCONTROLLER_Device_WarmStartDecoderConfigCallback (ARCONTROLLER_Stream_Codec_t codec, void *customData)
+{
+    // -- Keep the parameter sets and configure the video decoder --
+    
+    ARCONTROLLER_Device_t *deviceController = (ARCONTROLLER_Device_t *) customData;
+    eARCONTROLLER_ERROR error = ARCONTROLLER_OK;
+    
+    ARCONTROLLER_WarmStart_SetVideoCodec (deviceController->privatePart->warmStart, &codec);
+    
+    if (deviceController->privatePart->videoDecoderConfigCallback != NULL)
+    {
+        error = deviceController->privatePart->videoDecoderConfigCallback (codec, deviceController->privatePart->videoReceiveCustomData);
+    }
+    
+    return error;
+}
+
+eARCONTROLLER_ERROR ARCONTROLLER_Device_WarmStartReceiveFrameCallback (ARCONTROLLER_Frame_t *frame, void *customData)
+{
+    // -- Forward the frame to the video callback --
+    
+    ARCONTROLLER_Device_t *deviceController = (ARCONTROLLER_Device_t *) customData;
+    eARCONTROLLER_ERROR error = ARCONTROLLER_OK;
+    
+    if (deviceController->privatePart->videoReceiveCallback != NULL)
+    {
+        error = deviceController->privatePart->videoReceiveCallback (frame, deviceController->privatePart->videoReceiveCustomData);
+    }
+    
+    return error;
+}
+
+void ARCONTROLLER_Device_WarmStartTimeoutFrameCallback (void *customData)
+{
+    // -- Forward the timeout to the video callback --
+    
+    ARCONTROLLER_Device_t *deviceController = (ARCONTROLLER_Device_t *) customData;
+    
+    if (deviceController->privatePart->videoTimeoutCallback != NULL)
+    {
+        deviceController->privatePart->videoTimeoutCallback (deviceController->privatePart->videoReceiveCustomData);
+    }
+}
+
 void *ARCONTROLLER_Device_ExtensionStartRun (void *data)
 {
     // -- Start the Thread of the Extension --
@@ -6583,6 +7279,8 @@ eARDISCOVERY_ERROR ARCONTROLLER_Device_ReceiveJsonCallback (json_object *jsonObj
     // Local declarations
     ARCONTROLLER_Device_t *deviceController = customData;
     eARDISCOVERY_ERROR error = ARDISCOVERY_OK;
+    json_object *valueJsonObj = NULL;
+    ARCONTROLLER_WARMSTART_LINK_t *link = NULL;
     
     if ((jsonObj == NULL) ||
         (deviceController == NULL) ||
@@ -6593,6 +7291,24 @@ eARDISCOVERY_ERROR ARCONTROLLER_Device_ReceiveJsonCallback (json_object *jsonObj
     
     if (error == ARDISCOVERY_OK)
     {
+        // Keep the negotiated link ; a warm start cache is only used for the same link
+        link = &(deviceController->privatePart->warmStartLink);
+        link->productID = deviceController->privatePart->discoveryDevice->productID;
+        
+        // Another device may be reached on the same ports
+        if (ARDISCOVERY_DEVICE_WifiGetIpAddress (deviceController->privatePart->discoveryDevice, link->address, ARCONTROLLER_WARMSTART_ADDRESS_SIZE) != ARDISCOVERY_OK)
+        {
+            link->address[0] = '\0';
+        }
+        
+        valueJsonObj = json_object_object_get (jsonObj, ARDISCOVERY_CONNECTION_JSON_C2DPORT_KEY);
+        link->c2dPort = (valueJsonObj != NULL) ? json_object_get_int (valueJsonObj) : 0;
+        
+        valueJsonObj = json_object_object_get (jsonObj, ARDISCOVERY_CONNECTION_JSON_ARSTREAM2_SERVER_STREAM_PORT_KEY);
+        link->serverStreamPort = (valueJsonObj != NULL) ? json_object_get_int (valueJsonObj) : 0;
+        
+        valueJsonObj = json_object_object_get (jsonObj, ARDISCOVERY_CONNECTION_JSON_ARSTREAM2_SERVER_CONTROL_PORT_KEY);
+        link->serverControlPort = (valueJsonObj != NULL) ? json_object_get_int (valueJsonObj) : 0;
     }
     
     return error;
@@ -6662,6 +7378,11 @@ void *ARCONTROLLER_Device_ControllerLooperThread (void *data)
                 {
                     ARSAL_PRINT (ARSAL_PRINT_ERROR, ARCONTROLLER_DEVICE_TAG, "Error occured while send PCMD : %s", ARCONTROLLER_Error_ToString (error));
                 }
+                else
+                {
+                    // this PCMD is the first one to carry the last decision of the application
+                    ARSAL_Trace_RecordPendingCommand ();
+                }
                 error = ARCONTROLLER_ARDrone3_SendCameraOrientationStruct (deviceController->aRDrone3, cmdBuffer, ARCONTROLLER_DEVICE_DEFAULT_LOOPER_CMD_BUFFER_SIZE);
                 if (error != ARCONTROLLER_OK)
                 {
@@ -21,6 +21,8 @@
 #include <libARCommands/ARCommands.h>
 #include <libARController/ARCONTROLLER_Feature.h>
 
+#include "ARCONTROLLER_WarmStart.h"
+
 #define ARCONTROLLER_DEVICE_DEFAULT_LOOPER_CMD_BUFFER_SIZE 1024
 
 /**
@@ -61,12 +63,18 @@ struct ARCONTROLLER_Device_Private_t
     eARCONTROLLER_DEVICE_STATE state; /**< state of the deviceController*/
     ARSAL_Thread_t controllerLooperThread; /**< looper threads used to send data in loop */
     ARCONTROLLER_DICTIONARY_CALLBAK_LIST_ELEMENT_t *commandCallbacks; /**< Array storing callbacks to use when a command is received. */
+    ARCONTROLLER_DICTIONARY_CALLBAK_LIST_ELEMENT_t *keyCommandCallbacks[ARCONTROLLER_DICTIONARY_DICTIONARY_KEY_MAX]; /**< Callbacks to use when a command is received, indexed by the command key. */
+    uint8_t subscribedKeys[ARCONTROLLER_DICTIONARY_DICTIONARY_KEY_MAX]; /**< 1 at the index of each command having a callback or used by the device controller ; written under mutex. */
+    int subscribedCommandsOnly; /**< 1 if the features only build the commands of subscribedKeys ; otherwide 0 */
     ARCONTROLLER_Device_STATECHANGEDCALLBACKELEMENT_t *stateChangedCallbacks; /**< Array storing callbacks to use when a state is changed. */
     ARCONTROLLER_Device_EXTENSIONSTATECHANGEDCALLBACKELEMENT_t *extensionStateChangedCallbacks; /**< Array storing callbacks to use when a state of the extension is changed. */
     int startCancelled; /**< 1 if the start is canceled*/
+    int directCommandDispatch; /**< 1 if the commands are decoded by the network receiver thread ; otherwide 0 */
     //video part
     int hasVideo; /**< 0 if the device has not Video stream ; otherwide 1 */
     int videoIsMP4Compliant; /**< 1 if the video is mp4 fomat compliant ; otherwide 0 */
+    eARCONTROLLER_STREAM_DECODE_POLICY videoDecodePolicy; /**< Policy of the decode stage of the video stream */
+    int videoDecodeQueueSize; /**< Size of the queue of the decode stage of the video stream */
     ARCONTROLLER_Stream_DecoderConfigCallback_t videoDecoderConfigCallback;
     ARCONTROLLER_Stream_DidReceiveFrameCallback_t videoReceiveCallback;
     ARCONTROLLER_Stream_TimeoutFrameCallback_t videoTimeoutCallback;
@@ -81,6 +89,11 @@ struct ARCONTROLLER_Device_Private_t
     eARCONTROLLER_DEVICE_STATE extensionState; /**< extension state of the deviceController*/
     char *extensionName;
     eARDISCOVERY_PRODUCT extensionProduct;
+    //warm start part
+    ARCONTROLLER_WarmStart_t *warmStart; /**< cache of the last connection ; NULL if the warm start is disabled */
+    ARCONTROLLER_WARMSTART_LINK_t warmStartLink; /**< parameters negotiated by the last connection */
+    ARSAL_Thread_t reconcileThread; /**< thread getting the initial settings and states after a warm start */
+    int warmStartReconciled; /**< 1 if the dictionaries have been refreshed by the device since the start ; otherwide 0 ; written under mutex */
 };
 
 /**
@@ -117,6 +130,21 @@ eARCONTROLLER_ERROR ARCONTROLLER_Device_OnStart (ARCONTROLLER_Device_t *deviceCo
  */
 eARCONTROLLER_ERROR ARCONTROLLER_Device_SetNetworkControllerToFeatures (ARCONTROLLER_Device_t *deviceController, void* specificFeature);
 
+/**
+ * @brief Set the commands of which the features build the elements.
+ * @param deviceController The device controller.
+ * @param[in] subscribedKeys Table indexed by eARCONTROLLER_DICTIONARY_KEY, 1 for each command to build ; NULL to build all commands.
+ * @return executing error.
+ */
+eARCONTROLLER_ERROR ARCONTROLLER_Device_SetSubscribedKeysToFeatures (ARCONTROLLER_Device_t *deviceController, const uint8_t *subscribedKeys);
+
+/**
+ * @brief Update the table of the subscribed commands after a change of the command received callbacks.
+ * @note Must be called with the mutex of the device controller locked.
+ * @param deviceController The device controller.
+ */
+void ARCONTROLLER_Device_UpdateSubscribedKeys (ARCONTROLLER_Device_t *deviceController);
+
 /**
  * @brief Register callback for each command received.
  * @param deviceController The device controller.
@@ -268,6 +296,35 @@ void *ARCONTROLLER_Device_StartRun (void *data);
  */
 void *ARCONTROLLER_Device_StopRun (void *data);
 
+/**
+ * @brief Thread getting the initial settings and states after a warm start.
+ * @param data The device controller.
+ * @return NULL.
+ */
+void *ARCONTROLLER_Device_ReconcileRun (void *data);
+
+/**
+ * @brief Decoder configuration callback used when the warm start is enabled ; keeps the parameter sets before calling the video decoder configuration callback.
+ * @param codec The codec of the video stream.
+ * @param customData The device controller.
+ * @return Executing error of the video decoder configuration callback.
+ */
+eARCONTROLLER_ERROR ARCONTROLLER_Device_WarmStartDecoderConfigCallback (ARCONTROLLER_Stream_Codec_t codec, void *customData);
+
+/**
+ * @brief Frame callback used when the warm start is enabled ; calls the video frame callback.
+ * @param frame The frame received.
+ * @param customData The device controller.
+ * @return Executing error of the video frame callback.
+ */
+eARCONTROLLER_ERROR ARCONTROLLER_Device_WarmStartReceiveFrameCallback (ARCONTROLLER_Frame_t *frame, void *customData);
+
+/**
+ * @brief Timeout callback used when the warm start is enabled ; calls the video timeout callback.
+ * @param customData The device controller.
+ */
+void ARCONTROLLER_Device_WarmStartTimeoutFrameCallback (void *customData);
+
 /**
  * @brief Start extension thread run .
  * @param data The device controller.
@@ -0,0 +1,323 @@
+/*
+    Copyright (C) 2014 Parrot SA
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions
+    are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the 
+      distribution.
+    * Neither the name of Parrot nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+    "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+    LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+    FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+    COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+    INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+    OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED 
+    AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+    OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+    SUCH DAMAGE.
+*/
+/**
+ * @file ARCONTROLLER_DictionaryPool.c
+ * @brief Slab allocator for the elements and arguments of the commands dictionaries.
+ *
+ * Every decoded command replaces the element previously stored for its key, so
+ * the number of live elements stays constant while the device streams its
+ * states. Recycling the blocks through free lists keeps the steady state free
+ * of heap allocations.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <uthash/uthash.h>
+
+#include <libARSAL/ARSAL_Mutex.h>
+#include <libARSAL/ARSAL_Print.h>
+
+#include <libARController/ARCONTROLLER_Dictionary.h>
+#include "ARCONTROLLER_DictionaryPool.h"
+
+/*************************
+ * Private header
+ *************************/
+
+typedef struct ARCONTROLLER_DICTIONARY_POOL_ELEMENT_BLOCK_t ARCONTROLLER_DICTIONARY_POOL_ELEMENT_BLOCK_t;
+typedef struct ARCONTROLLER_DICTIONARY_POOL_ARG_BLOCK_t ARCONTROLLER_DICTIONARY_POOL_ARG_BLOCK_t;
+typedef struct ARCONTROLLER_DICTIONARY_POOL_ELEMENT_SLAB_t ARCONTROLLER_DICTIONARY_POOL_ELEMENT_SLAB_t;
+typedef struct ARCONTROLLER_DICTIONARY_POOL_ARG_SLAB_t ARCONTROLLER_DICTIONARY_POOL_ARG_SLAB_t;
+
+/**
+ * @brief Element block ; the element must stay the first field.
+ */
+struct ARCONTROLLER_DICTIONARY_POOL_ELEMENT_BLOCK_t
+{
+    ARCONTROLLER_DICTIONARY_ELEMENT_t element; /**< Element given to the caller */
+    char key[ARCONTROLLER_DICTIONARY_POOL_KEY_CAPACITY]; /**< Storage of short keys */
+    int pooled; /**< 1 if the block belongs to a slab ; 0 if it was allocated alone */
+    ARCONTROLLER_DICTIONARY_POOL_ELEMENT_BLOCK_t *nextFree; /**< Next block of the free list */
+};
+
+/**
+ * @brief Argument block ; the argument must stay the first field.
+ */
+struct ARCONTROLLER_DICTIONARY_POOL_ARG_BLOCK_t
+{
+    ARCONTROLLER_DICTIONARY_ARG_t arg; /**< Argument given to the caller */
+    int pooled; /**< 1 if the block belongs to a slab ; 0 if it was allocated alone */
+    ARCONTROLLER_DICTIONARY_POOL_ARG_BLOCK_t *nextFree; /**< Next block of the free list */
+};
+
+struct ARCONTROLLER_DICTIONARY_POOL_ELEMENT_SLAB_t
+{
+    ARCONTROLLER_DICTIONARY_POOL_ELEMENT_SLAB_t *next; /**< Next slab */
+    ARCONTROLLER_DICTIONARY_POOL_ELEMENT_BLOCK_t blocks[ARCONTROLLER_DICTIONARY_POOL_SLAB_CAPACITY];
+};
+
+struct ARCONTROLLER_DICTIONARY_POOL_ARG_SLAB_t
+{
+    ARCONTROLLER_DICTIONARY_POOL_ARG_SLAB_t *next; /**< Next slab */
+    ARCONTROLLER_DICTIONARY_POOL_ARG_BLOCK_t blocks[ARCONTROLLER_DICTIONARY_POOL_SLAB_CAPACITY];
+};
+
+static int ARCONTROLLER_DictionaryPool_Initialized = 0;
+static ARSAL_Mutex_t ARCONTROLLER_DictionaryPool_Mutex;
+static ARCONTROLLER_DICTIONARY_POOL_ELEMENT_SLAB_t *ARCONTROLLER_DictionaryPool_ElementSlabs = NULL;
+static ARCONTROLLER_DICTIONARY_POOL_ELEMENT_BLOCK_t *ARCONTROLLER_DictionaryPool_FreeElements = NULL;
+static ARCONTROLLER_DICTIONARY_POOL_ARG_SLAB_t *ARCONTROLLER_DictionaryPool_ArgSlabs = NULL;
+static ARCONTROLLER_DICTIONARY_POOL_ARG_BLOCK_t *ARCONTROLLER_DictionaryPool_FreeArgs = NULL;
+
+/*************************
+ * Implementation
+ *************************/
+
+void ARCONTROLLER_DictionaryPool_Init (void)
+{
+    // -- Initialize the pool --
+    
+    if (!ARCONTROLLER_DictionaryPool_Initialized)
+    {
+        if (ARSAL_Mutex_Init (&ARCONTROLLER_DictionaryPool_Mutex) == 0)
+        {
+            ARCONTROLLER_DictionaryPool_Initialized = 1;
+        }
+        else
+        {
+            ARSAL_PRINT (ARSAL_PRINT_ERROR, ARCONTROLLER_DICTIONARY_POOL_TAG, "Mutex creation failed ; dictionary elements are allocated one by one.");
+        }
+    }
+    // No else: already initialized
+}
+
+ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_DictionaryPool_NewElement (void)
+{
+    // -- Get an element block --
+    
+    ARCONTROLLER_DICTIONARY_POOL_ELEMENT_BLOCK_t *block = NULL;
+    ARCONTROLLER_DICTIONARY_POOL_ELEMENT_SLAB_t *slab = NULL;
+    int index = 0;
+    
+    if (ARCONTROLLER_DictionaryPool_Initialized)
+    {
+        ARSAL_Mutex_Lock (&ARCONTROLLER_DictionaryPool_Mutex);
+        
+        if (ARCONTROLLER_DictionaryPool_FreeElements == NULL)
+        {
+            // Refill the free list with a new slab
+            slab = malloc (sizeof (ARCONTROLLER_DICTIONARY_POOL_ELEMENT_SLAB_t));
+            if (slab != NULL)
+            {
+                for (index = 0; index < ARCONTROLLER_DICTIONARY_POOL_SLAB_CAPACITY; index++)
+                {
+                    slab->blocks[index].pooled = 1;
+                    slab->blocks[index].nextFree = ARCONTROLLER_DictionaryPool_FreeElements;
+                    ARCONTROLLER_DictionaryPool_FreeElements = &(slab->blocks[index]);
+                }
+                
+                slab->next = ARCONTROLLER_DictionaryPool_ElementSlabs;
+                ARCONTROLLER_DictionaryPool_ElementSlabs = slab;
+            }
+        }
+        
+        block = ARCONTROLLER_DictionaryPool_FreeElements;
+        if (block != NULL)
+        {
+            ARCONTROLLER_DictionaryPool_FreeElements = block->nextFree;
+        }
+        
+        ARSAL_Mutex_Unlock (&ARCONTROLLER_DictionaryPool_Mutex);
+    }
+    else
+    {
+        block = malloc (sizeof (ARCONTROLLER_DICTIONARY_POOL_ELEMENT_BLOCK_t));
+        if (block != NULL)
+        {
+            block->pooled = 0;
+        }
+    }
+    
+    if (block == NULL)
+    {
+        return NULL;
+    }
+    
+    block->nextFree = NULL;
+    block->element.key = NULL;
+    block->element.arguments = NULL;
+    
+    return &(block->element);
+}
+
+void ARCONTROLLER_DictionaryPool_DeleteElement (ARCONTROLLER_DICTIONARY_ELEMENT_t *element)
+{
+    // -- Give back an element block --
+    
+    ARCONTROLLER_DICTIONARY_POOL_ELEMENT_BLOCK_t *block = (ARCONTROLLER_DICTIONARY_POOL_ELEMENT_BLOCK_t *)element;
+    
+    if (block == NULL)
+    {
+        return;
+    }
+    
+    if (block->pooled)
+    {
+        ARSAL_Mutex_Lock (&ARCONTROLLER_DictionaryPool_Mutex);
+        block->nextFree = ARCONTROLLER_DictionaryPool_FreeElements;
+        ARCONTROLLER_DictionaryPool_FreeElements = block;
+        ARSAL_Mutex_Unlock (&ARCONTROLLER_DictionaryPool_Mutex);
+    }
+    else
+    {
+        free (block);
+    }
+}
+
+char *ARCONTROLLER_DictionaryPool_NewElementKey (ARCONTROLLER_DICTIONARY_ELEMENT_t *element, int size)
+{
+    // -- Get the storage of a key --
+    
+    ARCONTROLLER_DICTIONARY_POOL_ELEMENT_BLOCK_t *block = (ARCONTROLLER_DICTIONARY_POOL_ELEMENT_BLOCK_t *)element;
+    
+    if ((block == NULL) || (size <= 0))
+    {
+        return NULL;
+    }
+    
+    if (size <= ARCONTROLLER_DICTIONARY_POOL_KEY_CAPACITY)
+    {
+        return block->key;
+    }
+    
+    return malloc (size);
+}
+
+void ARCONTROLLER_DictionaryPool_DeleteElementKey (ARCONTROLLER_DICTIONARY_ELEMENT_t *element)
+{
+    // -- Release the key of an element --
+    
+    ARCONTROLLER_DICTIONARY_POOL_ELEMENT_BLOCK_t *block = (ARCONTROLLER_DICTIONARY_POOL_ELEMENT_BLOCK_t *)element;
+    
+    if ((block == NULL) || (block->element.key == NULL))
+    {
+        return;
+    }
+    
+    if (block->element.key != block->key)
+    {
+        free (block->element.key);
+    }
+    
+    block->element.key = NULL;
+}
+
+ARCONTROLLER_DICTIONARY_ARG_t *ARCONTROLLER_DictionaryPool_NewArg (void)
+{
+    // -- Get an argument block --
+    
+    ARCONTROLLER_DICTIONARY_POOL_ARG_BLOCK_t *block = NULL;
+    ARCONTROLLER_DICTIONARY_POOL_ARG_SLAB_t *slab = NULL;
+    int index = 0;
+    
+    if (ARCONTROLLER_DictionaryPool_Initialized)
+    {
+        ARSAL_Mutex_Lock (&ARCONTROLLER_DictionaryPool_Mutex);
+        
+        if (ARCONTROLLER_DictionaryPool_FreeArgs == NULL)
+        {
+            // Refill the free list with a new slab
+            slab = malloc (sizeof (ARCONTROLLER_DICTIONARY_POOL_ARG_SLAB_t));
+            if (slab != NULL)
+            {
+                for (index = 0; index < ARCONTROLLER_DICTIONARY_POOL_SLAB_CAPACITY; index++)
+                {
+                    slab->blocks[index].pooled = 1;
+                    slab->blocks[index].nextFree = ARCONTROLLER_DictionaryPool_FreeArgs;
+                    ARCONTROLLER_DictionaryPool_FreeArgs = &(slab->blocks[index]);
+                }
+                
+                slab->next = ARCONTROLLER_DictionaryPool_ArgSlabs;
+                ARCONTROLLER_DictionaryPool_ArgSlabs = slab;
+            }
+        }
+        
+        block = ARCONTROLLER_DictionaryPool_FreeArgs;
+        if (block != NULL)
+        {
+            ARCONTROLLER_DictionaryPool_FreeArgs = block->nextFree;
+        }
+        
+        ARSAL_Mutex_Unlock (&ARCONTROLLER_DictionaryPool_Mutex);
+    }
+    else
+    {
+        block = malloc (sizeof (ARCONTROLLER_DICTIONARY_POOL_ARG_BLOCK_t));
+        if (block != NULL)
+        {
+            block->pooled = 0;
+        }
+    }
+    
+    if (block == NULL)
+    {
+        return NULL;
+    }
+    
+    block->nextFree = NULL;
+    
+    return &(block->arg);
+}
+
+void ARCONTROLLER_DictionaryPool_DeleteArg (ARCONTROLLER_DICTIONARY_ARG_t *arg)
+{
+    // -- Give back an argument block --
+    
+    ARCONTROLLER_DICTIONARY_POOL_ARG_BLOCK_t *block = (ARCONTROLLER_DICTIONARY_POOL_ARG_BLOCK_t *)arg;
+    
+    if (block == NULL)
+    {
+        return;
+    }
+    
+    if (block->pooled)
+    {
+        ARSAL_Mutex_Lock (&ARCONTROLLER_DictionaryPool_Mutex);
+        block->nextFree = ARCONTROLLER_DictionaryPool_FreeArgs;
+        ARCONTROLLER_DictionaryPool_FreeArgs = block;
+        ARSAL_Mutex_Unlock (&ARCONTROLLER_DictionaryPool_Mutex);
+    }
+    else
+    {
+        free (block);
+    }
+}
@@ -0,0 +1,92 @@
+/*
+    Copyright (C) 2014 Parrot SA
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions
+    are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the 
+      distribution.
+    * Neither the name of Parrot nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+    "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+    LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+    FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+    COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+    INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+    OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED 
+    AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+    OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+    SUCH DAMAGE.
+*/
+/**
+ * @file ARCONTROLLER_DictionaryPool.h
+ * @brief Slab allocator for the elements and arguments of the commands dictionaries.
+ */
+
+#ifndef _ARCONTROLLER_DICTIONARY_POOL_PRIVATE_H_
+#define _ARCONTROLLER_DICTIONARY_POOL_PRIVATE_H_
+
+#include <libARController/ARCONTROLLER_Dictionary.h>
+
+#define ARCONTROLLER_DICTIONARY_POOL_TAG "ARCONTROLLER_DictionaryPool"
+#define ARCONTROLLER_DICTIONARY_POOL_SLAB_CAPACITY 32 /**< Number of blocks allocated at once when a free list is empty */
+#define ARCONTROLLER_DICTIONARY_POOL_KEY_CAPACITY 40 /**< Keys up to this size (terminating null included) are stored inside the element block */
+
+/**
+ * @brief Initialize the pool ; called by ARCONTROLLER_Device_New before any feature decodes a command.
+ * @note Blocks requested before the initialization are allocated one by one with malloc.
+ * @note The slabs are kept for the lifetime of the process ; their size is bounded by the largest dictionaries ever held.
+ */
+void ARCONTROLLER_DictionaryPool_Init (void);
+
+/**
+ * @brief Get a dictionary element from the pool.
+ * @return The element, with key and arguments set to NULL ; NULL if the allocation failed.
+ */
+ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_DictionaryPool_NewElement (void);
+
+/**
+ * @brief Give a dictionary element back to the pool.
+ * @note The key and the arguments must have been released before.
+ * @param element The element got by ARCONTROLLER_DictionaryPool_NewElement().
+ */
+void ARCONTROLLER_DictionaryPool_DeleteElement (ARCONTROLLER_DICTIONARY_ELEMENT_t *element);
+
+/**
+ * @brief Get the storage of the key of an element.
+ * @param element The element got by ARCONTROLLER_DictionaryPool_NewElement().
+ * @param size Size of the key, terminating null included.
+ * @return The storage inside the element block if the key fits ; otherwise a malloc'ed buffer ; NULL if the allocation failed.
+ */
+char *ARCONTROLLER_DictionaryPool_NewElementKey (ARCONTROLLER_DICTIONARY_ELEMENT_t *element, int size);
+
+/**
+ * @brief Release the key of an element.
+ * @param element The element owning the key got by ARCONTROLLER_DictionaryPool_NewElementKey().
+ */
+void ARCONTROLLER_DictionaryPool_DeleteElementKey (ARCONTROLLER_DICTIONARY_ELEMENT_t *element);
+
+/**
+ * @brief Get a dictionary argument from the pool.
+ * @return The argument ; NULL if the allocation failed.
+ */
+ARCONTROLLER_DICTIONARY_ARG_t *ARCONTROLLER_DictionaryPool_NewArg (void);
+
+/**
+ * @brief Give a dictionary argument back to the pool.
+ * @note A string value must have been freed before.
+ * @param arg The argument got by ARCONTROLLER_DictionaryPool_NewArg() ; can be NULL.
+ */
+void ARCONTROLLER_DictionaryPool_DeleteArg (ARCONTROLLER_DICTIONARY_ARG_t *arg);
+
+#endif /* _ARCONTROLLER_DICTIONARY_POOL_PRIVATE_H_ */
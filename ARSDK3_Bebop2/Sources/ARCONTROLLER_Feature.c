@@ -14,6 +14,7 @@
 */
 
 #include <stdio.h>
+#include <string.h>
 #include <libARSAL/ARSAL_Mutex.h>
 #include <libARCommands/ARCommands.h>
 #include <libARController/ARCONTROLLER_Network.h>
@@ -24,6 +25,7 @@
 #include "ARCONTROLLER_StreamSender.h"
 #include "ARCONTROLLER_Feature.h"
 #include "ARCONTROLLER_Network.h"
+#include "ARCONTROLLER_DictionaryPool.h"
 
 #define ARCONTROLLER_FEATURE_TAG "ARCONTROLLER_Feature"
 
@@ -54,15 +56,11 @@ void ARCONTROLLER_Feature_DeleteCommandsDictionary (ARCONTROLLER_DICTIONARY_COMM
                         ARCONTROLLER_Feature_DeleteArgumentsDictionary (&(dictElement->arguments));
                     }
                     
-                    if (dictElement->key != NULL)
-                    {
-                        // free the key of the element
-                        free (dictElement->key);
-                        dictElement->key = NULL;
-                    }
+                    // free the key of the element
+                    ARCONTROLLER_DictionaryPool_DeleteElementKey (dictElement);
                     
                     HASH_DEL (dictCmdElement->elements, dictElement);
-                    free (dictElement);
+                    ARCONTROLLER_DictionaryPool_DeleteElement (dictElement);
                     dictElement = NULL;
                 }
                 
@@ -145,14 +143,10 @@ void ARCONTROLLER_Feature_DeleteElement (ARCONTROLLER_DICTIONARY_ELEMENT_t **ele
                 ARCONTROLLER_Feature_DeleteArgumentsDictionary (&((*element)->arguments));
             }
             
-            if ((*element)->key != NULL)
-            {
-                // free the key of the element
-                free ((*element)->key);
-                (*element)->key = NULL;
-            }
+            // free the key of the element
+            ARCONTROLLER_DictionaryPool_DeleteElementKey (*element);
             
-            free (*element);
+            ARCONTROLLER_DictionaryPool_DeleteElement (*element);
             (*element) = NULL;
         }
     }
@@ -180,7 +174,7 @@ void ARCONTROLLER_Feature_DeleteArgumentsDictionary (ARCONTROLLER_DICTIONARY_ARG
                 }
                 
                 HASH_DEL((*dictionary), dictElement);
-                free(dictElement);
+                ARCONTROLLER_DictionaryPool_DeleteArg (dictElement);
                 dictElement = NULL;
             }
             
@@ -201,9 +195,7 @@ void ARCONTROLLER_Feature_AddElement (ARCONTROLLER_DICTIONARY_ELEMENT_t **elemen
     {
         HASH_REPLACE_STR ((*elementDict), key, newElement, oldElement);
         
-        ARCONTROLLER_Feature_DeleteArgumentsDictionary (&(oldElement->arguments));
-        free (oldElement);
-        oldElement = NULL;
+        ARCONTROLLER_Feature_DeleteElement (&oldElement);
     }
     else
     {
@@ -212,6 +204,43 @@ void ARCONTROLLER_Feature_AddElement (ARCONTROLLER_DICTIONARY_ELEMENT_t **elemen
     
 }
 
+int ARCONTROLLER_Feature_UpdateSingleElement (ARCONTROLLER_DICTIONARY_COMMANDS_t *dictCmdElement, const ARCONTROLLER_DICTIONARY_ARG_t *values, int valuesCount)
+{
+    // -- Update the single element of a command in place --
+    ARCONTROLLER_DICTIONARY_ELEMENT_t *element = NULL;
+    ARCONTROLLER_DICTIONARY_ARG_t *arg = NULL;
+    int index = 0;
+    
+    if (dictCmdElement == NULL)
+    {
+        return 0;
+    }
+    
+    HASH_FIND_STR (dictCmdElement->elements, ARCONTROLLER_DICTIONARY_SINGLE_KEY, element);
+    if (element == NULL)
+    {
+        return 0;
+    }
+    
+    // Check all arguments first to never leave the element half updated
+    for (index = 0; index < valuesCount; index++)
+    {
+        HASH_FIND_STR (element->arguments, values[index].argument, arg);
+        if ((arg == NULL) || (arg->valueType != values[index].valueType) || (arg->valueType == ARCONTROLLER_DICTIONARY_VALUE_TYPE_STRING))
+        {
+            return 0;
+        }
+    }
+    
+    for (index = 0; index < valuesCount; index++)
+    {
+        HASH_FIND_STR (element->arguments, values[index].argument, arg);
+        arg->value = values[index].value;
+    }
+    
+    return 1;
+}
+
 /*******************************
  * --- FEATURE generic --- 
  ******************************/
@@ -258,6 +287,7 @@ ARCONTROLLER_FEATURE_Generic_t *ARCONTROLLER_FEATURE_Generic_New (ARCONTROLLER_N
             featureController->privatePart->networkController = networkController;
             featureController->privatePart->dictionary = NULL;
             featureController->privatePart->commandCallbacks = NULL;
+            featureController->privatePart->subscribedKeys = NULL;
             // Create the mutex 
             if (ARSAL_Mutex_Init (&(featureController->privatePart->mutex)) != 0)
             {
@@ -488,6 +518,27 @@ eARCONTROLLER_ERROR ARCONTROLLER_FEATURE_Generic_SetNetworkController (ARCONTROL
     return error;
 }
 
+eARCONTROLLER_ERROR ARCONTROLLER_FEATURE_Generic_SetSubscribedKeys (ARCONTROLLER_FEATURE_Generic_t *feature, const uint8_t *subscribedKeys)
+{
+    // -- Set the commands of which the elements are built. --
+    
+    eARCONTROLLER_ERROR error = ARCONTROLLER_OK;
+    
+    // Check parameters
+    if ((feature == NULL) || (feature->privatePart == NULL))
+    {
+        error = ARCONTROLLER_ERROR_BAD_PARAMETER;
+    }
+    // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
+    
+    if (error == ARCONTROLLER_OK)
+    {
+        feature->privatePart->subscribedKeys = subscribedKeys;
+    }
+    
+    return error;
+}
+
 ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Generic_GetCommandElements (ARCONTROLLER_FEATURE_Generic_t *feature, eARCONTROLLER_DICTIONARY_KEY commandKey, eARCONTROLLER_ERROR *error)
 {
     // -- Get Command Arguments --
@@ -883,8 +934,11 @@ ARCONTROLLER_FEATURE_ARDrone3_t *ARCONTROLLER_FEATURE_ARDrone3_New (ARCONTROLLER
             featureController->privatePart->networkController = networkController;
             featureController->privatePart->dictionary = NULL;
             featureController->privatePart->commandCallbacks = NULL;
+            featureController->privatePart->subscribedKeys = NULL;
             featureController->privatePart->PilotingPCMDParameters = NULL;
             featureController->privatePart->CameraOrientationParameters = NULL;
+            ARCONTROLLER_Telemetry_InitSeqlock (&(featureController->privatePart->telemetryLock));
+            memset (&(featureController->privatePart->telemetry), 0, sizeof (ARCONTROLLER_TELEMETRY_ARDRONE3_t));
             // Create the mutex 
             if (ARSAL_Mutex_Init (&(featureController->privatePart->mutex)) != 0)
             {
@@ -3689,6 +3743,12 @@ void ARCONTROLLER_FEATURE_ARDrone3_MediaRecordStatePictureStateChangedCallback (
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -3772,6 +3832,12 @@ void ARCONTROLLER_FEATURE_ARDrone3_MediaRecordStateVideoStateChangedCallback (eA
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -3855,6 +3921,12 @@ void ARCONTROLLER_FEATURE_ARDrone3_MediaRecordStatePictureStateChangedV2Callback
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -3938,6 +4010,12 @@ void ARCONTROLLER_FEATURE_ARDrone3_MediaRecordStateVideoStateChangedV2Callback (
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -4021,6 +4099,12 @@ void ARCONTROLLER_FEATURE_ARDrone3_MediaRecordStateVideoResolutionStateCallback
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -4104,6 +4188,12 @@ void ARCONTROLLER_FEATURE_ARDrone3_MediaRecordEventPictureEventChangedCallback (
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -4187,6 +4277,12 @@ void ARCONTROLLER_FEATURE_ARDrone3_MediaRecordEventVideoEventChangedCallback (eA
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -4270,6 +4366,12 @@ void ARCONTROLLER_FEATURE_ARDrone3_PilotingStateFlatTrimChangedCallback (void *c
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -4353,6 +4455,12 @@ void ARCONTROLLER_FEATURE_ARDrone3_PilotingStateFlyingStateChangedCallback (eARC
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -4436,6 +4544,12 @@ void ARCONTROLLER_FEATURE_ARDrone3_PilotingStateAlertStateChangedCallback (eARCO
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -4519,6 +4633,12 @@ void ARCONTROLLER_FEATURE_ARDrone3_PilotingStateNavigateHomeStateChangedCallback
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -4595,6 +4715,8 @@ void ARCONTROLLER_FEATURE_ARDrone3_PilotingStatePositionChangedCallback (double
     int isANewCommandElement = 0;
     int elementAdded = 0;
     ARCONTROLLER_DICTIONARY_ELEMENT_t *newElement = NULL;
+    int elementUpdated = 0;
+    ARCONTROLLER_DICTIONARY_ARG_t values[3];
     // Check parameters
     if ((feature == NULL) || (feature->privatePart == NULL))
     {
@@ -4606,7 +4728,40 @@ void ARCONTROLLER_FEATURE_ARDrone3_PilotingStatePositionChangedCallback (double
     {
         // Find command elements
         ARSAL_Mutex_Lock (&(feature->privatePart->mutex));
+        
+        // Update the typed snapshot
+        ARCONTROLLER_Telemetry_WriteBegin (&(feature->privatePart->telemetryLock));
+        feature->privatePart->telemetry.latitude = _latitude;
+        feature->privatePart->telemetry.longitude = _longitude;
+        feature->privatePart->telemetry.positionAltitude = _altitude;
+        feature->privatePart->telemetry.positionSequence++;
+        ARCONTROLLER_Telemetry_WriteEnd (&(feature->privatePart->telemetryLock));
+        
+        if (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey))
+        {
+            // No subscriber: only the typed snapshot is updated
+            ARSAL_Mutex_Unlock (&(feature->privatePart->mutex));
+            return;
+        }
+        
         HASH_FIND_INT (feature->privatePart->dictionary, &commandKey, dictCmdElement);
+        
+        if (dictCmdElement != NULL)
+        {
+            // Periodic state: overwrite the previous values instead of allocating a new element
+            values[0].argument = ARCONTROLLER_DICTIONARY_KEY_ARDRONE3_PILOTINGSTATE_POSITIONCHANGED_LATITUDE;
+            values[0].valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_DOUBLE;
+            values[0].value.Double = _latitude;
+            values[1].argument = ARCONTROLLER_DICTIONARY_KEY_ARDRONE3_PILOTINGSTATE_POSITIONCHANGED_LONGITUDE;
+            values[1].valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_DOUBLE;
+            values[1].value.Double = _longitude;
+            values[2].argument = ARCONTROLLER_DICTIONARY_KEY_ARDRONE3_PILOTINGSTATE_POSITIONCHANGED_ALTITUDE;
+            values[2].valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_DOUBLE;
+            values[2].value.Double = _altitude;
+            
+            elementUpdated = ARCONTROLLER_Feature_UpdateSingleElement (dictCmdElement, values, 3);
+        }
+        
         ARSAL_Mutex_Unlock (&(feature->privatePart->mutex));
         
         if (dictCmdElement == NULL)
@@ -4619,14 +4774,14 @@ void ARCONTROLLER_FEATURE_ARDrone3_PilotingStatePositionChangedCallback (double
         
     }
     
-    if (error == ARCONTROLLER_OK)
+    if ((error == ARCONTROLLER_OK) && (!elementUpdated))
     {
         //Create new element
         newElement = ARCONTROLLER_ARDrone3_NewCmdElementPilotingStatePositionChanged (feature,  _latitude,  _longitude,  _altitude, &error);
     }
     
     //Set new element in CommandElements 
-    if (error == ARCONTROLLER_OK)
+    if ((error == ARCONTROLLER_OK) && (!elementUpdated))
     {
         ARSAL_Mutex_Lock (&(feature->privatePart->mutex));
         
@@ -4678,6 +4833,8 @@ void ARCONTROLLER_FEATURE_ARDrone3_PilotingStateSpeedChangedCallback (float _spe
     int isANewCommandElement = 0;
     int elementAdded = 0;
     ARCONTROLLER_DICTIONARY_ELEMENT_t *newElement = NULL;
+    int elementUpdated = 0;
+    ARCONTROLLER_DICTIONARY_ARG_t values[3];
     // Check parameters
     if ((feature == NULL) || (feature->privatePart == NULL))
     {
@@ -4689,7 +4846,40 @@ void ARCONTROLLER_FEATURE_ARDrone3_PilotingStateSpeedChangedCallback (float _spe
     {
         // Find command elements
         ARSAL_Mutex_Lock (&(feature->privatePart->mutex));
+        
+        // Update the typed snapshot
+        ARCONTROLLER_Telemetry_WriteBegin (&(feature->privatePart->telemetryLock));
+        feature->privatePart->telemetry.speedX = _speedX;
+        feature->privatePart->telemetry.speedY = _speedY;
+        feature->privatePart->telemetry.speedZ = _speedZ;
+        feature->privatePart->telemetry.speedSequence++;
+        ARCONTROLLER_Telemetry_WriteEnd (&(feature->privatePart->telemetryLock));
+        
+        if (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey))
+        {
+            // No subscriber: only the typed snapshot is updated
+            ARSAL_Mutex_Unlock (&(feature->privatePart->mutex));
+            return;
+        }
+        
         HASH_FIND_INT (feature->privatePart->dictionary, &commandKey, dictCmdElement);
+        
+        if (dictCmdElement != NULL)
+        {
+            // Periodic state: overwrite the previous values instead of allocating a new element
+            values[0].argument = ARCONTROLLER_DICTIONARY_KEY_ARDRONE3_PILOTINGSTATE_SPEEDCHANGED_SPEEDX;
+            values[0].valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
+            values[0].value.Float = _speedX;
+            values[1].argument = ARCONTROLLER_DICTIONARY_KEY_ARDRONE3_PILOTINGSTATE_SPEEDCHANGED_SPEEDY;
+            values[1].valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
+            values[1].value.Float = _speedY;
+            values[2].argument = ARCONTROLLER_DICTIONARY_KEY_ARDRONE3_PILOTINGSTATE_SPEEDCHANGED_SPEEDZ;
+            values[2].valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
+            values[2].value.Float = _speedZ;
+            
+            elementUpdated = ARCONTROLLER_Feature_UpdateSingleElement (dictCmdElement, values, 3);
+        }
+        
         ARSAL_Mutex_Unlock (&(feature->privatePart->mutex));
         
         if (dictCmdElement == NULL)
@@ -4702,14 +4892,14 @@ void ARCONTROLLER_FEATURE_ARDrone3_PilotingStateSpeedChangedCallback (float _spe
         
     }
     
-    if (error == ARCONTROLLER_OK)
+    if ((error == ARCONTROLLER_OK) && (!elementUpdated))
     {
         //Create new element
         newElement = ARCONTROLLER_ARDrone3_NewCmdElementPilotingStateSpeedChanged (feature,  _speedX,  _speedY,  _speedZ, &error);
     }
     
     //Set new element in CommandElements 
-    if (error == ARCONTROLLER_OK)
+    if ((error == ARCONTROLLER_OK) && (!elementUpdated))
     {
         ARSAL_Mutex_Lock (&(feature->privatePart->mutex));
         
@@ -4761,6 +4951,8 @@ void ARCONTROLLER_FEATURE_ARDrone3_PilotingStateAttitudeChangedCallback (float _
     int isANewCommandElement = 0;
     int elementAdded = 0;
     ARCONTROLLER_DICTIONARY_ELEMENT_t *newElement = NULL;
+    int elementUpdated = 0;
+    ARCONTROLLER_DICTIONARY_ARG_t values[3];
     // Check parameters
     if ((feature == NULL) || (feature->privatePart == NULL))
     {
@@ -4772,7 +4964,40 @@ void ARCONTROLLER_FEATURE_ARDrone3_PilotingStateAttitudeChangedCallback (float _
     {
         // Find command elements
         ARSAL_Mutex_Lock (&(feature->privatePart->mutex));
+        
+        // Update the typed snapshot
+        ARCONTROLLER_Telemetry_WriteBegin (&(feature->privatePart->telemetryLock));
+        feature->privatePart->telemetry.roll = _roll;
+        feature->privatePart->telemetry.pitch = _pitch;
+        feature->privatePart->telemetry.yaw = _yaw;
+        feature->privatePart->telemetry.attitudeSequence++;
+        ARCONTROLLER_Telemetry_WriteEnd (&(feature->privatePart->telemetryLock));
+        
+        if (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey))
+        {
+            // No subscriber: only the typed snapshot is updated
+            ARSAL_Mutex_Unlock (&(feature->privatePart->mutex));
+            return;
+        }
+        
         HASH_FIND_INT (feature->privatePart->dictionary, &commandKey, dictCmdElement);
+        
+        if (dictCmdElement != NULL)
+        {
+            // Periodic state: overwrite the previous values instead of allocating a new element
+            values[0].argument = ARCONTROLLER_DICTIONARY_KEY_ARDRONE3_PILOTINGSTATE_ATTITUDECHANGED_ROLL;
+            values[0].valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
+            values[0].value.Float = _roll;
+            values[1].argument = ARCONTROLLER_DICTIONARY_KEY_ARDRONE3_PILOTINGSTATE_ATTITUDECHANGED_PITCH;
+            values[1].valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
+            values[1].value.Float = _pitch;
+            values[2].argument = ARCONTROLLER_DICTIONARY_KEY_ARDRONE3_PILOTINGSTATE_ATTITUDECHANGED_YAW;
+            values[2].valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
+            values[2].value.Float = _yaw;
+            
+            elementUpdated = ARCONTROLLER_Feature_UpdateSingleElement (dictCmdElement, values, 3);
+        }
+        
         ARSAL_Mutex_Unlock (&(feature->privatePart->mutex));
         
         if (dictCmdElement == NULL)
@@ -4785,14 +5010,14 @@ void ARCONTROLLER_FEATURE_ARDrone3_PilotingStateAttitudeChangedCallback (float _
         
     }
     
-    if (error == ARCONTROLLER_OK)
+    if ((error == ARCONTROLLER_OK) && (!elementUpdated))
     {
         //Create new element
         newElement = ARCONTROLLER_ARDrone3_NewCmdElementPilotingStateAttitudeChanged (feature,  _roll,  _pitch,  _yaw, &error);
     }
     
     //Set new element in CommandElements 
-    if (error == ARCONTROLLER_OK)
+    if ((error == ARCONTROLLER_OK) && (!elementUpdated))
     {
         ARSAL_Mutex_Lock (&(feature->privatePart->mutex));
         
@@ -4851,6 +5076,12 @@ void ARCONTROLLER_FEATURE_ARDrone3_PilotingStateAutoTakeOffModeChangedCallback (
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -4927,6 +5158,8 @@ void ARCONTROLLER_FEATURE_ARDrone3_PilotingStateAltitudeChangedCallback (double
     int isANewCommandElement = 0;
     int elementAdded = 0;
     ARCONTROLLER_DICTIONARY_ELEMENT_t *newElement = NULL;
+    int elementUpdated = 0;
+    ARCONTROLLER_DICTIONARY_ARG_t values[1];
     // Check parameters
     if ((feature == NULL) || (feature->privatePart == NULL))
     {
@@ -4938,7 +5171,32 @@ void ARCONTROLLER_FEATURE_ARDrone3_PilotingStateAltitudeChangedCallback (double
     {
         // Find command elements
         ARSAL_Mutex_Lock (&(feature->privatePart->mutex));
+        
+        // Update the typed snapshot
+        ARCONTROLLER_Telemetry_WriteBegin (&(feature->privatePart->telemetryLock));
+        feature->privatePart->telemetry.altitude = _altitude;
+        feature->privatePart->telemetry.altitudeSequence++;
+        ARCONTROLLER_Telemetry_WriteEnd (&(feature->privatePart->telemetryLock));
+        
+        if (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey))
+        {
+            // No subscriber: only the typed snapshot is updated
+            ARSAL_Mutex_Unlock (&(feature->privatePart->mutex));
+            return;
+        }
+        
         HASH_FIND_INT (feature->privatePart->dictionary, &commandKey, dictCmdElement);
+        
+        if (dictCmdElement != NULL)
+        {
+            // Periodic state: overwrite the previous values instead of allocating a new element
+            values[0].argument = ARCONTROLLER_DICTIONARY_KEY_ARDRONE3_PILOTINGSTATE_ALTITUDECHANGED_ALTITUDE;
+            values[0].valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_DOUBLE;
+            values[0].value.Double = _altitude;
+            
+            elementUpdated = ARCONTROLLER_Feature_UpdateSingleElement (dictCmdElement, values, 1);
+        }
+        
         ARSAL_Mutex_Unlock (&(feature->privatePart->mutex));
         
         if (dictCmdElement == NULL)
@@ -4951,14 +5209,14 @@ void ARCONTROLLER_FEATURE_ARDrone3_PilotingStateAltitudeChangedCallback (double
         
     }
     
-    if (error == ARCONTROLLER_OK)
+    if ((error == ARCONTROLLER_OK) && (!elementUpdated))
     {
         //Create new element
         newElement = ARCONTROLLER_ARDrone3_NewCmdElementPilotingStateAltitudeChanged (feature,  _altitude, &error);
     }
     
     //Set new element in CommandElements 
-    if (error == ARCONTROLLER_OK)
+    if ((error == ARCONTROLLER_OK) && (!elementUpdated))
     {
         ARSAL_Mutex_Lock (&(feature->privatePart->mutex));
         
@@ -5017,6 +5275,12 @@ void ARCONTROLLER_FEATURE_ARDrone3_PilotingStateGpsLocationChangedCallback (doub
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -5100,6 +5364,12 @@ void ARCONTROLLER_FEATURE_ARDrone3_PilotingStateLandingStateChangedCallback (eAR
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -5183,6 +5453,12 @@ void ARCONTROLLER_FEATURE_ARDrone3_PilotingEventMoveByEndCallback (float _dX, fl
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -5266,6 +5542,12 @@ void ARCONTROLLER_FEATURE_ARDrone3_NetworkStateWifiScanListChangedCallback (char
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -5349,6 +5631,12 @@ void ARCONTROLLER_FEATURE_ARDrone3_NetworkStateAllWifiScanChangedCallback (void
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -5433,6 +5721,12 @@ void ARCONTROLLER_FEATURE_ARDrone3_NetworkStateWifiAuthChannelListChangedCallbac
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -5521,6 +5815,12 @@ void ARCONTROLLER_FEATURE_ARDrone3_NetworkStateAllWifiAuthChannelChangedCallback
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -5604,6 +5904,12 @@ void ARCONTROLLER_FEATURE_ARDrone3_PilotingSettingsStateMaxAltitudeChangedCallba
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -5687,6 +5993,12 @@ void ARCONTROLLER_FEATURE_ARDrone3_PilotingSettingsStateMaxTiltChangedCallback (
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -5770,6 +6082,12 @@ void ARCONTROLLER_FEATURE_ARDrone3_PilotingSettingsStateAbsolutControlChangedCal
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -5853,6 +6171,12 @@ void ARCONTROLLER_FEATURE_ARDrone3_PilotingSettingsStateMaxDistanceChangedCallba
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -5936,6 +6260,12 @@ void ARCONTROLLER_FEATURE_ARDrone3_PilotingSettingsStateNoFlyOverMaxDistanceChan
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -6019,6 +6349,12 @@ void ARCONTROLLER_FEATURE_ARDrone3_PilotingSettingsStateAutonomousFlightMaxHoriz
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -6102,6 +6438,12 @@ void ARCONTROLLER_FEATURE_ARDrone3_PilotingSettingsStateAutonomousFlightMaxVerti
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -6185,6 +6527,12 @@ void ARCONTROLLER_FEATURE_ARDrone3_PilotingSettingsStateAutonomousFlightMaxHoriz
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -6268,6 +6616,12 @@ void ARCONTROLLER_FEATURE_ARDrone3_PilotingSettingsStateAutonomousFlightMaxVerti
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -6351,6 +6705,12 @@ void ARCONTROLLER_FEATURE_ARDrone3_PilotingSettingsStateAutonomousFlightMaxRotat
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -6434,6 +6794,12 @@ void ARCONTROLLER_FEATURE_ARDrone3_PilotingSettingsStateBankedTurnChangedCallbac
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -6517,6 +6883,12 @@ void ARCONTROLLER_FEATURE_ARDrone3_PilotingSettingsStateMinAltitudeChangedCallba
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -6600,6 +6972,12 @@ void ARCONTROLLER_FEATURE_ARDrone3_PilotingSettingsStateCirclingDirectionChanged
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -6683,6 +7061,12 @@ void ARCONTROLLER_FEATURE_ARDrone3_PilotingSettingsStateCirclingRadiusChangedCal
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -6766,6 +7150,12 @@ void ARCONTROLLER_FEATURE_ARDrone3_PilotingSettingsStateCirclingAltitudeChangedC
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -6849,6 +7239,12 @@ void ARCONTROLLER_FEATURE_ARDrone3_PilotingSettingsStatePitchModeChangedCallback
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -6932,6 +7328,12 @@ void ARCONTROLLER_FEATURE_ARDrone3_SpeedSettingsStateMaxVerticalSpeedChangedCall
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -7015,6 +7417,12 @@ void ARCONTROLLER_FEATURE_ARDrone3_SpeedSettingsStateMaxRotationSpeedChangedCall
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -7098,6 +7506,12 @@ void ARCONTROLLER_FEATURE_ARDrone3_SpeedSettingsStateHullProtectionChangedCallba
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -7181,6 +7595,12 @@ void ARCONTROLLER_FEATURE_ARDrone3_SpeedSettingsStateOutdoorChangedCallback (uin
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -7264,6 +7684,12 @@ void ARCONTROLLER_FEATURE_ARDrone3_SpeedSettingsStateMaxPitchRollRotationSpeedCh
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -7347,6 +7773,12 @@ void ARCONTROLLER_FEATURE_ARDrone3_NetworkSettingsStateWifiSelectionChangedCallb
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -7430,6 +7862,12 @@ void ARCONTROLLER_FEATURE_ARDrone3_NetworkSettingsStateWifiSecurityChangedCallba
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -7513,6 +7951,12 @@ void ARCONTROLLER_FEATURE_ARDrone3_NetworkSettingsStateWifiSecurityCallback (eAR
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -7596,6 +8040,12 @@ void ARCONTROLLER_FEATURE_ARDrone3_SettingsStateProductMotorVersionListChangedCa
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -7679,6 +8129,12 @@ void ARCONTROLLER_FEATURE_ARDrone3_SettingsStateProductGPSVersionChangedCallback
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -7762,6 +8218,12 @@ void ARCONTROLLER_FEATURE_ARDrone3_SettingsStateMotorErrorStateChangedCallback (
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -7845,6 +8307,12 @@ void ARCONTROLLER_FEATURE_ARDrone3_SettingsStateMotorSoftwareVersionChangedCallb
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -7928,6 +8396,12 @@ void ARCONTROLLER_FEATURE_ARDrone3_SettingsStateMotorFlightsStatusChangedCallbac
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -8011,6 +8485,12 @@ void ARCONTROLLER_FEATURE_ARDrone3_SettingsStateMotorErrorLastErrorChangedCallba
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -8094,6 +8574,12 @@ void ARCONTROLLER_FEATURE_ARDrone3_SettingsStateP7IDCallback (char * _serialID,
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -8177,6 +8663,12 @@ void ARCONTROLLER_FEATURE_ARDrone3_SettingsStateCPUIDCallback (char * _id, void
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -8260,6 +8752,12 @@ void ARCONTROLLER_FEATURE_ARDrone3_PictureSettingsStatePictureFormatChangedCallb
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -8343,6 +8841,12 @@ void ARCONTROLLER_FEATURE_ARDrone3_PictureSettingsStateAutoWhiteBalanceChangedCa
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -8426,6 +8930,12 @@ void ARCONTROLLER_FEATURE_ARDrone3_PictureSettingsStateExpositionChangedCallback
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -8509,6 +9019,12 @@ void ARCONTROLLER_FEATURE_ARDrone3_PictureSettingsStateSaturationChangedCallback
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -8592,6 +9108,12 @@ void ARCONTROLLER_FEATURE_ARDrone3_PictureSettingsStateTimelapseChangedCallback
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -8675,6 +9197,12 @@ void ARCONTROLLER_FEATURE_ARDrone3_PictureSettingsStateVideoAutorecordChangedCal
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -8758,6 +9286,12 @@ void ARCONTROLLER_FEATURE_ARDrone3_PictureSettingsStateVideoStabilizationModeCha
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -8841,6 +9375,12 @@ void ARCONTROLLER_FEATURE_ARDrone3_PictureSettingsStateVideoRecordingModeChanged
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -8924,6 +9464,12 @@ void ARCONTROLLER_FEATURE_ARDrone3_PictureSettingsStateVideoFramerateChangedCall
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -9007,6 +9553,12 @@ void ARCONTROLLER_FEATURE_ARDrone3_PictureSettingsStateVideoResolutionsChangedCa
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -9090,6 +9642,12 @@ void ARCONTROLLER_FEATURE_ARDrone3_MediaStreamingStateVideoEnableChangedCallback
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -9173,6 +9731,12 @@ void ARCONTROLLER_FEATURE_ARDrone3_MediaStreamingStateVideoStreamModeChangedCall
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -9256,6 +9820,12 @@ void ARCONTROLLER_FEATURE_ARDrone3_GPSSettingsStateHomeChangedCallback (double _
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -9339,6 +9909,12 @@ void ARCONTROLLER_FEATURE_ARDrone3_GPSSettingsStateResetHomeChangedCallback (dou
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -9422,6 +9998,12 @@ void ARCONTROLLER_FEATURE_ARDrone3_GPSSettingsStateGPSFixStateChangedCallback (u
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -9505,6 +10087,12 @@ void ARCONTROLLER_FEATURE_ARDrone3_GPSSettingsStateGPSUpdateStateChangedCallback
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -9588,6 +10176,12 @@ void ARCONTROLLER_FEATURE_ARDrone3_GPSSettingsStateHomeTypeChangedCallback (eARC
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -9671,6 +10265,12 @@ void ARCONTROLLER_FEATURE_ARDrone3_GPSSettingsStateReturnHomeDelayChangedCallbac
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -9747,6 +10347,8 @@ void ARCONTROLLER_FEATURE_ARDrone3_CameraStateOrientationCallback (int8_t _tilt,
     int isANewCommandElement = 0;
     int elementAdded = 0;
     ARCONTROLLER_DICTIONARY_ELEMENT_t *newElement = NULL;
+    int elementUpdated = 0;
+    ARCONTROLLER_DICTIONARY_ARG_t values[2];
     // Check parameters
     if ((feature == NULL) || (feature->privatePart == NULL))
     {
@@ -9758,7 +10360,36 @@ void ARCONTROLLER_FEATURE_ARDrone3_CameraStateOrientationCallback (int8_t _tilt,
     {
         // Find command elements
         ARSAL_Mutex_Lock (&(feature->privatePart->mutex));
+        
+        // Update the typed snapshot
+        ARCONTROLLER_Telemetry_WriteBegin (&(feature->privatePart->telemetryLock));
+        feature->privatePart->telemetry.tilt = _tilt;
+        feature->privatePart->telemetry.pan = _pan;
+        feature->privatePart->telemetry.cameraOrientationSequence++;
+        ARCONTROLLER_Telemetry_WriteEnd (&(feature->privatePart->telemetryLock));
+        
+        if (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey))
+        {
+            // No subscriber: only the typed snapshot is updated
+            ARSAL_Mutex_Unlock (&(feature->privatePart->mutex));
+            return;
+        }
+        
         HASH_FIND_INT (feature->privatePart->dictionary, &commandKey, dictCmdElement);
+        
+        if (dictCmdElement != NULL)
+        {
+            // Periodic state: overwrite the previous values instead of allocating a new element
+            values[0].argument = ARCONTROLLER_DICTIONARY_KEY_ARDRONE3_CAMERASTATE_ORIENTATION_TILT;
+            values[0].valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_I8;
+            values[0].value.I8 = _tilt;
+            values[1].argument = ARCONTROLLER_DICTIONARY_KEY_ARDRONE3_CAMERASTATE_ORIENTATION_PAN;
+            values[1].valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_I8;
+            values[1].value.I8 = _pan;
+            
+            elementUpdated = ARCONTROLLER_Feature_UpdateSingleElement (dictCmdElement, values, 2);
+        }
+        
         ARSAL_Mutex_Unlock (&(feature->privatePart->mutex));
         
         if (dictCmdElement == NULL)
@@ -9771,14 +10402,14 @@ void ARCONTROLLER_FEATURE_ARDrone3_CameraStateOrientationCallback (int8_t _tilt,
         
     }
     
-    if (error == ARCONTROLLER_OK)
+    if ((error == ARCONTROLLER_OK) && (!elementUpdated))
     {
         //Create new element
         newElement = ARCONTROLLER_ARDrone3_NewCmdElementCameraStateOrientation (feature,  _tilt,  _pan, &error);
     }
     
     //Set new element in CommandElements 
-    if (error == ARCONTROLLER_OK)
+    if ((error == ARCONTROLLER_OK) && (!elementUpdated))
     {
         ARSAL_Mutex_Lock (&(feature->privatePart->mutex));
         
@@ -9837,6 +10468,12 @@ void ARCONTROLLER_FEATURE_ARDrone3_CameraStateDefaultCameraOrientationCallback (
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -9920,6 +10557,12 @@ void ARCONTROLLER_FEATURE_ARDrone3_AntiflickeringStateElectricFrequencyChangedCa
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -10003,6 +10646,12 @@ void ARCONTROLLER_FEATURE_ARDrone3_AntiflickeringStateModeChangedCallback (eARCO
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -10086,6 +10735,12 @@ void ARCONTROLLER_FEATURE_ARDrone3_GPSStateNumberOfSatelliteChangedCallback (uin
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -10169,6 +10824,12 @@ void ARCONTROLLER_FEATURE_ARDrone3_GPSStateHomeTypeAvailabilityChangedCallback (
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -10252,6 +10913,12 @@ void ARCONTROLLER_FEATURE_ARDrone3_GPSStateHomeTypeChosenChangedCallback (eARCOM
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -10335,6 +11002,12 @@ void ARCONTROLLER_FEATURE_ARDrone3_PROStateFeaturesCallback (uint64_t _features,
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -10420,7 +11093,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementMediaRecor
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -10436,7 +11109,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementMediaRecor
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -10453,7 +11126,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementMediaRecor
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -10472,7 +11145,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementMediaRecor
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -10495,21 +11168,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementMediaRecor
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -10542,7 +11214,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementMediaRecor
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -10558,7 +11230,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementMediaRecor
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -10575,7 +11247,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementMediaRecor
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -10594,7 +11266,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementMediaRecor
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -10617,21 +11289,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementMediaRecor
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -10664,7 +11335,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementMediaRecor
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -10680,7 +11351,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementMediaRecor
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -10697,7 +11368,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementMediaRecor
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -10716,7 +11387,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementMediaRecor
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -10739,21 +11410,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementMediaRecor
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -10786,7 +11456,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementMediaRecor
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -10802,7 +11472,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementMediaRecor
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -10819,7 +11489,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementMediaRecor
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -10838,7 +11508,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementMediaRecor
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -10861,21 +11531,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementMediaRecor
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -10908,7 +11577,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementMediaRecor
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -10924,7 +11593,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementMediaRecor
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -10941,7 +11610,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementMediaRecor
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -10960,7 +11629,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementMediaRecor
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -10983,21 +11652,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementMediaRecor
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -11030,7 +11698,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementMediaRecor
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -11046,7 +11714,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementMediaRecor
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -11063,7 +11731,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementMediaRecor
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -11082,7 +11750,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementMediaRecor
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -11105,21 +11773,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementMediaRecor
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -11152,7 +11819,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementMediaRecor
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -11168,7 +11835,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementMediaRecor
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -11185,7 +11852,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementMediaRecor
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -11204,7 +11871,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementMediaRecor
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -11227,21 +11894,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementMediaRecor
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -11273,7 +11939,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSt
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -11289,7 +11955,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSt
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -11310,17 +11976,16 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSt
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
     }
@@ -11354,7 +12019,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSt
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -11370,7 +12035,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSt
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -11387,7 +12052,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSt
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -11410,21 +12075,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSt
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -11457,7 +12121,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSt
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -11473,7 +12137,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSt
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -11490,7 +12154,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSt
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -11513,21 +12177,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSt
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -11560,7 +12223,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSt
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -11576,7 +12239,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSt
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -11593,7 +12256,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSt
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -11612,7 +12275,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSt
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -11635,21 +12298,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSt
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -11682,7 +12344,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSt
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -11698,7 +12360,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSt
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -11715,7 +12377,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSt
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_DOUBLE;
@@ -11734,7 +12396,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSt
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_DOUBLE;
@@ -11753,7 +12415,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSt
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_DOUBLE;
@@ -11776,21 +12438,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSt
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -11823,7 +12484,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSt
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -11839,7 +12500,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSt
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -11856,7 +12517,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSt
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -11875,7 +12536,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSt
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -11894,7 +12555,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSt
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -11917,21 +12578,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSt
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -11964,7 +12624,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSt
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -11980,7 +12640,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSt
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -11997,7 +12657,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSt
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -12016,7 +12676,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSt
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -12035,7 +12695,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSt
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -12058,21 +12718,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSt
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -12105,7 +12764,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSt
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -12121,7 +12780,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSt
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -12138,7 +12797,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSt
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -12161,21 +12820,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSt
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -12208,7 +12866,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSt
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -12224,7 +12882,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSt
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -12241,7 +12899,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSt
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_DOUBLE;
@@ -12264,21 +12922,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSt
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -12311,7 +12968,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSt
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -12327,7 +12984,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSt
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -12344,7 +13001,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSt
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_DOUBLE;
@@ -12363,7 +13020,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSt
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_DOUBLE;
@@ -12382,7 +13039,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSt
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_DOUBLE;
@@ -12401,7 +13058,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSt
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_I8;
@@ -12420,7 +13077,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSt
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_I8;
@@ -12439,7 +13096,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSt
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_I8;
@@ -12462,21 +13119,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSt
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -12509,7 +13165,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSt
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -12525,7 +13181,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSt
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -12542,7 +13198,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSt
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -12565,21 +13221,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSt
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -12612,7 +13267,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingEv
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -12628,7 +13283,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingEv
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -12645,7 +13300,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingEv
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -12664,7 +13319,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingEv
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -12683,7 +13338,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingEv
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -12702,7 +13357,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingEv
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -12721,7 +13376,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingEv
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -12744,21 +13399,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingEv
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -12792,7 +13446,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementNetworkSta
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -12808,7 +13462,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementNetworkSta
     {
         //Alloc Element Key
         elementKeyLength = strlen (_ssid);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, _ssid, (elementKeyLength + 1));
@@ -12825,7 +13479,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementNetworkSta
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_STRING;
@@ -12857,7 +13511,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementNetworkSta
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_I16;
@@ -12876,7 +13530,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementNetworkSta
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -12895,7 +13549,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementNetworkSta
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -12924,21 +13578,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementNetworkSta
                     newElement->arguments->value.String = NULL;
                 }
                 
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -12970,7 +13623,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementNetworkSta
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -12986,7 +13639,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementNetworkSta
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -13007,17 +13660,16 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementNetworkSta
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
     }
@@ -13051,7 +13703,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementNetworkSta
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -13069,7 +13721,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementNetworkSta
         
         //Alloc Element Key
         elementKeyLength = snprintf (NULL, 0, "%d", listIndex);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             snprintf (newElement->key, (elementKeyLength + 1), "%d", listIndex);
@@ -13088,7 +13740,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementNetworkSta
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -13107,7 +13759,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementNetworkSta
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -13126,7 +13778,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementNetworkSta
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -13149,21 +13801,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementNetworkSta
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -13195,7 +13846,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementNetworkSta
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -13211,7 +13862,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementNetworkSta
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -13232,17 +13883,16 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementNetworkSta
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
     }
@@ -13276,7 +13926,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSe
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -13292,7 +13942,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSe
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -13309,7 +13959,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSe
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -13328,7 +13978,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSe
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -13347,7 +13997,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSe
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -13370,21 +14020,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSe
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -13417,7 +14066,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSe
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -13433,7 +14082,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSe
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -13450,7 +14099,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSe
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -13469,7 +14118,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSe
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -13488,7 +14137,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSe
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -13511,21 +14160,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSe
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -13558,7 +14206,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSe
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -13574,7 +14222,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSe
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -13591,7 +14239,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSe
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -13614,21 +14262,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSe
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -13661,7 +14308,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSe
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -13677,7 +14324,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSe
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -13694,7 +14341,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSe
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -13713,7 +14360,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSe
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -13732,7 +14379,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSe
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -13755,21 +14402,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSe
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -13802,7 +14448,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSe
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -13818,7 +14464,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSe
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -13835,7 +14481,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSe
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -13858,21 +14504,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSe
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -13905,7 +14550,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSe
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -13921,7 +14566,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSe
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -13938,7 +14583,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSe
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -13961,21 +14606,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSe
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -14008,7 +14652,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSe
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -14024,7 +14668,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSe
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -14041,7 +14685,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSe
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -14064,21 +14708,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSe
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -14111,7 +14754,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSe
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -14127,7 +14770,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSe
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -14144,7 +14787,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSe
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -14167,21 +14810,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSe
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -14214,7 +14856,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSe
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -14230,7 +14872,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSe
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -14247,7 +14889,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSe
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -14270,21 +14912,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSe
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -14317,7 +14958,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSe
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -14333,7 +14974,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSe
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -14350,7 +14991,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSe
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -14373,21 +15014,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSe
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -14420,7 +15060,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSe
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -14436,7 +15076,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSe
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -14453,7 +15093,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSe
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -14476,21 +15116,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSe
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -14523,7 +15162,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSe
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -14539,7 +15178,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSe
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -14556,7 +15195,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSe
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -14575,7 +15214,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSe
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -14594,7 +15233,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSe
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -14617,21 +15256,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSe
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -14664,7 +15302,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSe
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -14680,7 +15318,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSe
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -14697,7 +15335,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSe
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -14720,21 +15358,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSe
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -14767,7 +15404,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSe
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -14783,7 +15420,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSe
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -14800,7 +15437,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSe
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U16;
@@ -14819,7 +15456,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSe
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U16;
@@ -14838,7 +15475,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSe
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U16;
@@ -14861,21 +15498,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSe
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -14908,7 +15544,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSe
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -14924,7 +15560,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSe
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -14941,7 +15577,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSe
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U16;
@@ -14960,7 +15596,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSe
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U16;
@@ -14979,7 +15615,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSe
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U16;
@@ -15002,21 +15638,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSe
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -15049,7 +15684,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSe
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -15065,7 +15700,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSe
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -15082,7 +15717,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSe
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -15105,21 +15740,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPilotingSe
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -15152,7 +15786,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementSpeedSetti
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -15168,7 +15802,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementSpeedSetti
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -15185,7 +15819,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementSpeedSetti
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -15204,7 +15838,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementSpeedSetti
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -15223,7 +15857,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementSpeedSetti
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -15246,21 +15880,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementSpeedSetti
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -15293,7 +15926,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementSpeedSetti
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -15309,7 +15942,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementSpeedSetti
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -15326,7 +15959,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementSpeedSetti
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -15345,7 +15978,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementSpeedSetti
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -15364,7 +15997,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementSpeedSetti
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -15387,21 +16020,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementSpeedSetti
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -15434,7 +16066,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementSpeedSetti
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -15450,7 +16082,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementSpeedSetti
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -15467,7 +16099,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementSpeedSetti
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -15490,21 +16122,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementSpeedSetti
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -15537,7 +16168,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementSpeedSetti
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -15553,7 +16184,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementSpeedSetti
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -15570,7 +16201,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementSpeedSetti
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -15593,21 +16224,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementSpeedSetti
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -15640,7 +16270,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementSpeedSetti
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -15656,7 +16286,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementSpeedSetti
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -15673,7 +16303,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementSpeedSetti
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -15692,7 +16322,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementSpeedSetti
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -15711,7 +16341,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementSpeedSetti
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -15734,21 +16364,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementSpeedSetti
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -15781,7 +16410,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementNetworkSet
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -15797,7 +16426,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementNetworkSet
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -15814,7 +16443,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementNetworkSet
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -15833,7 +16462,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementNetworkSet
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -15852,7 +16481,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementNetworkSet
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -15875,21 +16504,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementNetworkSet
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -15922,7 +16550,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementNetworkSet
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -15938,7 +16566,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementNetworkSet
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -15955,7 +16583,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementNetworkSet
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -15978,21 +16606,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementNetworkSet
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -16026,7 +16653,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementNetworkSet
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -16042,7 +16669,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementNetworkSet
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -16059,7 +16686,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementNetworkSet
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -16078,7 +16705,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementNetworkSet
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_STRING;
@@ -16110,7 +16737,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementNetworkSet
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -16139,21 +16766,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementNetworkSet
                     newElement->arguments->value.String = NULL;
                 }
                 
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -16187,7 +16813,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementSettingsSt
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -16203,7 +16829,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementSettingsSt
     {
         //Alloc Element Key
         elementKeyLength = snprintf (NULL, 0, "%"PRIu8, _motor_number);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             snprintf (newElement->key, (elementKeyLength + 1), "%"PRIu8, _motor_number);
@@ -16220,7 +16846,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementSettingsSt
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -16239,7 +16865,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementSettingsSt
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_STRING;
@@ -16271,7 +16897,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementSettingsSt
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_STRING;
@@ -16303,7 +16929,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementSettingsSt
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_STRING;
@@ -16357,21 +16983,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementSettingsSt
                     newElement->arguments->value.String = NULL;
                 }
                 
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -16405,7 +17030,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementSettingsSt
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -16421,7 +17046,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementSettingsSt
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -16438,7 +17063,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementSettingsSt
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_STRING;
@@ -16470,7 +17095,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementSettingsSt
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_STRING;
@@ -16518,21 +17143,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementSettingsSt
                     newElement->arguments->value.String = NULL;
                 }
                 
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -16565,7 +17189,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementSettingsSt
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -16581,7 +17205,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementSettingsSt
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -16598,7 +17222,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementSettingsSt
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -16617,7 +17241,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementSettingsSt
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -16640,21 +17264,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementSettingsSt
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -16688,7 +17311,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementSettingsSt
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -16704,7 +17327,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementSettingsSt
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -16721,7 +17344,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementSettingsSt
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_STRING;
@@ -16763,21 +17386,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementSettingsSt
                     newElement->arguments->value.String = NULL;
                 }
                 
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -16810,7 +17432,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementSettingsSt
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -16826,7 +17448,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementSettingsSt
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -16843,7 +17465,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementSettingsSt
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U16;
@@ -16862,7 +17484,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementSettingsSt
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U16;
@@ -16881,7 +17503,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementSettingsSt
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U32;
@@ -16904,21 +17526,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementSettingsSt
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -16951,7 +17572,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementSettingsSt
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -16967,7 +17588,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementSettingsSt
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -16984,7 +17605,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementSettingsSt
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -17007,21 +17628,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementSettingsSt
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -17055,7 +17675,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementSettingsSt
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -17071,7 +17691,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementSettingsSt
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -17088,7 +17708,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementSettingsSt
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_STRING;
@@ -17130,21 +17750,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementSettingsSt
                     newElement->arguments->value.String = NULL;
                 }
                 
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -17178,7 +17797,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementSettingsSt
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -17194,7 +17813,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementSettingsSt
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -17211,7 +17830,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementSettingsSt
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_STRING;
@@ -17253,21 +17872,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementSettingsSt
                     newElement->arguments->value.String = NULL;
                 }
                 
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -17300,7 +17918,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPictureSet
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -17316,7 +17934,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPictureSet
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -17333,7 +17951,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPictureSet
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -17356,21 +17974,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPictureSet
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -17403,7 +18020,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPictureSet
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -17419,7 +18036,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPictureSet
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -17436,7 +18053,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPictureSet
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -17459,21 +18076,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPictureSet
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -17506,7 +18122,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPictureSet
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -17522,7 +18138,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPictureSet
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -17539,7 +18155,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPictureSet
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -17558,7 +18174,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPictureSet
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -17577,7 +18193,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPictureSet
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -17600,21 +18216,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPictureSet
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -17647,7 +18262,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPictureSet
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -17663,7 +18278,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPictureSet
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -17680,7 +18295,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPictureSet
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -17699,7 +18314,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPictureSet
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -17718,7 +18333,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPictureSet
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -17741,21 +18356,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPictureSet
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -17788,7 +18402,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPictureSet
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -17804,7 +18418,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPictureSet
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -17821,7 +18435,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPictureSet
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -17840,7 +18454,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPictureSet
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -17859,7 +18473,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPictureSet
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -17878,7 +18492,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPictureSet
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -17901,21 +18515,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPictureSet
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -17948,7 +18561,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPictureSet
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -17964,7 +18577,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPictureSet
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -17981,7 +18594,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPictureSet
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -18000,7 +18613,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPictureSet
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -18023,21 +18636,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPictureSet
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -18070,7 +18682,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPictureSet
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -18086,7 +18698,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPictureSet
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -18103,7 +18715,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPictureSet
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -18126,21 +18738,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPictureSet
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -18173,7 +18784,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPictureSet
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -18189,7 +18800,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPictureSet
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -18206,7 +18817,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPictureSet
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -18229,21 +18840,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPictureSet
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -18276,7 +18886,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPictureSet
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -18292,7 +18902,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPictureSet
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -18309,7 +18919,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPictureSet
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -18332,21 +18942,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPictureSet
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -18379,7 +18988,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPictureSet
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -18395,7 +19004,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPictureSet
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -18412,7 +19021,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPictureSet
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -18435,21 +19044,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPictureSet
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -18482,7 +19090,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementMediaStrea
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -18498,7 +19106,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementMediaStrea
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -18515,7 +19123,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementMediaStrea
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -18538,21 +19146,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementMediaStrea
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -18585,7 +19192,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementMediaStrea
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -18601,7 +19208,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementMediaStrea
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -18618,7 +19225,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementMediaStrea
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -18641,21 +19248,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementMediaStrea
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -18688,7 +19294,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementGPSSetting
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -18704,7 +19310,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementGPSSetting
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -18721,7 +19327,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementGPSSetting
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_DOUBLE;
@@ -18740,7 +19346,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementGPSSetting
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_DOUBLE;
@@ -18759,7 +19365,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementGPSSetting
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_DOUBLE;
@@ -18782,21 +19388,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementGPSSetting
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -18829,7 +19434,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementGPSSetting
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -18845,7 +19450,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementGPSSetting
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -18862,7 +19467,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementGPSSetting
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_DOUBLE;
@@ -18881,7 +19486,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementGPSSetting
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_DOUBLE;
@@ -18900,7 +19505,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementGPSSetting
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_DOUBLE;
@@ -18923,21 +19528,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementGPSSetting
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -18970,7 +19574,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementGPSSetting
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -18986,7 +19590,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementGPSSetting
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -19003,7 +19607,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementGPSSetting
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -19026,21 +19630,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementGPSSetting
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -19073,7 +19676,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementGPSSetting
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -19089,7 +19692,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementGPSSetting
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -19106,7 +19709,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementGPSSetting
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -19129,21 +19732,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementGPSSetting
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -19176,7 +19778,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementGPSSetting
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -19192,7 +19794,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementGPSSetting
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -19209,7 +19811,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementGPSSetting
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -19232,21 +19834,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementGPSSetting
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -19279,7 +19880,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementGPSSetting
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -19295,7 +19896,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementGPSSetting
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -19312,7 +19913,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementGPSSetting
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U16;
@@ -19335,21 +19936,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementGPSSetting
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -19382,7 +19982,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementCameraStat
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -19398,7 +19998,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementCameraStat
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -19415,7 +20015,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementCameraStat
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_I8;
@@ -19434,7 +20034,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementCameraStat
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_I8;
@@ -19457,21 +20057,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementCameraStat
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -19504,7 +20103,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementCameraStat
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -19520,7 +20119,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementCameraStat
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -19537,7 +20136,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementCameraStat
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_I8;
@@ -19556,7 +20155,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementCameraStat
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_I8;
@@ -19579,21 +20178,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementCameraStat
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -19626,7 +20224,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementAntiflicke
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -19642,7 +20240,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementAntiflicke
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -19659,7 +20257,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementAntiflicke
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -19682,21 +20280,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementAntiflicke
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -19729,7 +20326,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementAntiflicke
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -19745,7 +20342,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementAntiflicke
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -19762,7 +20359,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementAntiflicke
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -19785,21 +20382,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementAntiflicke
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -19832,7 +20428,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementGPSStateNu
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -19848,7 +20444,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementGPSStateNu
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -19865,7 +20461,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementGPSStateNu
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -19888,21 +20484,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementGPSStateNu
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -19935,7 +20530,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementGPSStateHo
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -19951,7 +20546,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementGPSStateHo
     {
         //Alloc Element Key
         elementKeyLength = snprintf (NULL, 0, "%d", _type);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             snprintf (newElement->key, (elementKeyLength + 1), "%d", _type);
@@ -19968,7 +20563,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementGPSStateHo
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -19987,7 +20582,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementGPSStateHo
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -20010,21 +20605,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementGPSStateHo
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -20057,7 +20651,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementGPSStateHo
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -20073,7 +20667,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementGPSStateHo
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -20090,7 +20684,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementGPSStateHo
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -20113,21 +20707,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementGPSStateHo
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -20160,7 +20753,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPROStateFe
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -20176,7 +20769,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPROStateFe
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -20193,7 +20786,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPROStateFe
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U64;
@@ -20216,21 +20809,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_NewCmdElementPROStateFe
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -20264,6 +20856,27 @@ eARCONTROLLER_ERROR ARCONTROLLER_FEATURE_ARDrone3_SetNetworkController (ARCONTRO
     return error;
 }
 
+eARCONTROLLER_ERROR ARCONTROLLER_FEATURE_ARDrone3_SetSubscribedKeys (ARCONTROLLER_FEATURE_ARDrone3_t *feature, const uint8_t *subscribedKeys)
+{
+    // -- Set the commands of which the elements are built. --
+    
+    eARCONTROLLER_ERROR error = ARCONTROLLER_OK;
+    
+    // Check parameters
+    if ((feature == NULL) || (feature->privatePart == NULL))
+    {
+        error = ARCONTROLLER_ERROR_BAD_PARAMETER;
+    }
+    // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
+    
+    if (error == ARCONTROLLER_OK)
+    {
+        feature->privatePart->subscribedKeys = subscribedKeys;
+    }
+    
+    return error;
+}
+
 ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ARDrone3_GetCommandElements (ARCONTROLLER_FEATURE_ARDrone3_t *feature, eARCONTROLLER_DICTIONARY_KEY commandKey, eARCONTROLLER_ERROR *error)
 {
     // -- Get Command Arguments --
@@ -20527,6 +21140,9 @@ ARCONTROLLER_FEATURE_Common_t *ARCONTROLLER_FEATURE_Common_New (ARCONTROLLER_Net
             featureController->privatePart->networkController = networkController;
             featureController->privatePart->dictionary = NULL;
             featureController->privatePart->commandCallbacks = NULL;
+            featureController->privatePart->subscribedKeys = NULL;
+            ARCONTROLLER_Telemetry_InitSeqlock (&(featureController->privatePart->telemetryLock));
+            memset (&(featureController->privatePart->telemetry), 0, sizeof (ARCONTROLLER_TELEMETRY_COMMON_t));
             // Create the mutex 
             if (ARSAL_Mutex_Init (&(featureController->privatePart->mutex)) != 0)
             {
@@ -21770,6 +22386,12 @@ void ARCONTROLLER_FEATURE_Common_NetworkEventDisconnectionCallback (eARCOMMANDS_
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -21853,6 +22475,12 @@ void ARCONTROLLER_FEATURE_Common_SettingsStateAllSettingsChangedCallback (void *
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -21936,6 +22564,12 @@ void ARCONTROLLER_FEATURE_Common_SettingsStateResetChangedCallback (void *custom
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -22019,6 +22653,12 @@ void ARCONTROLLER_FEATURE_Common_SettingsStateProductNameChangedCallback (char *
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -22102,6 +22742,12 @@ void ARCONTROLLER_FEATURE_Common_SettingsStateProductVersionChangedCallback (cha
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -22185,6 +22831,12 @@ void ARCONTROLLER_FEATURE_Common_SettingsStateProductSerialHighChangedCallback (
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -22268,6 +22920,12 @@ void ARCONTROLLER_FEATURE_Common_SettingsStateProductSerialLowChangedCallback (c
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -22351,6 +23009,12 @@ void ARCONTROLLER_FEATURE_Common_SettingsStateCountryChangedCallback (char * _co
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -22434,6 +23098,12 @@ void ARCONTROLLER_FEATURE_Common_SettingsStateAutoCountryChangedCallback (uint8_
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -22517,6 +23187,12 @@ void ARCONTROLLER_FEATURE_Common_CommonStateAllStatesChangedCallback (void *cust
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -22604,6 +23280,20 @@ void ARCONTROLLER_FEATURE_Common_CommonStateBatteryStateChangedCallback (uint8_t
     {
         // Find command elements
         ARSAL_Mutex_Lock (&(feature->privatePart->mutex));
+        
+        // Update the typed snapshot
+        ARCONTROLLER_Telemetry_WriteBegin (&(feature->privatePart->telemetryLock));
+        feature->privatePart->telemetry.batteryPercent = _percent;
+        feature->privatePart->telemetry.batterySequence++;
+        ARCONTROLLER_Telemetry_WriteEnd (&(feature->privatePart->telemetryLock));
+        
+        if (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey))
+        {
+            // No subscriber: only the typed snapshot is updated
+            ARSAL_Mutex_Unlock (&(feature->privatePart->mutex));
+            return;
+        }
+        
         HASH_FIND_INT (feature->privatePart->dictionary, &commandKey, dictCmdElement);
         ARSAL_Mutex_Unlock (&(feature->privatePart->mutex));
         
@@ -22683,6 +23373,12 @@ void ARCONTROLLER_FEATURE_Common_CommonStateMassStorageStateListChangedCallback
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -22766,6 +23462,12 @@ void ARCONTROLLER_FEATURE_Common_CommonStateMassStorageInfoStateListChangedCallb
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -22849,6 +23551,12 @@ void ARCONTROLLER_FEATURE_Common_CommonStateCurrentDateChangedCallback (char * _
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -22932,6 +23640,12 @@ void ARCONTROLLER_FEATURE_Common_CommonStateCurrentTimeChangedCallback (char * _
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -23016,6 +23730,12 @@ void ARCONTROLLER_FEATURE_Common_CommonStateMassStorageInfoRemainingListChangedC
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -23104,6 +23824,12 @@ void ARCONTROLLER_FEATURE_Common_CommonStateWifiSignalChangedCallback (int16_t _
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -23187,6 +23913,12 @@ void ARCONTROLLER_FEATURE_Common_CommonStateSensorsStatesListChangedCallback (eA
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -23270,6 +24002,12 @@ void ARCONTROLLER_FEATURE_Common_CommonStateProductModelCallback (eARCOMMANDS_CO
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -23354,6 +24092,12 @@ void ARCONTROLLER_FEATURE_Common_CommonStateCountryListKnownCallback (uint8_t _l
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -23442,6 +24186,12 @@ void ARCONTROLLER_FEATURE_Common_CommonStateDeprecatedMassStorageContentChangedC
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -23525,6 +24275,12 @@ void ARCONTROLLER_FEATURE_Common_CommonStateMassStorageContentCallback (uint8_t
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -23608,6 +24364,12 @@ void ARCONTROLLER_FEATURE_Common_CommonStateMassStorageContentForCurrentRunCallb
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -23691,6 +24453,12 @@ void ARCONTROLLER_FEATURE_Common_OverHeatStateOverHeatChangedCallback (void *cus
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -23774,6 +24542,12 @@ void ARCONTROLLER_FEATURE_Common_OverHeatStateOverHeatRegulationChangedCallback
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -23857,6 +24631,12 @@ void ARCONTROLLER_FEATURE_Common_WifiSettingsStateOutdoorSettingsChangedCallback
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -23940,88 +24720,11 @@ void ARCONTROLLER_FEATURE_Common_MavlinkStateMavlinkFilePlayingStateChangedCallb
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
-    if (error == ARCONTROLLER_OK)
-    {
-        // Find command elements
-        ARSAL_Mutex_Lock (&(feature->privatePart->mutex));
-        HASH_FIND_INT (feature->privatePart->dictionary, &commandKey, dictCmdElement);
-        ARSAL_Mutex_Unlock (&(feature->privatePart->mutex));
-        
-        if (dictCmdElement == NULL)
-        {
-            // New command element
-            isANewCommandElement = 1;
-            dictCmdElement = ARCONTROLLER_Feature_NewCommandsElement (commandKey, &error);
-        }
-        // No Else ; commandElement already exists.
-        
-    }
-    
-    if (error == ARCONTROLLER_OK)
-    {
-        //Create new element
-        newElement = ARCONTROLLER_Common_NewCmdElementMavlinkStateMavlinkFilePlayingStateChanged (feature,  _state,  _filepath,  _type, &error);
-    }
-    
-    //Set new element in CommandElements 
-    if (error == ARCONTROLLER_OK)
-    {
-        ARSAL_Mutex_Lock (&(feature->privatePart->mutex));
-        
-        ARCONTROLLER_Feature_AddElement (&(dictCmdElement->elements), newElement);
-        
-        //Add new commandElement if necessary
-        if (isANewCommandElement)
-        {
-            HASH_ADD_INT (feature->privatePart->dictionary, command, dictCmdElement);
-        }
-        
-        elementAdded = 1;
-        
-        ARSAL_Mutex_Unlock (&(feature->privatePart->mutex));
-    }
-    
-    if (error == ARCONTROLLER_OK)
-    {
-        // Notification Callback
-        error = ARCONTROLLER_Dictionary_Notify (feature->privatePart->commandCallbacks, dictCmdElement->command, dictCmdElement->elements);
-    }
-    
-    // if an error occurred 
-    if (error != ARCONTROLLER_OK)
-    {
-        // cleanup
-        if ((dictCmdElement != NULL) && (isANewCommandElement))
-        {
-            ARCONTROLLER_Feature_DeleteCommandsElement(&dictCmdElement);
-        }
-        
-        if ((newElement != NULL) && (!elementAdded ))
-        {
-            ARCONTROLLER_Feature_DeleteElement (&newElement);
-        }
-        
-    }
-    
-}
-
-void ARCONTROLLER_FEATURE_Common_MavlinkStateMavlinkPlayErrorStateChangedCallback (eARCOMMANDS_COMMON_MAVLINKSTATE_MAVLINKPLAYERRORSTATECHANGED_ERROR _error, void *customData)
-{
-    // -- callback used when the command <code>MavlinkStateMavlinkPlayErrorStateChanged</code> is decoded -- 
-    
-    ARCONTROLLER_FEATURE_Common_t *feature = (ARCONTROLLER_FEATURE_Common_t *)customData;
-    eARCONTROLLER_ERROR error = ARCONTROLLER_OK;
-    int commandKey = ARCONTROLLER_DICTIONARY_KEY_COMMON_MAVLINKSTATE_MAVLINKPLAYERRORSTATECHANGED;
-    ARCONTROLLER_DICTIONARY_COMMANDS_t *dictCmdElement = NULL;
-    int isANewCommandElement = 0;
-    int elementAdded = 0;
-    ARCONTROLLER_DICTIONARY_ELEMENT_t *newElement = NULL;
-    // Check parameters
-    if ((feature == NULL) || (feature->privatePart == NULL))
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
     {
-        error = ARCONTROLLER_ERROR_BAD_PARAMETER;
+        // No subscriber: the elements of the command are not built
+        return;
     }
-    // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
     if (error == ARCONTROLLER_OK)
     {
@@ -24043,7 +24746,96 @@ void ARCONTROLLER_FEATURE_Common_MavlinkStateMavlinkPlayErrorStateChangedCallbac
     if (error == ARCONTROLLER_OK)
     {
         //Create new element
-        newElement = ARCONTROLLER_Common_NewCmdElementMavlinkStateMavlinkPlayErrorStateChanged (feature,  _error, &error);
+        newElement = ARCONTROLLER_Common_NewCmdElementMavlinkStateMavlinkFilePlayingStateChanged (feature,  _state,  _filepath,  _type, &error);
+    }
+    
+    //Set new element in CommandElements 
+    if (error == ARCONTROLLER_OK)
+    {
+        ARSAL_Mutex_Lock (&(feature->privatePart->mutex));
+        
+        ARCONTROLLER_Feature_AddElement (&(dictCmdElement->elements), newElement);
+        
+        //Add new commandElement if necessary
+        if (isANewCommandElement)
+        {
+            HASH_ADD_INT (feature->privatePart->dictionary, command, dictCmdElement);
+        }
+        
+        elementAdded = 1;
+        
+        ARSAL_Mutex_Unlock (&(feature->privatePart->mutex));
+    }
+    
+    if (error == ARCONTROLLER_OK)
+    {
+        // Notification Callback
+        error = ARCONTROLLER_Dictionary_Notify (feature->privatePart->commandCallbacks, dictCmdElement->command, dictCmdElement->elements);
+    }
+    
+    // if an error occurred 
+    if (error != ARCONTROLLER_OK)
+    {
+        // cleanup
+        if ((dictCmdElement != NULL) && (isANewCommandElement))
+        {
+            ARCONTROLLER_Feature_DeleteCommandsElement(&dictCmdElement);
+        }
+        
+        if ((newElement != NULL) && (!elementAdded ))
+        {
+            ARCONTROLLER_Feature_DeleteElement (&newElement);
+        }
+        
+    }
+    
+}
+
+void ARCONTROLLER_FEATURE_Common_MavlinkStateMavlinkPlayErrorStateChangedCallback (eARCOMMANDS_COMMON_MAVLINKSTATE_MAVLINKPLAYERRORSTATECHANGED_ERROR _error, void *customData)
+{
+    // -- callback used when the command <code>MavlinkStateMavlinkPlayErrorStateChanged</code> is decoded -- 
+    
+    ARCONTROLLER_FEATURE_Common_t *feature = (ARCONTROLLER_FEATURE_Common_t *)customData;
+    eARCONTROLLER_ERROR error = ARCONTROLLER_OK;
+    int commandKey = ARCONTROLLER_DICTIONARY_KEY_COMMON_MAVLINKSTATE_MAVLINKPLAYERRORSTATECHANGED;
+    ARCONTROLLER_DICTIONARY_COMMANDS_t *dictCmdElement = NULL;
+    int isANewCommandElement = 0;
+    int elementAdded = 0;
+    ARCONTROLLER_DICTIONARY_ELEMENT_t *newElement = NULL;
+    // Check parameters
+    if ((feature == NULL) || (feature->privatePart == NULL))
+    {
+        error = ARCONTROLLER_ERROR_BAD_PARAMETER;
+    }
+    // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
+    
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
+    if (error == ARCONTROLLER_OK)
+    {
+        // Find command elements
+        ARSAL_Mutex_Lock (&(feature->privatePart->mutex));
+        HASH_FIND_INT (feature->privatePart->dictionary, &commandKey, dictCmdElement);
+        ARSAL_Mutex_Unlock (&(feature->privatePart->mutex));
+        
+        if (dictCmdElement == NULL)
+        {
+            // New command element
+            isANewCommandElement = 1;
+            dictCmdElement = ARCONTROLLER_Feature_NewCommandsElement (commandKey, &error);
+        }
+        // No Else ; commandElement already exists.
+        
+    }
+    
+    if (error == ARCONTROLLER_OK)
+    {
+        //Create new element
+        newElement = ARCONTROLLER_Common_NewCmdElementMavlinkStateMavlinkPlayErrorStateChanged (feature,  _error, &error);
     }
     
     //Set new element in CommandElements 
@@ -24106,6 +24898,12 @@ void ARCONTROLLER_FEATURE_Common_CalibrationStateMagnetoCalibrationStateChangedC
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -24189,6 +24987,12 @@ void ARCONTROLLER_FEATURE_Common_CalibrationStateMagnetoCalibrationRequiredState
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -24272,6 +25076,12 @@ void ARCONTROLLER_FEATURE_Common_CalibrationStateMagnetoCalibrationAxisToCalibra
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -24355,6 +25165,12 @@ void ARCONTROLLER_FEATURE_Common_CalibrationStateMagnetoCalibrationStartedChange
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -24438,6 +25254,12 @@ void ARCONTROLLER_FEATURE_Common_CalibrationStatePitotCalibrationStateChangedCal
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -24521,6 +25343,12 @@ void ARCONTROLLER_FEATURE_Common_CameraSettingsStateCameraSettingsChangedCallbac
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -24604,6 +25432,12 @@ void ARCONTROLLER_FEATURE_Common_FlightPlanStateAvailabilityStateChangedCallback
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -24687,6 +25521,12 @@ void ARCONTROLLER_FEATURE_Common_FlightPlanStateComponentStateListChangedCallbac
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -24770,6 +25610,12 @@ void ARCONTROLLER_FEATURE_Common_FlightPlanStateLockStateChangedCallback (uint8_
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -24853,6 +25699,12 @@ void ARCONTROLLER_FEATURE_Common_FlightPlanEventStartingErrorEventCallback (void
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -24936,6 +25788,12 @@ void ARCONTROLLER_FEATURE_Common_FlightPlanEventSpeedBridleEventCallback (void *
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -25019,6 +25877,12 @@ void ARCONTROLLER_FEATURE_Common_ARLibsVersionsStateControllerLibARCommandsVersi
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -25102,6 +25966,12 @@ void ARCONTROLLER_FEATURE_Common_ARLibsVersionsStateSkyControllerLibARCommandsVe
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -25185,6 +26055,12 @@ void ARCONTROLLER_FEATURE_Common_ARLibsVersionsStateDeviceLibARCommandsVersionCa
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -25268,6 +26144,12 @@ void ARCONTROLLER_FEATURE_Common_AudioStateAudioStreamingRunningCallback (uint8_
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -25351,6 +26233,12 @@ void ARCONTROLLER_FEATURE_Common_HeadlightsStateIntensityChangedCallback (uint8_
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -25434,6 +26322,12 @@ void ARCONTROLLER_FEATURE_Common_AnimationsStateListCallback (eARCOMMANDS_COMMON
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -25517,6 +26411,12 @@ void ARCONTROLLER_FEATURE_Common_AccessoryStateSupportedAccessoriesListChangedCa
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -25600,6 +26500,12 @@ void ARCONTROLLER_FEATURE_Common_AccessoryStateAccessoryConfigChangedCallback (e
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -25683,6 +26589,12 @@ void ARCONTROLLER_FEATURE_Common_AccessoryStateAccessoryConfigModificationEnable
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -25766,6 +26678,12 @@ void ARCONTROLLER_FEATURE_Common_ChargerStateMaxChargeRateChangedCallback (eARCO
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -25849,6 +26767,12 @@ void ARCONTROLLER_FEATURE_Common_ChargerStateCurrentChargeStateChangedCallback (
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -25932,6 +26856,12 @@ void ARCONTROLLER_FEATURE_Common_ChargerStateLastChargeRateChangedCallback (eARC
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -26015,6 +26945,12 @@ void ARCONTROLLER_FEATURE_Common_ChargerStateChargingInfoCallback (eARCOMMANDS_C
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -26098,6 +27034,12 @@ void ARCONTROLLER_FEATURE_Common_RunStateRunIdChangedCallback (char * _runId, vo
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -26183,7 +27125,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementNetworkEvent
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -26199,7 +27141,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementNetworkEvent
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -26216,7 +27158,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementNetworkEvent
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -26239,21 +27181,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementNetworkEvent
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -26285,7 +27226,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementSettingsStat
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -26301,7 +27242,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementSettingsStat
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -26322,17 +27263,16 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementSettingsStat
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
     }
@@ -26365,7 +27305,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementSettingsStat
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -26381,7 +27321,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementSettingsStat
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -26402,17 +27342,16 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementSettingsStat
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
     }
@@ -26447,7 +27386,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementSettingsStat
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -26463,7 +27402,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementSettingsStat
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -26480,7 +27419,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementSettingsStat
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_STRING;
@@ -26522,21 +27461,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementSettingsStat
                     newElement->arguments->value.String = NULL;
                 }
                 
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -26570,7 +27508,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementSettingsStat
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -26586,7 +27524,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementSettingsStat
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -26603,7 +27541,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementSettingsStat
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_STRING;
@@ -26635,7 +27573,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementSettingsStat
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_STRING;
@@ -26683,21 +27621,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementSettingsStat
                     newElement->arguments->value.String = NULL;
                 }
                 
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -26731,7 +27668,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementSettingsStat
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -26747,7 +27684,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementSettingsStat
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -26764,7 +27701,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementSettingsStat
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_STRING;
@@ -26806,21 +27743,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementSettingsStat
                     newElement->arguments->value.String = NULL;
                 }
                 
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -26854,7 +27790,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementSettingsStat
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -26870,7 +27806,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementSettingsStat
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -26887,7 +27823,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementSettingsStat
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_STRING;
@@ -26929,21 +27865,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementSettingsStat
                     newElement->arguments->value.String = NULL;
                 }
                 
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -26977,7 +27912,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementSettingsStat
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -26993,7 +27928,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementSettingsStat
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -27010,7 +27945,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementSettingsStat
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_STRING;
@@ -27052,21 +27987,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementSettingsStat
                     newElement->arguments->value.String = NULL;
                 }
                 
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -27099,7 +28033,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementSettingsStat
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -27115,7 +28049,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementSettingsStat
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -27132,7 +28066,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementSettingsStat
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -27155,21 +28089,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementSettingsStat
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -27201,7 +28134,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCommonStateA
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -27217,7 +28150,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCommonStateA
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -27238,17 +28171,16 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCommonStateA
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
     }
@@ -27282,7 +28214,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCommonStateB
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -27298,7 +28230,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCommonStateB
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -27315,7 +28247,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCommonStateB
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -27338,21 +28270,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCommonStateB
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -27386,7 +28317,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCommonStateM
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -27402,7 +28333,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCommonStateM
     {
         //Alloc Element Key
         elementKeyLength = snprintf (NULL, 0, "%"PRIu8, _mass_storage_id);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             snprintf (newElement->key, (elementKeyLength + 1), "%"PRIu8, _mass_storage_id);
@@ -27419,7 +28350,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCommonStateM
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -27438,7 +28369,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCommonStateM
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_STRING;
@@ -27480,21 +28411,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCommonStateM
                     newElement->arguments->value.String = NULL;
                 }
                 
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -27527,7 +28457,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCommonStateM
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -27543,7 +28473,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCommonStateM
     {
         //Alloc Element Key
         elementKeyLength = snprintf (NULL, 0, "%"PRIu8, _mass_storage_id);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             snprintf (newElement->key, (elementKeyLength + 1), "%"PRIu8, _mass_storage_id);
@@ -27560,7 +28490,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCommonStateM
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -27579,7 +28509,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCommonStateM
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U32;
@@ -27598,7 +28528,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCommonStateM
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U32;
@@ -27617,7 +28547,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCommonStateM
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -27636,7 +28566,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCommonStateM
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -27655,7 +28585,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCommonStateM
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -27678,21 +28608,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCommonStateM
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -27726,7 +28655,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCommonStateC
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -27742,7 +28671,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCommonStateC
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -27759,7 +28688,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCommonStateC
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_STRING;
@@ -27801,21 +28730,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCommonStateC
                     newElement->arguments->value.String = NULL;
                 }
                 
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -27849,7 +28777,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCommonStateC
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -27865,7 +28793,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCommonStateC
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -27882,7 +28810,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCommonStateC
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_STRING;
@@ -27924,21 +28852,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCommonStateC
                     newElement->arguments->value.String = NULL;
                 }
                 
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -27971,7 +28898,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCommonStateM
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -27989,7 +28916,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCommonStateM
         
         //Alloc Element Key
         elementKeyLength = snprintf (NULL, 0, "%d", listIndex);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             snprintf (newElement->key, (elementKeyLength + 1), "%d", listIndex);
@@ -28008,7 +28935,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCommonStateM
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U32;
@@ -28027,7 +28954,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCommonStateM
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U16;
@@ -28046,7 +28973,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCommonStateM
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U32;
@@ -28069,21 +28996,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCommonStateM
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -28116,7 +29042,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCommonStateW
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -28132,7 +29058,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCommonStateW
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -28149,7 +29075,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCommonStateW
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_I16;
@@ -28172,21 +29098,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCommonStateW
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -28219,7 +29144,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCommonStateS
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -28235,7 +29160,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCommonStateS
     {
         //Alloc Element Key
         elementKeyLength = snprintf (NULL, 0, "%d", _sensorName);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             snprintf (newElement->key, (elementKeyLength + 1), "%d", _sensorName);
@@ -28252,7 +29177,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCommonStateS
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -28271,7 +29196,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCommonStateS
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -28294,21 +29219,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCommonStateS
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -28341,7 +29265,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCommonStateP
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -28357,7 +29281,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCommonStateP
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -28374,7 +29298,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCommonStateP
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -28397,21 +29321,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCommonStateP
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -28445,7 +29368,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCommonStateC
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -28463,7 +29386,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCommonStateC
         
         //Alloc Element Key
         elementKeyLength = snprintf (NULL, 0, "%d", listIndex);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             snprintf (newElement->key, (elementKeyLength + 1), "%d", listIndex);
@@ -28482,7 +29405,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCommonStateC
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -28501,7 +29424,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCommonStateC
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_STRING;
@@ -28543,21 +29466,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCommonStateC
                     newElement->arguments->value.String = NULL;
                 }
                 
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -28590,7 +29512,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCommonStateD
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -28606,7 +29528,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCommonStateD
     {
         //Alloc Element Key
         elementKeyLength = snprintf (NULL, 0, "%"PRIu8, _mass_storage_id);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             snprintf (newElement->key, (elementKeyLength + 1), "%"PRIu8, _mass_storage_id);
@@ -28623,7 +29545,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCommonStateD
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -28642,7 +29564,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCommonStateD
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U16;
@@ -28661,7 +29583,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCommonStateD
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U16;
@@ -28680,7 +29602,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCommonStateD
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U16;
@@ -28699,7 +29621,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCommonStateD
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U16;
@@ -28722,21 +29644,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCommonStateD
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -28769,7 +29690,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCommonStateM
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -28785,7 +29706,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCommonStateM
     {
         //Alloc Element Key
         elementKeyLength = snprintf (NULL, 0, "%"PRIu8, _mass_storage_id);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             snprintf (newElement->key, (elementKeyLength + 1), "%"PRIu8, _mass_storage_id);
@@ -28802,7 +29723,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCommonStateM
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -28821,7 +29742,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCommonStateM
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U16;
@@ -28840,7 +29761,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCommonStateM
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U16;
@@ -28859,7 +29780,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCommonStateM
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U16;
@@ -28878,7 +29799,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCommonStateM
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U16;
@@ -28897,7 +29818,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCommonStateM
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U16;
@@ -28920,21 +29841,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCommonStateM
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -28967,7 +29887,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCommonStateM
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -28983,7 +29903,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCommonStateM
     {
         //Alloc Element Key
         elementKeyLength = snprintf (NULL, 0, "%"PRIu8, _mass_storage_id);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             snprintf (newElement->key, (elementKeyLength + 1), "%"PRIu8, _mass_storage_id);
@@ -29000,7 +29920,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCommonStateM
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -29019,7 +29939,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCommonStateM
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U16;
@@ -29038,7 +29958,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCommonStateM
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U16;
@@ -29057,7 +29977,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCommonStateM
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U16;
@@ -29080,21 +30000,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCommonStateM
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -29126,7 +30045,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementOverHeatStat
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -29142,7 +30061,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementOverHeatStat
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -29163,17 +30082,16 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementOverHeatStat
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
     }
@@ -29207,7 +30125,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementOverHeatStat
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -29223,7 +30141,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementOverHeatStat
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -29240,7 +30158,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementOverHeatStat
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -29263,21 +30181,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementOverHeatStat
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -29310,7 +30227,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementWifiSettings
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -29326,7 +30243,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementWifiSettings
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -29343,7 +30260,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementWifiSettings
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -29366,21 +30283,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementWifiSettings
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -29414,7 +30330,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementMavlinkState
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -29430,7 +30346,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementMavlinkState
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -29447,7 +30363,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementMavlinkState
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -29466,7 +30382,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementMavlinkState
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_STRING;
@@ -29498,7 +30414,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementMavlinkState
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -29527,21 +30443,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementMavlinkState
                     newElement->arguments->value.String = NULL;
                 }
                 
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -29574,7 +30489,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementMavlinkState
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -29590,7 +30505,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementMavlinkState
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -29607,7 +30522,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementMavlinkState
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -29630,21 +30545,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementMavlinkState
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -29677,7 +30591,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCalibrationS
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -29693,7 +30607,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCalibrationS
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -29710,7 +30624,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCalibrationS
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -29729,7 +30643,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCalibrationS
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -29748,7 +30662,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCalibrationS
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -29767,7 +30681,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCalibrationS
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -29790,21 +30704,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCalibrationS
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -29837,7 +30750,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCalibrationS
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -29853,7 +30766,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCalibrationS
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -29870,7 +30783,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCalibrationS
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -29893,21 +30806,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCalibrationS
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -29940,7 +30852,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCalibrationS
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -29956,7 +30868,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCalibrationS
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -29973,7 +30885,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCalibrationS
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -29996,21 +30908,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCalibrationS
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -30043,7 +30954,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCalibrationS
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -30059,7 +30970,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCalibrationS
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -30076,7 +30987,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCalibrationS
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -30099,21 +31010,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCalibrationS
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -30146,7 +31056,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCalibrationS
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -30162,7 +31072,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCalibrationS
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -30179,7 +31089,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCalibrationS
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -30198,7 +31108,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCalibrationS
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -30221,21 +31131,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCalibrationS
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -30268,7 +31177,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCameraSettin
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -30284,7 +31193,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCameraSettin
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -30301,7 +31210,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCameraSettin
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -30320,7 +31229,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCameraSettin
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -30339,7 +31248,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCameraSettin
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -30358,7 +31267,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCameraSettin
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -30377,7 +31286,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCameraSettin
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -30400,21 +31309,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementCameraSettin
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -30447,7 +31355,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementFlightPlanSt
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -30463,7 +31371,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementFlightPlanSt
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -30480,7 +31388,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementFlightPlanSt
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -30503,21 +31411,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementFlightPlanSt
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -30550,7 +31457,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementFlightPlanSt
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -30566,7 +31473,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementFlightPlanSt
     {
         //Alloc Element Key
         elementKeyLength = snprintf (NULL, 0, "%d", _component);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             snprintf (newElement->key, (elementKeyLength + 1), "%d", _component);
@@ -30583,7 +31490,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementFlightPlanSt
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -30602,7 +31509,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementFlightPlanSt
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -30625,21 +31532,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementFlightPlanSt
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -30672,7 +31578,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementFlightPlanSt
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -30688,7 +31594,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementFlightPlanSt
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -30705,7 +31611,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementFlightPlanSt
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -30728,21 +31634,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementFlightPlanSt
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -30774,7 +31679,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementFlightPlanEv
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -30790,7 +31695,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementFlightPlanEv
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -30811,17 +31716,16 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementFlightPlanEv
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
     }
@@ -30854,7 +31758,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementFlightPlanEv
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -30870,7 +31774,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementFlightPlanEv
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -30891,17 +31795,16 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementFlightPlanEv
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
     }
@@ -30936,7 +31839,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementARLibsVersio
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -30952,7 +31855,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementARLibsVersio
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -30969,7 +31872,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementARLibsVersio
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_STRING;
@@ -31011,21 +31914,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementARLibsVersio
                     newElement->arguments->value.String = NULL;
                 }
                 
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -31059,7 +31961,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementARLibsVersio
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -31075,7 +31977,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementARLibsVersio
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -31092,7 +31994,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementARLibsVersio
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_STRING;
@@ -31134,21 +32036,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementARLibsVersio
                     newElement->arguments->value.String = NULL;
                 }
                 
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -31182,7 +32083,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementARLibsVersio
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -31198,7 +32099,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementARLibsVersio
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -31215,7 +32116,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementARLibsVersio
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_STRING;
@@ -31257,21 +32158,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementARLibsVersio
                     newElement->arguments->value.String = NULL;
                 }
                 
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -31304,7 +32204,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementAudioStateAu
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -31320,7 +32220,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementAudioStateAu
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -31337,7 +32237,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementAudioStateAu
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -31360,21 +32260,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementAudioStateAu
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -31407,7 +32306,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementHeadlightsSt
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -31423,7 +32322,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementHeadlightsSt
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -31440,7 +32339,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementHeadlightsSt
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -31459,7 +32358,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementHeadlightsSt
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -31482,21 +32381,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementHeadlightsSt
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -31529,7 +32427,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementAnimationsSt
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -31545,7 +32443,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementAnimationsSt
     {
         //Alloc Element Key
         elementKeyLength = snprintf (NULL, 0, "%d", _anim);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             snprintf (newElement->key, (elementKeyLength + 1), "%d", _anim);
@@ -31562,7 +32460,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementAnimationsSt
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -31581,7 +32479,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementAnimationsSt
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -31600,7 +32498,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementAnimationsSt
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -31623,21 +32521,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementAnimationsSt
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -31670,7 +32567,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementAccessorySta
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -31686,7 +32583,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementAccessorySta
     {
         //Alloc Element Key
         elementKeyLength = snprintf (NULL, 0, "%d", _accessory);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             snprintf (newElement->key, (elementKeyLength + 1), "%d", _accessory);
@@ -31703,7 +32600,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementAccessorySta
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -31726,21 +32623,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementAccessorySta
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -31773,7 +32669,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementAccessorySta
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -31789,7 +32685,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementAccessorySta
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -31806,7 +32702,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementAccessorySta
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -31825,7 +32721,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementAccessorySta
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -31848,21 +32744,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementAccessorySta
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -31895,7 +32790,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementAccessorySta
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -31911,7 +32806,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementAccessorySta
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -31928,7 +32823,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementAccessorySta
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -31951,21 +32846,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementAccessorySta
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -31998,7 +32892,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementChargerState
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -32014,7 +32908,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementChargerState
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -32031,7 +32925,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementChargerState
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -32054,21 +32948,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementChargerState
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -32101,7 +32994,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementChargerState
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -32117,7 +33010,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementChargerState
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -32134,7 +33027,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementChargerState
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -32153,7 +33046,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementChargerState
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -32176,21 +33069,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementChargerState
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -32223,7 +33115,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementChargerState
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -32239,7 +33131,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementChargerState
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -32256,7 +33148,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementChargerState
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -32279,21 +33171,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementChargerState
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -32326,7 +33217,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementChargerState
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -32342,7 +33233,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementChargerState
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -32359,7 +33250,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementChargerState
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -32378,7 +33269,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementChargerState
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -32397,7 +33288,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementChargerState
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -32416,7 +33307,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementChargerState
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -32439,21 +33330,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementChargerState
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -32487,7 +33377,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementRunStateRunI
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -32503,7 +33393,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementRunStateRunI
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -32520,7 +33410,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementRunStateRunI
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_STRING;
@@ -32562,21 +33452,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_NewCmdElementRunStateRunI
                     newElement->arguments->value.String = NULL;
                 }
                 
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -32610,6 +33499,27 @@ eARCONTROLLER_ERROR ARCONTROLLER_FEATURE_Common_SetNetworkController (ARCONTROLL
     return error;
 }
 
+eARCONTROLLER_ERROR ARCONTROLLER_FEATURE_Common_SetSubscribedKeys (ARCONTROLLER_FEATURE_Common_t *feature, const uint8_t *subscribedKeys)
+{
+    // -- Set the commands of which the elements are built. --
+    
+    eARCONTROLLER_ERROR error = ARCONTROLLER_OK;
+    
+    // Check parameters
+    if ((feature == NULL) || (feature->privatePart == NULL))
+    {
+        error = ARCONTROLLER_ERROR_BAD_PARAMETER;
+    }
+    // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
+    
+    if (error == ARCONTROLLER_OK)
+    {
+        feature->privatePart->subscribedKeys = subscribedKeys;
+    }
+    
+    return error;
+}
+
 ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Common_GetCommandElements (ARCONTROLLER_FEATURE_Common_t *feature, eARCONTROLLER_DICTIONARY_KEY commandKey, eARCONTROLLER_ERROR *error)
 {
     // -- Get Command Arguments --
@@ -32706,6 +33616,7 @@ ARCONTROLLER_FEATURE_ControllerInfo_t *ARCONTROLLER_FEATURE_ControllerInfo_New (
             featureController->privatePart->networkController = networkController;
             featureController->privatePart->dictionary = NULL;
             featureController->privatePart->commandCallbacks = NULL;
+            featureController->privatePart->subscribedKeys = NULL;
             // Create the mutex 
             if (ARSAL_Mutex_Init (&(featureController->privatePart->mutex)) != 0)
             {
@@ -32971,6 +33882,27 @@ eARCONTROLLER_ERROR ARCONTROLLER_FEATURE_ControllerInfo_SetNetworkController (AR
     return error;
 }
 
+eARCONTROLLER_ERROR ARCONTROLLER_FEATURE_ControllerInfo_SetSubscribedKeys (ARCONTROLLER_FEATURE_ControllerInfo_t *feature, const uint8_t *subscribedKeys)
+{
+    // -- Set the commands of which the elements are built. --
+    
+    eARCONTROLLER_ERROR error = ARCONTROLLER_OK;
+    
+    // Check parameters
+    if ((feature == NULL) || (feature->privatePart == NULL))
+    {
+        error = ARCONTROLLER_ERROR_BAD_PARAMETER;
+    }
+    // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
+    
+    if (error == ARCONTROLLER_OK)
+    {
+        feature->privatePart->subscribedKeys = subscribedKeys;
+    }
+    
+    return error;
+}
+
 ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_ControllerInfo_GetCommandElements (ARCONTROLLER_FEATURE_ControllerInfo_t *feature, eARCONTROLLER_DICTIONARY_KEY commandKey, eARCONTROLLER_ERROR *error)
 {
     // -- Get Command Arguments --
@@ -33080,6 +34012,7 @@ ARCONTROLLER_FEATURE_Debug_t *ARCONTROLLER_FEATURE_Debug_New (ARCONTROLLER_Netwo
             featureController->privatePart->networkController = networkController;
             featureController->privatePart->dictionary = NULL;
             featureController->privatePart->commandCallbacks = NULL;
+            featureController->privatePart->subscribedKeys = NULL;
             // Create the mutex 
             if (ARSAL_Mutex_Init (&(featureController->privatePart->mutex)) != 0)
             {
@@ -33347,6 +34280,12 @@ void ARCONTROLLER_FEATURE_Debug_SettingsInfoCallback (uint8_t _listFlags, uint16
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -33435,6 +34374,12 @@ void ARCONTROLLER_FEATURE_Debug_SettingsListCallback (uint16_t _id, char * _valu
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -33521,7 +34466,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Debug_NewCmdElementSettingsInfo
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -33539,7 +34484,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Debug_NewCmdElementSettingsInfo
         
         //Alloc Element Key
         elementKeyLength = snprintf (NULL, 0, "%d", listIndex);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             snprintf (newElement->key, (elementKeyLength + 1), "%d", listIndex);
@@ -33558,7 +34503,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Debug_NewCmdElementSettingsInfo
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -33577,7 +34522,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Debug_NewCmdElementSettingsInfo
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U16;
@@ -33596,7 +34541,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Debug_NewCmdElementSettingsInfo
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_STRING;
@@ -33628,7 +34573,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Debug_NewCmdElementSettingsInfo
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -33647,7 +34592,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Debug_NewCmdElementSettingsInfo
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -33666,7 +34611,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Debug_NewCmdElementSettingsInfo
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_STRING;
@@ -33698,7 +34643,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Debug_NewCmdElementSettingsInfo
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_STRING;
@@ -33730,7 +34675,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Debug_NewCmdElementSettingsInfo
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_STRING;
@@ -33762,7 +34707,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Debug_NewCmdElementSettingsInfo
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_STRING;
@@ -33828,21 +34773,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Debug_NewCmdElementSettingsInfo
                     newElement->arguments->value.String = NULL;
                 }
                 
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -33876,7 +34820,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Debug_NewCmdElementSettingsList
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -33892,7 +34836,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Debug_NewCmdElementSettingsList
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -33909,7 +34853,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Debug_NewCmdElementSettingsList
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U16;
@@ -33928,7 +34872,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Debug_NewCmdElementSettingsList
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_STRING;
@@ -33970,21 +34914,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Debug_NewCmdElementSettingsList
                     newElement->arguments->value.String = NULL;
                 }
                 
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -34018,6 +34961,27 @@ eARCONTROLLER_ERROR ARCONTROLLER_FEATURE_Debug_SetNetworkController (ARCONTROLLE
     return error;
 }
 
+eARCONTROLLER_ERROR ARCONTROLLER_FEATURE_Debug_SetSubscribedKeys (ARCONTROLLER_FEATURE_Debug_t *feature, const uint8_t *subscribedKeys)
+{
+    // -- Set the commands of which the elements are built. --
+    
+    eARCONTROLLER_ERROR error = ARCONTROLLER_OK;
+    
+    // Check parameters
+    if ((feature == NULL) || (feature->privatePart == NULL))
+    {
+        error = ARCONTROLLER_ERROR_BAD_PARAMETER;
+    }
+    // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
+    
+    if (error == ARCONTROLLER_OK)
+    {
+        feature->privatePart->subscribedKeys = subscribedKeys;
+    }
+    
+    return error;
+}
+
 ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Debug_GetCommandElements (ARCONTROLLER_FEATURE_Debug_t *feature, eARCONTROLLER_DICTIONARY_KEY commandKey, eARCONTROLLER_ERROR *error)
 {
     // -- Get Command Arguments --
@@ -34138,6 +35102,7 @@ ARCONTROLLER_FEATURE_DroneManager_t *ARCONTROLLER_FEATURE_DroneManager_New (ARCO
             featureController->privatePart->networkController = networkController;
             featureController->privatePart->dictionary = NULL;
             featureController->privatePart->commandCallbacks = NULL;
+            featureController->privatePart->subscribedKeys = NULL;
             // Create the mutex 
             if (ARSAL_Mutex_Init (&(featureController->privatePart->mutex)) != 0)
             {
@@ -34449,6 +35414,12 @@ void ARCONTROLLER_FEATURE_DroneManager_DroneListItemCallback (char * _serial, ui
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -34561,6 +35532,12 @@ void ARCONTROLLER_FEATURE_DroneManager_ConnectionStateCallback (eARCOMMANDS_DRON
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -34644,6 +35621,12 @@ void ARCONTROLLER_FEATURE_DroneManager_AuthenticationFailedCallback (char * _ser
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -34727,6 +35710,12 @@ void ARCONTROLLER_FEATURE_DroneManager_ConnectionRefusedCallback (char * _serial
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -34813,7 +35802,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_DroneManager_NewCmdElementDroneL
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -34829,7 +35818,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_DroneManager_NewCmdElementDroneL
     {
         //Alloc Element Key
         elementKeyLength = strlen (_serial);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, _serial, (elementKeyLength + 1));
@@ -34846,7 +35835,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_DroneManager_NewCmdElementDroneL
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_STRING;
@@ -34878,7 +35867,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_DroneManager_NewCmdElementDroneL
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U16;
@@ -34897,7 +35886,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_DroneManager_NewCmdElementDroneL
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_STRING;
@@ -34929,7 +35918,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_DroneManager_NewCmdElementDroneL
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -34948,7 +35937,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_DroneManager_NewCmdElementDroneL
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -34967,7 +35956,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_DroneManager_NewCmdElementDroneL
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -34986,7 +35975,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_DroneManager_NewCmdElementDroneL
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -35005,7 +35994,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_DroneManager_NewCmdElementDroneL
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -35024,7 +36013,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_DroneManager_NewCmdElementDroneL
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_I8;
@@ -35059,21 +36048,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_DroneManager_NewCmdElementDroneL
                     newElement->arguments->value.String = NULL;
                 }
                 
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -35107,7 +36095,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_DroneManager_NewCmdElementConnec
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -35123,7 +36111,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_DroneManager_NewCmdElementConnec
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -35140,7 +36128,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_DroneManager_NewCmdElementConnec
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -35159,7 +36147,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_DroneManager_NewCmdElementConnec
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_STRING;
@@ -35191,7 +36179,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_DroneManager_NewCmdElementConnec
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U16;
@@ -35210,7 +36198,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_DroneManager_NewCmdElementConnec
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_STRING;
@@ -35258,21 +36246,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_DroneManager_NewCmdElementConnec
                     newElement->arguments->value.String = NULL;
                 }
                 
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -35306,7 +36293,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_DroneManager_NewCmdElementAuthen
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -35322,7 +36309,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_DroneManager_NewCmdElementAuthen
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -35339,7 +36326,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_DroneManager_NewCmdElementAuthen
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_STRING;
@@ -35371,7 +36358,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_DroneManager_NewCmdElementAuthen
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U16;
@@ -35390,7 +36377,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_DroneManager_NewCmdElementAuthen
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_STRING;
@@ -35438,21 +36425,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_DroneManager_NewCmdElementAuthen
                     newElement->arguments->value.String = NULL;
                 }
                 
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -35486,7 +36472,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_DroneManager_NewCmdElementConnec
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -35502,7 +36488,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_DroneManager_NewCmdElementConnec
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -35519,7 +36505,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_DroneManager_NewCmdElementConnec
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_STRING;
@@ -35551,7 +36537,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_DroneManager_NewCmdElementConnec
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U16;
@@ -35570,7 +36556,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_DroneManager_NewCmdElementConnec
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_STRING;
@@ -35618,21 +36604,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_DroneManager_NewCmdElementConnec
                     newElement->arguments->value.String = NULL;
                 }
                 
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -35666,6 +36651,27 @@ eARCONTROLLER_ERROR ARCONTROLLER_FEATURE_DroneManager_SetNetworkController (ARCO
     return error;
 }
 
+eARCONTROLLER_ERROR ARCONTROLLER_FEATURE_DroneManager_SetSubscribedKeys (ARCONTROLLER_FEATURE_DroneManager_t *feature, const uint8_t *subscribedKeys)
+{
+    // -- Set the commands of which the elements are built. --
+    
+    eARCONTROLLER_ERROR error = ARCONTROLLER_OK;
+    
+    // Check parameters
+    if ((feature == NULL) || (feature->privatePart == NULL))
+    {
+        error = ARCONTROLLER_ERROR_BAD_PARAMETER;
+    }
+    // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
+    
+    if (error == ARCONTROLLER_OK)
+    {
+        feature->privatePart->subscribedKeys = subscribedKeys;
+    }
+    
+    return error;
+}
+
 ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_DroneManager_GetCommandElements (ARCONTROLLER_FEATURE_DroneManager_t *feature, eARCONTROLLER_DICTIONARY_KEY commandKey, eARCONTROLLER_ERROR *error)
 {
     // -- Get Command Arguments --
@@ -35862,6 +36868,7 @@ ARCONTROLLER_FEATURE_JumpingSumo_t *ARCONTROLLER_FEATURE_JumpingSumo_New (ARCONT
             featureController->privatePart->networkController = networkController;
             featureController->privatePart->dictionary = NULL;
             featureController->privatePart->commandCallbacks = NULL;
+            featureController->privatePart->subscribedKeys = NULL;
             featureController->privatePart->PilotingPCMDParameters = NULL;
             // Create the mutex 
             if (ARSAL_Mutex_Init (&(featureController->privatePart->mutex)) != 0)
@@ -37104,6 +38111,12 @@ void ARCONTROLLER_FEATURE_JumpingSumo_PilotingStatePostureChangedCallback (eARCO
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -37187,6 +38200,12 @@ void ARCONTROLLER_FEATURE_JumpingSumo_PilotingStateAlertStateChangedCallback (eA
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -37270,6 +38289,12 @@ void ARCONTROLLER_FEATURE_JumpingSumo_PilotingStateSpeedChangedCallback (int8_t
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -37353,6 +38378,12 @@ void ARCONTROLLER_FEATURE_JumpingSumo_AnimationsStateJumpLoadChangedCallback (eA
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -37436,6 +38467,12 @@ void ARCONTROLLER_FEATURE_JumpingSumo_AnimationsStateJumpTypeChangedCallback (eA
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -37519,6 +38556,12 @@ void ARCONTROLLER_FEATURE_JumpingSumo_AnimationsStateJumpMotorProblemChangedCall
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -37602,6 +38645,12 @@ void ARCONTROLLER_FEATURE_JumpingSumo_SettingsStateProductGPSVersionChangedCallb
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -37685,6 +38734,12 @@ void ARCONTROLLER_FEATURE_JumpingSumo_MediaRecordStatePictureStateChangedCallbac
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -37768,6 +38823,12 @@ void ARCONTROLLER_FEATURE_JumpingSumo_MediaRecordStateVideoStateChangedCallback
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -37851,6 +38912,12 @@ void ARCONTROLLER_FEATURE_JumpingSumo_MediaRecordStatePictureStateChangedV2Callb
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -37934,6 +39001,12 @@ void ARCONTROLLER_FEATURE_JumpingSumo_MediaRecordStateVideoStateChangedV2Callbac
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -38017,6 +39090,12 @@ void ARCONTROLLER_FEATURE_JumpingSumo_MediaRecordEventPictureEventChangedCallbac
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -38100,6 +39179,12 @@ void ARCONTROLLER_FEATURE_JumpingSumo_MediaRecordEventVideoEventChangedCallback
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -38183,6 +39268,12 @@ void ARCONTROLLER_FEATURE_JumpingSumo_NetworkSettingsStateWifiSelectionChangedCa
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -38266,6 +39357,12 @@ void ARCONTROLLER_FEATURE_JumpingSumo_NetworkStateWifiScanListChangedCallback (c
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -38349,6 +39446,12 @@ void ARCONTROLLER_FEATURE_JumpingSumo_NetworkStateAllWifiScanChangedCallback (vo
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -38433,6 +39536,12 @@ void ARCONTROLLER_FEATURE_JumpingSumo_NetworkStateWifiAuthChannelListChangedCall
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -38521,6 +39630,12 @@ void ARCONTROLLER_FEATURE_JumpingSumo_NetworkStateAllWifiAuthChannelChangedCallb
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -38604,6 +39719,12 @@ void ARCONTROLLER_FEATURE_JumpingSumo_NetworkStateLinkQualityChangedCallback (ui
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -38687,6 +39808,12 @@ void ARCONTROLLER_FEATURE_JumpingSumo_AudioSettingsStateMasterVolumeChangedCallb
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -38770,6 +39897,12 @@ void ARCONTROLLER_FEATURE_JumpingSumo_AudioSettingsStateThemeChangedCallback (eA
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -38853,6 +39986,12 @@ void ARCONTROLLER_FEATURE_JumpingSumo_RoadPlanStateScriptMetadataListChangedCall
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -38936,6 +40075,12 @@ void ARCONTROLLER_FEATURE_JumpingSumo_RoadPlanStateAllScriptsMetadataChangedCall
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -39019,6 +40164,12 @@ void ARCONTROLLER_FEATURE_JumpingSumo_RoadPlanStateScriptUploadChangedCallback (
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -39102,6 +40253,12 @@ void ARCONTROLLER_FEATURE_JumpingSumo_RoadPlanStateScriptDeleteChangedCallback (
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -39185,6 +40342,12 @@ void ARCONTROLLER_FEATURE_JumpingSumo_RoadPlanStatePlayScriptChangedCallback (eA
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -39268,6 +40431,12 @@ void ARCONTROLLER_FEATURE_JumpingSumo_SpeedSettingsStateOutdoorChangedCallback (
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -39351,6 +40520,12 @@ void ARCONTROLLER_FEATURE_JumpingSumo_MediaStreamingStateVideoEnableChangedCallb
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -39434,6 +40609,12 @@ void ARCONTROLLER_FEATURE_JumpingSumo_VideoSettingsStateAutorecordChangedCallbac
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -39519,7 +40700,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementPilotin
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -39535,7 +40716,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementPilotin
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -39552,7 +40733,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementPilotin
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -39575,21 +40756,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementPilotin
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -39622,7 +40802,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementPilotin
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -39638,7 +40818,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementPilotin
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -39655,7 +40835,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementPilotin
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -39678,21 +40858,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementPilotin
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -39725,7 +40904,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementPilotin
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -39741,7 +40920,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementPilotin
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -39758,7 +40937,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementPilotin
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_I8;
@@ -39777,7 +40956,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementPilotin
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_I16;
@@ -39800,21 +40979,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementPilotin
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -39847,7 +41025,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementAnimati
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -39863,7 +41041,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementAnimati
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -39880,7 +41058,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementAnimati
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -39903,21 +41081,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementAnimati
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -39950,7 +41127,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementAnimati
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -39966,7 +41143,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementAnimati
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -39983,7 +41160,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementAnimati
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -40006,21 +41183,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementAnimati
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -40053,7 +41229,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementAnimati
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -40069,7 +41245,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementAnimati
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -40086,7 +41262,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementAnimati
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -40109,21 +41285,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementAnimati
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -40157,7 +41332,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementSetting
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -40173,7 +41348,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementSetting
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -40190,7 +41365,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementSetting
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_STRING;
@@ -40222,7 +41397,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementSetting
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_STRING;
@@ -40270,21 +41445,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementSetting
                     newElement->arguments->value.String = NULL;
                 }
                 
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -40317,7 +41491,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementMediaRe
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -40333,7 +41507,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementMediaRe
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -40350,7 +41524,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementMediaRe
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -40369,7 +41543,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementMediaRe
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -40392,21 +41566,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementMediaRe
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -40439,7 +41612,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementMediaRe
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -40455,7 +41628,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementMediaRe
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -40472,7 +41645,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementMediaRe
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -40491,7 +41664,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementMediaRe
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -40514,21 +41687,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementMediaRe
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -40561,7 +41733,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementMediaRe
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -40577,7 +41749,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementMediaRe
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -40594,7 +41766,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementMediaRe
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -40613,7 +41785,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementMediaRe
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -40636,21 +41808,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementMediaRe
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -40683,7 +41854,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementMediaRe
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -40699,7 +41870,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementMediaRe
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -40716,7 +41887,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementMediaRe
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -40735,7 +41906,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementMediaRe
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -40758,21 +41929,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementMediaRe
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -40805,7 +41975,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementMediaRe
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -40821,7 +41991,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementMediaRe
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -40838,7 +42008,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementMediaRe
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -40857,7 +42027,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementMediaRe
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -40880,21 +42050,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementMediaRe
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -40927,7 +42096,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementMediaRe
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -40943,7 +42112,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementMediaRe
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -40960,7 +42129,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementMediaRe
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -40979,7 +42148,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementMediaRe
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -41002,21 +42171,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementMediaRe
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -41049,7 +42217,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementNetwork
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -41065,7 +42233,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementNetwork
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -41082,7 +42250,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementNetwork
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -41101,7 +42269,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementNetwork
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -41120,7 +42288,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementNetwork
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -41143,21 +42311,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementNetwork
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -41191,7 +42358,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementNetwork
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -41207,7 +42374,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementNetwork
     {
         //Alloc Element Key
         elementKeyLength = strlen (_ssid);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, _ssid, (elementKeyLength + 1));
@@ -41224,7 +42391,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementNetwork
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_STRING;
@@ -41256,7 +42423,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementNetwork
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_I16;
@@ -41275,7 +42442,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementNetwork
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -41294,7 +42461,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementNetwork
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -41323,21 +42490,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementNetwork
                     newElement->arguments->value.String = NULL;
                 }
                 
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -41369,7 +42535,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementNetwork
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -41385,7 +42551,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementNetwork
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -41406,17 +42572,16 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementNetwork
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
     }
@@ -41450,7 +42615,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementNetwork
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -41468,7 +42633,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementNetwork
         
         //Alloc Element Key
         elementKeyLength = snprintf (NULL, 0, "%d", listIndex);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             snprintf (newElement->key, (elementKeyLength + 1), "%d", listIndex);
@@ -41487,7 +42652,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementNetwork
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -41506,7 +42671,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementNetwork
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -41525,7 +42690,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementNetwork
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -41548,21 +42713,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementNetwork
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -41594,7 +42758,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementNetwork
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -41610,7 +42774,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementNetwork
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -41631,17 +42795,16 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementNetwork
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
     }
@@ -41675,7 +42838,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementNetwork
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -41691,7 +42854,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementNetwork
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -41708,7 +42871,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementNetwork
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -41731,21 +42894,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementNetwork
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -41778,7 +42940,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementAudioSe
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -41794,7 +42956,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementAudioSe
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -41811,7 +42973,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementAudioSe
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -41834,21 +42996,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementAudioSe
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -41881,7 +43042,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementAudioSe
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -41897,7 +43058,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementAudioSe
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -41914,7 +43075,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementAudioSe
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -41937,21 +43098,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementAudioSe
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -41985,7 +43145,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementRoadPla
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -42001,7 +43161,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementRoadPla
     {
         //Alloc Element Key
         elementKeyLength = strlen (_uuid);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, _uuid, (elementKeyLength + 1));
@@ -42018,7 +43178,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementRoadPla
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_STRING;
@@ -42050,7 +43210,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementRoadPla
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -42069,7 +43229,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementRoadPla
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_STRING;
@@ -42101,7 +43261,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementRoadPla
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_STRING;
@@ -42133,7 +43293,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementRoadPla
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U64;
@@ -42174,21 +43334,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementRoadPla
                     newElement->arguments->value.String = NULL;
                 }
                 
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -42220,7 +43379,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementRoadPla
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -42236,7 +43395,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementRoadPla
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -42257,17 +43416,16 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementRoadPla
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
     }
@@ -42301,7 +43459,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementRoadPla
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -42317,7 +43475,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementRoadPla
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -42334,7 +43492,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementRoadPla
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -42357,21 +43515,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementRoadPla
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -42404,7 +43561,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementRoadPla
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -42420,7 +43577,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementRoadPla
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -42437,7 +43594,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementRoadPla
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -42460,21 +43617,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementRoadPla
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -42507,7 +43663,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementRoadPla
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -42523,7 +43679,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementRoadPla
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -42540,7 +43696,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementRoadPla
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -42563,21 +43719,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementRoadPla
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -42610,7 +43765,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementSpeedSe
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -42626,7 +43781,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementSpeedSe
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -42643,7 +43798,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementSpeedSe
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -42666,21 +43821,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementSpeedSe
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -42713,7 +43867,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementMediaSt
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -42729,7 +43883,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementMediaSt
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -42746,7 +43900,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementMediaSt
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -42769,21 +43923,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementMediaSt
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -42816,7 +43969,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementVideoSe
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -42832,7 +43985,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementVideoSe
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -42849,7 +44002,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementVideoSe
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -42872,21 +44025,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_NewCmdElementVideoSe
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -42920,6 +44072,27 @@ eARCONTROLLER_ERROR ARCONTROLLER_FEATURE_JumpingSumo_SetNetworkController (ARCON
     return error;
 }
 
+eARCONTROLLER_ERROR ARCONTROLLER_FEATURE_JumpingSumo_SetSubscribedKeys (ARCONTROLLER_FEATURE_JumpingSumo_t *feature, const uint8_t *subscribedKeys)
+{
+    // -- Set the commands of which the elements are built. --
+    
+    eARCONTROLLER_ERROR error = ARCONTROLLER_OK;
+    
+    // Check parameters
+    if ((feature == NULL) || (feature->privatePart == NULL))
+    {
+        error = ARCONTROLLER_ERROR_BAD_PARAMETER;
+    }
+    // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
+    
+    if (error == ARCONTROLLER_OK)
+    {
+        feature->privatePart->subscribedKeys = subscribedKeys;
+    }
+    
+    return error;
+}
+
 ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_JumpingSumo_GetCommandElements (ARCONTROLLER_FEATURE_JumpingSumo_t *feature, eARCONTROLLER_DICTIONARY_KEY commandKey, eARCONTROLLER_ERROR *error)
 {
     // -- Get Command Arguments --
@@ -43056,6 +44229,7 @@ ARCONTROLLER_FEATURE_Mapper_t *ARCONTROLLER_FEATURE_Mapper_New (ARCONTROLLER_Net
             featureController->privatePart->networkController = networkController;
             featureController->privatePart->dictionary = NULL;
             featureController->privatePart->commandCallbacks = NULL;
+            featureController->privatePart->subscribedKeys = NULL;
             // Create the mutex 
             if (ARSAL_Mutex_Init (&(featureController->privatePart->mutex)) != 0)
             {
@@ -43476,6 +44650,12 @@ void ARCONTROLLER_FEATURE_Mapper_GrabStateCallback (uint32_t _buttons, uint32_t
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -43559,6 +44739,12 @@ void ARCONTROLLER_FEATURE_Mapper_GrabButtonEventCallback (uint32_t _button, eARC
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -43642,6 +44828,12 @@ void ARCONTROLLER_FEATURE_Mapper_GrabAxisEventCallback (uint32_t _axis, int8_t _
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -43734,6 +44926,12 @@ void ARCONTROLLER_FEATURE_Mapper_ButtonMappingItemCallback (uint32_t _uid, uint1
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -43863,6 +45061,12 @@ void ARCONTROLLER_FEATURE_Mapper_AxisMappingItemCallback (uint32_t _uid, uint16_
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -43983,6 +45187,12 @@ void ARCONTROLLER_FEATURE_Mapper_ApplicationAxisEventCallback (eARCOMMANDS_MAPPE
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -44066,6 +45276,12 @@ void ARCONTROLLER_FEATURE_Mapper_ApplicationButtonEventCallback (eARCOMMANDS_MAP
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -44158,6 +45374,12 @@ void ARCONTROLLER_FEATURE_Mapper_ExpoMapItemCallback (uint32_t _uid, uint16_t _p
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -44287,6 +45509,12 @@ void ARCONTROLLER_FEATURE_Mapper_InvertedMapItemCallback (uint32_t _uid, uint16_
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -44409,7 +45637,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Mapper_NewCmdElementGrabState (A
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -44425,7 +45653,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Mapper_NewCmdElementGrabState (A
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -44442,7 +45670,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Mapper_NewCmdElementGrabState (A
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U32;
@@ -44461,7 +45689,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Mapper_NewCmdElementGrabState (A
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U32;
@@ -44480,7 +45708,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Mapper_NewCmdElementGrabState (A
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U32;
@@ -44503,21 +45731,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Mapper_NewCmdElementGrabState (A
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -44550,7 +45777,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Mapper_NewCmdElementGrabButtonEv
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -44566,7 +45793,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Mapper_NewCmdElementGrabButtonEv
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -44583,7 +45810,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Mapper_NewCmdElementGrabButtonEv
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U32;
@@ -44602,7 +45829,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Mapper_NewCmdElementGrabButtonEv
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -44625,21 +45852,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Mapper_NewCmdElementGrabButtonEv
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -44672,7 +45898,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Mapper_NewCmdElementGrabAxisEven
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -44688,7 +45914,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Mapper_NewCmdElementGrabAxisEven
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -44705,7 +45931,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Mapper_NewCmdElementGrabAxisEven
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U32;
@@ -44724,7 +45950,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Mapper_NewCmdElementGrabAxisEven
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_I8;
@@ -44747,21 +45973,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Mapper_NewCmdElementGrabAxisEven
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -44794,7 +46019,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Mapper_NewCmdElementButtonMappin
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -44810,7 +46035,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Mapper_NewCmdElementButtonMappin
     {
         //Alloc Element Key
         elementKeyLength = snprintf (NULL, 0, "%"PRIu32, _uid);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             snprintf (newElement->key, (elementKeyLength + 1), "%"PRIu32, _uid);
@@ -44827,7 +46052,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Mapper_NewCmdElementButtonMappin
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U32;
@@ -44846,7 +46071,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Mapper_NewCmdElementButtonMappin
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U16;
@@ -44865,7 +46090,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Mapper_NewCmdElementButtonMappin
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -44884,7 +46109,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Mapper_NewCmdElementButtonMappin
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U32;
@@ -44907,21 +46132,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Mapper_NewCmdElementButtonMappin
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -44954,7 +46178,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Mapper_NewCmdElementAxisMappingI
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -44970,7 +46194,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Mapper_NewCmdElementAxisMappingI
     {
         //Alloc Element Key
         elementKeyLength = snprintf (NULL, 0, "%"PRIu32, _uid);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             snprintf (newElement->key, (elementKeyLength + 1), "%"PRIu32, _uid);
@@ -44987,7 +46211,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Mapper_NewCmdElementAxisMappingI
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U32;
@@ -45006,7 +46230,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Mapper_NewCmdElementAxisMappingI
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U16;
@@ -45025,7 +46249,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Mapper_NewCmdElementAxisMappingI
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -45044,7 +46268,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Mapper_NewCmdElementAxisMappingI
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_I32;
@@ -45063,7 +46287,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Mapper_NewCmdElementAxisMappingI
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U32;
@@ -45086,21 +46310,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Mapper_NewCmdElementAxisMappingI
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -45133,7 +46356,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Mapper_NewCmdElementApplicationA
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -45149,7 +46372,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Mapper_NewCmdElementApplicationA
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -45166,7 +46389,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Mapper_NewCmdElementApplicationA
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -45185,7 +46408,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Mapper_NewCmdElementApplicationA
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_I8;
@@ -45208,21 +46431,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Mapper_NewCmdElementApplicationA
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -45255,7 +46477,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Mapper_NewCmdElementApplicationB
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -45271,7 +46493,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Mapper_NewCmdElementApplicationB
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -45288,7 +46510,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Mapper_NewCmdElementApplicationB
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -45311,21 +46533,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Mapper_NewCmdElementApplicationB
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -45358,7 +46579,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Mapper_NewCmdElementExpoMapItem
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -45374,7 +46595,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Mapper_NewCmdElementExpoMapItem
     {
         //Alloc Element Key
         elementKeyLength = snprintf (NULL, 0, "%"PRIu32, _uid);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             snprintf (newElement->key, (elementKeyLength + 1), "%"PRIu32, _uid);
@@ -45391,7 +46612,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Mapper_NewCmdElementExpoMapItem
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U32;
@@ -45410,7 +46631,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Mapper_NewCmdElementExpoMapItem
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U16;
@@ -45429,7 +46650,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Mapper_NewCmdElementExpoMapItem
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_I32;
@@ -45448,7 +46669,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Mapper_NewCmdElementExpoMapItem
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -45471,21 +46692,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Mapper_NewCmdElementExpoMapItem
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -45518,7 +46738,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Mapper_NewCmdElementInvertedMapI
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -45534,7 +46754,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Mapper_NewCmdElementInvertedMapI
     {
         //Alloc Element Key
         elementKeyLength = snprintf (NULL, 0, "%"PRIu32, _uid);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             snprintf (newElement->key, (elementKeyLength + 1), "%"PRIu32, _uid);
@@ -45551,7 +46771,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Mapper_NewCmdElementInvertedMapI
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U32;
@@ -45570,7 +46790,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Mapper_NewCmdElementInvertedMapI
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U16;
@@ -45589,7 +46809,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Mapper_NewCmdElementInvertedMapI
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_I32;
@@ -45608,7 +46828,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Mapper_NewCmdElementInvertedMapI
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -45631,21 +46851,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Mapper_NewCmdElementInvertedMapI
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -45679,6 +46898,27 @@ eARCONTROLLER_ERROR ARCONTROLLER_FEATURE_Mapper_SetNetworkController (ARCONTROLL
     return error;
 }
 
+eARCONTROLLER_ERROR ARCONTROLLER_FEATURE_Mapper_SetSubscribedKeys (ARCONTROLLER_FEATURE_Mapper_t *feature, const uint8_t *subscribedKeys)
+{
+    // -- Set the commands of which the elements are built. --
+    
+    eARCONTROLLER_ERROR error = ARCONTROLLER_OK;
+    
+    // Check parameters
+    if ((feature == NULL) || (feature->privatePart == NULL))
+    {
+        error = ARCONTROLLER_ERROR_BAD_PARAMETER;
+    }
+    // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
+    
+    if (error == ARCONTROLLER_OK)
+    {
+        feature->privatePart->subscribedKeys = subscribedKeys;
+    }
+    
+    return error;
+}
+
 ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Mapper_GetCommandElements (ARCONTROLLER_FEATURE_Mapper_t *feature, eARCONTROLLER_DICTIONARY_KEY commandKey, eARCONTROLLER_ERROR *error)
 {
     // -- Get Command Arguments --
@@ -45887,6 +47127,7 @@ ARCONTROLLER_FEATURE_MiniDrone_t *ARCONTROLLER_FEATURE_MiniDrone_New (ARCONTROLL
             featureController->privatePart->networkController = networkController;
             featureController->privatePart->dictionary = NULL;
             featureController->privatePart->commandCallbacks = NULL;
+            featureController->privatePart->subscribedKeys = NULL;
             featureController->privatePart->PilotingPCMDParameters = NULL;
             // Create the mutex 
             if (ARSAL_Mutex_Init (&(featureController->privatePart->mutex)) != 0)
@@ -47368,6 +48609,12 @@ void ARCONTROLLER_FEATURE_MiniDrone_PilotingStateFlatTrimChangedCallback (void *
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -47451,6 +48698,12 @@ void ARCONTROLLER_FEATURE_MiniDrone_PilotingStateFlyingStateChangedCallback (eAR
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -47534,6 +48787,12 @@ void ARCONTROLLER_FEATURE_MiniDrone_PilotingStateAlertStateChangedCallback (eARC
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -47617,6 +48876,12 @@ void ARCONTROLLER_FEATURE_MiniDrone_PilotingStateAutoTakeOffModeChangedCallback
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -47700,6 +48965,12 @@ void ARCONTROLLER_FEATURE_MiniDrone_PilotingStateFlyingModeChangedCallback (eARC
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -47783,6 +49054,12 @@ void ARCONTROLLER_FEATURE_MiniDrone_PilotingStatePlaneGearBoxChangedCallback (eA
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -47866,6 +49143,12 @@ void ARCONTROLLER_FEATURE_MiniDrone_MediaRecordStatePictureStateChangedCallback
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -47949,6 +49232,12 @@ void ARCONTROLLER_FEATURE_MiniDrone_MediaRecordStatePictureStateChangedV2Callbac
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -48032,6 +49321,12 @@ void ARCONTROLLER_FEATURE_MiniDrone_MediaRecordEventPictureEventChangedCallback
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -48115,6 +49410,12 @@ void ARCONTROLLER_FEATURE_MiniDrone_PilotingSettingsStateMaxAltitudeChangedCallb
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -48198,6 +49499,12 @@ void ARCONTROLLER_FEATURE_MiniDrone_PilotingSettingsStateMaxTiltChangedCallback
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -48281,6 +49588,12 @@ void ARCONTROLLER_FEATURE_MiniDrone_PilotingSettingsStatePlaneModePitchChangedCa
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -48364,6 +49677,12 @@ void ARCONTROLLER_FEATURE_MiniDrone_SpeedSettingsStateMaxVerticalSpeedChangedCal
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -48447,6 +49766,12 @@ void ARCONTROLLER_FEATURE_MiniDrone_SpeedSettingsStateMaxRotationSpeedChangedCal
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -48530,6 +49855,12 @@ void ARCONTROLLER_FEATURE_MiniDrone_SpeedSettingsStateWheelsChangedCallback (uin
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -48613,6 +49944,12 @@ void ARCONTROLLER_FEATURE_MiniDrone_SpeedSettingsStateMaxHorizontalSpeedChangedC
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -48696,6 +50033,12 @@ void ARCONTROLLER_FEATURE_MiniDrone_SpeedSettingsStateMaxPlaneModeRotationSpeedC
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -48779,6 +50122,12 @@ void ARCONTROLLER_FEATURE_MiniDrone_SettingsStateProductMotorsVersionChangedCall
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -48862,6 +50211,12 @@ void ARCONTROLLER_FEATURE_MiniDrone_SettingsStateProductInertialVersionChangedCa
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -48945,6 +50300,12 @@ void ARCONTROLLER_FEATURE_MiniDrone_SettingsStateCutOutModeChangedCallback (uint
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -49028,6 +50389,12 @@ void ARCONTROLLER_FEATURE_MiniDrone_FloodControlStateFloodControlChangedCallback
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -49120,6 +50487,12 @@ void ARCONTROLLER_FEATURE_MiniDrone_UsbAccessoryStateLightStateCallback (uint8_t
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -49249,6 +50622,12 @@ void ARCONTROLLER_FEATURE_MiniDrone_UsbAccessoryStateClawStateCallback (uint8_t
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -49378,6 +50757,12 @@ void ARCONTROLLER_FEATURE_MiniDrone_UsbAccessoryStateGunStateCallback (uint8_t _
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -49498,6 +50883,12 @@ void ARCONTROLLER_FEATURE_MiniDrone_NavigationDataStateDronePositionCallback (fl
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -49582,7 +50973,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementPilotingS
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -49598,7 +50989,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementPilotingS
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -49619,17 +51010,16 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementPilotingS
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
     }
@@ -49663,7 +51053,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementPilotingS
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -49679,7 +51069,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementPilotingS
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -49696,7 +51086,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementPilotingS
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -49719,21 +51109,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementPilotingS
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -49766,7 +51155,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementPilotingS
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -49782,7 +51171,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementPilotingS
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -49799,7 +51188,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementPilotingS
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -49822,21 +51211,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementPilotingS
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -49869,7 +51257,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementPilotingS
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -49885,7 +51273,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementPilotingS
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -49902,7 +51290,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementPilotingS
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -49925,21 +51313,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementPilotingS
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -49972,7 +51359,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementPilotingS
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -49988,7 +51375,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementPilotingS
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -50005,7 +51392,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementPilotingS
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -50028,21 +51415,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementPilotingS
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -50075,7 +51461,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementPilotingS
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -50091,7 +51477,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementPilotingS
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -50108,7 +51494,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementPilotingS
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -50131,21 +51517,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementPilotingS
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -50178,7 +51563,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementMediaReco
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -50194,7 +51579,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementMediaReco
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -50211,7 +51596,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementMediaReco
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -50230,7 +51615,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementMediaReco
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -50253,21 +51638,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementMediaReco
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -50300,7 +51684,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementMediaReco
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -50316,7 +51700,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementMediaReco
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -50333,7 +51717,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementMediaReco
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -50352,7 +51736,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementMediaReco
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -50375,21 +51759,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementMediaReco
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -50422,7 +51805,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementMediaReco
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -50438,7 +51821,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementMediaReco
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -50455,7 +51838,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementMediaReco
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -50474,7 +51857,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementMediaReco
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -50497,21 +51880,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementMediaReco
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -50544,7 +51926,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementPilotingS
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -50560,7 +51942,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementPilotingS
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -50577,7 +51959,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementPilotingS
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -50596,7 +51978,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementPilotingS
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -50615,7 +51997,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementPilotingS
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -50638,21 +52020,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementPilotingS
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -50685,7 +52066,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementPilotingS
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -50701,7 +52082,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementPilotingS
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -50718,7 +52099,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementPilotingS
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -50737,7 +52118,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementPilotingS
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -50756,7 +52137,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementPilotingS
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -50779,21 +52160,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementPilotingS
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -50826,7 +52206,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementPilotingS
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -50842,7 +52222,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementPilotingS
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -50859,7 +52239,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementPilotingS
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -50878,7 +52258,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementPilotingS
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -50897,7 +52277,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementPilotingS
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -50920,21 +52300,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementPilotingS
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -50967,7 +52346,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementSpeedSett
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -50983,7 +52362,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementSpeedSett
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -51000,7 +52379,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementSpeedSett
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -51019,7 +52398,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementSpeedSett
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -51038,7 +52417,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementSpeedSett
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -51061,21 +52440,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementSpeedSett
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -51108,7 +52486,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementSpeedSett
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -51124,7 +52502,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementSpeedSett
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -51141,7 +52519,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementSpeedSett
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -51160,7 +52538,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementSpeedSett
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -51179,7 +52557,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementSpeedSett
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -51202,21 +52580,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementSpeedSett
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -51249,7 +52626,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementSpeedSett
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -51265,7 +52642,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementSpeedSett
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -51282,7 +52659,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementSpeedSett
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -51305,21 +52682,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementSpeedSett
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -51352,7 +52728,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementSpeedSett
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -51368,7 +52744,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementSpeedSett
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -51385,7 +52761,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementSpeedSett
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -51404,7 +52780,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementSpeedSett
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -51423,7 +52799,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementSpeedSett
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -51446,21 +52822,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementSpeedSett
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -51493,7 +52868,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementSpeedSett
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -51509,7 +52884,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementSpeedSett
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -51526,7 +52901,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementSpeedSett
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -51545,7 +52920,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementSpeedSett
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -51564,7 +52939,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementSpeedSett
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -51587,21 +52962,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementSpeedSett
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -51635,7 +53009,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementSettingsS
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -51651,7 +53025,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementSettingsS
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -51668,7 +53042,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementSettingsS
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -51687,7 +53061,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementSettingsS
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_STRING;
@@ -51719,7 +53093,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementSettingsS
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_STRING;
@@ -51751,7 +53125,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementSettingsS
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_STRING;
@@ -51805,21 +53179,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementSettingsS
                     newElement->arguments->value.String = NULL;
                 }
                 
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -51853,7 +53226,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementSettingsS
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -51869,7 +53242,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementSettingsS
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -51886,7 +53259,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementSettingsS
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_STRING;
@@ -51918,7 +53291,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementSettingsS
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_STRING;
@@ -51966,21 +53339,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementSettingsS
                     newElement->arguments->value.String = NULL;
                 }
                 
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -52013,7 +53385,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementSettingsS
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -52029,7 +53401,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementSettingsS
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -52046,7 +53418,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementSettingsS
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -52069,21 +53441,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementSettingsS
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -52116,7 +53487,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementFloodCont
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -52132,7 +53503,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementFloodCont
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -52149,7 +53520,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementFloodCont
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U16;
@@ -52172,21 +53543,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementFloodCont
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -52219,7 +53589,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementUsbAccess
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -52235,7 +53605,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementUsbAccess
     {
         //Alloc Element Key
         elementKeyLength = snprintf (NULL, 0, "%"PRIu8, _id);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             snprintf (newElement->key, (elementKeyLength + 1), "%"PRIu8, _id);
@@ -52252,7 +53622,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementUsbAccess
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -52271,7 +53641,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementUsbAccess
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -52290,7 +53660,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementUsbAccess
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -52313,21 +53683,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementUsbAccess
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -52360,7 +53729,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementUsbAccess
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -52376,7 +53745,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementUsbAccess
     {
         //Alloc Element Key
         elementKeyLength = snprintf (NULL, 0, "%"PRIu8, _id);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             snprintf (newElement->key, (elementKeyLength + 1), "%"PRIu8, _id);
@@ -52393,7 +53762,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementUsbAccess
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -52412,7 +53781,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementUsbAccess
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -52435,21 +53804,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementUsbAccess
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -52482,7 +53850,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementUsbAccess
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -52498,7 +53866,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementUsbAccess
     {
         //Alloc Element Key
         elementKeyLength = snprintf (NULL, 0, "%"PRIu8, _id);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             snprintf (newElement->key, (elementKeyLength + 1), "%"PRIu8, _id);
@@ -52515,7 +53883,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementUsbAccess
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -52534,7 +53902,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementUsbAccess
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -52557,21 +53925,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementUsbAccess
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -52604,7 +53971,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementNavigatio
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -52620,7 +53987,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementNavigatio
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -52637,7 +54004,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementNavigatio
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -52656,7 +54023,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementNavigatio
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -52675,7 +54042,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementNavigatio
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_I16;
@@ -52694,7 +54061,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementNavigatio
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_I16;
@@ -52713,7 +54080,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementNavigatio
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_I16;
@@ -52736,21 +54103,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_NewCmdElementNavigatio
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -52784,6 +54150,27 @@ eARCONTROLLER_ERROR ARCONTROLLER_FEATURE_MiniDrone_SetNetworkController (ARCONTR
     return error;
 }
 
+eARCONTROLLER_ERROR ARCONTROLLER_FEATURE_MiniDrone_SetSubscribedKeys (ARCONTROLLER_FEATURE_MiniDrone_t *feature, const uint8_t *subscribedKeys)
+{
+    // -- Set the commands of which the elements are built. --
+    
+    eARCONTROLLER_ERROR error = ARCONTROLLER_OK;
+    
+    // Check parameters
+    if ((feature == NULL) || (feature->privatePart == NULL))
+    {
+        error = ARCONTROLLER_ERROR_BAD_PARAMETER;
+    }
+    // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
+    
+    if (error == ARCONTROLLER_OK)
+    {
+        feature->privatePart->subscribedKeys = subscribedKeys;
+    }
+    
+    return error;
+}
+
 ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_MiniDrone_GetCommandElements (ARCONTROLLER_FEATURE_MiniDrone_t *feature, eARCONTROLLER_DICTIONARY_KEY commandKey, eARCONTROLLER_ERROR *error)
 {
     // -- Get Command Arguments --
@@ -52949,6 +54336,7 @@ ARCONTROLLER_FEATURE_Powerup_t *ARCONTROLLER_FEATURE_Powerup_New (ARCONTROLLER_N
             featureController->privatePart->networkController = networkController;
             featureController->privatePart->dictionary = NULL;
             featureController->privatePart->commandCallbacks = NULL;
+            featureController->privatePart->subscribedKeys = NULL;
             featureController->privatePart->PilotingPCMDParameters = NULL;
             // Create the mutex 
             if (ARSAL_Mutex_Init (&(featureController->privatePart->mutex)) != 0)
@@ -53788,6 +55176,12 @@ void ARCONTROLLER_FEATURE_Powerup_PilotingStateAlertStateChangedCallback (eARCOM
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -53871,6 +55265,12 @@ void ARCONTROLLER_FEATURE_Powerup_PilotingStateFlyingStateChangedCallback (eARCO
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -53954,6 +55354,12 @@ void ARCONTROLLER_FEATURE_Powerup_PilotingStateMotorModeChangedCallback (eARCOMM
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -54037,6 +55443,12 @@ void ARCONTROLLER_FEATURE_Powerup_PilotingStateAttitudeChangedCallback (float _r
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -54120,6 +55532,12 @@ void ARCONTROLLER_FEATURE_Powerup_PilotingStateAltitudeChangedCallback (float _a
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -54212,6 +55630,12 @@ void ARCONTROLLER_FEATURE_Powerup_PilotingSettingsStateSettingChangedCallback (e
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -54332,6 +55756,12 @@ void ARCONTROLLER_FEATURE_Powerup_MediaRecordStatePictureStateChangedV2Callback
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -54415,6 +55845,12 @@ void ARCONTROLLER_FEATURE_Powerup_MediaRecordStateVideoStateChangedV2Callback (e
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -54498,6 +55934,12 @@ void ARCONTROLLER_FEATURE_Powerup_MediaRecordEventPictureEventChangedCallback (e
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -54581,6 +56023,12 @@ void ARCONTROLLER_FEATURE_Powerup_MediaRecordEventVideoEventChangedCallback (eAR
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -54664,6 +56112,12 @@ void ARCONTROLLER_FEATURE_Powerup_NetworkSettingsStateWifiSelectionChangedCallba
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -54747,6 +56201,12 @@ void ARCONTROLLER_FEATURE_Powerup_NetworkStateWifiScanListChangedCallback (char
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -54830,6 +56290,12 @@ void ARCONTROLLER_FEATURE_Powerup_NetworkStateAllWifiScanChangedCallback (void *
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -54914,6 +56380,12 @@ void ARCONTROLLER_FEATURE_Powerup_NetworkStateWifiAuthChannelListChangedCallback
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -55002,6 +56474,12 @@ void ARCONTROLLER_FEATURE_Powerup_NetworkStateAllWifiAuthChannelChangedCallback
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -55085,6 +56563,12 @@ void ARCONTROLLER_FEATURE_Powerup_NetworkStateLinkQualityChangedCallback (uint8_
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -55168,6 +56652,12 @@ void ARCONTROLLER_FEATURE_Powerup_MediaStreamingStateVideoEnableChangedCallback
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -55251,6 +56741,12 @@ void ARCONTROLLER_FEATURE_Powerup_VideoSettingsStateAutorecordChangedCallback (u
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -55334,6 +56830,12 @@ void ARCONTROLLER_FEATURE_Powerup_VideoSettingsStateVideoModeChangedCallback (eA
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -55417,6 +56919,12 @@ void ARCONTROLLER_FEATURE_Powerup_SoundsStateBuzzChangedCallback (uint8_t _enabl
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -55502,7 +57010,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Powerup_NewCmdElementPilotingSta
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -55518,7 +57026,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Powerup_NewCmdElementPilotingSta
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -55535,7 +57043,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Powerup_NewCmdElementPilotingSta
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -55558,21 +57066,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Powerup_NewCmdElementPilotingSta
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -55605,7 +57112,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Powerup_NewCmdElementPilotingSta
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -55621,7 +57128,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Powerup_NewCmdElementPilotingSta
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -55638,7 +57145,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Powerup_NewCmdElementPilotingSta
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -55661,21 +57168,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Powerup_NewCmdElementPilotingSta
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -55708,7 +57214,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Powerup_NewCmdElementPilotingSta
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -55724,7 +57230,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Powerup_NewCmdElementPilotingSta
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -55741,7 +57247,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Powerup_NewCmdElementPilotingSta
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -55764,21 +57270,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Powerup_NewCmdElementPilotingSta
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -55811,7 +57316,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Powerup_NewCmdElementPilotingSta
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -55827,7 +57332,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Powerup_NewCmdElementPilotingSta
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -55844,7 +57349,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Powerup_NewCmdElementPilotingSta
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -55863,7 +57368,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Powerup_NewCmdElementPilotingSta
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -55882,7 +57387,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Powerup_NewCmdElementPilotingSta
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -55905,21 +57410,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Powerup_NewCmdElementPilotingSta
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -55952,7 +57456,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Powerup_NewCmdElementPilotingSta
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -55968,7 +57472,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Powerup_NewCmdElementPilotingSta
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -55985,7 +57489,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Powerup_NewCmdElementPilotingSta
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -56008,21 +57512,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Powerup_NewCmdElementPilotingSta
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -56055,7 +57558,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Powerup_NewCmdElementPilotingSet
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -56071,7 +57574,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Powerup_NewCmdElementPilotingSet
     {
         //Alloc Element Key
         elementKeyLength = snprintf (NULL, 0, "%d", _setting);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             snprintf (newElement->key, (elementKeyLength + 1), "%d", _setting);
@@ -56088,7 +57591,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Powerup_NewCmdElementPilotingSet
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -56107,7 +57610,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Powerup_NewCmdElementPilotingSet
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -56126,7 +57629,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Powerup_NewCmdElementPilotingSet
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -56145,7 +57648,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Powerup_NewCmdElementPilotingSet
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -56168,21 +57671,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Powerup_NewCmdElementPilotingSet
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -56215,7 +57717,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Powerup_NewCmdElementMediaRecord
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -56231,7 +57733,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Powerup_NewCmdElementMediaRecord
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -56248,7 +57750,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Powerup_NewCmdElementMediaRecord
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -56267,7 +57769,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Powerup_NewCmdElementMediaRecord
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -56290,21 +57792,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Powerup_NewCmdElementMediaRecord
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -56337,7 +57838,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Powerup_NewCmdElementMediaRecord
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -56353,7 +57854,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Powerup_NewCmdElementMediaRecord
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -56370,7 +57871,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Powerup_NewCmdElementMediaRecord
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -56389,7 +57890,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Powerup_NewCmdElementMediaRecord
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -56412,21 +57913,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Powerup_NewCmdElementMediaRecord
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -56459,7 +57959,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Powerup_NewCmdElementMediaRecord
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -56475,7 +57975,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Powerup_NewCmdElementMediaRecord
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -56492,7 +57992,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Powerup_NewCmdElementMediaRecord
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -56511,7 +58011,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Powerup_NewCmdElementMediaRecord
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -56534,21 +58034,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Powerup_NewCmdElementMediaRecord
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -56581,7 +58080,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Powerup_NewCmdElementMediaRecord
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -56597,7 +58096,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Powerup_NewCmdElementMediaRecord
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -56614,7 +58113,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Powerup_NewCmdElementMediaRecord
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -56633,7 +58132,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Powerup_NewCmdElementMediaRecord
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -56656,21 +58155,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Powerup_NewCmdElementMediaRecord
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -56703,7 +58201,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Powerup_NewCmdElementNetworkSett
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -56719,7 +58217,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Powerup_NewCmdElementNetworkSett
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -56736,7 +58234,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Powerup_NewCmdElementNetworkSett
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -56755,7 +58253,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Powerup_NewCmdElementNetworkSett
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -56774,7 +58272,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Powerup_NewCmdElementNetworkSett
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -56797,21 +58295,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Powerup_NewCmdElementNetworkSett
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -56845,7 +58342,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Powerup_NewCmdElementNetworkStat
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -56861,7 +58358,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Powerup_NewCmdElementNetworkStat
     {
         //Alloc Element Key
         elementKeyLength = strlen (_ssid);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, _ssid, (elementKeyLength + 1));
@@ -56878,7 +58375,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Powerup_NewCmdElementNetworkStat
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_STRING;
@@ -56910,7 +58407,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Powerup_NewCmdElementNetworkStat
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_I16;
@@ -56929,7 +58426,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Powerup_NewCmdElementNetworkStat
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -56948,7 +58445,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Powerup_NewCmdElementNetworkStat
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -56977,21 +58474,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Powerup_NewCmdElementNetworkStat
                     newElement->arguments->value.String = NULL;
                 }
                 
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -57023,7 +58519,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Powerup_NewCmdElementNetworkStat
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -57039,7 +58535,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Powerup_NewCmdElementNetworkStat
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -57060,17 +58556,16 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Powerup_NewCmdElementNetworkStat
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
     }
@@ -57104,7 +58599,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Powerup_NewCmdElementNetworkStat
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -57122,7 +58617,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Powerup_NewCmdElementNetworkStat
         
         //Alloc Element Key
         elementKeyLength = snprintf (NULL, 0, "%d", listIndex);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             snprintf (newElement->key, (elementKeyLength + 1), "%d", listIndex);
@@ -57141,7 +58636,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Powerup_NewCmdElementNetworkStat
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -57160,7 +58655,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Powerup_NewCmdElementNetworkStat
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -57179,7 +58674,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Powerup_NewCmdElementNetworkStat
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -57202,21 +58697,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Powerup_NewCmdElementNetworkStat
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -57248,7 +58742,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Powerup_NewCmdElementNetworkStat
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -57264,7 +58758,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Powerup_NewCmdElementNetworkStat
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -57285,17 +58779,16 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Powerup_NewCmdElementNetworkStat
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
     }
@@ -57329,7 +58822,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Powerup_NewCmdElementNetworkStat
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -57345,7 +58838,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Powerup_NewCmdElementNetworkStat
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -57362,7 +58855,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Powerup_NewCmdElementNetworkStat
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -57385,21 +58878,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Powerup_NewCmdElementNetworkStat
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -57432,7 +58924,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Powerup_NewCmdElementMediaStream
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -57448,7 +58940,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Powerup_NewCmdElementMediaStream
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -57465,7 +58957,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Powerup_NewCmdElementMediaStream
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -57488,21 +58980,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Powerup_NewCmdElementMediaStream
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -57535,7 +59026,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Powerup_NewCmdElementVideoSettin
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -57551,7 +59042,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Powerup_NewCmdElementVideoSettin
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -57568,7 +59059,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Powerup_NewCmdElementVideoSettin
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -57591,21 +59082,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Powerup_NewCmdElementVideoSettin
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -57638,7 +59128,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Powerup_NewCmdElementVideoSettin
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -57654,7 +59144,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Powerup_NewCmdElementVideoSettin
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -57671,7 +59161,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Powerup_NewCmdElementVideoSettin
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -57694,21 +59184,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Powerup_NewCmdElementVideoSettin
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -57741,7 +59230,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Powerup_NewCmdElementSoundsState
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -57757,7 +59246,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Powerup_NewCmdElementSoundsState
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -57774,7 +59263,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Powerup_NewCmdElementSoundsState
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -57797,21 +59286,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Powerup_NewCmdElementSoundsState
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -57845,6 +59333,27 @@ eARCONTROLLER_ERROR ARCONTROLLER_FEATURE_Powerup_SetNetworkController (ARCONTROL
     return error;
 }
 
+eARCONTROLLER_ERROR ARCONTROLLER_FEATURE_Powerup_SetSubscribedKeys (ARCONTROLLER_FEATURE_Powerup_t *feature, const uint8_t *subscribedKeys)
+{
+    // -- Set the commands of which the elements are built. --
+    
+    eARCONTROLLER_ERROR error = ARCONTROLLER_OK;
+    
+    // Check parameters
+    if ((feature == NULL) || (feature->privatePart == NULL))
+    {
+        error = ARCONTROLLER_ERROR_BAD_PARAMETER;
+    }
+    // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
+    
+    if (error == ARCONTROLLER_OK)
+    {
+        feature->privatePart->subscribedKeys = subscribedKeys;
+    }
+    
+    return error;
+}
+
 ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Powerup_GetCommandElements (ARCONTROLLER_FEATURE_Powerup_t *feature, eARCONTROLLER_DICTIONARY_KEY commandKey, eARCONTROLLER_ERROR *error)
 {
     // -- Get Command Arguments --
@@ -57949,6 +59458,7 @@ ARCONTROLLER_FEATURE_Pro_t *ARCONTROLLER_FEATURE_Pro_New (ARCONTROLLER_Network_t
             featureController->privatePart->networkController = networkController;
             featureController->privatePart->dictionary = NULL;
             featureController->privatePart->commandCallbacks = NULL;
+            featureController->privatePart->subscribedKeys = NULL;
             // Create the mutex 
             if (ARSAL_Mutex_Init (&(featureController->privatePart->mutex)) != 0)
             {
@@ -58252,6 +59762,12 @@ void ARCONTROLLER_FEATURE_Pro_ProStateSupportedFeaturesCallback (eARCOMMANDS_PRO
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -58335,6 +59851,12 @@ void ARCONTROLLER_FEATURE_Pro_ProStateFeaturesActivatedCallback (uint64_t _featu
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -58418,6 +59940,12 @@ void ARCONTROLLER_FEATURE_Pro_ProEventChallengeEventCallback (char * _challenge,
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -58503,7 +60031,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Pro_NewCmdElementProStateSupport
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -58519,7 +60047,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Pro_NewCmdElementProStateSupport
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -58536,7 +60064,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Pro_NewCmdElementProStateSupport
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -58555,7 +60083,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Pro_NewCmdElementProStateSupport
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U64;
@@ -58578,21 +60106,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Pro_NewCmdElementProStateSupport
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -58625,7 +60152,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Pro_NewCmdElementProStateFeature
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -58641,7 +60168,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Pro_NewCmdElementProStateFeature
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -58658,7 +60185,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Pro_NewCmdElementProStateFeature
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U64;
@@ -58681,21 +60208,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Pro_NewCmdElementProStateFeature
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -58729,7 +60255,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Pro_NewCmdElementProEventChallen
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -58745,7 +60271,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Pro_NewCmdElementProEventChallen
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -58762,7 +60288,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Pro_NewCmdElementProEventChallen
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_STRING;
@@ -58804,21 +60330,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Pro_NewCmdElementProEventChallen
                     newElement->arguments->value.String = NULL;
                 }
                 
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -58852,6 +60377,27 @@ eARCONTROLLER_ERROR ARCONTROLLER_FEATURE_Pro_SetNetworkController (ARCONTROLLER_
     return error;
 }
 
+eARCONTROLLER_ERROR ARCONTROLLER_FEATURE_Pro_SetSubscribedKeys (ARCONTROLLER_FEATURE_Pro_t *feature, const uint8_t *subscribedKeys)
+{
+    // -- Set the commands of which the elements are built. --
+    
+    eARCONTROLLER_ERROR error = ARCONTROLLER_OK;
+    
+    // Check parameters
+    if ((feature == NULL) || (feature->privatePart == NULL))
+    {
+        error = ARCONTROLLER_ERROR_BAD_PARAMETER;
+    }
+    // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
+    
+    if (error == ARCONTROLLER_OK)
+    {
+        feature->privatePart->subscribedKeys = subscribedKeys;
+    }
+    
+    return error;
+}
+
 ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Pro_GetCommandElements (ARCONTROLLER_FEATURE_Pro_t *feature, eARCONTROLLER_DICTIONARY_KEY commandKey, eARCONTROLLER_ERROR *error)
 {
     // -- Get Command Arguments --
@@ -58970,6 +60516,7 @@ ARCONTROLLER_FEATURE_Rc_t *ARCONTROLLER_FEATURE_Rc_New (ARCONTROLLER_Network_t *
             featureController->privatePart->networkController = networkController;
             featureController->privatePart->dictionary = NULL;
             featureController->privatePart->commandCallbacks = NULL;
+            featureController->privatePart->subscribedKeys = NULL;
             // Create the mutex 
             if (ARSAL_Mutex_Init (&(featureController->privatePart->mutex)) != 0)
             {
@@ -59347,6 +60894,12 @@ void ARCONTROLLER_FEATURE_Rc_ReceiverStateCallback (eARCOMMANDS_RC_RECEIVER_STAT
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -59430,6 +60983,12 @@ void ARCONTROLLER_FEATURE_Rc_ChannelsMonitorStateCallback (uint8_t _state, void
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -59522,6 +61081,12 @@ void ARCONTROLLER_FEATURE_Rc_ChannelValueCallback (uint8_t _id, eARCOMMANDS_RC_C
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -59642,6 +61207,12 @@ void ARCONTROLLER_FEATURE_Rc_CalibrationStateCallback (eARCOMMANDS_RC_CALIBRATIO
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -59725,6 +61296,12 @@ void ARCONTROLLER_FEATURE_Rc_ReceiverQualityCallback (uint8_t _level, void *cust
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -59811,7 +61388,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Rc_NewCmdElementReceiverState (A
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -59827,7 +61404,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Rc_NewCmdElementReceiverState (A
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -59844,7 +61421,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Rc_NewCmdElementReceiverState (A
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -59863,7 +61440,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Rc_NewCmdElementReceiverState (A
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_STRING;
@@ -59905,21 +61482,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Rc_NewCmdElementReceiverState (A
                     newElement->arguments->value.String = NULL;
                 }
                 
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -59952,7 +61528,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Rc_NewCmdElementChannelsMonitorS
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -59968,7 +61544,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Rc_NewCmdElementChannelsMonitorS
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -59985,7 +61561,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Rc_NewCmdElementChannelsMonitorS
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -60008,21 +61584,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Rc_NewCmdElementChannelsMonitorS
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -60055,7 +61630,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Rc_NewCmdElementChannelValue (AR
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -60071,7 +61646,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Rc_NewCmdElementChannelValue (AR
     {
         //Alloc Element Key
         elementKeyLength = snprintf (NULL, 0, "%"PRIu8, _id);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             snprintf (newElement->key, (elementKeyLength + 1), "%"PRIu8, _id);
@@ -60088,7 +61663,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Rc_NewCmdElementChannelValue (AR
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -60107,7 +61682,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Rc_NewCmdElementChannelValue (AR
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -60126,7 +61701,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Rc_NewCmdElementChannelValue (AR
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_I16;
@@ -60149,21 +61724,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Rc_NewCmdElementChannelValue (AR
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -60196,7 +61770,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Rc_NewCmdElementCalibrationState
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -60212,7 +61786,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Rc_NewCmdElementCalibrationState
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -60229,7 +61803,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Rc_NewCmdElementCalibrationState
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -60248,7 +61822,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Rc_NewCmdElementCalibrationState
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -60267,7 +61841,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Rc_NewCmdElementCalibrationState
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U32;
@@ -60286,7 +61860,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Rc_NewCmdElementCalibrationState
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U32;
@@ -60305,7 +61879,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Rc_NewCmdElementCalibrationState
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U32;
@@ -60324,7 +61898,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Rc_NewCmdElementCalibrationState
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -60343,7 +61917,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Rc_NewCmdElementCalibrationState
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U32;
@@ -60366,21 +61940,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Rc_NewCmdElementCalibrationState
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -60413,7 +61986,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Rc_NewCmdElementReceiverQuality
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -60429,7 +62002,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Rc_NewCmdElementReceiverQuality
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -60446,7 +62019,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Rc_NewCmdElementReceiverQuality
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -60469,21 +62042,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Rc_NewCmdElementReceiverQuality
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -60517,6 +62089,27 @@ eARCONTROLLER_ERROR ARCONTROLLER_FEATURE_Rc_SetNetworkController (ARCONTROLLER_F
     return error;
 }
 
+eARCONTROLLER_ERROR ARCONTROLLER_FEATURE_Rc_SetSubscribedKeys (ARCONTROLLER_FEATURE_Rc_t *feature, const uint8_t *subscribedKeys)
+{
+    // -- Set the commands of which the elements are built. --
+    
+    eARCONTROLLER_ERROR error = ARCONTROLLER_OK;
+    
+    // Check parameters
+    if ((feature == NULL) || (feature->privatePart == NULL))
+    {
+        error = ARCONTROLLER_ERROR_BAD_PARAMETER;
+    }
+    // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
+    
+    if (error == ARCONTROLLER_OK)
+    {
+        feature->privatePart->subscribedKeys = subscribedKeys;
+    }
+    
+    return error;
+}
+
 ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Rc_GetCommandElements (ARCONTROLLER_FEATURE_Rc_t *feature, eARCONTROLLER_DICTIONARY_KEY commandKey, eARCONTROLLER_ERROR *error)
 {
     // -- Get Command Arguments --
@@ -60738,6 +62331,7 @@ ARCONTROLLER_FEATURE_SkyController_t *ARCONTROLLER_FEATURE_SkyController_New (AR
             featureController->privatePart->networkController = networkController;
             featureController->privatePart->dictionary = NULL;
             featureController->privatePart->commandCallbacks = NULL;
+            featureController->privatePart->subscribedKeys = NULL;
             // Create the mutex 
             if (ARSAL_Mutex_Init (&(featureController->privatePart->mutex)) != 0)
             {
@@ -62093,6 +63687,12 @@ void ARCONTROLLER_FEATURE_SkyController_WifiStateWifiListCallback (char * _bssid
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -62176,6 +63776,12 @@ void ARCONTROLLER_FEATURE_SkyController_WifiStateConnexionChangedCallback (char
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -62260,6 +63866,12 @@ void ARCONTROLLER_FEATURE_SkyController_WifiStateWifiAuthChannelListChangedCallb
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -62348,6 +63960,12 @@ void ARCONTROLLER_FEATURE_SkyController_WifiStateAllWifiAuthChannelChangedCallba
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -62431,6 +64049,12 @@ void ARCONTROLLER_FEATURE_SkyController_WifiStateWifiSignalChangedCallback (uint
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -62515,6 +64139,12 @@ void ARCONTROLLER_FEATURE_SkyController_DeviceStateDeviceListCallback (char * _n
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -62603,6 +64233,12 @@ void ARCONTROLLER_FEATURE_SkyController_DeviceStateConnexionChangedCallback (eAR
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -62686,6 +64322,12 @@ void ARCONTROLLER_FEATURE_SkyController_SettingsStateAllSettingsChangedCallback
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -62769,6 +64411,12 @@ void ARCONTROLLER_FEATURE_SkyController_SettingsStateResetChangedCallback (void
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -62852,6 +64500,12 @@ void ARCONTROLLER_FEATURE_SkyController_SettingsStateProductSerialChangedCallbac
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -62935,6 +64589,12 @@ void ARCONTROLLER_FEATURE_SkyController_SettingsStateProductVariantChangedCallba
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -63018,6 +64678,12 @@ void ARCONTROLLER_FEATURE_SkyController_SettingsStateProductVersionChangedCallba
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -63101,6 +64767,12 @@ void ARCONTROLLER_FEATURE_SkyController_CommonStateAllStatesChangedCallback (voi
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -63184,6 +64856,12 @@ void ARCONTROLLER_FEATURE_SkyController_SkyControllerStateBatteryChangedCallback
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -63267,6 +64945,12 @@ void ARCONTROLLER_FEATURE_SkyController_SkyControllerStateGpsFixChangedCallback
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -63350,6 +65034,12 @@ void ARCONTROLLER_FEATURE_SkyController_SkyControllerStateGpsPositionChangedCall
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -63433,6 +65123,12 @@ void ARCONTROLLER_FEATURE_SkyController_SkyControllerStateBatteryStateCallback (
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -63516,6 +65212,12 @@ void ARCONTROLLER_FEATURE_SkyController_SkyControllerStateAttitudeChangedCallbac
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -63599,6 +65301,12 @@ void ARCONTROLLER_FEATURE_SkyController_AccessPointSettingsStateAccessPointSSIDC
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -63682,6 +65390,12 @@ void ARCONTROLLER_FEATURE_SkyController_AccessPointSettingsStateAccessPointChann
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -63765,6 +65479,12 @@ void ARCONTROLLER_FEATURE_SkyController_AccessPointSettingsStateWifiSelectionCha
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -63849,6 +65569,12 @@ void ARCONTROLLER_FEATURE_SkyController_GamepadInfosStateGamepadControlCallback
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -63937,6 +65663,12 @@ void ARCONTROLLER_FEATURE_SkyController_GamepadInfosStateAllGamepadControlsSentC
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -64020,6 +65752,12 @@ void ARCONTROLLER_FEATURE_SkyController_ButtonMappingsStateCurrentButtonMappings
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -64103,6 +65841,12 @@ void ARCONTROLLER_FEATURE_SkyController_ButtonMappingsStateAllCurrentButtonMappi
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -64186,6 +65930,12 @@ void ARCONTROLLER_FEATURE_SkyController_ButtonMappingsStateAvailableButtonMappin
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -64269,6 +66019,12 @@ void ARCONTROLLER_FEATURE_SkyController_ButtonMappingsStateAllAvailableButtonsMa
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -64352,6 +66108,12 @@ void ARCONTROLLER_FEATURE_SkyController_AxisMappingsStateCurrentAxisMappingsCall
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -64435,6 +66197,12 @@ void ARCONTROLLER_FEATURE_SkyController_AxisMappingsStateAllCurrentAxisMappingsS
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -64518,6 +66286,12 @@ void ARCONTROLLER_FEATURE_SkyController_AxisMappingsStateAvailableAxisMappingsCa
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -64601,6 +66375,12 @@ void ARCONTROLLER_FEATURE_SkyController_AxisMappingsStateAllAvailableAxisMapping
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -64684,6 +66464,12 @@ void ARCONTROLLER_FEATURE_SkyController_AxisFiltersStateCurrentAxisFiltersCallba
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -64767,6 +66553,12 @@ void ARCONTROLLER_FEATURE_SkyController_AxisFiltersStateAllCurrentFiltersSentCal
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -64850,6 +66642,12 @@ void ARCONTROLLER_FEATURE_SkyController_AxisFiltersStatePresetAxisFiltersCallbac
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -64933,6 +66731,12 @@ void ARCONTROLLER_FEATURE_SkyController_AxisFiltersStateAllPresetFiltersSentCall
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -65016,6 +66820,12 @@ void ARCONTROLLER_FEATURE_SkyController_CoPilotingStatePilotingSourceCallback (e
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -65099,6 +66909,12 @@ void ARCONTROLLER_FEATURE_SkyController_CalibrationStateMagnetoCalibrationStateC
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -65182,6 +66998,12 @@ void ARCONTROLLER_FEATURE_SkyController_CalibrationStateMagnetoCalibrationQualit
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -65265,6 +67087,12 @@ void ARCONTROLLER_FEATURE_SkyController_ButtonEventsSettingsCallback (void *cust
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -65351,7 +67179,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementWifiS
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -65367,7 +67195,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementWifiS
     {
         //Alloc Element Key
         elementKeyLength = strlen (_bssid);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, _bssid, (elementKeyLength + 1));
@@ -65384,7 +67212,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementWifiS
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_STRING;
@@ -65416,7 +67244,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementWifiS
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_STRING;
@@ -65448,7 +67276,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementWifiS
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -65467,7 +67295,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementWifiS
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -65486,7 +67314,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementWifiS
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_I32;
@@ -65505,7 +67333,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementWifiS
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_I32;
@@ -65540,21 +67368,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementWifiS
                     newElement->arguments->value.String = NULL;
                 }
                 
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -65588,7 +67415,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementWifiS
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -65604,7 +67431,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementWifiS
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -65621,7 +67448,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementWifiS
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_STRING;
@@ -65653,7 +67480,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementWifiS
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -65682,21 +67509,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementWifiS
                     newElement->arguments->value.String = NULL;
                 }
                 
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -65729,7 +67555,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementWifiS
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -65747,7 +67573,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementWifiS
         
         //Alloc Element Key
         elementKeyLength = snprintf (NULL, 0, "%d", listIndex);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             snprintf (newElement->key, (elementKeyLength + 1), "%d", listIndex);
@@ -65766,7 +67592,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementWifiS
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -65785,7 +67611,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementWifiS
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -65804,7 +67630,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementWifiS
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -65827,21 +67653,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementWifiS
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -65873,7 +67698,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementWifiS
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -65889,7 +67714,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementWifiS
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -65910,17 +67735,16 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementWifiS
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
     }
@@ -65954,7 +67778,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementWifiS
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -65970,7 +67794,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementWifiS
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -65987,7 +67811,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementWifiS
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -66010,21 +67834,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementWifiS
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -66058,7 +67881,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementDevic
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -66076,7 +67899,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementDevic
         
         //Alloc Element Key
         elementKeyLength = snprintf (NULL, 0, "%d", listIndex);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             snprintf (newElement->key, (elementKeyLength + 1), "%d", listIndex);
@@ -66095,7 +67918,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementDevic
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_STRING;
@@ -66137,21 +67960,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementDevic
                     newElement->arguments->value.String = NULL;
                 }
                 
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -66185,7 +68007,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementDevic
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -66201,7 +68023,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementDevic
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -66218,7 +68040,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementDevic
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -66237,7 +68059,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementDevic
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_STRING;
@@ -66269,7 +68091,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementDevic
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U16;
@@ -66298,21 +68120,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementDevic
                     newElement->arguments->value.String = NULL;
                 }
                 
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -66344,7 +68165,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementSetti
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -66360,7 +68181,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementSetti
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -66381,17 +68202,16 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementSetti
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
     }
@@ -66424,7 +68244,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementSetti
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -66440,7 +68260,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementSetti
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -66461,17 +68281,16 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementSetti
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
     }
@@ -66506,7 +68325,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementSetti
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -66522,7 +68341,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementSetti
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -66539,7 +68358,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementSetti
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_STRING;
@@ -66581,21 +68400,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementSetti
                     newElement->arguments->value.String = NULL;
                 }
                 
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -66628,7 +68446,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementSetti
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -66644,7 +68462,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementSetti
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -66661,7 +68479,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementSetti
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -66684,21 +68502,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementSetti
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -66732,7 +68549,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementSetti
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -66748,7 +68565,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementSetti
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -66765,7 +68582,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementSetti
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_STRING;
@@ -66797,7 +68614,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementSetti
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_STRING;
@@ -66845,21 +68662,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementSetti
                     newElement->arguments->value.String = NULL;
                 }
                 
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -66891,7 +68707,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementCommo
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -66907,7 +68723,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementCommo
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -66928,17 +68744,16 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementCommo
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
     }
@@ -66972,7 +68787,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementSkyCo
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -66988,7 +68803,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementSkyCo
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -67005,7 +68820,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementSkyCo
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -67028,21 +68843,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementSkyCo
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -67075,7 +68889,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementSkyCo
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -67091,7 +68905,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementSkyCo
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -67108,7 +68922,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementSkyCo
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -67131,21 +68945,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementSkyCo
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -67178,7 +68991,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementSkyCo
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -67194,7 +69007,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementSkyCo
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -67211,7 +69024,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementSkyCo
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_DOUBLE;
@@ -67230,7 +69043,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementSkyCo
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_DOUBLE;
@@ -67249,7 +69062,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementSkyCo
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_DOUBLE;
@@ -67268,7 +69081,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementSkyCo
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -67291,21 +69104,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementSkyCo
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -67338,7 +69150,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementSkyCo
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -67354,7 +69166,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementSkyCo
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -67371,7 +69183,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementSkyCo
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -67394,21 +69206,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementSkyCo
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -67441,7 +69252,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementSkyCo
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -67457,7 +69268,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementSkyCo
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -67474,7 +69285,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementSkyCo
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -67493,7 +69304,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementSkyCo
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -67512,7 +69323,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementSkyCo
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -67531,7 +69342,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementSkyCo
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -67554,21 +69365,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementSkyCo
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -67602,7 +69412,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementAcces
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -67618,7 +69428,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementAcces
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -67635,7 +69445,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementAcces
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_STRING;
@@ -67677,21 +69487,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementAcces
                     newElement->arguments->value.String = NULL;
                 }
                 
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -67724,7 +69533,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementAcces
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -67740,7 +69549,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementAcces
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -67757,7 +69566,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementAcces
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -67780,21 +69589,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementAcces
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -67827,7 +69635,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementAcces
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -67843,7 +69651,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementAcces
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -67860,7 +69668,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementAcces
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -67879,7 +69687,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementAcces
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -67898,7 +69706,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementAcces
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -67921,21 +69729,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementAcces
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -67969,7 +69776,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementGamep
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -67987,7 +69794,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementGamep
         
         //Alloc Element Key
         elementKeyLength = snprintf (NULL, 0, "%d", listIndex);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             snprintf (newElement->key, (elementKeyLength + 1), "%d", listIndex);
@@ -68006,7 +69813,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementGamep
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -68025,7 +69832,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementGamep
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_I32;
@@ -68044,7 +69851,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementGamep
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_STRING;
@@ -68086,21 +69893,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementGamep
                     newElement->arguments->value.String = NULL;
                 }
                 
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -68132,7 +69938,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementGamep
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -68148,7 +69954,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementGamep
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -68169,17 +69975,16 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementGamep
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
     }
@@ -68214,7 +70019,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementButto
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -68230,7 +70035,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementButto
     {
         //Alloc Element Key
         elementKeyLength = snprintf (NULL, 0, "%"PRIi32, _key_id);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             snprintf (newElement->key, (elementKeyLength + 1), "%"PRIi32, _key_id);
@@ -68247,7 +70052,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementButto
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_I32;
@@ -68266,7 +70071,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementButto
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_STRING;
@@ -68308,21 +70113,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementButto
                     newElement->arguments->value.String = NULL;
                 }
                 
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -68354,7 +70158,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementButto
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -68370,7 +70174,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementButto
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -68391,17 +70195,16 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementButto
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
     }
@@ -68436,7 +70239,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementButto
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -68452,7 +70255,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementButto
     {
         //Alloc Element Key
         elementKeyLength = strlen (_mapping_uid);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, _mapping_uid, (elementKeyLength + 1));
@@ -68469,7 +70272,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementButto
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_STRING;
@@ -68501,7 +70304,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementButto
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_STRING;
@@ -68549,21 +70352,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementButto
                     newElement->arguments->value.String = NULL;
                 }
                 
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -68595,7 +70397,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementButto
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -68611,7 +70413,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementButto
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -68632,17 +70434,16 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementButto
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
     }
@@ -68677,7 +70478,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementAxisM
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -68693,7 +70494,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementAxisM
     {
         //Alloc Element Key
         elementKeyLength = snprintf (NULL, 0, "%"PRIi32, _axis_id);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             snprintf (newElement->key, (elementKeyLength + 1), "%"PRIi32, _axis_id);
@@ -68710,7 +70511,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementAxisM
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_I32;
@@ -68729,7 +70530,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementAxisM
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_STRING;
@@ -68771,21 +70572,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementAxisM
                     newElement->arguments->value.String = NULL;
                 }
                 
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -68817,7 +70617,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementAxisM
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -68833,7 +70633,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementAxisM
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -68854,17 +70654,16 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementAxisM
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
     }
@@ -68899,7 +70698,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementAxisM
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -68915,7 +70714,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementAxisM
     {
         //Alloc Element Key
         elementKeyLength = strlen (_mapping_uid);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, _mapping_uid, (elementKeyLength + 1));
@@ -68932,7 +70731,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementAxisM
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_STRING;
@@ -68964,7 +70763,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementAxisM
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_STRING;
@@ -69012,21 +70811,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementAxisM
                     newElement->arguments->value.String = NULL;
                 }
                 
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -69058,7 +70856,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementAxisM
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -69074,7 +70872,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementAxisM
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -69095,17 +70893,16 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementAxisM
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
     }
@@ -69140,7 +70937,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementAxisF
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -69156,7 +70953,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementAxisF
     {
         //Alloc Element Key
         elementKeyLength = snprintf (NULL, 0, "%"PRIi32, _axis_id);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             snprintf (newElement->key, (elementKeyLength + 1), "%"PRIi32, _axis_id);
@@ -69173,7 +70970,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementAxisF
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_I32;
@@ -69192,7 +70989,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementAxisF
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_STRING;
@@ -69234,21 +71031,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementAxisF
                     newElement->arguments->value.String = NULL;
                 }
                 
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -69280,7 +71076,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementAxisF
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -69296,7 +71092,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementAxisF
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -69317,17 +71113,16 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementAxisF
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
     }
@@ -69362,7 +71157,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementAxisF
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -69378,7 +71173,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementAxisF
     {
         //Alloc Element Key
         elementKeyLength = strlen (_filter_uid);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, _filter_uid, (elementKeyLength + 1));
@@ -69395,7 +71190,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementAxisF
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_STRING;
@@ -69427,7 +71222,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementAxisF
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_STRING;
@@ -69475,21 +71270,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementAxisF
                     newElement->arguments->value.String = NULL;
                 }
                 
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -69521,7 +71315,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementAxisF
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -69537,7 +71331,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementAxisF
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -69558,17 +71352,16 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementAxisF
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
     }
@@ -69602,7 +71395,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementCoPil
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -69618,7 +71411,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementCoPil
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -69635,7 +71428,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementCoPil
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -69658,21 +71451,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementCoPil
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -69705,7 +71497,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementCalib
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -69721,7 +71513,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementCalib
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -69738,7 +71530,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementCalib
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -69757,7 +71549,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementCalib
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -69776,7 +71568,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementCalib
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -69795,7 +71587,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementCalib
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -69818,21 +71610,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementCalib
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -69865,7 +71656,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementCalib
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -69881,7 +71672,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementCalib
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -69898,7 +71689,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementCalib
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -69921,21 +71712,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementCalib
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -69967,7 +71757,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementButto
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -69983,7 +71773,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementButto
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -70004,17 +71794,16 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_NewCmdElementButto
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
     }
@@ -70049,6 +71838,27 @@ eARCONTROLLER_ERROR ARCONTROLLER_FEATURE_SkyController_SetNetworkController (ARC
     return error;
 }
 
+eARCONTROLLER_ERROR ARCONTROLLER_FEATURE_SkyController_SetSubscribedKeys (ARCONTROLLER_FEATURE_SkyController_t *feature, const uint8_t *subscribedKeys)
+{
+    // -- Set the commands of which the elements are built. --
+    
+    eARCONTROLLER_ERROR error = ARCONTROLLER_OK;
+    
+    // Check parameters
+    if ((feature == NULL) || (feature->privatePart == NULL))
+    {
+        error = ARCONTROLLER_ERROR_BAD_PARAMETER;
+    }
+    // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
+    
+    if (error == ARCONTROLLER_OK)
+    {
+        feature->privatePart->subscribedKeys = subscribedKeys;
+    }
+    
+    return error;
+}
+
 ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_SkyController_GetCommandElements (ARCONTROLLER_FEATURE_SkyController_t *feature, eARCONTROLLER_DICTIONARY_KEY commandKey, eARCONTROLLER_ERROR *error)
 {
     // -- Get Command Arguments --
@@ -70207,6 +72017,7 @@ ARCONTROLLER_FEATURE_UnknownFeature1_t *ARCONTROLLER_FEATURE_UnknownFeature1_New
             featureController->privatePart->networkController = networkController;
             featureController->privatePart->dictionary = NULL;
             featureController->privatePart->commandCallbacks = NULL;
+            featureController->privatePart->subscribedKeys = NULL;
             // Create the mutex 
             if (ARSAL_Mutex_Init (&(featureController->privatePart->mutex)) != 0)
             {
@@ -70841,6 +72652,12 @@ void ARCONTROLLER_FEATURE_UnknownFeature1_AvailabilityCallback (eARCOMMANDS_UNKN
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -70924,6 +72741,12 @@ void ARCONTROLLER_FEATURE_UnknownFeature1_RunCallback (eARCOMMANDS_UNKNOWN_FEATU
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -71007,6 +72830,12 @@ void ARCONTROLLER_FEATURE_UnknownFeature1_GeographicConfigChangedCallback (uint8
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -71090,6 +72919,12 @@ void ARCONTROLLER_FEATURE_UnknownFeature1_RelativeConfigChangedCallback (uint8_t
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -71173,6 +73008,12 @@ void ARCONTROLLER_FEATURE_UnknownFeature1_AnimRunCallback (eARCOMMANDS_UNKNOWN_F
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -71256,6 +73097,12 @@ void ARCONTROLLER_FEATURE_UnknownFeature1_SpiralAnimConfigChangedCallback (uint8
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -71339,6 +73186,12 @@ void ARCONTROLLER_FEATURE_UnknownFeature1_SwingAnimConfigChangedCallback (uint8_
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -71422,6 +73275,12 @@ void ARCONTROLLER_FEATURE_UnknownFeature1_BoomerangAnimConfigChangedCallback (ui
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -71505,6 +73364,12 @@ void ARCONTROLLER_FEATURE_UnknownFeature1_CandleAnimConfigChangedCallback (uint8
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -71588,6 +73453,12 @@ void ARCONTROLLER_FEATURE_UnknownFeature1_DollySlideAnimConfigChangedCallback (u
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -71671,6 +73542,12 @@ void ARCONTROLLER_FEATURE_UnknownFeature1_UserFramingPositionChangedCallback (in
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -71756,7 +73633,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_UnknownFeature1_NewCmdElementAva
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -71772,7 +73649,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_UnknownFeature1_NewCmdElementAva
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -71789,7 +73666,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_UnknownFeature1_NewCmdElementAva
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -71812,21 +73689,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_UnknownFeature1_NewCmdElementAva
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -71859,7 +73735,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_UnknownFeature1_NewCmdElementRun
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -71875,7 +73751,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_UnknownFeature1_NewCmdElementRun
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -71892,7 +73768,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_UnknownFeature1_NewCmdElementRun
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -71915,21 +73791,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_UnknownFeature1_NewCmdElementRun
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -71962,7 +73837,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_UnknownFeature1_NewCmdElementGeo
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -71978,7 +73853,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_UnknownFeature1_NewCmdElementGeo
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -71995,7 +73870,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_UnknownFeature1_NewCmdElementGeo
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -72014,7 +73889,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_UnknownFeature1_NewCmdElementGeo
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -72033,7 +73908,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_UnknownFeature1_NewCmdElementGeo
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -72052,7 +73927,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_UnknownFeature1_NewCmdElementGeo
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -72071,7 +73946,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_UnknownFeature1_NewCmdElementGeo
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -72090,7 +73965,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_UnknownFeature1_NewCmdElementGeo
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -72113,21 +73988,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_UnknownFeature1_NewCmdElementGeo
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -72160,7 +74034,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_UnknownFeature1_NewCmdElementRel
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -72176,7 +74050,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_UnknownFeature1_NewCmdElementRel
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -72193,7 +74067,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_UnknownFeature1_NewCmdElementRel
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -72212,7 +74086,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_UnknownFeature1_NewCmdElementRel
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -72231,7 +74105,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_UnknownFeature1_NewCmdElementRel
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -72250,7 +74124,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_UnknownFeature1_NewCmdElementRel
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -72269,7 +74143,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_UnknownFeature1_NewCmdElementRel
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -72288,7 +74162,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_UnknownFeature1_NewCmdElementRel
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -72311,21 +74185,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_UnknownFeature1_NewCmdElementRel
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -72358,7 +74231,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_UnknownFeature1_NewCmdElementAni
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -72374,7 +74247,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_UnknownFeature1_NewCmdElementAni
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -72391,7 +74264,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_UnknownFeature1_NewCmdElementAni
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -72414,21 +74287,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_UnknownFeature1_NewCmdElementAni
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -72461,7 +74333,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_UnknownFeature1_NewCmdElementSpi
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -72477,7 +74349,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_UnknownFeature1_NewCmdElementSpi
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -72494,7 +74366,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_UnknownFeature1_NewCmdElementSpi
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -72513,7 +74385,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_UnknownFeature1_NewCmdElementSpi
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -72532,7 +74404,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_UnknownFeature1_NewCmdElementSpi
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -72551,7 +74423,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_UnknownFeature1_NewCmdElementSpi
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -72570,7 +74442,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_UnknownFeature1_NewCmdElementSpi
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -72589,7 +74461,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_UnknownFeature1_NewCmdElementSpi
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -72612,21 +74484,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_UnknownFeature1_NewCmdElementSpi
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -72659,7 +74530,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_UnknownFeature1_NewCmdElementSwi
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -72675,7 +74546,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_UnknownFeature1_NewCmdElementSwi
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -72692,7 +74563,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_UnknownFeature1_NewCmdElementSwi
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -72711,7 +74582,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_UnknownFeature1_NewCmdElementSwi
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -72730,7 +74601,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_UnknownFeature1_NewCmdElementSwi
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -72749,7 +74620,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_UnknownFeature1_NewCmdElementSwi
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -72772,21 +74643,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_UnknownFeature1_NewCmdElementSwi
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -72819,7 +74689,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_UnknownFeature1_NewCmdElementBoo
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -72835,7 +74705,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_UnknownFeature1_NewCmdElementBoo
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -72852,7 +74722,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_UnknownFeature1_NewCmdElementBoo
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -72871,7 +74741,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_UnknownFeature1_NewCmdElementBoo
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -72890,7 +74760,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_UnknownFeature1_NewCmdElementBoo
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -72909,7 +74779,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_UnknownFeature1_NewCmdElementBoo
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -72932,21 +74802,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_UnknownFeature1_NewCmdElementBoo
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -72979,7 +74848,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_UnknownFeature1_NewCmdElementCan
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -72995,7 +74864,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_UnknownFeature1_NewCmdElementCan
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -73012,7 +74881,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_UnknownFeature1_NewCmdElementCan
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -73031,7 +74900,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_UnknownFeature1_NewCmdElementCan
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -73050,7 +74919,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_UnknownFeature1_NewCmdElementCan
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -73069,7 +74938,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_UnknownFeature1_NewCmdElementCan
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -73092,21 +74961,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_UnknownFeature1_NewCmdElementCan
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -73139,7 +75007,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_UnknownFeature1_NewCmdElementDol
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -73155,7 +75023,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_UnknownFeature1_NewCmdElementDol
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -73172,7 +75040,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_UnknownFeature1_NewCmdElementDol
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -73191,7 +75059,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_UnknownFeature1_NewCmdElementDol
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -73210,7 +75078,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_UnknownFeature1_NewCmdElementDol
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -73229,7 +75097,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_UnknownFeature1_NewCmdElementDol
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -73248,7 +75116,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_UnknownFeature1_NewCmdElementDol
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -73267,7 +75135,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_UnknownFeature1_NewCmdElementDol
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_FLOAT;
@@ -73290,21 +75158,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_UnknownFeature1_NewCmdElementDol
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -73337,7 +75204,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_UnknownFeature1_NewCmdElementUse
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -73353,7 +75220,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_UnknownFeature1_NewCmdElementUse
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -73370,7 +75237,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_UnknownFeature1_NewCmdElementUse
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_I8;
@@ -73389,7 +75256,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_UnknownFeature1_NewCmdElementUse
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_I8;
@@ -73412,21 +75279,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_UnknownFeature1_NewCmdElementUse
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -73460,6 +75326,27 @@ eARCONTROLLER_ERROR ARCONTROLLER_FEATURE_UnknownFeature1_SetNetworkController (A
     return error;
 }
 
+eARCONTROLLER_ERROR ARCONTROLLER_FEATURE_UnknownFeature1_SetSubscribedKeys (ARCONTROLLER_FEATURE_UnknownFeature1_t *feature, const uint8_t *subscribedKeys)
+{
+    // -- Set the commands of which the elements are built. --
+    
+    eARCONTROLLER_ERROR error = ARCONTROLLER_OK;
+    
+    // Check parameters
+    if ((feature == NULL) || (feature->privatePart == NULL))
+    {
+        error = ARCONTROLLER_ERROR_BAD_PARAMETER;
+    }
+    // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
+    
+    if (error == ARCONTROLLER_OK)
+    {
+        feature->privatePart->subscribedKeys = subscribedKeys;
+    }
+    
+    return error;
+}
+
 ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_UnknownFeature1_GetCommandElements (ARCONTROLLER_FEATURE_UnknownFeature1_t *feature, eARCONTROLLER_DICTIONARY_KEY commandKey, eARCONTROLLER_ERROR *error)
 {
     // -- Get Command Arguments --
@@ -73583,6 +75470,7 @@ ARCONTROLLER_FEATURE_Wifi_t *ARCONTROLLER_FEATURE_Wifi_New (ARCONTROLLER_Network
             featureController->privatePart->networkController = networkController;
             featureController->privatePart->dictionary = NULL;
             featureController->privatePart->commandCallbacks = NULL;
+            featureController->privatePart->subscribedKeys = NULL;
             // Create the mutex 
             if (ARSAL_Mutex_Init (&(featureController->privatePart->mutex)) != 0)
             {
@@ -74005,6 +75893,12 @@ void ARCONTROLLER_FEATURE_Wifi_ScannedItemCallback (char * _ssid, int16_t _rssi,
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -74122,6 +76016,12 @@ void ARCONTROLLER_FEATURE_Wifi_AuthorizedChannelCallback (eARCOMMANDS_WIFI_BAND
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -74226,6 +76126,12 @@ void ARCONTROLLER_FEATURE_Wifi_ApChannelChangedCallback (eARCOMMANDS_WIFI_SELECT
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -74309,6 +76215,12 @@ void ARCONTROLLER_FEATURE_Wifi_SecurityChangedCallback (char * _key, eARCOMMANDS
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -74392,6 +76304,12 @@ void ARCONTROLLER_FEATURE_Wifi_CountryChangedCallback (eARCOMMANDS_WIFI_COUNTRY_
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -74475,6 +76393,12 @@ void ARCONTROLLER_FEATURE_Wifi_EnvironmentChangedCallback (eARCOMMANDS_WIFI_ENVI
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -74558,6 +76482,12 @@ void ARCONTROLLER_FEATURE_Wifi_RssiChangedCallback (int16_t _rssi, void *customD
     }
     // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
     
+    if ((error == ARCONTROLLER_OK) && (!ARCONTROLLER_FEATURE_IS_SUBSCRIBED (feature->privatePart, commandKey)))
+    {
+        // No subscriber: the elements of the command are not built
+        return;
+    }
+    
     if (error == ARCONTROLLER_OK)
     {
         // Find command elements
@@ -74644,7 +76574,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Wifi_NewCmdElementScannedItem (A
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -74660,7 +76590,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Wifi_NewCmdElementScannedItem (A
     {
         //Alloc Element Key
         elementKeyLength = strlen (_ssid);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, _ssid, (elementKeyLength + 1));
@@ -74677,7 +76607,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Wifi_NewCmdElementScannedItem (A
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_STRING;
@@ -74709,7 +76639,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Wifi_NewCmdElementScannedItem (A
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_I16;
@@ -74728,7 +76658,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Wifi_NewCmdElementScannedItem (A
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -74747,7 +76677,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Wifi_NewCmdElementScannedItem (A
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -74776,21 +76706,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Wifi_NewCmdElementScannedItem (A
                     newElement->arguments->value.String = NULL;
                 }
                 
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -74823,7 +76752,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Wifi_NewCmdElementAuthorizedChan
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -74841,7 +76770,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Wifi_NewCmdElementAuthorizedChan
         
         //Alloc Element Key
         elementKeyLength = snprintf (NULL, 0, "%d", listIndex);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             snprintf (newElement->key, (elementKeyLength + 1), "%d", listIndex);
@@ -74860,7 +76789,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Wifi_NewCmdElementAuthorizedChan
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -74879,7 +76808,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Wifi_NewCmdElementAuthorizedChan
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -74898,7 +76827,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Wifi_NewCmdElementAuthorizedChan
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -74921,21 +76850,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Wifi_NewCmdElementAuthorizedChan
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -74968,7 +76896,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Wifi_NewCmdElementApChannelChang
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -74984,7 +76912,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Wifi_NewCmdElementApChannelChang
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -75001,7 +76929,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Wifi_NewCmdElementApChannelChang
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -75020,7 +76948,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Wifi_NewCmdElementApChannelChang
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -75039,7 +76967,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Wifi_NewCmdElementApChannelChang
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_U8;
@@ -75062,21 +76990,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Wifi_NewCmdElementApChannelChang
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -75110,7 +77037,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Wifi_NewCmdElementSecurityChange
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -75126,7 +77053,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Wifi_NewCmdElementSecurityChange
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -75143,7 +77070,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Wifi_NewCmdElementSecurityChange
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_STRING;
@@ -75175,7 +77102,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Wifi_NewCmdElementSecurityChange
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -75204,21 +77131,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Wifi_NewCmdElementSecurityChange
                     newElement->arguments->value.String = NULL;
                 }
                 
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -75252,7 +77178,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Wifi_NewCmdElementCountryChanged
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -75268,7 +77194,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Wifi_NewCmdElementCountryChanged
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -75285,7 +77211,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Wifi_NewCmdElementCountryChanged
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -75304,7 +77230,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Wifi_NewCmdElementCountryChanged
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_STRING;
@@ -75346,21 +77272,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Wifi_NewCmdElementCountryChanged
                     newElement->arguments->value.String = NULL;
                 }
                 
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -75393,7 +77318,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Wifi_NewCmdElementEnvironmentCha
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -75409,7 +77334,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Wifi_NewCmdElementEnvironmentCha
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -75426,7 +77351,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Wifi_NewCmdElementEnvironmentCha
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_ENUM;
@@ -75449,21 +77374,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Wifi_NewCmdElementEnvironmentCha
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -75496,7 +77420,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Wifi_NewCmdElementRssiChanged (A
     if (localError == ARCONTROLLER_OK)
     {
         // New element
-        newElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ELEMENT_t));
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
         if (newElement != NULL)
         {
             newElement->key = NULL;
@@ -75512,7 +77436,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Wifi_NewCmdElementRssiChanged (A
     {
         //Alloc Element Key
         elementKeyLength = strlen (ARCONTROLLER_DICTIONARY_SINGLE_KEY);
-        newElement->key = malloc (elementKeyLength + 1);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, elementKeyLength + 1);
         if (newElement->key != NULL)
         {
             strncpy (newElement->key, ARCONTROLLER_DICTIONARY_SINGLE_KEY, (elementKeyLength + 1));
@@ -75529,7 +77453,7 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Wifi_NewCmdElementRssiChanged (A
     if (localError == ARCONTROLLER_OK)
     {
         // New argument element
-        argDictNewElement = malloc (sizeof(ARCONTROLLER_DICTIONARY_ARG_t));
+        argDictNewElement = ARCONTROLLER_DictionaryPool_NewArg ();
         if (argDictNewElement != NULL)
         {
             argDictNewElement->valueType = ARCONTROLLER_DICTIONARY_VALUE_TYPE_I16;
@@ -75552,21 +77476,20 @@ ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Wifi_NewCmdElementRssiChanged (A
         {
             if (newElement->arguments != NULL)
             {
-                free (newElement->arguments);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newElement->arguments);
                 newElement->arguments = NULL;
             }
             
             if (newElement->key != NULL)
             {
-                free (newElement->key);
-                newElement->key = NULL;
+                ARCONTROLLER_DictionaryPool_DeleteElementKey (newElement);
             }
             
-            free (newElement);
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
             newElement = NULL;
         }
 
-        free (argDictNewElement);
+        ARCONTROLLER_DictionaryPool_DeleteArg (argDictNewElement);
         argDictNewElement = NULL;
     }
     // Return the error
@@ -75600,6 +77523,27 @@ eARCONTROLLER_ERROR ARCONTROLLER_FEATURE_Wifi_SetNetworkController (ARCONTROLLER
     return error;
 }
 
+eARCONTROLLER_ERROR ARCONTROLLER_FEATURE_Wifi_SetSubscribedKeys (ARCONTROLLER_FEATURE_Wifi_t *feature, const uint8_t *subscribedKeys)
+{
+    // -- Set the commands of which the elements are built. --
+    
+    eARCONTROLLER_ERROR error = ARCONTROLLER_OK;
+    
+    // Check parameters
+    if ((feature == NULL) || (feature->privatePart == NULL))
+    {
+        error = ARCONTROLLER_ERROR_BAD_PARAMETER;
+    }
+    // No Else: the checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing
+    
+    if (error == ARCONTROLLER_OK)
+    {
+        feature->privatePart->subscribedKeys = subscribedKeys;
+    }
+    
+    return error;
+}
+
 ARCONTROLLER_DICTIONARY_ELEMENT_t *ARCONTROLLER_Wifi_GetCommandElements (ARCONTROLLER_FEATURE_Wifi_t *feature, eARCONTROLLER_DICTIONARY_KEY commandKey, eARCONTROLLER_ERROR *error)
 {
     // -- Get Command Arguments --
@@ -20,6 +20,8 @@
 #include <libARCommands/ARCommands.h>
 #include <libARController/ARCONTROLLER_Feature.h>
 
+#include "ARCONTROLLER_Telemetry.h"
+
 void ARCONTROLLER_Feature_DeleteCommandsDictionary (ARCONTROLLER_DICTIONARY_COMMANDS_t **dictionary);
 
 ARCONTROLLER_DICTIONARY_COMMANDS_t *ARCONTROLLER_Feature_NewCommandsElement (int commandKey, eARCONTROLLER_ERROR *error);
@@ -31,6 +33,22 @@ void ARCONTROLLER_Feature_DeleteArgumentsDictionary (ARCONTROLLER_DICTIONARY_ARG
 
 void ARCONTROLLER_Feature_AddElement (ARCONTROLLER_DICTIONARY_ELEMENT_t **elementDict, ARCONTROLLER_DICTIONARY_ELEMENT_t *newElement);
 
+/**
+ * @brief Overwrite the arguments of the single element of a command in place.
+ * @param dictCmdElement The command element ; can be NULL.
+ * @param values The new values ; the argument, valueType and value fields are used.
+ * @param valuesCount Number of values.
+ * @return 1 if the element existed with all these arguments and was updated ; otherwise 0 and nothing is modified.
+ */
+int ARCONTROLLER_Feature_UpdateSingleElement (ARCONTROLLER_DICTIONARY_COMMANDS_t *dictCmdElement, const ARCONTROLLER_DICTIONARY_ARG_t *values, int valuesCount);
+
+/**
+ * @brief Check if the elements of a decoded command must be built.
+ * @param privatePart Private part of the feature.
+ * @param commandKey Key of the command.
+ */
+#define ARCONTROLLER_FEATURE_IS_SUBSCRIBED(privatePart, commandKey) (((privatePart)->subscribedKeys == NULL) || ((privatePart)->subscribedKeys[(commandKey)]))
+
 /*******************************
  * --- FEATURE generic --- 
  ******************************/
@@ -43,8 +61,17 @@ struct ARCONTROLLER_FEATURE_Generic_Private_t
     ARCONTROLLER_DICTIONARY_COMMANDS_t *dictionary; /**< stores states and settings of the device */
     ARCONTROLLER_Dictionary_t *commandCallbacks; /**< dictionary storing callbacks to use when the command is received. */
     ARSAL_Mutex_t mutex; /**< Mutex for multihreading */
+    const uint8_t *subscribedKeys; /**< 1 at the index of each command of which the elements are built ; NULL to build all commands */
 };
 
+/**
+ * @brief Set the commands of which the elements are built when they are decoded.
+ * @param feature The feature controller.
+ * @param[in] subscribedKeys Table indexed by eARCONTROLLER_DICTIONARY_KEY, 1 for each command to build ; NULL to build all commands. Must stay valid while the feature is used.
+ * @return executing error.
+ */
+eARCONTROLLER_ERROR ARCONTROLLER_FEATURE_Generic_SetSubscribedKeys (ARCONTROLLER_FEATURE_Generic_t *feature, const uint8_t *subscribedKeys);
+
 /**
  * @brief Send a command <code>Default</code> in project <code>Generic</code>
  * default
@@ -88,10 +115,21 @@ struct ARCONTROLLER_FEATURE_ARDrone3_Private_t
     ARCONTROLLER_DICTIONARY_COMMANDS_t *dictionary; /**< stores states and settings of the device */
     ARCONTROLLER_Dictionary_t *commandCallbacks; /**< dictionary storing callbacks to use when the command is received. */
     ARSAL_Mutex_t mutex; /**< Mutex for multihreading */
+    const uint8_t *subscribedKeys; /**< 1 at the index of each command of which the elements are built ; NULL to build all commands */
     ARCONTROLLER_ARDrone3_PilotingPCMDParameters_t *PilotingPCMDParameters; /**< */
     ARCONTROLLER_ARDrone3_CameraOrientationParameters_t *CameraOrientationParameters; /**< */
+    ARCONTROLLER_TELEMETRY_SEQLOCK_t telemetryLock; /**< Sequence lock of telemetry ; written under mutex */
+    ARCONTROLLER_TELEMETRY_ARDRONE3_t telemetry; /**< Typed snapshot of the periodic states */
 };
 
+/**
+ * @brief Set the commands of which the elements are built when they are decoded.
+ * @param feature The feature controller.
+ * @param[in] subscribedKeys Table indexed by eARCONTROLLER_DICTIONARY_KEY, 1 for each command to build ; NULL to build all commands. Must stay valid while the feature is used.
+ * @return executing error.
+ */
+eARCONTROLLER_ERROR ARCONTROLLER_FEATURE_ARDrone3_SetSubscribedKeys (ARCONTROLLER_FEATURE_ARDrone3_t *feature, const uint8_t *subscribedKeys);
+
 /**
  * @brief Send a command <code>PilotingFlatTrim</code> in project <code>ARDrone3</code>
  * Do a flat trim of the accelerometer/gyro.
@@ -1728,8 +1766,19 @@ struct ARCONTROLLER_FEATURE_Common_Private_t
     ARCONTROLLER_DICTIONARY_COMMANDS_t *dictionary; /**< stores states and settings of the device */
     ARCONTROLLER_Dictionary_t *commandCallbacks; /**< dictionary storing callbacks to use when the command is received. */
     ARSAL_Mutex_t mutex; /**< Mutex for multihreading */
+    const uint8_t *subscribedKeys; /**< 1 at the index of each command of which the elements are built ; NULL to build all commands */
+    ARCONTROLLER_TELEMETRY_SEQLOCK_t telemetryLock; /**< Sequence lock of telemetry ; written under mutex */
+    ARCONTROLLER_TELEMETRY_COMMON_t telemetry; /**< Typed snapshot of the periodic states */
 };
 
+/**
+ * @brief Set the commands of which the elements are built when they are decoded.
+ * @param feature The feature controller.
+ * @param[in] subscribedKeys Table indexed by eARCONTROLLER_DICTIONARY_KEY, 1 for each command to build ; NULL to build all commands. Must stay valid while the feature is used.
+ * @return executing error.
+ */
+eARCONTROLLER_ERROR ARCONTROLLER_FEATURE_Common_SetSubscribedKeys (ARCONTROLLER_FEATURE_Common_t *feature, const uint8_t *subscribedKeys);
+
 /**
  * @brief Send a command <code>NetworkDisconnect</code> in project <code>Common</code>
  * @deprecated
@@ -2596,8 +2645,17 @@ struct ARCONTROLLER_FEATURE_ControllerInfo_Private_t
     ARCONTROLLER_DICTIONARY_COMMANDS_t *dictionary; /**< stores states and settings of the device */
     ARCONTROLLER_Dictionary_t *commandCallbacks; /**< dictionary storing callbacks to use when the command is received. */
     ARSAL_Mutex_t mutex; /**< Mutex for multihreading */
+    const uint8_t *subscribedKeys; /**< 1 at the index of each command of which the elements are built ; NULL to build all commands */
 };
 
+/**
+ * @brief Set the commands of which the elements are built when they are decoded.
+ * @param feature The feature controller.
+ * @param[in] subscribedKeys Table indexed by eARCONTROLLER_DICTIONARY_KEY, 1 for each command to build ; NULL to build all commands. Must stay valid while the feature is used.
+ * @return executing error.
+ */
+eARCONTROLLER_ERROR ARCONTROLLER_FEATURE_ControllerInfo_SetSubscribedKeys (ARCONTROLLER_FEATURE_ControllerInfo_t *feature, const uint8_t *subscribedKeys);
+
 /**
  * @brief Send a command <code>Gps</code> in project <code>ControllerInfo</code>
  * Controller gps info.
@@ -2640,8 +2698,17 @@ struct ARCONTROLLER_FEATURE_Debug_Private_t
     ARCONTROLLER_DICTIONARY_COMMANDS_t *dictionary; /**< stores states and settings of the device */
     ARCONTROLLER_Dictionary_t *commandCallbacks; /**< dictionary storing callbacks to use when the command is received. */
     ARSAL_Mutex_t mutex; /**< Mutex for multihreading */
+    const uint8_t *subscribedKeys; /**< 1 at the index of each command of which the elements are built ; NULL to build all commands */
 };
 
+/**
+ * @brief Set the commands of which the elements are built when they are decoded.
+ * @param feature The feature controller.
+ * @param[in] subscribedKeys Table indexed by eARCONTROLLER_DICTIONARY_KEY, 1 for each command to build ; NULL to build all commands. Must stay valid while the feature is used.
+ * @return executing error.
+ */
+eARCONTROLLER_ERROR ARCONTROLLER_FEATURE_Debug_SetSubscribedKeys (ARCONTROLLER_FEATURE_Debug_t *feature, const uint8_t *subscribedKeys);
+
 /**
  * @brief Send a command <code>GetAllSettings</code> in project <code>Debug</code>
  * Cmd sent by controller to get all settings info (generate "settings_info" events).
@@ -2703,8 +2770,17 @@ struct ARCONTROLLER_FEATURE_DroneManager_Private_t
     ARCONTROLLER_DICTIONARY_COMMANDS_t *dictionary; /**< stores states and settings of the device */
     ARCONTROLLER_Dictionary_t *commandCallbacks; /**< dictionary storing callbacks to use when the command is received. */
     ARSAL_Mutex_t mutex; /**< Mutex for multihreading */
+    const uint8_t *subscribedKeys; /**< 1 at the index of each command of which the elements are built ; NULL to build all commands */
 };
 
+/**
+ * @brief Set the commands of which the elements are built when they are decoded.
+ * @param feature The feature controller.
+ * @param[in] subscribedKeys Table indexed by eARCONTROLLER_DICTIONARY_KEY, 1 for each command to build ; NULL to build all commands. Must stay valid while the feature is used.
+ * @return executing error.
+ */
+eARCONTROLLER_ERROR ARCONTROLLER_FEATURE_DroneManager_SetSubscribedKeys (ARCONTROLLER_FEATURE_DroneManager_t *feature, const uint8_t *subscribedKeys);
+
 /**
  * @brief Send a command <code>DiscoverDrones</code> in project <code>DroneManager</code>
  * Request the drone list.
@@ -2811,9 +2887,18 @@ struct ARCONTROLLER_FEATURE_JumpingSumo_Private_t
     ARCONTROLLER_DICTIONARY_COMMANDS_t *dictionary; /**< stores states and settings of the device */
     ARCONTROLLER_Dictionary_t *commandCallbacks; /**< dictionary storing callbacks to use when the command is received. */
     ARSAL_Mutex_t mutex; /**< Mutex for multihreading */
+    const uint8_t *subscribedKeys; /**< 1 at the index of each command of which the elements are built ; NULL to build all commands */
     ARCONTROLLER_JumpingSumo_PilotingPCMDParameters_t *PilotingPCMDParameters; /**< */
 };
 
+/**
+ * @brief Set the commands of which the elements are built when they are decoded.
+ * @param feature The feature controller.
+ * @param[in] subscribedKeys Table indexed by eARCONTROLLER_DICTIONARY_KEY, 1 for each command to build ; NULL to build all commands. Must stay valid while the feature is used.
+ * @return executing error.
+ */
+eARCONTROLLER_ERROR ARCONTROLLER_FEATURE_JumpingSumo_SetSubscribedKeys (ARCONTROLLER_FEATURE_JumpingSumo_t *feature, const uint8_t *subscribedKeys);
+
 /**
  * @brief Send a command <code>PilotingPCMD</code> in project <code>JumpingSumo</code>
  * Ask the JS speed and turn ratio.
@@ -3390,8 +3475,17 @@ struct ARCONTROLLER_FEATURE_Mapper_Private_t
     ARCONTROLLER_DICTIONARY_COMMANDS_t *dictionary; /**< stores states and settings of the device */
     ARCONTROLLER_Dictionary_t *commandCallbacks; /**< dictionary storing callbacks to use when the command is received. */
     ARSAL_Mutex_t mutex; /**< Mutex for multihreading */
+    const uint8_t *subscribedKeys; /**< 1 at the index of each command of which the elements are built ; NULL to build all commands */
 };
 
+/**
+ * @brief Set the commands of which the elements are built when they are decoded.
+ * @param feature The feature controller.
+ * @param[in] subscribedKeys Table indexed by eARCONTROLLER_DICTIONARY_KEY, 1 for each command to build ; NULL to build all commands. Must stay valid while the feature is used.
+ * @return executing error.
+ */
+eARCONTROLLER_ERROR ARCONTROLLER_FEATURE_Mapper_SetSubscribedKeys (ARCONTROLLER_FEATURE_Mapper_t *feature, const uint8_t *subscribedKeys);
+
 /**
  * @brief Send a command <code>Grab</code> in project <code>Mapper</code>
  * Grabbed buttons are sent to the app and are not handled by the mapper
@@ -3594,9 +3688,18 @@ struct ARCONTROLLER_FEATURE_MiniDrone_Private_t
     ARCONTROLLER_DICTIONARY_COMMANDS_t *dictionary; /**< stores states and settings of the device */
     ARCONTROLLER_Dictionary_t *commandCallbacks; /**< dictionary storing callbacks to use when the command is received. */
     ARSAL_Mutex_t mutex; /**< Mutex for multihreading */
+    const uint8_t *subscribedKeys; /**< 1 at the index of each command of which the elements are built ; NULL to build all commands */
     ARCONTROLLER_MiniDrone_PilotingPCMDParameters_t *PilotingPCMDParameters; /**< */
 };
 
+/**
+ * @brief Set the commands of which the elements are built when they are decoded.
+ * @param feature The feature controller.
+ * @param[in] subscribedKeys Table indexed by eARCONTROLLER_DICTIONARY_KEY, 1 for each command to build ; NULL to build all commands. Must stay valid while the feature is used.
+ * @return executing error.
+ */
+eARCONTROLLER_ERROR ARCONTROLLER_FEATURE_MiniDrone_SetSubscribedKeys (ARCONTROLLER_FEATURE_MiniDrone_t *feature, const uint8_t *subscribedKeys);
+
 /**
  * @brief Send a command <code>PilotingFlatTrim</code> in project <code>MiniDrone</code>
  * Do a flat trim
@@ -4239,9 +4342,18 @@ struct ARCONTROLLER_FEATURE_Powerup_Private_t
     ARCONTROLLER_DICTIONARY_COMMANDS_t *dictionary; /**< stores states and settings of the device */
     ARCONTROLLER_Dictionary_t *commandCallbacks; /**< dictionary storing callbacks to use when the command is received. */
     ARSAL_Mutex_t mutex; /**< Mutex for multihreading */
+    const uint8_t *subscribedKeys; /**< 1 at the index of each command of which the elements are built ; NULL to build all commands */
     ARCONTROLLER_Powerup_PilotingPCMDParameters_t *PilotingPCMDParameters; /**< */
 };
 
+/**
+ * @brief Set the commands of which the elements are built when they are decoded.
+ * @param feature The feature controller.
+ * @param[in] subscribedKeys Table indexed by eARCONTROLLER_DICTIONARY_KEY, 1 for each command to build ; NULL to build all commands. Must stay valid while the feature is used.
+ * @return executing error.
+ */
+eARCONTROLLER_ERROR ARCONTROLLER_FEATURE_Powerup_SetSubscribedKeys (ARCONTROLLER_FEATURE_Powerup_t *feature, const uint8_t *subscribedKeys);
+
 /**
  * @brief Send a command <code>PilotingPCMD</code> in project <code>Powerup</code>
  * Ask the Power Up speed and turn ratio.
@@ -4628,8 +4740,17 @@ struct ARCONTROLLER_FEATURE_Pro_Private_t
     ARCONTROLLER_DICTIONARY_COMMANDS_t *dictionary; /**< stores states and settings of the device */
     ARCONTROLLER_Dictionary_t *commandCallbacks; /**< dictionary storing callbacks to use when the command is received. */
     ARSAL_Mutex_t mutex; /**< Mutex for multihreading */
+    const uint8_t *subscribedKeys; /**< 1 at the index of each command of which the elements are built ; NULL to build all commands */
 };
 
+/**
+ * @brief Set the commands of which the elements are built when they are decoded.
+ * @param feature The feature controller.
+ * @param[in] subscribedKeys Table indexed by eARCONTROLLER_DICTIONARY_KEY, 1 for each command to build ; NULL to build all commands. Must stay valid while the feature is used.
+ * @return executing error.
+ */
+eARCONTROLLER_ERROR ARCONTROLLER_FEATURE_Pro_SetSubscribedKeys (ARCONTROLLER_FEATURE_Pro_t *feature, const uint8_t *subscribedKeys);
+
 /**
  * @brief Send a command <code>ProBoughtFeatures</code> in project <code>Pro</code>
  * Bought features on this pro version of the controller (features that have been bought)
@@ -4704,8 +4825,17 @@ struct ARCONTROLLER_FEATURE_Rc_Private_t
     ARCONTROLLER_DICTIONARY_COMMANDS_t *dictionary; /**< stores states and settings of the device */
     ARCONTROLLER_Dictionary_t *commandCallbacks; /**< dictionary storing callbacks to use when the command is received. */
     ARSAL_Mutex_t mutex; /**< Mutex for multihreading */
+    const uint8_t *subscribedKeys; /**< 1 at the index of each command of which the elements are built ; NULL to build all commands */
 };
 
+/**
+ * @brief Set the commands of which the elements are built when they are decoded.
+ * @param feature The feature controller.
+ * @param[in] subscribedKeys Table indexed by eARCONTROLLER_DICTIONARY_KEY, 1 for each command to build ; NULL to build all commands. Must stay valid while the feature is used.
+ * @return executing error.
+ */
+eARCONTROLLER_ERROR ARCONTROLLER_FEATURE_Rc_SetSubscribedKeys (ARCONTROLLER_FEATURE_Rc_t *feature, const uint8_t *subscribedKeys);
+
 /**
  * @brief Send a command <code>MonitorChannels</code> in project <code>Rc</code>
  * Enable or Disable RC channels monitoring.
@@ -4826,8 +4956,17 @@ struct ARCONTROLLER_FEATURE_SkyController_Private_t
     ARCONTROLLER_DICTIONARY_COMMANDS_t *dictionary; /**< stores states and settings of the device */
     ARCONTROLLER_Dictionary_t *commandCallbacks; /**< dictionary storing callbacks to use when the command is received. */
     ARSAL_Mutex_t mutex; /**< Mutex for multihreading */
+    const uint8_t *subscribedKeys; /**< 1 at the index of each command of which the elements are built ; NULL to build all commands */
 };
 
+/**
+ * @brief Set the commands of which the elements are built when they are decoded.
+ * @param feature The feature controller.
+ * @param[in] subscribedKeys Table indexed by eARCONTROLLER_DICTIONARY_KEY, 1 for each command to build ; NULL to build all commands. Must stay valid while the feature is used.
+ * @return executing error.
+ */
+eARCONTROLLER_ERROR ARCONTROLLER_FEATURE_SkyController_SetSubscribedKeys (ARCONTROLLER_FEATURE_SkyController_t *feature, const uint8_t *subscribedKeys);
+
 /**
  * @brief Send a command <code>WifiRequestWifiList</code> in project <code>SkyController</code>
  * Request wifi list
@@ -5520,8 +5659,17 @@ struct ARCONTROLLER_FEATURE_UnknownFeature1_Private_t
     ARCONTROLLER_DICTIONARY_COMMANDS_t *dictionary; /**< stores states and settings of the device */
     ARCONTROLLER_Dictionary_t *commandCallbacks; /**< dictionary storing callbacks to use when the command is received. */
     ARSAL_Mutex_t mutex; /**< Mutex for multihreading */
+    const uint8_t *subscribedKeys; /**< 1 at the index of each command of which the elements are built ; NULL to build all commands */
 };
 
+/**
+ * @brief Set the commands of which the elements are built when they are decoded.
+ * @param feature The feature controller.
+ * @param[in] subscribedKeys Table indexed by eARCONTROLLER_DICTIONARY_KEY, 1 for each command to build ; NULL to build all commands. Must stay valid while the feature is used.
+ * @return executing error.
+ */
+eARCONTROLLER_ERROR ARCONTROLLER_FEATURE_UnknownFeature1_SetSubscribedKeys (ARCONTROLLER_FEATURE_UnknownFeature1_t *feature, const uint8_t *subscribedKeys);
+
 /**
  * @brief Send a command <code>GeographicRun</code> in project <code>UnknownFeature1</code>
  * Begin or stop geographic type followMe (follow the leader keeping the same vector).
@@ -5842,8 +5990,17 @@ struct ARCONTROLLER_FEATURE_Wifi_Private_t
     ARCONTROLLER_DICTIONARY_COMMANDS_t *dictionary; /**< stores states and settings of the device */
     ARCONTROLLER_Dictionary_t *commandCallbacks; /**< dictionary storing callbacks to use when the command is received. */
     ARSAL_Mutex_t mutex; /**< Mutex for multihreading */
+    const uint8_t *subscribedKeys; /**< 1 at the index of each command of which the elements are built ; NULL to build all commands */
 };
 
+/**
+ * @brief Set the commands of which the elements are built when they are decoded.
+ * @param feature The feature controller.
+ * @param[in] subscribedKeys Table indexed by eARCONTROLLER_DICTIONARY_KEY, 1 for each command to build ; NULL to build all commands. Must stay valid while the feature is used.
+ * @return executing error.
+ */
+eARCONTROLLER_ERROR ARCONTROLLER_FEATURE_Wifi_SetSubscribedKeys (ARCONTROLLER_FEATURE_Wifi_t *feature, const uint8_t *subscribedKeys);
+
 /**
  * @brief Send a command <code>Scan</code> in project <code>Wifi</code>
  * Launches wifi network scan for a given band to get a list of all wifi networks found by the drone.
@@ -44,11 +44,20 @@
 #include <libARController/ARCONTROLLER_Frame.h>
 
 #include "ARCONTROLLER_Frame.h"
+#include "ARCONTROLLER_StreamPool.h"
 
 /*************************
  * Private header
  *************************/
 
+/**
+ * @brief Allocate or reallocate the data buffer of a frame, preceded by its ARCONTROLLER_FRAME_DATA_HEADER_t.
+ * @param frame The frame.
+ * @param capacity The new capacity.
+ * @return '1' if the buffer is allocated, otherwise '0' and the previous buffer is kept.
+ */
+static int ARCONTROLLER_Frame_AllocBase (ARCONTROLLER_Frame_t *frame, uint32_t capacity);
+
 /*************************
  * Implementation
  *************************/
@@ -85,6 +94,8 @@ ARCONTROLLER_Frame_t *ARCONTROLLER_Frame_NewWithCapacity (uint32_t defaultCapaci
             frame->base = NULL;
             frame->metadata = NULL;
             frame->metadataSize = 0;
+            frame->pool = NULL;
+            frame->poolIndex = 0;
         }
         else
         {
@@ -95,13 +106,7 @@ ARCONTROLLER_Frame_t *ARCONTROLLER_Frame_NewWithCapacity (uint32_t defaultCapaci
     if ((localError == ARCONTROLLER_OK) && (defaultCapacity > 0))
     {
         //alloc data
-        frame->base = malloc (sizeof (uint8_t) * defaultCapacity);
-        if (frame->base != NULL)
-        {
-            frame->data = frame->base;
-            frame->capacity = defaultCapacity;
-        }
-        else
+        if (!ARCONTROLLER_Frame_AllocBase (frame, defaultCapacity))
         {
             localError = ARCONTROLLER_ERROR_ALLOC;
         }
@@ -128,7 +133,7 @@ void ARCONTROLLER_Frame_Delete (ARCONTROLLER_Frame_t **frame)
             // Free data
             if ((*frame)->base != NULL)
             {
-                free ((*frame)->base);
+                free ((*frame)->base - sizeof (ARCONTROLLER_FRAME_DATA_HEADER_t));
                 (*frame)->base = NULL;
                 (*frame)->data = NULL;
             }
@@ -145,7 +150,6 @@ int ARCONTROLLER_Frame_ensureCapacityIsAtLeast (ARCONTROLLER_Frame_t *frame, uin
 
     eARCONTROLLER_ERROR localError = ARCONTROLLER_OK;
     int res = 0;
-    uint8_t *newData = NULL;
     
     // Check parameters
     if (frame == NULL)
@@ -163,12 +167,8 @@ int ARCONTROLLER_Frame_ensureCapacityIsAtLeast (ARCONTROLLER_Frame_t *frame, uin
         else
         {
             // Realloc data
-            newData = realloc (frame->base, minimumCapacity);
-            if (newData != NULL)
+            if (ARCONTROLLER_Frame_AllocBase (frame, minimumCapacity))
             {
-                frame->base = newData;
-                frame->data = frame->base;
-                frame->capacity = minimumCapacity;
                 res = 1;
             }
             else
@@ -203,23 +203,82 @@ eARCONTROLLER_ERROR ARCONTROLLER_Frame_SetFree (ARCONTROLLER_Frame_t *frame)
     
     if (error == ARCONTROLLER_OK)
     {
+        frame->data = frame->base; // readers may have moved data past the sps/pps or the audio header
         frame->used = 0;
         frame->missed = 0;
         frame->width = 0;
         frame->height = 0;
         frame->timestamp = 0;
         frame->isIFrame = 0;
-        frame->available = 1;
         frame->metadata = NULL;
         frame->metadataSize = 0;
+
+        if (frame->pool != NULL)
+        {
+            // Give the frame back to its pool, only once even if it is freed twice
+            if (ARCONTROLLER_STREAMPOOL_EXCHANGE (&frame->available, 1) == 0)
+            {
+                ARCONTROLLER_StreamPool_PutFrame (frame->pool, frame);
+            }
+            // No else: the frame is already free
+        }
+        else
+        {
+            frame->available = 1;
+        }
     }
 
     return error;
 }
 
+ARCONTROLLER_Frame_t *ARCONTROLLER_Frame_GetFromBase (uint8_t *base)
+{
+    // -- Get the frame owning a data buffer --
+
+    ARCONTROLLER_FRAME_DATA_HEADER_t *dataHeader = NULL;
+    ARCONTROLLER_Frame_t *frame = NULL;
+
+    if (base != NULL)
+    {
+        dataHeader = (ARCONTROLLER_FRAME_DATA_HEADER_t *)(base - sizeof (ARCONTROLLER_FRAME_DATA_HEADER_t));
+        if ((dataHeader->header.magic == ARCONTROLLER_FRAME_DATA_MAGIC) &&
+            (dataHeader->header.frame != NULL) &&
+            (dataHeader->header.frame->base == base))
+        {
+            frame = dataHeader->header.frame;
+        }
+    }
+
+    return frame;
+}
+
 /*****************************************
  *
  *             local implementation:
  *
  ****************************************/
 
+static int ARCONTROLLER_Frame_AllocBase (ARCONTROLLER_Frame_t *frame, uint32_t capacity)
+{
+    // -- Allocate the data buffer after its header --
+
+    ARCONTROLLER_FRAME_DATA_HEADER_t *dataHeader = NULL;
+    uint8_t *previous = (frame->base != NULL) ? (frame->base - sizeof (ARCONTROLLER_FRAME_DATA_HEADER_t)) : NULL;
+    int res = 0;
+
+    dataHeader = realloc (previous, sizeof (ARCONTROLLER_FRAME_DATA_HEADER_t) + (sizeof (uint8_t) * capacity));
+    if (dataHeader != NULL)
+    {
+        dataHeader->header.magic = ARCONTROLLER_FRAME_DATA_MAGIC;
+        dataHeader->header.frame = frame;
+
+        frame->base = (uint8_t *)(dataHeader + 1);
+        frame->data = frame->base;
+        frame->capacity = capacity;
+        res = 1;
+    }
+    // No else: the previous buffer is kept
+
+    return res;
+}
+
@@ -42,6 +42,29 @@
 
 #define ARCONTROLLER_FRAME_TAG "ARCONTROLLER_Frame"
 
+#define ARCONTROLLER_FRAME_DATA_MAGIC 0x46524D45 /**< Marks a data buffer allocated by ARCONTROLLER_Frame ("FRME") */
+
+/**
+ * @brief Header placed just before the data buffer of each frame, to find the frame back from its data in constant time.
+ * @note The union keeps the buffer aligned as malloc would.
+ */
+typedef union
+{
+    struct
+    {
+        uint32_t magic; /**< ARCONTROLLER_FRAME_DATA_MAGIC */
+        ARCONTROLLER_Frame_t *frame; /**< Frame owning the buffer */
+    } header;
+    uint64_t align[2];
+} ARCONTROLLER_FRAME_DATA_HEADER_t;
+
+/**
+ * @brief Get the frame owning a data buffer.
+ * @param base Data buffer ; must be the 'base' of a frame.
+ * @return The frame, or NULL if the buffer was not allocated by ARCONTROLLER_Frame.
+ */
+ARCONTROLLER_Frame_t *ARCONTROLLER_Frame_GetFromBase (uint8_t *base);
+
 
 
 #endif /* _ARCONTROLLER_FRAME_PRIVATE_H_ */
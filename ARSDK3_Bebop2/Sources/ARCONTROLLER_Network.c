@@ -57,6 +57,11 @@
  * Private header
  *************************/
 
+/**
+ * @brief Decode a command and print the decoding errors.
+ */
+static void ARCONTROLLER_Network_DecodeCommand (ARCONTROLLER_Network_t *networkController, uint8_t *data, int dataSize);
+
 /*************************
  * Implementation
  *************************/
@@ -143,6 +148,7 @@ ARCONTROLLER_Network_t *ARCONTROLLER_Network_New (ARDISCOVERY_Device_t *discover
             networkController->txThread = NULL;
             networkController->readerThreads = NULL;
             networkController->readerThreadsData = NULL;
+            networkController->directDispatch = 0;
             networkController->state = ARCONTROLLER_NETWORK_STATE_RUNNING;
             
             //video part
@@ -671,6 +677,164 @@ eARCONTROLLER_ERROR ARCONTROLLER_Network_SetVideoStreamMP4Compliant (ARCONTROLLE
     return error;
 }
 
+eARCONTROLLER_ERROR ARCONTROLLER_Network_SetVideoStreamDecodeStage (ARCONTROLLER_Network_t *networkController, eARCONTROLLER_STREAM_DECODE_POLICY policy, int queueSize)
+{
+    // -- Set the decode stage of the video stream --
+    
+    eARCONTROLLER_ERROR error = ARCONTROLLER_OK;
+    int locked = 0;
+    
+    // Check parameters
+    if (networkController == NULL)
+    {
+        error = ARCONTROLLER_ERROR_BAD_PARAMETER;
+    }
+    // No Else: the checking parameters sets error to ARCONTROLLER_ERROR_BAD_PARAMETER and stop the processing
+    
+    if (error == ARCONTROLLER_OK)
+    {
+        if (ARSAL_Mutex_Lock (&(networkController->mutex)) != 0)
+        {
+            error = ARCONTROLLER_ERROR_MUTEX;
+        }
+        else
+        {
+            locked = 1;
+        }
+    }
+    
+    if (error == ARCONTROLLER_OK)
+    {
+        // Check if the device has video
+        if (networkController->hasVideo)
+        {
+            error = ARCONTROLLER_Stream_SetDecodeStage (networkController->videoController, policy, queueSize);
+        }
+        //NO else ; device has not video
+    }
+    // No else: skipped by an error
+    
+    if (locked)
+    {
+        ARSAL_Mutex_Unlock (&(networkController->mutex));
+    }
+    
+    return error;
+}
+
+eARCONTROLLER_ERROR ARCONTROLLER_Network_GetVideoStreamDecodeStats (ARCONTROLLER_Network_t *networkController, ARCONTROLLER_Stream_DecodeStats_t *stats)
+{
+    // -- Get the statistics of the decode stage of the video stream --
+    
+    eARCONTROLLER_ERROR error = ARCONTROLLER_OK;
+    int locked = 0;
+    
+    // Check parameters
+    if ((networkController == NULL) ||
+        (stats == NULL))
+    {
+        error = ARCONTROLLER_ERROR_BAD_PARAMETER;
+    }
+    // No Else: the checking parameters sets error to ARCONTROLLER_ERROR_BAD_PARAMETER and stop the processing
+    
+    if (error == ARCONTROLLER_OK)
+    {
+        if (ARSAL_Mutex_Lock (&(networkController->mutex)) != 0)
+        {
+            error = ARCONTROLLER_ERROR_MUTEX;
+        }
+        else
+        {
+            locked = 1;
+        }
+    }
+    
+    if (error == ARCONTROLLER_OK)
+    {
+        // Check if the device has video
+        if (networkController->hasVideo)
+        {
+            error = ARCONTROLLER_Stream_GetDecodeStats (networkController->videoController, stats);
+        }
+        else
+        {
+            error = ARCONTROLLER_ERROR_NO_VIDEO;
+        }
+    }
+    // No else: skipped by an error
+    
+    if (locked)
+    {
+        ARSAL_Mutex_Unlock (&(networkController->mutex));
+    }
+    
+    return error;
+}
+
+eARCONTROLLER_ERROR ARCONTROLLER_Network_SetDirectCommandDispatch (ARCONTROLLER_Network_t *networkController, int directDispatch)
+{
+    // -- Set how the commands received are decoded --
+    
+    eARCONTROLLER_ERROR error = ARCONTROLLER_OK;
+    int locked = 0;
+    int changed = 0;
+    int bufferIndex = 0;
+    
+    // Check parameters
+    if (networkController == NULL)
+    {
+        error = ARCONTROLLER_ERROR_BAD_PARAMETER;
+    }
+    // No Else: the checking parameters sets error to ARCONTROLLER_ERROR_BAD_PARAMETER and stop the processing
+    
+    if (error == ARCONTROLLER_OK)
+    {
+        if (ARSAL_Mutex_Lock (&(networkController->mutex)) != 0)
+        {
+            error = ARCONTROLLER_ERROR_MUTEX;
+        }
+        else
+        {
+            locked = 1;
+        }
+    }
+    
+    if ((error == ARCONTROLLER_OK) && (networkController->directDispatch != directDispatch))
+    {
+        networkController->directDispatch = directDispatch;
+        changed = 1;
+        
+        // From now on, the receiver thread delivers the commands or copies them in the buffers again
+        for (bufferIndex = 0 ; bufferIndex < networkController->networkConfig.numberOfDeviceToControllerCommandsBufferIds ; bufferIndex++)
+        {
+            eARNETWORK_ERROR netError = ARNETWORK_Manager_SetDirectReadCallback (networkController->networkManager, networkController->networkConfig.deviceToControllerCommandsBufferIds[bufferIndex], (directDispatch) ? ARCONTROLLER_Network_OnDirectRead : NULL, networkController);
+            if (netError != ARNETWORK_OK)
+            {
+                ARSAL_PRINT(ARSAL_PRINT_ERROR, ARCONTROLLER_NETWORK_TAG, "ARNETWORK_Manager_SetDirectReadCallback () failed : %s", ARNETWORK_Error_ToString(netError));
+            }
+        }
+    }
+    // No else: skipped by an error or nothing to change
+    
+    if (locked)
+    {
+        ARSAL_Mutex_Unlock (&(networkController->mutex));
+    }
+    
+    if (changed)
+    {
+        // The reader threads stop by themselves once their buffer is drained in direct dispatch
+        error = ARCONTROLLER_Network_StopReaderThreads (networkController);
+        
+        if ((error == ARCONTROLLER_OK) && (!directDispatch))
+        {
+            error = ARCONTROLLER_Network_CreateReaderThreads (networkController);
+        }
+    }
+    
+    return error;
+}
+
 eARCONTROLLER_ERROR ARCONTROLLER_Network_SetAudioReceiveCallback (ARCONTROLLER_Network_t *networkController, ARCONTROLLER_Stream_DecoderConfigCallback_t decoderConfigCallback, ARCONTROLLER_Stream_DidReceiveFrameCallback_t receiveFrameCallback, ARCONTROLLER_Stream_TimeoutFrameCallback_t timeoutFrameCallback, void *customData)
 {
     // -- Set Audio Receive Callback --
@@ -1252,23 +1416,26 @@ void *ARCONTROLLER_Network_ReaderRun (void *data)
                     {
                         ARSAL_PRINT(ARSAL_PRINT_ERROR, ARCONTROLLER_NETWORK_TAG, "ARNETWORK_Manager_ReadDataWithTimeout () failed : %s", ARNETWORK_Error_ToString(netError));
                     }
+                    else if (networkController->directDispatch)
+                    {
+                        // The receiver thread decodes the commands now ; the buffer is drained
+                        break;
+                    }
                     skip = 1;
                 }
                 
                 if (!skip)
                 {
                     // Forward data to the CommandsManager
-                    eARCOMMANDS_DECODER_ERROR cmdError = ARCOMMANDS_DECODER_OK;
-                    cmdError = ARCOMMANDS_Decoder_DecodeCommand (networkController->decoder, (uint8_t *)readData, length);
-                    if ((cmdError != ARCOMMANDS_DECODER_OK) && (cmdError != ARCOMMANDS_DECODER_ERROR_NO_CALLBACK))
-                    {
-                        char msg[128];
-                        ARCOMMANDS_Decoder_DescribeBuffer ((uint8_t *)readData, length, msg, sizeof(msg));
-                        ARSAL_PRINT(ARSAL_PRINT_ERROR, ARCONTROLLER_NETWORK_TAG, "ARCOMMANDS_Decoder_DecodeBuffer () failed : %d %s", cmdError, msg);
-                    }
+                    ARCONTROLLER_Network_DecodeCommand (networkController, (uint8_t *)readData, length);
                 }
                 //NO ELSE ; no data read
             }
+            else if (networkController->directDispatch)
+            {
+                // Paused: nothing to drain for the receiver thread
+                break;
+            }
             else
             {
                 //sleep
@@ -1293,6 +1460,17 @@ void *ARCONTROLLER_Network_ReaderRun (void *data)
     return NULL;
 }
 
+void ARCONTROLLER_Network_OnDirectRead (int bufferId, uint8_t *data, int dataSize, void *customData)
+{
+    ARCONTROLLER_Network_t *networkController = (ARCONTROLLER_Network_t *)customData;
+    
+    if ((networkController != NULL) && (networkController->state == ARCONTROLLER_NETWORK_STATE_RUNNING))
+    {
+        ARCONTROLLER_Network_DecodeCommand (networkController, data, dataSize);
+    }
+    //NO ELSE ; the commands are dropped while the network controller is paused or stopped
+}
+
 void ARCONTROLLER_Network_OnDisconnectNetwork (ARNETWORK_Manager_t *manager, ARNETWORKAL_Manager_t *alManager, void *customData)
 {
     ARCONTROLLER_Network_t *networkController = (ARCONTROLLER_Network_t *)customData;
@@ -1350,3 +1528,22 @@ eARNETWORK_MANAGER_CALLBACK_RETURN ARCONTROLLER_Network_SendingCallback(int buff
     
     return retval;
 }
+
+/*****************************************
+ *
+ *             local implementation:
+ *
+ ****************************************/
+
+static void ARCONTROLLER_Network_DecodeCommand (ARCONTROLLER_Network_t *networkController, uint8_t *data, int dataSize)
+{
+    // -- Forward data to the CommandsManager --
+    
+    eARCOMMANDS_DECODER_ERROR cmdError = ARCOMMANDS_Decoder_DecodeCommand (networkController->decoder, data, dataSize);
+    if ((cmdError != ARCOMMANDS_DECODER_OK) && (cmdError != ARCOMMANDS_DECODER_ERROR_NO_CALLBACK))
+    {
+        char msg[128];
+        ARCOMMANDS_Decoder_DescribeBuffer (data, dataSize, msg, sizeof(msg));
+        ARSAL_PRINT(ARSAL_PRINT_ERROR, ARCONTROLLER_NETWORK_TAG, "ARCOMMANDS_Decoder_DecodeBuffer () failed : %d %s", cmdError, msg);
+    }
+}
@@ -61,6 +61,7 @@ struct ARCONTROLLER_Network_t
     ARSAL_Thread_t txThread; /**< Transmitter thread of the networkManager */
     ARSAL_Thread_t *readerThreads; /**< Reader threads for all buffers of receiving */
     ARCONTROLLER_NETWORK_THREAD_DATA_t *readerThreadsData; /**< Data for all reader threads*/
+    int directDispatch; /**< 1 if the commands are decoded by the receiver thread ; 0 if they are read by the reader threads */
     ARSAL_Mutex_t mutex; /**< Mutex for multithreading */
     eARCONTROLLER_NETWORK_STATE state; /**< State of the networkController*/
     
@@ -119,6 +120,16 @@ eARCONTROLLER_ERROR ARCONTROLLER_Network_StopReaderThreads (ARCONTROLLER_Network
  */
 void *ARCONTROLLER_Network_ReaderRun (void *data);
 
+/**
+ * @brief Decode the commands of an input network buffer in the receiver thread.
+ * @note Callback of ARNETWORK_Manager_SetDirectReadCallback() used in direct dispatch.
+ * @param bufferId ID of the buffer.
+ * @param data Data received ; only valid during the call.
+ * @param dataSize Size of the data.
+ * @param customData The network controller.
+ */
+void ARCONTROLLER_Network_OnDirectRead (int bufferId, uint8_t *data, int dataSize, void *customData);
+
 //TODO !!!!!!!!!!!!!!!!!
 void ARCONTROLLER_Network_OnDisconnectNetwork (ARNETWORK_Manager_t *manager, ARNETWORKAL_Manager_t *alManager, void *customData);
 
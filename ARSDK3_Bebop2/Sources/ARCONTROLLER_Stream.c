@@ -37,6 +37,7 @@
  */
  
 #include <stdlib.h>
+#include <string.h>
 
 #include <json/json.h>
 #include <libARSAL/ARSAL_Print.h>
@@ -223,6 +224,57 @@ eARCONTROLLER_ERROR ARCONTROLLER_Stream_SetMP4Compliant (ARCONTROLLER_Stream_t *
     return error;
 }
 
+eARCONTROLLER_ERROR ARCONTROLLER_Stream_SetDecodeStage (ARCONTROLLER_Stream_t *streamController, eARCONTROLLER_STREAM_DECODE_POLICY policy, int queueSize)
+{
+    // -- Set the decode stage of the stream --
+    
+    eARCONTROLLER_ERROR error = ARCONTROLLER_OK;
+    
+    // Check parameters
+    if (streamController == NULL)
+    {
+        error = ARCONTROLLER_ERROR_BAD_PARAMETER;
+    }
+    // No Else: the checking parameters sets error to ARCONTROLLER_ERROR_BAD_PARAMETER and stop the processing
+    
+    if ((error == ARCONTROLLER_OK) && (streamController->stream2Controller != NULL))
+    {
+        error = ARCONTROLLER_Stream2_SetDecodeStage (streamController->stream2Controller, policy, queueSize);
+    }
+    // No else: the frames of stream 1 are already given to the callback by its own thread
+    
+    return error;
+}
+
+eARCONTROLLER_ERROR ARCONTROLLER_Stream_GetDecodeStats (ARCONTROLLER_Stream_t *streamController, ARCONTROLLER_Stream_DecodeStats_t *stats)
+{
+    // -- Get the statistics of the decode stage --
+    
+    eARCONTROLLER_ERROR error = ARCONTROLLER_OK;
+    
+    // Check parameters
+    if ((streamController == NULL) ||
+        (stats == NULL))
+    {
+        error = ARCONTROLLER_ERROR_BAD_PARAMETER;
+    }
+    // No Else: the checking parameters sets error to ARCONTROLLER_ERROR_BAD_PARAMETER and stop the processing
+    
+    if (error == ARCONTROLLER_OK)
+    {
+        if (streamController->stream2Controller != NULL)
+        {
+            error = ARCONTROLLER_Stream2_GetDecodeStats (streamController->stream2Controller, stats);
+        }
+        else
+        {
+            memset (stats, 0, sizeof (ARCONTROLLER_Stream_DecodeStats_t));
+        }
+    }
+    
+    return error;
+}
+
 eARCONTROLLER_ERROR ARCONTROLLER_Stream_Start (ARCONTROLLER_Stream_t *streamController, ARNETWORK_Manager_t *networkManager)
 {
     // -- Start to read the stream --
@@ -38,11 +38,14 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <errno.h>
 #include <json/json.h>
 #include <libARSAL/ARSAL_Print.h>
 #include <libARSAL/ARSAL_Socket.h>
 #include <libARSAL/ARSAL_Thread.h>
+#include <libARSAL/ARSAL_Mutex.h>
+#include <libARSAL/ARSAL_Time.h>
 #include <libARDiscovery/ARDISCOVERY_Error.h>
 #include <libARDiscovery/ARDISCOVERY_Device.h>
 #include <libARStream2/arstream2_stream_receiver.h>
@@ -65,9 +68,15 @@ static eARCONTROLLER_ERROR ARCONTROLLER_Stream2_StartStream (ARCONTROLLER_Stream
 static eARCONTROLLER_ERROR ARCONTROLLER_Stream2_StopStream (ARCONTROLLER_Stream2_t *stream2Controller);
 static eARCONTROLLER_ERROR ARCONTROLLER_Stream2_RestartStream (ARCONTROLLER_Stream2_t *stream2Controller);
 static eARSTREAM2_ERROR ARCONTROLLER_Stream2_SpsPpsCallback(uint8_t *spsBuffer, int spsSize, uint8_t *ppsBuffer, int ppsSize, void *userPtr);
-static eARSTREAM2_ERROR ARCONTROLLER_Stream2_GetAuBufferCallback(uint8_t **auBuffer, int *auBufferSize, void **auBufferUserPtr, void *userPtr);
 static eARSTREAM2_ERROR ARCONTROLLER_Stream2_AuReadyCallback(uint8_t *auBuffer, int auSize, uint64_t auTimestamp, uint64_t auTimestampShifted, eARSTREAM2_H264_FILTER_AU_SYNC_TYPE auSyncType, void *auMetadata, int auMetadataSize, void *auUserData, int auUserDataSize, void *auBufferUserPtr, void *userPtr);
 static void *ARCONTROLLER_Stream2_RestartRun (void *data);
+static int ARCONTROLLER_Stream2_ManageCallbackError (ARCONTROLLER_Stream2_t *stream2Controller, eARCONTROLLER_ERROR callbackError);
+static eARCONTROLLER_ERROR ARCONTROLLER_Stream2_StartDecodeStage (ARCONTROLLER_Stream2_t *stream2Controller);
+static void ARCONTROLLER_Stream2_StopDecodeStage (ARCONTROLLER_Stream2_t *stream2Controller);
+static void ARCONTROLLER_Stream2_PushDecodeQueue (ARCONTROLLER_Stream2_t *stream2Controller, ARCONTROLLER_Frame_t *frame);
+static void ARCONTROLLER_Stream2_LocalFlushDecodeQueue (ARCONTROLLER_Stream2_t *stream2Controller);
+static void *ARCONTROLLER_Stream2_DecodeRun (void *data);
+static uint32_t ARCONTROLLER_Stream2_ElapsedUs (struct timespec *start, struct timespec *end);
 
 #define ARCONTROLLER_STREAM2_TAG "ARCONTROLLER_Stream2"
 
@@ -191,6 +200,24 @@ ARCONTROLLER_Stream2_t *ARCONTROLLER_Stream2_New (ARDISCOVERY_Device_t *discover
             stream2Controller->callbackData = NULL;
             stream2Controller->decoderConfigCallback = NULL;
             stream2Controller->receiveFrameCallback = NULL;
+            
+            stream2Controller->framePool = NULL;
+            
+            stream2Controller->decodePolicy = ARCONTROLLER_STREAM_DECODE_POLICY_SYNCHRONOUS;
+            stream2Controller->decodeQueueSize = ARCONTROLLER_STREAM_DECODE_DEFAULT_QUEUE_SIZE;
+            stream2Controller->decodeIsRunning = 0;
+            stream2Controller->decodeThread = NULL;
+            stream2Controller->decodeQueueHead = 0;
+            stream2Controller->decodeQueueCount = 0;
+            stream2Controller->decodeWaitIFrame = 0;
+            memset (&(stream2Controller->decodeStats), 0, sizeof (ARCONTROLLER_Stream_DecodeStats_t));
+            
+            if ((ARSAL_Mutex_Init (&(stream2Controller->decodeMutex)) != 0) ||
+                (ARSAL_Cond_Init (&(stream2Controller->decodeCond)) != 0) ||
+                (ARSAL_Mutex_Init (&(stream2Controller->callbackMutex)) != 0))
+            {
+                localError = ARCONTROLLER_ERROR_INIT_MUTEX;
+            }
         }
         else
         {
@@ -238,6 +265,10 @@ void ARCONTROLLER_Stream2_Delete (ARCONTROLLER_Stream2_t **stream2Controller)
             if ((*stream2Controller)->clientControlFd >= 0)
                 ARSAL_Socket_Close((*stream2Controller)->clientControlFd);
 
+            ARSAL_Mutex_Destroy (&((*stream2Controller)->decodeMutex));
+            ARSAL_Cond_Destroy (&((*stream2Controller)->decodeCond));
+            ARSAL_Mutex_Destroy (&((*stream2Controller)->callbackMutex));
+
             free (*stream2Controller);
             (*stream2Controller) = NULL;
         }
@@ -263,14 +294,19 @@ eARCONTROLLER_ERROR ARCONTROLLER_Stream2_Start (ARCONTROLLER_Stream2_t *stream2C
         
         if (ARCONTROLLER_Stream2_IsInitilized(stream2Controller) != 0)
         {
-            // create the frame pool
-            stream2Controller->framePool = ARCONTROLLER_StreamPool_New (ARCONTROLLER_STREAM2_AU_ARRAY_SIZE, &error);
+            // create the frame pool ; the decode stage also holds the queued frames and the frame being decoded
+            stream2Controller->framePool = ARCONTROLLER_StreamPool_New ((stream2Controller->decodePolicy != ARCONTROLLER_STREAM_DECODE_POLICY_SYNCHRONOUS) ? (uint32_t)(stream2Controller->decodeQueueSize + 2) : ARCONTROLLER_STREAM2_AU_ARRAY_SIZE, &error);
         }
         else
         {
             error = ARCONTROLLER_ERROR_INIT_STREAM;
         }
         
+        if (error == ARCONTROLLER_OK)
+        {
+            error = ARCONTROLLER_Stream2_StartDecodeStage (stream2Controller);
+        }
+        
         if (error == ARCONTROLLER_OK)
         {
             error = ARCONTROLLER_Stream2_StartStream (stream2Controller);
@@ -303,6 +339,11 @@ eARCONTROLLER_ERROR ARCONTROLLER_Stream2_Stop (ARCONTROLLER_Stream2_t *stream2Co
         stream2Controller->isRunning = 0;
         
         ARCONTROLLER_Stream2_StopStream (stream2Controller);
+        
+        // the filter is stopped ; stop the decode stage before deleting the frames it holds
+        ARCONTROLLER_Stream2_StopDecodeStage (stream2Controller);
+        
+        ARCONTROLLER_StreamPool_Delete (&(stream2Controller->framePool));
     }
     
     return error;
@@ -378,6 +419,67 @@ eARCONTROLLER_ERROR ARCONTROLLER_Stream2_SetMP4Compliant (ARCONTROLLER_Stream2_t
     return error;
 }
 
+eARCONTROLLER_ERROR ARCONTROLLER_Stream2_SetDecodeStage (ARCONTROLLER_Stream2_t *stream2Controller, eARCONTROLLER_STREAM_DECODE_POLICY policy, int queueSize)
+{
+    // -- Set the decode stage --
+    
+    // local declarations
+    eARCONTROLLER_ERROR error = ARCONTROLLER_OK;
+    
+    // Check parameters
+    if ((stream2Controller == NULL) ||
+        (policy < ARCONTROLLER_STREAM_DECODE_POLICY_SYNCHRONOUS) ||
+        (policy >= ARCONTROLLER_STREAM_DECODE_POLICY_MAX) ||
+        (queueSize < 1) ||
+        (queueSize > ARCONTROLLER_STREAM_DECODE_MAX_QUEUE_SIZE))
+    {
+        error = ARCONTROLLER_ERROR_BAD_PARAMETER;
+    }
+    // No Else: the checking parameters sets error to ARCONTROLLER_ERROR_BAD_PARAMETER and stop the processing
+    
+    if ((error == ARCONTROLLER_OK) && (stream2Controller->isRunning))
+    {
+        // the decode queue is in use
+        error = ARCONTROLLER_ERROR_STATE;
+    }
+    
+    if (error == ARCONTROLLER_OK)
+    {
+        stream2Controller->decodePolicy = policy;
+        stream2Controller->decodeQueueSize = queueSize;
+    }
+    
+    return error;
+}
+
+eARCONTROLLER_ERROR ARCONTROLLER_Stream2_GetDecodeStats (ARCONTROLLER_Stream2_t *stream2Controller, ARCONTROLLER_Stream_DecodeStats_t *stats)
+{
+    // -- Get the statistics of the decode stage --
+    
+    // local declarations
+    eARCONTROLLER_ERROR error = ARCONTROLLER_OK;
+    
+    // Check parameters
+    if ((stream2Controller == NULL) ||
+        (stats == NULL))
+    {
+        error = ARCONTROLLER_ERROR_BAD_PARAMETER;
+    }
+    // No Else: the checking parameters sets error to ARCONTROLLER_ERROR_BAD_PARAMETER and stop the processing
+    
+    if (error == ARCONTROLLER_OK)
+    {
+        ARSAL_Mutex_Lock (&(stream2Controller->decodeMutex));
+        
+        *stats = stream2Controller->decodeStats;
+        stats->queueLevel = (uint32_t)stream2Controller->decodeQueueCount;
+        
+        ARSAL_Mutex_Unlock (&(stream2Controller->decodeMutex));
+    }
+    
+    return error;
+}
+
 /*****************************************
  *
  *             private implementation:
@@ -628,7 +730,7 @@ static eARCONTROLLER_ERROR ARCONTROLLER_Stream2_StartStream (ARCONTROLLER_Stream
     
     if (error == ARCONTROLLER_OK)
     {
-        stream2Error = ARSTREAM2_StreamReceiver_StartFilter (stream2Controller->readerFilterHandle, ARCONTROLLER_Stream2_SpsPpsCallback, stream2Controller, ARCONTROLLER_Stream2_GetAuBufferCallback, stream2Controller, ARCONTROLLER_Stream2_AuReadyCallback, stream2Controller);
+        stream2Error = ARSTREAM2_StreamReceiver_StartFilter (stream2Controller->readerFilterHandle, ARCONTROLLER_Stream2_SpsPpsCallback, stream2Controller, NULL, NULL, ARCONTROLLER_Stream2_AuReadyCallback, stream2Controller);
         
         if (stream2Error != ARSTREAM2_OK)
         {
@@ -716,6 +818,15 @@ eARSTREAM2_ERROR ARCONTROLLER_Stream2_SpsPpsCallback(uint8_t *spsBuffer, int sps
     if(stream2Controller->decoderConfigCallback != NULL)
     {
         ARCONTROLLER_Stream_Codec_t codec;
+        
+        if (stream2Controller->decodeIsRunning)
+        {
+            // the queued frames belong to the previous configuration
+            ARSAL_Mutex_Lock (&(stream2Controller->decodeMutex));
+            ARCONTROLLER_Stream2_LocalFlushDecodeQueue (stream2Controller);
+            ARSAL_Mutex_Unlock (&(stream2Controller->decodeMutex));
+        }
+        // No else: the frame callback is called on this thread
         codec.type = ARCONTROLLER_STREAM_CODEC_TYPE_H264;
         codec.parameters.h264parameters.spsBuffer = spsBuffer;
         codec.parameters.h264parameters.spsSize = spsSize;
@@ -723,43 +834,66 @@ eARSTREAM2_ERROR ARCONTROLLER_Stream2_SpsPpsCallback(uint8_t *spsBuffer, int sps
         codec.parameters.h264parameters.ppsSize = ppsSize;
         codec.parameters.h264parameters.isMP4Compliant = stream2Controller->replaceStartCodesWithNaluSize;
         
+        // the decoder must not be configured while it decodes a frame
+        ARSAL_Mutex_Lock (&(stream2Controller->callbackMutex));
         stream2Controller->decoderConfigCallback(codec, stream2Controller->callbackData);
+        ARSAL_Mutex_Unlock (&(stream2Controller->callbackMutex));
     }
     
     return ARSTREAM2_OK;
 }
 
-static eARSTREAM2_ERROR ARCONTROLLER_Stream2_GetAuBufferCallback(uint8_t **auBuffer, int *auBufferSize, void **auBufferUserPtr, void *userPtr)
+static eARSTREAM2_ERROR ARCONTROLLER_Stream2_AuReadyCallback(uint8_t *auBuffer, int auSize, uint64_t auTimestamp, uint64_t auTimestampShifted, eARSTREAM2_H264_FILTER_AU_SYNC_TYPE auSyncType, void *auMetadata, int auMetadataSize, void *auUserData, int auUserDataSize, void *auBufferUserPtr, void *userPtr)
 {
     ARCONTROLLER_Stream2_t *stream2Controller = (ARCONTROLLER_Stream2_t *)userPtr;
+    ARCONTROLLER_Frame_t *frame = NULL;
     eARSTREAM2_ERROR retVal = ARSTREAM2_OK;
     eARCONTROLLER_ERROR error = ARCONTROLLER_OK;
-    ARCONTROLLER_Frame_t *frame = ARCONTROLLER_StreamPool_GetNextFreeFrame (stream2Controller->framePool, &error);
+    ARCONTROLLER_StreamPool_Stats_t stats;
     
-    if (error == ARCONTROLLER_OK)
+    if (stream2Controller->receiveFrameCallback != NULL)
     {
-        *auBuffer = frame->data;
-        *auBufferSize = frame->capacity;
-        *auBufferUserPtr = frame;
-        
-        frame->available = 0;
+        frame = ARCONTROLLER_StreamPool_GetNextFreeFrame (stream2Controller->framePool, &error);
+        if (error != ARCONTROLLER_OK)
+        {
+            ARCONTROLLER_StreamPool_GetStats (stream2Controller->framePool, &stats);
+            ARSAL_PRINT(ARSAL_PRINT_ERROR, ARCONTROLLER_STREAM2_TAG, "ARCONTROLLER_Stream2_AuReadyCallback ERROR NO FRAME available (%u/%u in use, exhausted %u times)", stats.inUse, stats.capacity, stats.exhaustedCount);
+            frame = NULL;
+            retVal = ARSTREAM2_ERROR_RESOURCE_UNAVAILABLE;
+        }
     }
-    else
+    
+    if ((frame != NULL) && (stream2Controller->decodeIsRunning))
     {
-        ARSAL_PRINT(ARSAL_PRINT_ERROR, ARCONTROLLER_STREAM2_TAG, "ARCONTROLLER_Stream2_GetAuBuffer ERROR NO BUFFER available");
-        retVal = ARSTREAM2_ERROR_RESOURCE_UNAVAILABLE;
+        //the frame outlives the filter buffer: copy the AU and its metadata in the frame
+        if (ARCONTROLLER_Frame_ensureCapacityIsAtLeast (frame, (uint32_t)(auSize + auMetadataSize), &error))
+        {
+            memcpy (frame->data, auBuffer, auSize);
+            if ((auMetadata != NULL) && (auMetadataSize > 0))
+            {
+                memcpy (frame->data + auSize, auMetadata, auMetadataSize);
+                frame->metadata = frame->data + auSize;
+            }
+            else
+            {
+                //the frame is reused from the pool: do not keep the metadata of its previous AU
+                frame->metadata = NULL;
+            }
+        }
+        else
+        {
+            ARSAL_PRINT(ARSAL_PRINT_ERROR, ARCONTROLLER_STREAM2_TAG, "ARCONTROLLER_Stream2_AuReadyCallback ERROR frame of %d bytes not allocated: %s", auSize + auMetadataSize, ARCONTROLLER_Error_ToString (error));
+            ARCONTROLLER_Frame_SetFree(frame);
+            frame = NULL;
+            retVal = ARSTREAM2_ERROR_RESOURCE_UNAVAILABLE;
+        }
+    }
+    else if (frame != NULL)
+    {
+        //the frame points to the filter buffer, valid until the frame is freed below
+        frame->data = auBuffer;
+        frame->metadata = auMetadata;
     }
-    
-    return retVal;
-}
-
-static eARSTREAM2_ERROR ARCONTROLLER_Stream2_AuReadyCallback(uint8_t *auBuffer, int auSize, uint64_t auTimestamp, uint64_t auTimestampShifted, eARSTREAM2_H264_FILTER_AU_SYNC_TYPE auSyncType, void *auMetadata, int auMetadataSize, void *auUserData, int auUserDataSize, void *auBufferUserPtr, void *userPtr)
-{
-    ARCONTROLLER_Stream2_t *stream2Controller = (ARCONTROLLER_Stream2_t *)userPtr;
-    ARCONTROLLER_Frame_t *frame = (ARCONTROLLER_Frame_t *) auBufferUserPtr;
-    eARSTREAM2_ERROR retVal = ARSTREAM2_OK;
-    eARCONTROLLER_ERROR error = ARCONTROLLER_OK;
-    ARSAL_Thread_t restartThread = NULL;
     
     //callback
     if ((frame != NULL) && (stream2Controller->receiveFrameCallback != NULL))
@@ -773,55 +907,300 @@ static eARSTREAM2_ERROR ARCONTROLLER_Stream2_AuReadyCallback(uint8_t *auBuffer,
         //set timestamp
         frame->timestamp = auTimestamp;
 
-        //set metadata
-        frame->metadata = auMetadata;
-        frame->metadataSize = auMetadataSize;
+        //set metadata size
+        frame->metadataSize = (frame->metadata != NULL) ? auMetadataSize : 0;
 
-        error = stream2Controller->receiveFrameCallback(frame, stream2Controller->callbackData);
-        
-        //Manage Error
-        if (error != ARCONTROLLER_OK)
+        if (stream2Controller->decodeIsRunning)
+        {
+            // the decode stage calls the callback and frees the frame
+            ARCONTROLLER_Stream2_PushDecodeQueue (stream2Controller, frame);
+        }
+        else
         {
-            if ((error == ARCONTROLLER_ERROR_STREAM_RESYNC_REQUIRED) && (stream2Controller->errorCount < ARCONTROLLER_STREAM2_MAX_RESYNC_ERROR))
+            error = stream2Controller->receiveFrameCallback(frame, stream2Controller->callbackData);
+            
+            //Manage Error
+            if (ARCONTROLLER_Stream2_ManageCallbackError (stream2Controller, error))
             {
-                stream2Controller->errorCount++;
                 retVal = ARSTREAM2_ERROR_RESYNC_REQUIRED;
             }
+            
+            //Free the current frame
+            ARCONTROLLER_Frame_SetFree(frame);
+        }
+    }
+
+    return retVal;
+}
+
+static void *ARCONTROLLER_Stream2_RestartRun (void *data)
+{
+    // -- Thread Run of re-start --
+    
+    // Local declarations
+    ARCONTROLLER_Stream2_t *stream2Controller = (ARCONTROLLER_Stream2_t *)data;
+    
+    ARCONTROLLER_Stream2_RestartStream (stream2Controller);
+    
+    return NULL;
+}
+
+static int ARCONTROLLER_Stream2_ManageCallbackError (ARCONTROLLER_Stream2_t *stream2Controller, eARCONTROLLER_ERROR callbackError)
+{
+    // -- Manage the error returned by the frame callback --
+    
+    // Local declarations
+    int resyncRequired = 0;
+    ARSAL_Thread_t restartThread = NULL;
+    
+    if (callbackError != ARCONTROLLER_OK)
+    {
+        if ((callbackError == ARCONTROLLER_ERROR_STREAM_RESYNC_REQUIRED) && (stream2Controller->errorCount < ARCONTROLLER_STREAM2_MAX_RESYNC_ERROR))
+        {
+            stream2Controller->errorCount++;
+            resyncRequired = 1;
+        }
+        else
+        {
+            // Restart stream2
+            if (ARSAL_Thread_Create (&restartThread, ARCONTROLLER_Stream2_RestartRun, stream2Controller) != 0)
+            {
+                ARSAL_PRINT(ARSAL_PRINT_ERROR, ARCONTROLLER_STREAM2_TAG, "Creation of restart thread failed.");
+            }
             else
             {
-                // Restart stream2
-                if (ARSAL_Thread_Create (&restartThread, ARCONTROLLER_Stream2_RestartRun, stream2Controller) != 0)
+                ARSAL_Thread_Destroy (&restartThread);
+                restartThread = NULL;
+            }
+        }
+    }
+    else
+    {
+        stream2Controller->errorCount = 0;
+    }
+    
+    return resyncRequired;
+}
+
+static eARCONTROLLER_ERROR ARCONTROLLER_Stream2_StartDecodeStage (ARCONTROLLER_Stream2_t *stream2Controller)
+{
+    // -- Start the decode stage --
+    
+    // Local declarations
+    eARCONTROLLER_ERROR error = ARCONTROLLER_OK;
+    
+    stream2Controller->decodeQueueHead = 0;
+    stream2Controller->decodeQueueCount = 0;
+    stream2Controller->decodeWaitIFrame = 0;
+    memset (&(stream2Controller->decodeStats), 0, sizeof (ARCONTROLLER_Stream_DecodeStats_t));
+    
+    if (stream2Controller->decodePolicy != ARCONTROLLER_STREAM_DECODE_POLICY_SYNCHRONOUS)
+    {
+        stream2Controller->decodeIsRunning = 1;
+        
+        if (ARSAL_Thread_Create (&(stream2Controller->decodeThread), ARCONTROLLER_Stream2_DecodeRun, stream2Controller) != 0)
+        {
+            ARSAL_PRINT(ARSAL_PRINT_ERROR, ARCONTROLLER_STREAM2_TAG, "Creation of decode thread failed.");
+            stream2Controller->decodeThread = NULL;
+            stream2Controller->decodeIsRunning = 0;
+            error = ARCONTROLLER_ERROR_INIT_THREAD;
+        }
+    }
+    // No else: the frame callback is called on the filter thread
+    
+    return error;
+}
+
+static void ARCONTROLLER_Stream2_StopDecodeStage (ARCONTROLLER_Stream2_t *stream2Controller)
+{
+    // -- Stop the decode stage --
+    
+    if (stream2Controller->decodeThread != NULL)
+    {
+        ARSAL_Mutex_Lock (&(stream2Controller->decodeMutex));
+        stream2Controller->decodeIsRunning = 0;
+        ARSAL_Cond_Broadcast (&(stream2Controller->decodeCond));
+        ARSAL_Mutex_Unlock (&(stream2Controller->decodeMutex));
+        
+        ARSAL_Thread_Join (stream2Controller->decodeThread, NULL);
+        ARSAL_Thread_Destroy (&(stream2Controller->decodeThread));
+        stream2Controller->decodeThread = NULL;
+    }
+    
+    // Free the frames not decoded
+    ARSAL_Mutex_Lock (&(stream2Controller->decodeMutex));
+    ARCONTROLLER_Stream2_LocalFlushDecodeQueue (stream2Controller);
+    ARSAL_Mutex_Unlock (&(stream2Controller->decodeMutex));
+}
+
+static void ARCONTROLLER_Stream2_PushDecodeQueue (ARCONTROLLER_Stream2_t *stream2Controller, ARCONTROLLER_Frame_t *frame)
+{
+    // -- Queue a frame to the decode stage, applying the policy if the queue is full --
+    
+    // Local declarations
+    ARCONTROLLER_Stream2_DecodeItem_t *item = NULL;
+    
+    ARSAL_Mutex_Lock (&(stream2Controller->decodeMutex));
+    
+    if ((stream2Controller->decodeWaitIFrame) && (!frame->isIFrame))
+    {
+        // The frame can not be decoded without the previous ones
+        ARCONTROLLER_Frame_SetFree (frame);
+        frame = NULL;
+        stream2Controller->decodeStats.droppedCount++;
+    }
+    else if (stream2Controller->decodeQueueCount == stream2Controller->decodeQueueSize)
+    {
+        switch (stream2Controller->decodePolicy)
+        {
+            case ARCONTROLLER_STREAM_DECODE_POLICY_BLOCK:
+                while ((stream2Controller->decodeIsRunning) && (stream2Controller->decodeQueueCount == stream2Controller->decodeQueueSize))
                 {
-                    ARSAL_PRINT(ARSAL_PRINT_ERROR, ARCONTROLLER_STREAM2_TAG, "Creation of restart thread failed.");
+                    ARSAL_Cond_Wait (&(stream2Controller->decodeCond), &(stream2Controller->decodeMutex));
                 }
-                else
+                break;
+                
+            case ARCONTROLLER_STREAM_DECODE_POLICY_DROP_OLDEST:
+                ARCONTROLLER_Frame_SetFree (stream2Controller->decodeQueue[stream2Controller->decodeQueueHead].frame);
+                stream2Controller->decodeQueue[stream2Controller->decodeQueueHead].frame = NULL;
+                stream2Controller->decodeQueueHead = (stream2Controller->decodeQueueHead + 1) % stream2Controller->decodeQueueSize;
+                stream2Controller->decodeQueueCount--;
+                stream2Controller->decodeStats.droppedCount++;
+                break;
+                
+            case ARCONTROLLER_STREAM_DECODE_POLICY_SKIP_TO_IFRAME:
+            default:
+                ARCONTROLLER_Stream2_LocalFlushDecodeQueue (stream2Controller);
+                if (!frame->isIFrame)
                 {
-                    ARSAL_Thread_Destroy (&restartThread);
-                    restartThread = NULL;
+                    ARCONTROLLER_Frame_SetFree (frame);
+                    frame = NULL;
+                    stream2Controller->decodeStats.droppedCount++;
+                    stream2Controller->decodeWaitIFrame = 1;
                 }
-            }
-        }
-        else
-        {
-            stream2Controller->errorCount = 0;
+                // No else: decoding can restart from this frame
+                break;
         }
+    }
+    // No else: the queue has a free place
+    
+    if ((frame != NULL) && (stream2Controller->decodeQueueCount < stream2Controller->decodeQueueSize))
+    {
+        stream2Controller->decodeWaitIFrame = 0;
         
-        //Free the current frame
-        ARCONTROLLER_Frame_SetFree(frame);
+        item = &(stream2Controller->decodeQueue[(stream2Controller->decodeQueueHead + stream2Controller->decodeQueueCount) % stream2Controller->decodeQueueSize]);
+        item->frame = frame;
+        ARSAL_Time_GetTime (&(item->receptionTime));
+        stream2Controller->decodeQueueCount++;
+        stream2Controller->decodeStats.queuedCount++;
+        
+        ARSAL_Cond_Broadcast (&(stream2Controller->decodeCond));
+    }
+    else if (frame != NULL)
+    {
+        // The decode stage stopped while the queue was full
+        ARCONTROLLER_Frame_SetFree (frame);
+        stream2Controller->decodeStats.droppedCount++;
     }
+    // No else: the frame is dropped
+    
+    ARSAL_Mutex_Unlock (&(stream2Controller->decodeMutex));
+}
 
-    return retVal;
+static void ARCONTROLLER_Stream2_LocalFlushDecodeQueue (ARCONTROLLER_Stream2_t *stream2Controller)
+{
+    // -- Drop the frames of the decode queue ; decodeMutex must be locked --
+    
+    ARCONTROLLER_Stream2_DecodeItem_t *item = NULL;
+    
+    while (stream2Controller->decodeQueueCount > 0)
+    {
+        item = &(stream2Controller->decodeQueue[stream2Controller->decodeQueueHead]);
+        ARCONTROLLER_Frame_SetFree (item->frame);
+        item->frame = NULL;
+        
+        stream2Controller->decodeQueueHead = (stream2Controller->decodeQueueHead + 1) % stream2Controller->decodeQueueSize;
+        stream2Controller->decodeQueueCount--;
+        stream2Controller->decodeStats.droppedCount++;
+    }
+    
+    ARSAL_Cond_Broadcast (&(stream2Controller->decodeCond));
 }
 
-static void *ARCONTROLLER_Stream2_RestartRun (void *data)
+static void *ARCONTROLLER_Stream2_DecodeRun (void *data)
 {
-    // -- Thread Run of re-start --
+    // -- Thread Run of the decode stage --
     
     // Local declarations
     ARCONTROLLER_Stream2_t *stream2Controller = (ARCONTROLLER_Stream2_t *)data;
+    ARCONTROLLER_Stream_DecodeStats_t *stats = &(stream2Controller->decodeStats);
+    ARCONTROLLER_Frame_t *frame = NULL;
+    struct timespec receptionTime;
+    struct timespec startTime;
+    struct timespec endTime;
+    eARCONTROLLER_ERROR error = ARCONTROLLER_OK;
+    uint32_t latencyUs = 0;
     
-    ARCONTROLLER_Stream2_RestartStream (stream2Controller);
+    ARSAL_Mutex_Lock (&(stream2Controller->decodeMutex));
+    
+    while (stream2Controller->decodeIsRunning)
+    {
+        if (stream2Controller->decodeQueueCount == 0)
+        {
+            ARSAL_Cond_Wait (&(stream2Controller->decodeCond), &(stream2Controller->decodeMutex));
+            continue;
+        }
+        
+        // Pop the oldest frame
+        frame = stream2Controller->decodeQueue[stream2Controller->decodeQueueHead].frame;
+        receptionTime = stream2Controller->decodeQueue[stream2Controller->decodeQueueHead].receptionTime;
+        stream2Controller->decodeQueue[stream2Controller->decodeQueueHead].frame = NULL;
+        stream2Controller->decodeQueueHead = (stream2Controller->decodeQueueHead + 1) % stream2Controller->decodeQueueSize;
+        stream2Controller->decodeQueueCount--;
+        ARSAL_Cond_Broadcast (&(stream2Controller->decodeCond));
+        
+        ARSAL_Mutex_Unlock (&(stream2Controller->decodeMutex));
+        
+        ARSAL_Time_GetTime (&startTime);
+        
+        ARSAL_Mutex_Lock (&(stream2Controller->callbackMutex));
+        error = stream2Controller->receiveFrameCallback(frame, stream2Controller->callbackData);
+        ARSAL_Mutex_Unlock (&(stream2Controller->callbackMutex));
+        
+        ARSAL_Time_GetTime (&endTime);
+        
+        ARCONTROLLER_Frame_SetFree (frame);
+        frame = NULL;
+        
+        ARSAL_Mutex_Lock (&(stream2Controller->decodeMutex));
+        
+        // Update the statistics
+        latencyUs = ARCONTROLLER_Stream2_ElapsedUs (&receptionTime, &endTime);
+        stats->decodedCount++;
+        stats->lastLatencyUs = latencyUs;
+        stats->averageLatencyUs = (stats->decodedCount == 1) ? latencyUs : (stats->averageLatencyUs - (stats->averageLatencyUs / 16) + (latencyUs / 16));
+        stats->maxLatencyUs = (latencyUs > stats->maxLatencyUs) ? latencyUs : stats->maxLatencyUs;
+        stats->lastDecodeTimeUs = ARCONTROLLER_Stream2_ElapsedUs (&startTime, &endTime);
+        stats->maxDecodeTimeUs = (stats->lastDecodeTimeUs > stats->maxDecodeTimeUs) ? stats->lastDecodeTimeUs : stats->maxDecodeTimeUs;
+        
+        //Manage Error ; the filter has moved on, so the resynchronization is done by waiting for the next IFrame
+        if (ARCONTROLLER_Stream2_ManageCallbackError (stream2Controller, error))
+        {
+            ARCONTROLLER_Stream2_LocalFlushDecodeQueue (stream2Controller);
+            stream2Controller->decodeWaitIFrame = 1;
+        }
+    }
+    
+    ARSAL_Mutex_Unlock (&(stream2Controller->decodeMutex));
     
     return NULL;
 }
 
+static uint32_t ARCONTROLLER_Stream2_ElapsedUs (struct timespec *start, struct timespec *end)
+{
+    // -- Time elapsed between two times, in microseconds --
+    
+    int64_t elapsedUs = ((int64_t)(end->tv_sec - start->tv_sec) * 1000000) + ((end->tv_nsec - start->tv_nsec) / 1000);
+    
+    return (elapsedUs > 0) ? (uint32_t)elapsedUs : 0;
+}
@@ -42,6 +42,8 @@
 #include <json/json.h>
 #include <libARSAL/ARSAL_Socket.h>
 #include <libARSAL/ARSAL_Thread.h>
+#include <libARSAL/ARSAL_Mutex.h>
+#include <libARSAL/ARSAL_Time.h>
 #include <libARController/ARCONTROLLER_Error.h>
 #include <libARStream2/arstream2_stream_receiver.h>
 #include <libARController/ARCONTROLLER_StreamPool.h>
@@ -61,6 +63,15 @@ struct mux_ctx;
 
 #define ARCONTROLLER_STREAM2_MAX_RESYNC_ERROR 10
 
+/**
+ * @brief Frame waiting for the decode stage.
+ */
+typedef struct
+{
+    ARCONTROLLER_Frame_t *frame; /**< Frame owning a copy of the access unit */
+    struct timespec receptionTime; /**< Time the access unit was output by the filter */
+}ARCONTROLLER_Stream2_DecodeItem_t;
+
 /**
  * @brief Stream controller allow to operate ARStream for receive a stream.
  */
@@ -97,6 +108,19 @@ struct ARCONTROLLER_Stream2_t
     void *callbackData;
     ARCONTROLLER_Stream_DecoderConfigCallback_t decoderConfigCallback;
     ARCONTROLLER_Stream_DidReceiveFrameCallback_t receiveFrameCallback;
+    
+    eARCONTROLLER_STREAM_DECODE_POLICY decodePolicy; /**< Policy of the decode stage ; applied at the start of the stream */
+    int decodeQueueSize; /**< Size of the decode queue ; applied at the start of the stream */
+    int decodeIsRunning; /**< 1 if the frames go through the decode stage ; otherwise they are given to the callback on the filter thread */
+    ARSAL_Thread_t decodeThread; /**< Thread calling the frame callback */
+    ARCONTROLLER_Stream2_DecodeItem_t decodeQueue[ARCONTROLLER_STREAM_DECODE_MAX_QUEUE_SIZE]; /**< Ring of the frames waiting for the decode stage */
+    int decodeQueueHead; /**< Index of the oldest frame of the ring */
+    int decodeQueueCount; /**< Number of frames in the ring */
+    int decodeWaitIFrame; /**< 1 if the frames are dropped until the next IFrame */
+    ARSAL_Mutex_t decodeMutex; /**< Mutex protecting the decode queue and statistics */
+    ARSAL_Cond_t decodeCond; /**< Signaled when a frame is queued or a place is freed */
+    ARSAL_Mutex_t callbackMutex; /**< Serializes the decoder config callback with the frame callback */
+    ARCONTROLLER_Stream_DecodeStats_t decodeStats; /**< Statistics of the decode stage */
 };
 
 #endif /* _ARCONTROLLER_STREAM2_PRIVATE_H_ */
@@ -43,12 +43,23 @@
 #include <libARController/ARCONTROLLER_Frame.h>
 #include <libARController/ARCONTROLLER_StreamPool.h>
 
+#include "ARCONTROLLER_Frame.h"
 #include "ARCONTROLLER_StreamPool.h"
 
 /*************************
  * Private header
  *************************/
 
+/**
+ * @brief Build a new top of the free list from the previous one and the new first index.
+ */
+#define ARCONTROLLER_STREAMPOOL_HEAD(previousHead, index) ((int64_t)(((((uint64_t)(previousHead)) >> 32) + 1) << 32) | (int64_t)(uint32_t)(index))
+
+/**
+ * @brief Get the first index of a top of the free list.
+ */
+#define ARCONTROLLER_STREAMPOOL_HEAD_INDEX(head) ((uint32_t)((uint64_t)(head) & 0xFFFFFFFF))
+
 /*************************
  * Implementation
  *************************/
@@ -71,6 +82,12 @@ ARCONTROLLER_StreamPool_t *ARCONTROLLER_StreamPool_New (uint32_t capacity, eARCO
             // Initialize to default values
             streamPool->frames = NULL;
             streamPool->capacity = 0;
+            streamPool->nextFree = NULL;
+            streamPool->freeHead = ARCONTROLLER_STREAMPOOL_NO_FRAME;
+            streamPool->inUse = 0;
+            streamPool->peakInUse = 0;
+            streamPool->acquiredCount = 0;
+            streamPool->exhaustedCount = 0;
         }
         else
         {
@@ -82,13 +99,23 @@ ARCONTROLLER_StreamPool_t *ARCONTROLLER_StreamPool_New (uint32_t capacity, eARCO
     {
         //Allocate the frame array
         streamPool->frames = calloc (sizeof (ARCONTROLLER_Frame_t*), capacity);
-        if (streamPool->frames != NULL)
+        streamPool->nextFree = calloc (sizeof (uint32_t), capacity);
+        if ((streamPool->frames != NULL) && (streamPool->nextFree != NULL))
         {
             streamPool->capacity = capacity;
             for (index = 0 ; ((index < capacity) && (localError == ARCONTROLLER_OK)); index++)
             {
                 streamPool->frames[index] = ARCONTROLLER_Frame_New (&localError);
+                if (localError == ARCONTROLLER_OK)
+                {
+                    streamPool->frames[index]->pool = streamPool;
+                    streamPool->frames[index]->poolIndex = (uint32_t)index;
+
+                    // Chain all the frames in the free list, first frame on top
+                    streamPool->nextFree[index] = (index + 1 < capacity) ? (uint32_t)(index + 1) : ARCONTROLLER_STREAMPOOL_NO_FRAME;
+                }
             }
+            streamPool->freeHead = 0;
         }
         else
         {
@@ -134,6 +161,12 @@ void ARCONTROLLER_StreamPool_Delete (ARCONTROLLER_StreamPool_t **streamPool)
                 free ((*streamPool)->frames);
                 (*streamPool)->frames = NULL;
             }
+
+            if ((*streamPool)->nextFree != NULL)
+            {
+                free ((void *)(*streamPool)->nextFree);
+                (*streamPool)->nextFree = NULL;
+            }
             
             free (*streamPool);
             (*streamPool) = NULL;
@@ -147,7 +180,10 @@ ARCONTROLLER_Frame_t *ARCONTROLLER_StreamPool_GetNextFreeFrame (ARCONTROLLER_Str
 
     eARCONTROLLER_ERROR localError = ARCONTROLLER_OK;
     ARCONTROLLER_Frame_t *freeFrame = NULL;
-    size_t index = 0;
+    int64_t head = 0;
+    uint32_t index = 0;
+    int32_t inUse = 0;
+    int32_t peakInUse = 0;
     
     // Check parameters
     if (streamPool == NULL)
@@ -158,18 +194,32 @@ ARCONTROLLER_Frame_t *ARCONTROLLER_StreamPool_GetNextFreeFrame (ARCONTROLLER_Str
     
     if (localError == ARCONTROLLER_OK)
     {
-        for (index = 0 ; index < streamPool->capacity ; index++)
+        // Pop the top of the free list
+        do
         {
-            if (streamPool->frames[index]->available)
+            head = streamPool->freeHead;
+            index = ARCONTROLLER_STREAMPOOL_HEAD_INDEX (head);
+            if (index == ARCONTROLLER_STREAMPOOL_NO_FRAME)
             {
-                streamPool->frames[index]->available = 0;
-                freeFrame = streamPool->frames[index];
-                break; // The first free frame is found ; break the loop.
+                break; // The pool is exhausted ; break the loop.
             }
+        } while (!ARCONTROLLER_STREAMPOOL_CAS64 (&streamPool->freeHead, head, ARCONTROLLER_STREAMPOOL_HEAD (head, streamPool->nextFree[index])));
+        
+        if (index != ARCONTROLLER_STREAMPOOL_NO_FRAME)
+        {
+            freeFrame = streamPool->frames[index];
+            ARCONTROLLER_STREAMPOOL_EXCHANGE (&freeFrame->available, 0);
+            
+            ARCONTROLLER_STREAMPOOL_INCREMENT (&streamPool->acquiredCount);
+            inUse = ARCONTROLLER_STREAMPOOL_INCREMENT (&streamPool->inUse);
+            do
+            {
+                peakInUse = streamPool->peakInUse;
+            } while ((inUse > peakInUse) && (!ARCONTROLLER_STREAMPOOL_CAS32 (&streamPool->peakInUse, peakInUse, inUse)));
         }
-       
-        if (freeFrame == NULL)
+        else
         {
+            ARCONTROLLER_STREAMPOOL_INCREMENT (&streamPool->exhaustedCount);
             localError = ARCONTROLLER_ERROR_STREAMPOOL_FRAME_NOT_FOUND;
         }
     }
@@ -193,7 +243,7 @@ ARCONTROLLER_Frame_t *ARCONTROLLER_StreamPool_GetFrameFromData (ARCONTROLLER_Str
     size_t index = 0;
     
     // Check parameters
-    if (streamPool == NULL)
+    if ((streamPool == NULL) || (frameData == NULL))
     {
         localError = ARCONTROLLER_ERROR_BAD_PARAMETER;
     }
@@ -201,12 +251,19 @@ ARCONTROLLER_Frame_t *ARCONTROLLER_StreamPool_GetFrameFromData (ARCONTROLLER_Str
     
     if (localError == ARCONTROLLER_OK)
     {
-        for (index = 0 ; index < streamPool->capacity ; index++)
+        // The header before the buffer gives the frame directly
+        frame = ARCONTROLLER_Frame_GetFromBase (frameData);
+        if ((frame != NULL) && (frame->pool != streamPool))
+        {
+            frame = NULL;
+        }
+        
+        // Data moved inside its buffer ; search the frame
+        for (index = 0 ; ((frame == NULL) && (index < streamPool->capacity)) ; index++)
         {
             if (streamPool->frames[index]->data == frameData)
             {
                 frame = streamPool->frames[index];
-                break; // The frame is found ; break the loop
             }
         }
        
@@ -226,6 +283,51 @@ ARCONTROLLER_Frame_t *ARCONTROLLER_StreamPool_GetFrameFromData (ARCONTROLLER_Str
     return frame;
 }
 
+eARCONTROLLER_ERROR ARCONTROLLER_StreamPool_GetStats (ARCONTROLLER_StreamPool_t *streamPool, ARCONTROLLER_StreamPool_Stats_t *stats)
+{
+    // -- Get the usage statistics --
+
+    eARCONTROLLER_ERROR error = ARCONTROLLER_OK;
+    
+    // Check parameters
+    if ((streamPool == NULL) || (stats == NULL))
+    {
+        error = ARCONTROLLER_ERROR_BAD_PARAMETER;
+    }
+    // No Else: The checking parameters sets error to ARNETWORK_ERROR_BAD_PARAMETER and stop the processing.
+    
+    if (error == ARCONTROLLER_OK)
+    {
+        stats->capacity = streamPool->capacity;
+        stats->inUse = (uint32_t)streamPool->inUse;
+        stats->peakInUse = (uint32_t)streamPool->peakInUse;
+        stats->acquiredCount = (uint32_t)streamPool->acquiredCount;
+        stats->exhaustedCount = (uint32_t)streamPool->exhaustedCount;
+    }
+    
+    return error;
+}
+
+void ARCONTROLLER_StreamPool_PutFrame (ARCONTROLLER_StreamPool_t *streamPool, ARCONTROLLER_Frame_t *frame)
+{
+    // -- Push a frame on the free list --
+
+    int64_t head = 0;
+    uint32_t index = 0;
+    
+    if ((streamPool != NULL) && (frame != NULL) && (frame->poolIndex < streamPool->capacity))
+    {
+        index = frame->poolIndex;
+        do
+        {
+            head = streamPool->freeHead;
+            streamPool->nextFree[index] = ARCONTROLLER_STREAMPOOL_HEAD_INDEX (head);
+        } while (!ARCONTROLLER_STREAMPOOL_CAS64 (&streamPool->freeHead, head, ARCONTROLLER_STREAMPOOL_HEAD (head, index)));
+        
+        ARCONTROLLER_STREAMPOOL_DECREMENT (&streamPool->inUse);
+    }
+}
+
 /*****************************************
  *
  *             local implementation:
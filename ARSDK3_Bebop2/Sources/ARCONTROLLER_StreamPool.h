@@ -45,10 +45,48 @@
 
 #define ARCONTROLLER_STREAM_POOL_TAG "ARNETWORK_StreamPool"
 
+#define ARCONTROLLER_STREAMPOOL_NO_FRAME 0xFFFFFFFF /**< Index marking the end of the free list */
+
+// Atomic operations used by the lock-free free list
+#ifdef _WIN32
+#include <windows.h>
+#define ARCONTROLLER_STREAMPOOL_CAS64(pointer, expected, desired) (InterlockedCompareExchange64 ((volatile LONGLONG *)(pointer), (desired), (expected)) == (expected))
+#define ARCONTROLLER_STREAMPOOL_CAS32(pointer, expected, desired) (InterlockedCompareExchange ((volatile LONG *)(pointer), (desired), (expected)) == (expected))
+#define ARCONTROLLER_STREAMPOOL_INCREMENT(pointer) InterlockedIncrement ((volatile LONG *)(pointer))
+#define ARCONTROLLER_STREAMPOOL_DECREMENT(pointer) InterlockedDecrement ((volatile LONG *)(pointer))
+#define ARCONTROLLER_STREAMPOOL_EXCHANGE(pointer, value) InterlockedExchange ((volatile LONG *)(pointer), (value))
+#else
+#define ARCONTROLLER_STREAMPOOL_CAS64(pointer, expected, desired) __sync_bool_compare_and_swap ((pointer), (expected), (desired))
+#define ARCONTROLLER_STREAMPOOL_CAS32(pointer, expected, desired) __sync_bool_compare_and_swap ((pointer), (expected), (desired))
+#define ARCONTROLLER_STREAMPOOL_INCREMENT(pointer) __sync_add_and_fetch ((pointer), 1)
+#define ARCONTROLLER_STREAMPOOL_DECREMENT(pointer) __sync_sub_and_fetch ((pointer), 1)
+#define ARCONTROLLER_STREAMPOOL_EXCHANGE(pointer, value) __sync_lock_test_and_set ((pointer), (value))
+#endif
+
+/**
+ * @brief Stream pool.
+ * @note The free frames form a stack of indices linked by nextFree. The top of the stack is
+ * swapped with a 64 bits compare-and-swap, its high 32 bits being a tag incremented by every
+ * change so that a frame taken and given back between a read and the swap is detected (ABA).
+ */
 struct ARCONTROLLER_StreamPool_t
 {
     ARCONTROLLER_Frame_t **frames; /**< Frame array */
     uint32_t capacity; /**< Capacity of the frame array */
+    volatile uint32_t *nextFree; /**< Index of the next free frame, for each free frame */
+    volatile int64_t freeHead; /**< Index of the first free frame in the low 32 bits ; ABA tag in the high 32 bits */
+    volatile int32_t inUse; /**< Number of frames currently taken */
+    volatile int32_t peakInUse; /**< Highest number of frames taken at the same time */
+    volatile int32_t acquiredCount; /**< Number of frames given by ARCONTROLLER_StreamPool_GetNextFreeFrame() */
+    volatile int32_t exhaustedCount; /**< Number of ARCONTROLLER_StreamPool_GetNextFreeFrame() calls that found no free frame */
 };
 
+/**
+ * @brief Give a frame back to its pool.
+ * @note Called by ARCONTROLLER_Frame_SetFree() ; the frame must have been marked available before.
+ * @param streamPool The Stream Pool.
+ * @param frame The frame to put back in the free list.
+ */
+void ARCONTROLLER_StreamPool_PutFrame (ARCONTROLLER_StreamPool_t *streamPool, ARCONTROLLER_Frame_t *frame);
+
 #endif /* _ARCONTROLLER_STREAM_POOL_PRIVATE_H_ */
@@ -0,0 +1,124 @@
+/*
+    Copyright (C) 2014 Parrot SA
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions
+    are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the 
+      distribution.
+    * Neither the name of Parrot nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+    "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+    LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+    FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+    COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+    INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+    OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED 
+    AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+    OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+    SUCH DAMAGE.
+*/
+/**
+ * @file ARCONTROLLER_Telemetry.c
+ * @brief Typed snapshots of the periodic states of a device.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#define ARCONTROLLER_TELEMETRY_BARRIER() MemoryBarrier()
+#else
+#define ARCONTROLLER_TELEMETRY_BARRIER() __sync_synchronize()
+#endif
+
+#include <libARSAL/ARSAL_Mutex.h>
+
+#include <libARController/ARCONTROLLER_Error.h>
+#include <libARController/ARCONTROLLER_Feature.h>
+#include <libARController/ARCONTROLLER_Telemetry.h>
+
+#include "ARCONTROLLER_Feature.h"
+#include "ARCONTROLLER_Telemetry.h"
+
+/*************************
+ * Implementation
+ *************************/
+
+void ARCONTROLLER_Telemetry_InitSeqlock (ARCONTROLLER_TELEMETRY_SEQLOCK_t *seqlock)
+{
+    // -- Initialize a sequence lock --
+    
+    seqlock->sequence = 0;
+}
+
+void ARCONTROLLER_Telemetry_WriteBegin (ARCONTROLLER_TELEMETRY_SEQLOCK_t *seqlock)
+{
+    // -- Start a write ; readers see an odd sequence and retry --
+    
+    seqlock->sequence++;
+    ARCONTROLLER_TELEMETRY_BARRIER();
+}
+
+void ARCONTROLLER_Telemetry_WriteEnd (ARCONTROLLER_TELEMETRY_SEQLOCK_t *seqlock)
+{
+    // -- Finish a write --
+    
+    ARCONTROLLER_TELEMETRY_BARRIER();
+    seqlock->sequence++;
+}
+
+void ARCONTROLLER_Telemetry_Read (const ARCONTROLLER_TELEMETRY_SEQLOCK_t *seqlock, void *destination, const void *source, size_t size)
+{
+    // -- Copy without blocking the writer --
+    
+    uint32_t start = 0;
+    
+    do
+    {
+        start = seqlock->sequence;
+        ARCONTROLLER_TELEMETRY_BARRIER();
+        memcpy (destination, source, size);
+        ARCONTROLLER_TELEMETRY_BARRIER();
+    }
+    while ((start & 1) || (start != seqlock->sequence));
+}
+
+eARCONTROLLER_ERROR ARCONTROLLER_FEATURE_ARDrone3_GetTelemetry (ARCONTROLLER_FEATURE_ARDrone3_t *feature, ARCONTROLLER_TELEMETRY_ARDRONE3_t *snapshot)
+{
+    // -- Get the periodic states of ARDrone3 --
+    
+    if ((feature == NULL) || (feature->privatePart == NULL) || (snapshot == NULL))
+    {
+        return ARCONTROLLER_ERROR_BAD_PARAMETER;
+    }
+    
+    ARCONTROLLER_Telemetry_Read (&(feature->privatePart->telemetryLock), snapshot, &(feature->privatePart->telemetry), sizeof (ARCONTROLLER_TELEMETRY_ARDRONE3_t));
+    
+    return ARCONTROLLER_OK;
+}
+
+eARCONTROLLER_ERROR ARCONTROLLER_FEATURE_Common_GetTelemetry (ARCONTROLLER_FEATURE_Common_t *feature, ARCONTROLLER_TELEMETRY_COMMON_t *snapshot)
+{
+    // -- Get the periodic states of Common --
+    
+    if ((feature == NULL) || (feature->privatePart == NULL) || (snapshot == NULL))
+    {
+        return ARCONTROLLER_ERROR_BAD_PARAMETER;
+    }
+    
+    ARCONTROLLER_Telemetry_Read (&(feature->privatePart->telemetryLock), snapshot, &(feature->privatePart->telemetry), sizeof (ARCONTROLLER_TELEMETRY_COMMON_t));
+    
+    return ARCONTROLLER_OK;
+}
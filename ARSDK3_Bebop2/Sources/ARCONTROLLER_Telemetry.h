@@ -0,0 +1,82 @@
+/*
+    Copyright (C) 2014 Parrot SA
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions
+    are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the 
+      distribution.
+    * Neither the name of Parrot nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+    "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+    LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+    FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+    COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+    INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+    OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED 
+    AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+    OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+    SUCH DAMAGE.
+*/
+/**
+ * @file ARCONTROLLER_Telemetry.h
+ * @brief Sequence lock protecting the telemetry snapshots.
+ */
+
+#ifndef _ARCONTROLLER_TELEMETRY_PRIVATE_H_
+#define _ARCONTROLLER_TELEMETRY_PRIVATE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <libARController/ARCONTROLLER_Telemetry.h>
+
+#define ARCONTROLLER_TELEMETRY_TAG "ARCONTROLLER_Telemetry"
+
+/**
+ * @brief Sequence lock ; odd while a write is in progress.
+ * @note The writers must be serialized by the caller ; the features write under their mutex.
+ */
+typedef struct
+{
+    volatile uint32_t sequence; /**< Incremented before and after each write */
+} ARCONTROLLER_TELEMETRY_SEQLOCK_t;
+
+/**
+ * @brief Initialize a sequence lock.
+ * @param seqlock The sequence lock.
+ */
+void ARCONTROLLER_Telemetry_InitSeqlock (ARCONTROLLER_TELEMETRY_SEQLOCK_t *seqlock);
+
+/**
+ * @brief Start writing the data protected by a sequence lock.
+ * @param seqlock The sequence lock.
+ */
+void ARCONTROLLER_Telemetry_WriteBegin (ARCONTROLLER_TELEMETRY_SEQLOCK_t *seqlock);
+
+/**
+ * @brief Finish writing the data protected by a sequence lock.
+ * @param seqlock The sequence lock.
+ */
+void ARCONTROLLER_Telemetry_WriteEnd (ARCONTROLLER_TELEMETRY_SEQLOCK_t *seqlock);
+
+/**
+ * @brief Copy the data protected by a sequence lock ; retries until no write overlapped the copy.
+ * @param seqlock The sequence lock.
+ * @param[out] destination The copy.
+ * @param source The protected data.
+ * @param size Size of the data.
+ */
+void ARCONTROLLER_Telemetry_Read (const ARCONTROLLER_TELEMETRY_SEQLOCK_t *seqlock, void *destination, const void *source, size_t size);
+
+#endif /* _ARCONTROLLER_TELEMETRY_PRIVATE_H_ */
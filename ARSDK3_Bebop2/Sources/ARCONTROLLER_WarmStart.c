@@ -0,0 +1,1015 @@
+/*
+    Copyright (C) 2014 Parrot SA
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions
+    are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the 
+      distribution.
+    * Neither the name of Parrot nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+    "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+    LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+    FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+    COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+    INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+    OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED 
+    AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+    OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+    SUCH DAMAGE.
+*/
+/**
+ * @file ARCONTROLLER_WarmStart.c
+ * @brief Cache of the last connection to a device.
+ *
+ * The cache file holds the settings of the Common and ARDrone3 features,
+ * the states identifying the device and the H.264 parameter sets of the
+ * video stream. The states describing the flight (flying state, battery,
+ * alerts, position...) are not cached: replayed after a restart they would
+ * be taken for the current ones.
+ * It is written in the native byte order and is only read back on the same
+ * host:
+ *
+ *     header   : "ARWS", version, dictionary key count, value size (uint32 each)
+ *     link     : device address (string), then product, c2d port, server stream port, server control port (int32 each)
+ *     sps, pps : size (uint32) followed by the NAL unit
+ *     Common, then ARDrone3 : command count (uint32), then for each command:
+ *         command key (uint32), element count (uint32), then for each element:
+ *             key (string), argument count (uint32), then for each argument:
+ *                 name (string), value type (uint32), value (string or raw union)
+ *
+ * A string is its size (uint32, terminating null included) followed by its
+ * characters. The names of the restored arguments point into the loaded file,
+ * which is kept until the cache is deleted.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <uthash/uthash.h>
+#include <uthash/utlist.h>
+
+#include <libARSAL/ARSAL_Mutex.h>
+#include <libARSAL/ARSAL_Print.h>
+
+#include <libARController/ARCONTROLLER_Error.h>
+#include <libARController/ARCONTROLLER_DICTIONARY_Key.h>
+#include <libARController/ARCONTROLLER_Dictionary.h>
+#include <libARController/ARCONTROLLER_Feature.h>
+#include <libARController/ARCONTROLLER_Stream.h>
+
+#include "ARCONTROLLER_Feature.h"
+#include "ARCONTROLLER_DictionaryPool.h"
+#include "ARCONTROLLER_WarmStart.h"
+
+/*************************
+ * Private header
+ *************************/
+
+#define ARCONTROLLER_WARMSTART_MAGIC "ARWS"
+#define ARCONTROLLER_WARMSTART_MAGIC_SIZE 4
+#define ARCONTROLLER_WARMSTART_WRITER_INITIAL_CAPACITY 4096
+
+typedef struct ARCONTROLLER_WARMSTART_BLOCK_t ARCONTROLLER_WARMSTART_BLOCK_t;
+
+/**
+ * @brief Loaded cache file referenced by restored arguments.
+ */
+struct ARCONTROLLER_WARMSTART_BLOCK_t
+{
+    uint8_t *data; /**< Content of the file */
+    ARCONTROLLER_WARMSTART_BLOCK_t *next; /**< Next block */
+};
+
+struct ARCONTROLLER_WarmStart_t
+{
+    char *cachePath; /**< Path of the cache file */
+    char *tmpPath; /**< Path of the file written before replacing the cache file */
+    ARSAL_Mutex_t mutex; /**< Protects the parameter sets */
+    uint8_t *sps; /**< Last SPS NAL unit of the video stream ; NULL if unknown */
+    int spsSize; /**< Size of the SPS */
+    uint8_t *pps; /**< Last PPS NAL unit of the video stream ; NULL if unknown */
+    int ppsSize; /**< Size of the PPS */
+    ARCONTROLLER_WARMSTART_BLOCK_t *blocks; /**< Loaded cache files */
+};
+
+/**
+ * @brief Growable buffer in which the cache is serialized.
+ */
+typedef struct
+{
+    uint8_t *data;
+    size_t size;
+    size_t capacity;
+    int failed; /**< 1 if an allocation failed */
+} ARCONTROLLER_WARMSTART_WRITER_t;
+
+/**
+ * @brief Bounds checked cursor on a loaded cache file.
+ */
+typedef struct
+{
+    uint8_t *data;
+    size_t size;
+    size_t position;
+    int failed; /**< 1 if a read went past the end or found malformed data */
+} ARCONTROLLER_WARMSTART_READER_t;
+
+static int ARCONTROLLER_WarmStart_IsCachedCommand (eARCONTROLLER_DICTIONARY_KEY commandKey);
+static void ARCONTROLLER_WarmStart_Write (ARCONTROLLER_WARMSTART_WRITER_t *writer, const void *data, size_t size);
+static void ARCONTROLLER_WarmStart_WriteU32 (ARCONTROLLER_WARMSTART_WRITER_t *writer, uint32_t value);
+static void ARCONTROLLER_WarmStart_WriteString (ARCONTROLLER_WARMSTART_WRITER_t *writer, const char *string);
+static void ARCONTROLLER_WarmStart_WriteDictionary (ARCONTROLLER_WARMSTART_WRITER_t *writer, ARCONTROLLER_DICTIONARY_COMMANDS_t **dictionary, ARSAL_Mutex_t *mutex);
+static uint8_t *ARCONTROLLER_WarmStart_Read (ARCONTROLLER_WARMSTART_READER_t *reader, size_t size);
+static uint32_t ARCONTROLLER_WarmStart_ReadU32 (ARCONTROLLER_WARMSTART_READER_t *reader);
+static char *ARCONTROLLER_WarmStart_ReadString (ARCONTROLLER_WARMSTART_READER_t *reader);
+static ARCONTROLLER_DICTIONARY_COMMANDS_t *ARCONTROLLER_WarmStart_ReadCommand (ARCONTROLLER_WARMSTART_READER_t *reader, eARCONTROLLER_DICTIONARY_KEY featureKey);
+static int ARCONTROLLER_WarmStart_ReadDictionary (ARCONTROLLER_WARMSTART_READER_t *reader, eARCONTROLLER_DICTIONARY_KEY featureKey, ARCONTROLLER_DICTIONARY_COMMANDS_t **dictionary, ARSAL_Mutex_t *mutex, ARCONTROLLER_Dictionary_t *commandCallbacks);
+static uint8_t *ARCONTROLLER_WarmStart_LoadFile (const char *path, size_t *size);
+static char *ARCONTROLLER_WarmStart_Concat (const char *string, const char *suffix);
+
+/*************************
+ * Implementation
+ *************************/
+
+ARCONTROLLER_WarmStart_t *ARCONTROLLER_WarmStart_New (const char *cachePath, eARCONTROLLER_ERROR *error)
+{
+    // -- Create a warm start cache --
+    
+    eARCONTROLLER_ERROR localError = ARCONTROLLER_OK;
+    ARCONTROLLER_WarmStart_t *warmStart = NULL;
+    
+    // Check parameters
+    if (cachePath == NULL)
+    {
+        localError = ARCONTROLLER_ERROR_BAD_PARAMETER;
+    }
+    // No Else: the checking parameters sets localError to ARCONTROLLER_ERROR_BAD_PARAMETER and stop the processing
+    
+    if (localError == ARCONTROLLER_OK)
+    {
+        warmStart = calloc (1, sizeof (ARCONTROLLER_WarmStart_t));
+        if (warmStart == NULL)
+        {
+            localError = ARCONTROLLER_ERROR_ALLOC;
+        }
+    }
+    
+    if (localError == ARCONTROLLER_OK)
+    {
+        warmStart->cachePath = ARCONTROLLER_WarmStart_Concat (cachePath, "");
+        warmStart->tmpPath = ARCONTROLLER_WarmStart_Concat (cachePath, ".tmp");
+        if ((warmStart->cachePath == NULL) || (warmStart->tmpPath == NULL))
+        {
+            localError = ARCONTROLLER_ERROR_ALLOC;
+        }
+    }
+    
+    if (localError == ARCONTROLLER_OK)
+    {
+        if (ARSAL_Mutex_Init (&(warmStart->mutex)) != 0)
+        {
+            localError = ARCONTROLLER_ERROR_INIT_MUTEX;
+        }
+    }
+    
+    // Delete the warm start cache if an error occurred
+    if ((localError != ARCONTROLLER_OK) && (warmStart != NULL))
+    {
+        free (warmStart->cachePath);
+        free (warmStart->tmpPath);
+        free (warmStart);
+        warmStart = NULL;
+    }
+    
+    // Return the error
+    if (error != NULL)
+    {
+        *error = localError;
+    }
+    // No else: error is not returned 
+    
+    return warmStart;
+}
+
+void ARCONTROLLER_WarmStart_Delete (ARCONTROLLER_WarmStart_t **warmStart)
+{
+    // -- Delete a warm start cache --
+    
+    ARCONTROLLER_WARMSTART_BLOCK_t *block = NULL;
+    ARCONTROLLER_WARMSTART_BLOCK_t *blockTmp = NULL;
+    
+    if ((warmStart != NULL) && ((*warmStart) != NULL))
+    {
+        LL_FOREACH_SAFE ((*warmStart)->blocks, block, blockTmp)
+        {
+            LL_DELETE ((*warmStart)->blocks, block);
+            free (block->data);
+            free (block);
+        }
+        
+        ARSAL_Mutex_Destroy (&((*warmStart)->mutex));
+        free ((*warmStart)->sps);
+        free ((*warmStart)->pps);
+        free ((*warmStart)->cachePath);
+        free ((*warmStart)->tmpPath);
+        free (*warmStart);
+        (*warmStart) = NULL;
+    }
+}
+
+eARCONTROLLER_ERROR ARCONTROLLER_WarmStart_Restore (ARCONTROLLER_WarmStart_t *warmStart, const ARCONTROLLER_WARMSTART_LINK_t *link, ARCONTROLLER_FEATURE_Common_t *common, ARCONTROLLER_FEATURE_ARDrone3_t *aRDrone3)
+{
+    // -- Restore the cache file into the dictionaries of the features --
+    
+    eARCONTROLLER_ERROR error = ARCONTROLLER_OK;
+    ARCONTROLLER_WARMSTART_READER_t reader;
+    ARCONTROLLER_WARMSTART_BLOCK_t *block = NULL;
+    uint8_t *magic = NULL;
+    char *address = NULL;
+    uint8_t *sps = NULL;
+    uint8_t *pps = NULL;
+    uint32_t spsSize = 0;
+    uint32_t ppsSize = 0;
+    size_t contentPosition = 0;
+    int restoredCount = 0;
+    int pass = 0;
+    
+    memset (&reader, 0, sizeof (ARCONTROLLER_WARMSTART_READER_t));
+    
+    // Check parameters
+    if ((warmStart == NULL) || (link == NULL))
+    {
+        error = ARCONTROLLER_ERROR_BAD_PARAMETER;
+    }
+    // No Else: the checking parameters sets error to ARCONTROLLER_ERROR_BAD_PARAMETER and stop the processing
+    
+    if (error == ARCONTROLLER_OK)
+    {
+        reader.data = ARCONTROLLER_WarmStart_LoadFile (warmStart->cachePath, &(reader.size));
+        if (reader.data == NULL)
+        {
+            ARSAL_PRINT (ARSAL_PRINT_INFO, ARCONTROLLER_WARMSTART_TAG, "No cache in %s", warmStart->cachePath);
+            error = ARCONTROLLER_ERROR_NO_ELEMENT;
+        }
+    }
+    
+    if (error == ARCONTROLLER_OK)
+    {
+        // The cache must have been written by this build for the same link
+        magic = ARCONTROLLER_WarmStart_Read (&reader, ARCONTROLLER_WARMSTART_MAGIC_SIZE);
+        if ((magic == NULL) ||
+            (memcmp (magic, ARCONTROLLER_WARMSTART_MAGIC, ARCONTROLLER_WARMSTART_MAGIC_SIZE) != 0) ||
+            (ARCONTROLLER_WarmStart_ReadU32 (&reader) != ARCONTROLLER_WARMSTART_VERSION) ||
+            (ARCONTROLLER_WarmStart_ReadU32 (&reader) != ARCONTROLLER_DICTIONARY_DICTIONARY_KEY_MAX) ||
+            (ARCONTROLLER_WarmStart_ReadU32 (&reader) != sizeof (ARCONTROLLER_DICTIONARY_VALUE_t)) ||
+            ((address = ARCONTROLLER_WarmStart_ReadString (&reader)) == NULL) ||
+            (strcmp (address, link->address) != 0) ||
+            ((int)ARCONTROLLER_WarmStart_ReadU32 (&reader) != link->productID) ||
+            ((int)ARCONTROLLER_WarmStart_ReadU32 (&reader) != link->c2dPort) ||
+            ((int)ARCONTROLLER_WarmStart_ReadU32 (&reader) != link->serverStreamPort) ||
+            ((int)ARCONTROLLER_WarmStart_ReadU32 (&reader) != link->serverControlPort))
+        {
+            ARSAL_PRINT (ARSAL_PRINT_INFO, ARCONTROLLER_WARMSTART_TAG, "Cache %s does not match the connection", warmStart->cachePath);
+            error = ARCONTROLLER_ERROR_NO_ELEMENT;
+        }
+    }
+    
+    if (error == ARCONTROLLER_OK)
+    {
+        spsSize = ARCONTROLLER_WarmStart_ReadU32 (&reader);
+        sps = ARCONTROLLER_WarmStart_Read (&reader, spsSize);
+        ppsSize = ARCONTROLLER_WarmStart_ReadU32 (&reader);
+        pps = ARCONTROLLER_WarmStart_Read (&reader, ppsSize);
+        contentPosition = reader.position;
+        
+        // Check the whole file before restoring anything, then restore it
+        for (pass = 0; (pass < 2) && (!reader.failed); pass++)
+        {
+            reader.position = contentPosition;
+            restoredCount = ARCONTROLLER_WarmStart_ReadDictionary (&reader, ARCONTROLLER_DICTIONARY_KEY_COMMON,
+                                                                   ((pass == 1) && (common != NULL)) ? &(common->privatePart->dictionary) : NULL,
+                                                                   (common != NULL) ? &(common->privatePart->mutex) : NULL,
+                                                                   (common != NULL) ? common->privatePart->commandCallbacks : NULL);
+            restoredCount += ARCONTROLLER_WarmStart_ReadDictionary (&reader, ARCONTROLLER_DICTIONARY_KEY_ARDRONE3,
+                                                                    ((pass == 1) && (aRDrone3 != NULL)) ? &(aRDrone3->privatePart->dictionary) : NULL,
+                                                                    (aRDrone3 != NULL) ? &(aRDrone3->privatePart->mutex) : NULL,
+                                                                    (aRDrone3 != NULL) ? aRDrone3->privatePart->commandCallbacks : NULL);
+        }
+        
+        if (reader.failed)
+        {
+            ARSAL_PRINT (ARSAL_PRINT_ERROR, ARCONTROLLER_WARMSTART_TAG, "Cache %s is corrupted", warmStart->cachePath);
+            error = ARCONTROLLER_ERROR_NO_ELEMENT;
+        }
+    }
+    
+    if ((error == ARCONTROLLER_OK) && (spsSize > 0) && (ppsSize > 0))
+    {
+        // Parameter sets received on this connection are newer than the cached ones
+        ARSAL_Mutex_Lock (&(warmStart->mutex));
+        if ((warmStart->sps == NULL) && (warmStart->pps == NULL))
+        {
+            warmStart->sps = malloc (spsSize);
+            warmStart->pps = malloc (ppsSize);
+            if ((warmStart->sps != NULL) && (warmStart->pps != NULL))
+            {
+                memcpy (warmStart->sps, sps, spsSize);
+                warmStart->spsSize = spsSize;
+                memcpy (warmStart->pps, pps, ppsSize);
+                warmStart->ppsSize = ppsSize;
+            }
+            else
+            {
+                free (warmStart->sps);
+                warmStart->sps = NULL;
+                free (warmStart->pps);
+                warmStart->pps = NULL;
+            }
+        }
+        ARSAL_Mutex_Unlock (&(warmStart->mutex));
+    }
+    
+    if ((error == ARCONTROLLER_OK) && (restoredCount > 0))
+    {
+        // Keep the file ; the names of the restored arguments point into it
+        block = malloc (sizeof (ARCONTROLLER_WARMSTART_BLOCK_t));
+        if (block != NULL)
+        {
+            block->data = reader.data;
+            reader.data = NULL;
+            LL_PREPEND (warmStart->blocks, block);
+        }
+        else
+        {
+            // Leak the file rather than leave dangling names
+            ARSAL_PRINT (ARSAL_PRINT_ERROR, ARCONTROLLER_WARMSTART_TAG, "Cache block allocation failed");
+            reader.data = NULL;
+        }
+    }
+    
+    if (error == ARCONTROLLER_OK)
+    {
+        ARSAL_PRINT (ARSAL_PRINT_INFO, ARCONTROLLER_WARMSTART_TAG, "Restored %d commands from %s", restoredCount, warmStart->cachePath);
+    }
+    
+    free (reader.data);
+    
+    return error;
+}
+
+eARCONTROLLER_ERROR ARCONTROLLER_WarmStart_Save (ARCONTROLLER_WarmStart_t *warmStart, const ARCONTROLLER_WARMSTART_LINK_t *link, ARCONTROLLER_FEATURE_Common_t *common, ARCONTROLLER_FEATURE_ARDrone3_t *aRDrone3)
+{
+    // -- Save the dictionaries of the features and the video parameter sets to the cache file --
+    
+    eARCONTROLLER_ERROR error = ARCONTROLLER_OK;
+    ARCONTROLLER_WARMSTART_WRITER_t writer;
+    FILE *file = NULL;
+    
+    memset (&writer, 0, sizeof (ARCONTROLLER_WARMSTART_WRITER_t));
+    
+    // Check parameters
+    if ((warmStart == NULL) || (link == NULL))
+    {
+        error = ARCONTROLLER_ERROR_BAD_PARAMETER;
+    }
+    // No Else: the checking parameters sets error to ARCONTROLLER_ERROR_BAD_PARAMETER and stop the processing
+    
+    if (error == ARCONTROLLER_OK)
+    {
+        // Serialize in memory ; the features are only locked while their dictionary is copied
+        ARCONTROLLER_WarmStart_Write (&writer, ARCONTROLLER_WARMSTART_MAGIC, ARCONTROLLER_WARMSTART_MAGIC_SIZE);
+        ARCONTROLLER_WarmStart_WriteU32 (&writer, ARCONTROLLER_WARMSTART_VERSION);
+        ARCONTROLLER_WarmStart_WriteU32 (&writer, ARCONTROLLER_DICTIONARY_DICTIONARY_KEY_MAX);
+        ARCONTROLLER_WarmStart_WriteU32 (&writer, sizeof (ARCONTROLLER_DICTIONARY_VALUE_t));
+        ARCONTROLLER_WarmStart_WriteString (&writer, link->address);
+        ARCONTROLLER_WarmStart_WriteU32 (&writer, (uint32_t)link->productID);
+        ARCONTROLLER_WarmStart_WriteU32 (&writer, (uint32_t)link->c2dPort);
+        ARCONTROLLER_WarmStart_WriteU32 (&writer, (uint32_t)link->serverStreamPort);
+        ARCONTROLLER_WarmStart_WriteU32 (&writer, (uint32_t)link->serverControlPort);
+        
+        ARSAL_Mutex_Lock (&(warmStart->mutex));
+        ARCONTROLLER_WarmStart_WriteU32 (&writer, warmStart->spsSize);
+        ARCONTROLLER_WarmStart_Write (&writer, warmStart->sps, warmStart->spsSize);
+        ARCONTROLLER_WarmStart_WriteU32 (&writer, warmStart->ppsSize);
+        ARCONTROLLER_WarmStart_Write (&writer, warmStart->pps, warmStart->ppsSize);
+        ARSAL_Mutex_Unlock (&(warmStart->mutex));
+        
+        ARCONTROLLER_WarmStart_WriteDictionary (&writer, (common != NULL) ? &(common->privatePart->dictionary) : NULL, (common != NULL) ? &(common->privatePart->mutex) : NULL);
+        ARCONTROLLER_WarmStart_WriteDictionary (&writer, (aRDrone3 != NULL) ? &(aRDrone3->privatePart->dictionary) : NULL, (aRDrone3 != NULL) ? &(aRDrone3->privatePart->mutex) : NULL);
+        
+        if (writer.failed)
+        {
+            error = ARCONTROLLER_ERROR_ALLOC;
+        }
+    }
+    
+    if (error == ARCONTROLLER_OK)
+    {
+        // Write a temporary file then replace the cache, so that a crash never leaves a truncated cache
+        file = fopen (warmStart->tmpPath, "wb");
+        if (file == NULL)
+        {
+            ARSAL_PRINT (ARSAL_PRINT_ERROR, ARCONTROLLER_WARMSTART_TAG, "Unable to open %s", warmStart->tmpPath);
+            error = ARCONTROLLER_ERROR;
+        }
+    }
+    
+    if (error == ARCONTROLLER_OK)
+    {
+        if (fwrite (writer.data, 1, writer.size, file) != writer.size)
+        {
+            error = ARCONTROLLER_ERROR;
+        }
+        if (fclose (file) != 0)
+        {
+            error = ARCONTROLLER_ERROR;
+        }
+        file = NULL;
+        
+        if (error != ARCONTROLLER_OK)
+        {
+            ARSAL_PRINT (ARSAL_PRINT_ERROR, ARCONTROLLER_WARMSTART_TAG, "Unable to write %s", warmStart->tmpPath);
+            remove (warmStart->tmpPath);
+        }
+    }
+    
+    if (error == ARCONTROLLER_OK)
+    {
+#ifdef _WIN32
+        // rename() does not replace an existing file on Windows
+        remove (warmStart->cachePath);
+#endif
+        if (rename (warmStart->tmpPath, warmStart->cachePath) != 0)
+        {
+            ARSAL_PRINT (ARSAL_PRINT_ERROR, ARCONTROLLER_WARMSTART_TAG, "Unable to replace %s", warmStart->cachePath);
+            remove (warmStart->tmpPath);
+            error = ARCONTROLLER_ERROR;
+        }
+    }
+    
+    free (writer.data);
+    
+    return error;
+}
+
+eARCONTROLLER_ERROR ARCONTROLLER_WarmStart_SetVideoCodec (ARCONTROLLER_WarmStart_t *warmStart, const ARCONTROLLER_Stream_Codec_t *codec)
+{
+    // -- Keep the H.264 parameter sets of the video stream --
+    
+    eARCONTROLLER_ERROR error = ARCONTROLLER_OK;
+    const ARCONTROLLER_Stream_CodecH264_t *h264 = NULL;
+    uint8_t *sps = NULL;
+    uint8_t *pps = NULL;
+    
+    // Check parameters
+    if ((warmStart == NULL) || (codec == NULL))
+    {
+        error = ARCONTROLLER_ERROR_BAD_PARAMETER;
+    }
+    // No Else: the checking parameters sets error to ARCONTROLLER_ERROR_BAD_PARAMETER and stop the processing
+    
+    if ((error == ARCONTROLLER_OK) && (codec->type == ARCONTROLLER_STREAM_CODEC_TYPE_H264))
+    {
+        h264 = &(codec->parameters.h264parameters);
+        if ((h264->spsBuffer != NULL) && (h264->spsSize > 0) && (h264->ppsBuffer != NULL) && (h264->ppsSize > 0))
+        {
+            sps = malloc (h264->spsSize);
+            pps = malloc (h264->ppsSize);
+            if ((sps != NULL) && (pps != NULL))
+            {
+                memcpy (sps, h264->spsBuffer, h264->spsSize);
+                memcpy (pps, h264->ppsBuffer, h264->ppsSize);
+                
+                ARSAL_Mutex_Lock (&(warmStart->mutex));
+                free (warmStart->sps);
+                free (warmStart->pps);
+                warmStart->sps = sps;
+                warmStart->spsSize = h264->spsSize;
+                warmStart->pps = pps;
+                warmStart->ppsSize = h264->ppsSize;
+                ARSAL_Mutex_Unlock (&(warmStart->mutex));
+            }
+            else
+            {
+                free (sps);
+                free (pps);
+                error = ARCONTROLLER_ERROR_ALLOC;
+            }
+        }
+    }
+    
+    return error;
+}
+
+eARCONTROLLER_ERROR ARCONTROLLER_WarmStart_ConfigureDecoder (ARCONTROLLER_WarmStart_t *warmStart, ARCONTROLLER_Stream_DecoderConfigCallback_t decoderConfigCallback, void *customData)
+{
+    // -- Call a decoder configuration callback with the H.264 parameter sets restored from the cache --
+    
+    eARCONTROLLER_ERROR error = ARCONTROLLER_OK;
+    ARCONTROLLER_Stream_Codec_t codec;
+    
+    // Check parameters
+    if ((warmStart == NULL) || (decoderConfigCallback == NULL))
+    {
+        error = ARCONTROLLER_ERROR_BAD_PARAMETER;
+    }
+    // No Else: the checking parameters sets error to ARCONTROLLER_ERROR_BAD_PARAMETER and stop the processing
+    
+    if (error == ARCONTROLLER_OK)
+    {
+        ARSAL_Mutex_Lock (&(warmStart->mutex));
+        
+        if ((warmStart->sps != NULL) && (warmStart->pps != NULL))
+        {
+            memset (&codec, 0, sizeof (ARCONTROLLER_Stream_Codec_t));
+            codec.type = ARCONTROLLER_STREAM_CODEC_TYPE_H264;
+            codec.parameters.h264parameters.spsBuffer = warmStart->sps;
+            codec.parameters.h264parameters.spsSize = warmStart->spsSize;
+            codec.parameters.h264parameters.ppsBuffer = warmStart->pps;
+            codec.parameters.h264parameters.ppsSize = warmStart->ppsSize;
+            codec.parameters.h264parameters.isMP4Compliant = 0;
+            
+            // Called under the mutex so that the buffers cannot be replaced meanwhile
+            decoderConfigCallback (codec, customData);
+        }
+        else
+        {
+            error = ARCONTROLLER_ERROR_NO_ELEMENT;
+        }
+        
+        ARSAL_Mutex_Unlock (&(warmStart->mutex));
+    }
+    
+    return error;
+}
+
+/*************************
+ * Private Implementation
+ *************************/
+
+static int ARCONTROLLER_WarmStart_IsCachedCommand (eARCONTROLLER_DICTIONARY_KEY commandKey)
+{
+    // -- Check whether a command is kept in the cache : the settings and the states identifying the device --
+    
+    int isCached = 0;
+    
+    switch (commandKey)
+    {
+        case ARCONTROLLER_DICTIONARY_KEY_COMMON_SETTINGSSTATE_PRODUCTNAMECHANGED:
+        case ARCONTROLLER_DICTIONARY_KEY_COMMON_SETTINGSSTATE_PRODUCTVERSIONCHANGED:
+        case ARCONTROLLER_DICTIONARY_KEY_COMMON_SETTINGSSTATE_PRODUCTSERIALHIGHCHANGED:
+        case ARCONTROLLER_DICTIONARY_KEY_COMMON_SETTINGSSTATE_PRODUCTSERIALLOWCHANGED:
+        case ARCONTROLLER_DICTIONARY_KEY_COMMON_SETTINGSSTATE_COUNTRYCHANGED:
+        case ARCONTROLLER_DICTIONARY_KEY_COMMON_SETTINGSSTATE_AUTOCOUNTRYCHANGED:
+        case ARCONTROLLER_DICTIONARY_KEY_COMMON_COMMONSTATE_PRODUCTMODEL:
+        case ARCONTROLLER_DICTIONARY_KEY_ARDRONE3_PILOTINGSETTINGSSTATE_MAXALTITUDECHANGED:
+        case ARCONTROLLER_DICTIONARY_KEY_ARDRONE3_PILOTINGSETTINGSSTATE_MAXTILTCHANGED:
+        case ARCONTROLLER_DICTIONARY_KEY_ARDRONE3_PILOTINGSETTINGSSTATE_ABSOLUTCONTROLCHANGED:
+        case ARCONTROLLER_DICTIONARY_KEY_ARDRONE3_PILOTINGSETTINGSSTATE_MAXDISTANCECHANGED:
+        case ARCONTROLLER_DICTIONARY_KEY_ARDRONE3_PILOTINGSETTINGSSTATE_NOFLYOVERMAXDISTANCECHANGED:
+        case ARCONTROLLER_DICTIONARY_KEY_ARDRONE3_PILOTINGSETTINGSSTATE_BANKEDTURNCHANGED:
+        case ARCONTROLLER_DICTIONARY_KEY_ARDRONE3_PILOTINGSETTINGSSTATE_MINALTITUDECHANGED:
+        case ARCONTROLLER_DICTIONARY_KEY_ARDRONE3_SPEEDSETTINGSSTATE_MAXVERTICALSPEEDCHANGED:
+        case ARCONTROLLER_DICTIONARY_KEY_ARDRONE3_SPEEDSETTINGSSTATE_MAXROTATIONSPEEDCHANGED:
+        case ARCONTROLLER_DICTIONARY_KEY_ARDRONE3_SPEEDSETTINGSSTATE_HULLPROTECTIONCHANGED:
+        case ARCONTROLLER_DICTIONARY_KEY_ARDRONE3_SPEEDSETTINGSSTATE_OUTDOORCHANGED:
+        case ARCONTROLLER_DICTIONARY_KEY_ARDRONE3_SPEEDSETTINGSSTATE_MAXPITCHROLLROTATIONSPEEDCHANGED:
+        case ARCONTROLLER_DICTIONARY_KEY_ARDRONE3_NETWORKSETTINGSSTATE_WIFISELECTIONCHANGED:
+        case ARCONTROLLER_DICTIONARY_KEY_ARDRONE3_NETWORKSETTINGSSTATE_WIFISECURITYCHANGED:
+        case ARCONTROLLER_DICTIONARY_KEY_ARDRONE3_NETWORKSETTINGSSTATE_WIFISECURITY:
+        case ARCONTROLLER_DICTIONARY_KEY_ARDRONE3_PICTURESETTINGSSTATE_PICTUREFORMATCHANGED:
+        case ARCONTROLLER_DICTIONARY_KEY_ARDRONE3_PICTURESETTINGSSTATE_AUTOWHITEBALANCECHANGED:
+        case ARCONTROLLER_DICTIONARY_KEY_ARDRONE3_PICTURESETTINGSSTATE_EXPOSITIONCHANGED:
+        case ARCONTROLLER_DICTIONARY_KEY_ARDRONE3_PICTURESETTINGSSTATE_SATURATIONCHANGED:
+        case ARCONTROLLER_DICTIONARY_KEY_ARDRONE3_PICTURESETTINGSSTATE_TIMELAPSECHANGED:
+        case ARCONTROLLER_DICTIONARY_KEY_ARDRONE3_PICTURESETTINGSSTATE_VIDEOAUTORECORDCHANGED:
+        case ARCONTROLLER_DICTIONARY_KEY_ARDRONE3_PICTURESETTINGSSTATE_VIDEOSTABILIZATIONMODECHANGED:
+        case ARCONTROLLER_DICTIONARY_KEY_ARDRONE3_PICTURESETTINGSSTATE_VIDEORECORDINGMODECHANGED:
+        case ARCONTROLLER_DICTIONARY_KEY_ARDRONE3_PICTURESETTINGSSTATE_VIDEOFRAMERATECHANGED:
+        case ARCONTROLLER_DICTIONARY_KEY_ARDRONE3_PICTURESETTINGSSTATE_VIDEORESOLUTIONSCHANGED:
+        case ARCONTROLLER_DICTIONARY_KEY_ARDRONE3_MEDIASTREAMINGSTATE_VIDEOENABLECHANGED:
+        case ARCONTROLLER_DICTIONARY_KEY_ARDRONE3_MEDIASTREAMINGSTATE_VIDEOSTREAMMODECHANGED:
+        case ARCONTROLLER_DICTIONARY_KEY_ARDRONE3_GPSSETTINGSSTATE_HOMETYPECHANGED:
+        case ARCONTROLLER_DICTIONARY_KEY_ARDRONE3_GPSSETTINGSSTATE_RETURNHOMEDELAYCHANGED:
+        case ARCONTROLLER_DICTIONARY_KEY_ARDRONE3_ANTIFLICKERINGSTATE_ELECTRICFREQUENCYCHANGED:
+        case ARCONTROLLER_DICTIONARY_KEY_ARDRONE3_ANTIFLICKERINGSTATE_MODECHANGED:
+            isCached = 1;
+            break;
+            
+        default:
+            // The flight states, the end of the initial settings and states and the events are awaited from the device
+            isCached = 0;
+            break;
+    }
+    
+    return isCached;
+}
+
+static void ARCONTROLLER_WarmStart_Write (ARCONTROLLER_WARMSTART_WRITER_t *writer, const void *data, size_t size)
+{
+    // -- Append data to the serialized cache --
+    
+    size_t capacity = 0;
+    uint8_t *newData = NULL;
+    
+    if ((writer->failed) || (size == 0))
+    {
+        return;
+    }
+    
+    if (writer->size + size > writer->capacity)
+    {
+        capacity = (writer->capacity > 0) ? writer->capacity : ARCONTROLLER_WARMSTART_WRITER_INITIAL_CAPACITY;
+        while (writer->size + size > capacity)
+        {
+            capacity *= 2;
+        }
+        
+        newData = realloc (writer->data, capacity);
+        if (newData == NULL)
+        {
+            writer->failed = 1;
+            return;
+        }
+        writer->data = newData;
+        writer->capacity = capacity;
+    }
+    
+    memcpy (writer->data + writer->size, data, size);
+    writer->size += size;
+}
+
+static void ARCONTROLLER_WarmStart_WriteU32 (ARCONTROLLER_WARMSTART_WRITER_t *writer, uint32_t value)
+{
+    ARCONTROLLER_WarmStart_Write (writer, &value, sizeof (uint32_t));
+}
+
+static void ARCONTROLLER_WarmStart_WriteString (ARCONTROLLER_WARMSTART_WRITER_t *writer, const char *string)
+{
+    // -- Append a string, terminating null included --
+    
+    uint32_t size = (string != NULL) ? (uint32_t)(strlen (string) + 1) : 0;
+    
+    ARCONTROLLER_WarmStart_WriteU32 (writer, size);
+    ARCONTROLLER_WarmStart_Write (writer, string, size);
+}
+
+static void ARCONTROLLER_WarmStart_WriteDictionary (ARCONTROLLER_WARMSTART_WRITER_t *writer, ARCONTROLLER_DICTIONARY_COMMANDS_t **dictionary, ARSAL_Mutex_t *mutex)
+{
+    // -- Append the commands of a feature dictionary --
+    
+    ARCONTROLLER_DICTIONARY_COMMANDS_t *dictCmdElement = NULL;
+    ARCONTROLLER_DICTIONARY_COMMANDS_t *dictCmdTmp = NULL;
+    ARCONTROLLER_DICTIONARY_ELEMENT_t *dictElement = NULL;
+    ARCONTROLLER_DICTIONARY_ELEMENT_t *dictElementTmp = NULL;
+    ARCONTROLLER_DICTIONARY_ARG_t *arg = NULL;
+    ARCONTROLLER_DICTIONARY_ARG_t *argTmp = NULL;
+    size_t countPosition = writer->size;
+    uint32_t commandCount = 0;
+    
+    // The count is patched once the commands are written
+    ARCONTROLLER_WarmStart_WriteU32 (writer, 0);
+    
+    if ((dictionary == NULL) || (mutex == NULL))
+    {
+        return;
+    }
+    
+    // The head is read under the mutex ; the decode callbacks may add commands meanwhile
+    ARSAL_Mutex_Lock (mutex);
+    
+    HASH_ITER (hh, (*dictionary), dictCmdElement, dictCmdTmp)
+    {
+        // The other commands would be notified as current when the cache is restored
+        if (!ARCONTROLLER_WarmStart_IsCachedCommand (dictCmdElement->command))
+        {
+            continue;
+        }
+        
+        ARCONTROLLER_WarmStart_WriteU32 (writer, dictCmdElement->command);
+        ARCONTROLLER_WarmStart_WriteU32 (writer, HASH_COUNT (dictCmdElement->elements));
+        
+        HASH_ITER (hh, dictCmdElement->elements, dictElement, dictElementTmp)
+        {
+            ARCONTROLLER_WarmStart_WriteString (writer, dictElement->key);
+            ARCONTROLLER_WarmStart_WriteU32 (writer, HASH_COUNT (dictElement->arguments));
+            
+            HASH_ITER (hh, dictElement->arguments, arg, argTmp)
+            {
+                ARCONTROLLER_WarmStart_WriteString (writer, arg->argument);
+                ARCONTROLLER_WarmStart_WriteU32 (writer, arg->valueType);
+                if (arg->valueType == ARCONTROLLER_DICTIONARY_VALUE_TYPE_STRING)
+                {
+                    ARCONTROLLER_WarmStart_WriteString (writer, (arg->value.String != NULL) ? arg->value.String : "");
+                }
+                else
+                {
+                    ARCONTROLLER_WarmStart_Write (writer, &(arg->value), sizeof (ARCONTROLLER_DICTIONARY_VALUE_t));
+                }
+            }
+        }
+        
+        commandCount++;
+    }
+    
+    ARSAL_Mutex_Unlock (mutex);
+    
+    if (!writer->failed)
+    {
+        memcpy (writer->data + countPosition, &commandCount, sizeof (uint32_t));
+    }
+}
+
+static uint8_t *ARCONTROLLER_WarmStart_Read (ARCONTROLLER_WARMSTART_READER_t *reader, size_t size)
+{
+    // -- Get the next bytes of the cache file --
+    
+    uint8_t *data = NULL;
+    
+    if ((!reader->failed) && (size <= reader->size - reader->position))
+    {
+        data = reader->data + reader->position;
+        reader->position += size;
+    }
+    else
+    {
+        reader->failed = 1;
+    }
+    
+    return data;
+}
+
+static uint32_t ARCONTROLLER_WarmStart_ReadU32 (ARCONTROLLER_WARMSTART_READER_t *reader)
+{
+    uint32_t value = 0;
+    uint8_t *data = ARCONTROLLER_WarmStart_Read (reader, sizeof (uint32_t));
+    
+    if (data != NULL)
+    {
+        memcpy (&value, data, sizeof (uint32_t));
+    }
+    
+    return value;
+}
+
+static char *ARCONTROLLER_WarmStart_ReadString (ARCONTROLLER_WARMSTART_READER_t *reader)
+{
+    // -- Get the next string of the cache file ; it stays in the file --
+    
+    uint32_t size = ARCONTROLLER_WarmStart_ReadU32 (reader);
+    char *string = (char *)ARCONTROLLER_WarmStart_Read (reader, size);
+    
+    if ((string != NULL) && ((size == 0) || (string[size - 1] != '\0')))
+    {
+        reader->failed = 1;
+        string = NULL;
+    }
+    
+    return string;
+}
+
+static ARCONTROLLER_DICTIONARY_COMMANDS_t *ARCONTROLLER_WarmStart_ReadCommand (ARCONTROLLER_WARMSTART_READER_t *reader, eARCONTROLLER_DICTIONARY_KEY featureKey)
+{
+    // -- Read a command and build its elements --
+    
+    eARCONTROLLER_ERROR error = ARCONTROLLER_OK;
+    ARCONTROLLER_DICTIONARY_COMMANDS_t *dictCmdElement = NULL;
+    ARCONTROLLER_DICTIONARY_ELEMENT_t *newElement = NULL;
+    ARCONTROLLER_DICTIONARY_ARG_t *newArg = NULL;
+    uint32_t commandKey = 0;
+    uint32_t elementCount = 0;
+    uint32_t argCount = 0;
+    uint32_t elementIndex = 0;
+    uint32_t argIndex = 0;
+    char *key = NULL;
+    char *name = NULL;
+    char *string = NULL;
+    uint8_t *value = NULL;
+    int keyLength = 0;
+    
+    commandKey = ARCONTROLLER_WarmStart_ReadU32 (reader);
+    elementCount = ARCONTROLLER_WarmStart_ReadU32 (reader);
+    if ((reader->failed) ||
+        (commandKey >= ARCONTROLLER_DICTIONARY_DICTIONARY_KEY_MAX) ||
+        (ARCONTROLLER_DICTIONARY_Key_GetFeatureFromCommandKey (commandKey) != featureKey) ||
+        (!ARCONTROLLER_WarmStart_IsCachedCommand (commandKey)))
+    {
+        reader->failed = 1;
+        return NULL;
+    }
+    
+    dictCmdElement = ARCONTROLLER_Feature_NewCommandsElement (commandKey, &error);
+    
+    for (elementIndex = 0; (elementIndex < elementCount) && (error == ARCONTROLLER_OK) && (!reader->failed); elementIndex++)
+    {
+        key = ARCONTROLLER_WarmStart_ReadString (reader);
+        argCount = ARCONTROLLER_WarmStart_ReadU32 (reader);
+        if (reader->failed)
+        {
+            break;
+        }
+        
+        newElement = ARCONTROLLER_DictionaryPool_NewElement ();
+        if (newElement == NULL)
+        {
+            error = ARCONTROLLER_ERROR_ALLOC;
+            break;
+        }
+        
+        newElement->key = NULL;
+        newElement->arguments = NULL;
+        keyLength = (int)strlen (key);
+        newElement->key = ARCONTROLLER_DictionaryPool_NewElementKey (newElement, keyLength + 1);
+        if (newElement->key == NULL)
+        {
+            ARCONTROLLER_DictionaryPool_DeleteElement (newElement);
+            error = ARCONTROLLER_ERROR_ALLOC;
+            break;
+        }
+        memcpy (newElement->key, key, keyLength + 1);
+        
+        // The element is added first so that it is released with the command on error
+        HASH_ADD_KEYPTR (hh, dictCmdElement->elements, newElement->key, keyLength, newElement);
+        
+        for (argIndex = 0; (argIndex < argCount) && (!reader->failed); argIndex++)
+        {
+            name = ARCONTROLLER_WarmStart_ReadString (reader);
+            newArg = ARCONTROLLER_DictionaryPool_NewArg ();
+            if (newArg == NULL)
+            {
+                error = ARCONTROLLER_ERROR_ALLOC;
+                break;
+            }
+            
+            newArg->argument = name;
+            newArg->valueType = ARCONTROLLER_WarmStart_ReadU32 (reader);
+            memset (&(newArg->value), 0, sizeof (ARCONTROLLER_DICTIONARY_VALUE_t));
+            if ((reader->failed) || (newArg->valueType >= ARCONTROLLER_DICTIONARY_VALUE_TYPE_MAX))
+            {
+                reader->failed = 1;
+                ARCONTROLLER_DictionaryPool_DeleteArg (newArg);
+                break;
+            }
+            
+            if (newArg->valueType == ARCONTROLLER_DICTIONARY_VALUE_TYPE_STRING)
+            {
+                // String values are owned by the argument
+                string = ARCONTROLLER_WarmStart_ReadString (reader);
+                if (string != NULL)
+                {
+                    newArg->value.String = malloc (strlen (string) + 1);
+                    if (newArg->value.String != NULL)
+                    {
+                        strcpy (newArg->value.String, string);
+                    }
+                    else
+                    {
+                        error = ARCONTROLLER_ERROR_ALLOC;
+                    }
+                }
+            }
+            else
+            {
+                value = ARCONTROLLER_WarmStart_Read (reader, sizeof (ARCONTROLLER_DICTIONARY_VALUE_t));
+                if (value != NULL)
+                {
+                    memcpy (&(newArg->value), value, sizeof (ARCONTROLLER_DICTIONARY_VALUE_t));
+                }
+            }
+            
+            if ((reader->failed) || (error != ARCONTROLLER_OK))
+            {
+                free ((newArg->valueType == ARCONTROLLER_DICTIONARY_VALUE_TYPE_STRING) ? newArg->value.String : NULL);
+                ARCONTROLLER_DictionaryPool_DeleteArg (newArg);
+                break;
+            }
+            
+            HASH_ADD_KEYPTR (hh, newElement->arguments, newArg->argument, strlen (newArg->argument), newArg);
+        }
+    }
+    
+    if ((error != ARCONTROLLER_OK) || (reader->failed))
+    {
+        reader->failed = 1;
+        ARCONTROLLER_Feature_DeleteCommandsElement (&dictCmdElement);
+    }
+    
+    return dictCmdElement;
+}
+
+static int ARCONTROLLER_WarmStart_ReadDictionary (ARCONTROLLER_WARMSTART_READER_t *reader, eARCONTROLLER_DICTIONARY_KEY featureKey, ARCONTROLLER_DICTIONARY_COMMANDS_t **dictionary, ARSAL_Mutex_t *mutex, ARCONTROLLER_Dictionary_t *commandCallbacks)
+{
+    // -- Read the commands of a feature ; restore them if a dictionary is given --
+    
+    ARCONTROLLER_DICTIONARY_COMMANDS_t *dictCmdElement = NULL;
+    ARCONTROLLER_DICTIONARY_COMMANDS_t *existing = NULL;
+    uint32_t commandCount = 0;
+    uint32_t commandIndex = 0;
+    int commandKey = 0;
+    int restoredCount = 0;
+    
+    commandCount = ARCONTROLLER_WarmStart_ReadU32 (reader);
+    
+    for (commandIndex = 0; (commandIndex < commandCount) && (!reader->failed); commandIndex++)
+    {
+        dictCmdElement = ARCONTROLLER_WarmStart_ReadCommand (reader, featureKey);
+        if (dictCmdElement == NULL)
+        {
+            break;
+        }
+        
+        if (dictionary != NULL)
+        {
+            // A command already received on this connection is newer than the cache
+            commandKey = dictCmdElement->command;
+            existing = NULL;
+            
+            ARSAL_Mutex_Lock (mutex);
+            HASH_FIND_INT ((*dictionary), &commandKey, existing);
+            if (existing == NULL)
+            {
+                HASH_ADD_INT ((*dictionary), command, dictCmdElement);
+            }
+            ARSAL_Mutex_Unlock (mutex);
+            
+            if (existing == NULL)
+            {
+                ARCONTROLLER_Dictionary_Notify (commandCallbacks, dictCmdElement->command, dictCmdElement->elements);
+                restoredCount++;
+                dictCmdElement = NULL;
+            }
+        }
+        
+        ARCONTROLLER_Feature_DeleteCommandsElement (&dictCmdElement);
+    }
+    
+    return restoredCount;
+}
+
+static uint8_t *ARCONTROLLER_WarmStart_LoadFile (const char *path, size_t *size)
+{
+    // -- Read a whole file --
+    
+    FILE *file = NULL;
+    uint8_t *data = NULL;
+    long fileSize = -1;
+    
+    file = fopen (path, "rb");
+    if (file == NULL)
+    {
+        return NULL;
+    }
+    
+    if (fseek (file, 0, SEEK_END) == 0)
+    {
+        fileSize = ftell (file);
+    }
+    
+    if ((fileSize > 0) && (fseek (file, 0, SEEK_SET) == 0))
+    {
+        data = malloc (fileSize);
+        if ((data != NULL) && (fread (data, 1, fileSize, file) != (size_t)fileSize))
+        {
+            free (data);
+            data = NULL;
+        }
+    }
+    
+    fclose (file);
+    
+    if (data != NULL)
+    {
+        *size = fileSize;
+    }
+    
+    return data;
+}
+
+static char *ARCONTROLLER_WarmStart_Concat (const char *string, const char *suffix)
+{
+    // -- Allocate the concatenation of two strings --
+    
+    size_t stringLength = strlen (string);
+    size_t suffixLength = strlen (suffix);
+    char *result = malloc (stringLength + suffixLength + 1);
+    
+    if (result != NULL)
+    {
+        memcpy (result, string, stringLength);
+        memcpy (result + stringLength, suffix, suffixLength + 1);
+    }
+    
+    return result;
+}
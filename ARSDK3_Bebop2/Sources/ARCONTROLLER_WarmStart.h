@@ -0,0 +1,121 @@
+/*
+    Copyright (C) 2014 Parrot SA
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions
+    are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the 
+      distribution.
+    * Neither the name of Parrot nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+    "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+    LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+    FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+    COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+    INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+    OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED 
+    AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+    OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+    SUCH DAMAGE.
+*/
+/**
+ * @file ARCONTROLLER_WarmStart.h
+ * @brief Cache of the last connection to a device, used to reach the running state without waiting for the initial settings and states.
+ */
+
+#ifndef _ARCONTROLLER_WARMSTART_PRIVATE_H_
+#define _ARCONTROLLER_WARMSTART_PRIVATE_H_
+
+#include <stdint.h>
+
+#include <libARController/ARCONTROLLER_Error.h>
+#include <libARController/ARCONTROLLER_Feature.h>
+#include <libARController/ARCONTROLLER_Stream.h>
+
+#define ARCONTROLLER_WARMSTART_TAG "ARCONTROLLER_WarmStart"
+#define ARCONTROLLER_WARMSTART_VERSION 2 /**< Version of the cache file format ; a cache of another version is ignored */
+#define ARCONTROLLER_WARMSTART_ADDRESS_SIZE 20 /**< Size of the device address, terminating null included */
+
+/**
+ * @brief Parameters negotiated by the discovery handshake ; a cache is only used if they did not change.
+ */
+typedef struct
+{
+    char address[ARCONTROLLER_WARMSTART_ADDRESS_SIZE]; /**< IP address of the device ; empty if the device is not reached by IP */
+    int productID; /**< Product of the device */
+    int c2dPort; /**< Port on which the device receives the commands */
+    int serverStreamPort; /**< Port from which the device sends the video stream */
+    int serverControlPort; /**< Port from which the device sends the video stream control */
+} ARCONTROLLER_WARMSTART_LINK_t;
+
+/**
+ * @brief Warm start cache.
+ */
+typedef struct ARCONTROLLER_WarmStart_t ARCONTROLLER_WarmStart_t;
+
+/**
+ * @brief Create a warm start cache.
+ * @param cachePath Path of the cache file ; it does not need to exist.
+ * @param[out] error Executing error.
+ * @return The warm start cache ; NULL if an error occurred.
+ * @see ARCONTROLLER_WarmStart_Delete()
+ */
+ARCONTROLLER_WarmStart_t *ARCONTROLLER_WarmStart_New (const char *cachePath, eARCONTROLLER_ERROR *error);
+
+/**
+ * @brief Delete a warm start cache.
+ * @warning The features the cache has been restored into must have been deleted before ; their arguments point into the cache.
+ * @param warmStart The warm start cache.
+ */
+void ARCONTROLLER_WarmStart_Delete (ARCONTROLLER_WarmStart_t **warmStart);
+
+/**
+ * @brief Restore the cache file into the dictionaries of the features.
+ * @note Only the settings and the states identifying the device are cached ; the states describing the flight are always awaited from the device.
+ * @note Only the commands absent from a dictionary are restored ; each of them is notified to the command callbacks of its feature.
+ * @param warmStart The warm start cache.
+ * @param link Parameters negotiated by the discovery handshake of the current connection.
+ * @param common The Common feature ; can be NULL.
+ * @param aRDrone3 The ARDrone3 feature ; can be NULL.
+ * @return ARCONTROLLER_OK if the cache has been restored ; ARCONTROLLER_ERROR_NO_ELEMENT if there is no cache matching the link.
+ */
+eARCONTROLLER_ERROR ARCONTROLLER_WarmStart_Restore (ARCONTROLLER_WarmStart_t *warmStart, const ARCONTROLLER_WARMSTART_LINK_t *link, ARCONTROLLER_FEATURE_Common_t *common, ARCONTROLLER_FEATURE_ARDrone3_t *aRDrone3);
+
+/**
+ * @brief Save the dictionaries of the features and the video parameter sets to the cache file.
+ * @param warmStart The warm start cache.
+ * @param link Parameters negotiated by the discovery handshake of the current connection.
+ * @param common The Common feature ; can be NULL.
+ * @param aRDrone3 The ARDrone3 feature ; can be NULL.
+ * @return Executing error.
+ */
+eARCONTROLLER_ERROR ARCONTROLLER_WarmStart_Save (ARCONTROLLER_WarmStart_t *warmStart, const ARCONTROLLER_WARMSTART_LINK_t *link, ARCONTROLLER_FEATURE_Common_t *common, ARCONTROLLER_FEATURE_ARDrone3_t *aRDrone3);
+
+/**
+ * @brief Keep the H.264 parameter sets of the video stream.
+ * @param warmStart The warm start cache.
+ * @param codec The codec given to the decoder configuration callback.
+ * @return Executing error.
+ */
+eARCONTROLLER_ERROR ARCONTROLLER_WarmStart_SetVideoCodec (ARCONTROLLER_WarmStart_t *warmStart, const ARCONTROLLER_Stream_Codec_t *codec);
+
+/**
+ * @brief Call a decoder configuration callback with the H.264 parameter sets restored from the cache.
+ * @param warmStart The warm start cache.
+ * @param decoderConfigCallback The decoder configuration callback.
+ * @param customData Custom data given to the callback.
+ * @return ARCONTROLLER_OK if the callback has been called ; ARCONTROLLER_ERROR_NO_ELEMENT if no parameter sets are known.
+ */
+eARCONTROLLER_ERROR ARCONTROLLER_WarmStart_ConfigureDecoder (ARCONTROLLER_WarmStart_t *warmStart, ARCONTROLLER_Stream_DecoderConfigCallback_t decoderConfigCallback, void *customData);
+
+#endif /* _ARCONTROLLER_WARMSTART_PRIVATE_H_ */
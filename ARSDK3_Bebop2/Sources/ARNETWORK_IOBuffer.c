@@ -155,7 +155,10 @@ ARNETWORK_IOBuffer_t* ARNETWORK_IOBuffer_New(const ARNETWORK_IOBufferParam_t *pa
             IOBuffer->nbNetwork = 0;
             IOBuffer->waitTimeCount = param->sendingWaitTimeMs;
             IOBuffer->ackWaitTimeCount = param->ackTimeoutMs;
+            ARSAL_Time_GetTime(&(IOBuffer->countersTime));
             IOBuffer->retryCount = 0;
+            IOBuffer->directReadCallback = NULL;
+            IOBuffer->directReadCustomData = NULL;
 
             /** Create the RingBuffer for the information of the data*/
             IOBuffer->dataDescriptorRBuffer = ARNETWORK_RingBuffer_NewWithOverwriting(param->numberOfCell, sizeof(ARNETWORK_DataDescriptor_t), param->isOverwriting);
@@ -396,6 +399,7 @@ eARNETWORK_ERROR ARNETWORK_IOBuffer_Flush(ARNETWORK_IOBuffer_t *IOBuffer)
     IOBuffer->alreadyHadData = 0;
     IOBuffer->waitTimeCount = IOBuffer->sendingWaitTimeMs;
     IOBuffer->ackWaitTimeCount = IOBuffer->ackTimeoutMs;
+    ARSAL_Time_GetTime(&(IOBuffer->countersTime));
     IOBuffer->retryCount = 0;
 
     /** reset semaphore */
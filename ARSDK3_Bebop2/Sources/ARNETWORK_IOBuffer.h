@@ -43,6 +43,8 @@
 #include <libARNetwork/ARNETWORK_IOBufferParam.h>
 #include <libARSAL/ARSAL_Mutex.h>
 #include <libARSAL/ARSAL_Sem.h>
+#include <libARSAL/ARSAL_Time.h>
+#include <libARNetwork/ARNETWORK_Manager.h>
 
 /*****************************************
  *
@@ -72,6 +74,7 @@ typedef struct
     uint32_t nbNetwork; /**< Total number of packets sent/received, including misses (based on sequence numbers) */
     int waitTimeCount; /**< Counter of time to wait before the next sending*/
     int ackWaitTimeCount; /**< Counter of time to wait before to consider a timeout without receiving an acknowledgement*/
+    struct timespec countersTime; /**< Date from which waitTimeCount and ackWaitTimeCount count down ; the sender only applies the elapsed time when it processes the buffer */
     int retryCount; /**< Counter of sending retry remaining before to consider a failure*/
 
     ARSAL_Mutex_t mutex;  /**< Mutex to take before to use the IOBuffer.
@@ -80,6 +83,8 @@ typedef struct
                            *   @see ARNETWORK_IOBuffer_Unlock()
                            */
     ARSAL_Sem_t outputSem; /**< Semaphore used, by the outputs, to know when a data is ready to be read */
+    ARNETWORK_Manager_DirectReadCallback_t directReadCallback; /**< Callback receiving the data in place of the copy in the output buffer ; NULL to copy. Protected by the mutex */
+    void *directReadCustomData; /**< Custom data of directReadCallback */
 
 }ARNETWORK_IOBuffer_t;
 
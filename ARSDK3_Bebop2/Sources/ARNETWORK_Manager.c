@@ -523,7 +523,7 @@ eARNETWORK_ERROR ARNETWORK_Manager_SendData (ARNETWORK_Manager_t *manager, int i
         if ((inputBuffer->dataType == ARNETWORKAL_FRAME_TYPE_DATA_LOW_LATENCY) ||
             (bufferWasEmpty > 0))
         {
-            ARNETWORK_Sender_SignalNewData (manager->sender);
+            ARNETWORK_Sender_SignalNewData (manager->sender, inputBuffer->ID);
         }
     }
 
@@ -1004,6 +1004,48 @@ eARNETWORK_ERROR ARNETWORK_Manager_FlushOutputBuffer (ARNETWORK_Manager_t *manag
     return error;
 }
 
+eARNETWORK_ERROR ARNETWORK_Manager_SetDirectReadCallback (ARNETWORK_Manager_t *manager, int outBufferID, ARNETWORK_Manager_DirectReadCallback_t callback, void *customData)
+{
+    /** -- Deliver the data of an output buffer from the receiver thread -- */
+
+    /** local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+    ARNETWORK_IOBuffer_t *outputBuffer = NULL;
+
+    /** check paratemters */
+    if (manager != NULL)
+    {
+        outputBuffer = manager->outputBufferMap[outBufferID];
+
+        /** check pOutputBuffer */
+        if (outputBuffer == NULL)
+        {
+            error = ARNETWORK_ERROR_ID_UNKNOWN;
+        }
+    }
+    else
+    {
+        error = ARNETWORK_ERROR_BAD_PARAMETER;
+    }
+
+    if (error == ARNETWORK_OK)
+    {
+        /** lock the IOBuffer */
+        error = ARNETWORK_IOBuffer_Lock (outputBuffer);
+    }
+
+    if (error == ARNETWORK_OK)
+    {
+        outputBuffer->directReadCallback = callback;
+        outputBuffer->directReadCustomData = customData;
+
+        /** unlock the IOBuffer */
+        ARNETWORK_IOBuffer_Unlock (outputBuffer);
+    }
+
+    return error;
+}
+
 int ARNETWORK_Manager_GetEstimatedLatency (ARNETWORK_Manager_t *manager)
 {
     int result = -1;
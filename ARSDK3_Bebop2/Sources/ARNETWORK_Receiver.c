@@ -184,6 +184,8 @@ void* ARNETWORK_Receiver_ThreadRun (void *data)
     eARNETWORKAL_MANAGER_RETURN result = ARNETWORKAL_MANAGER_RETURN_DEFAULT;
     uint8_t ackSeqNumData = 0;
     struct timespec now;
+    ARNETWORK_Manager_DirectReadCallback_t directRead = NULL;
+    void *directReadCustomData = NULL;
 
     while (receiverPtr->isAlive)
     {
@@ -258,9 +260,12 @@ void* ARNETWORK_Receiver_ThreadRun (void *data)
                         if(error == ARNETWORK_OK)
                         {
                             int accept = ARNETWORK_IOBuffer_ShouldAcceptData (outBufferPtrTemp, frame.seq);
+                            directRead = NULL;
                             if (accept > 0)
                             {
                                 error = ARNETWORK_Receiver_CopyDataRecv(receiverPtr, outBufferPtrTemp, &frame);
+                                directRead = outBufferPtrTemp->directReadCallback;
+                                directReadCustomData = outBufferPtrTemp->directReadCustomData;
                             }
                             else if (accept == 0)
                             {
@@ -274,6 +279,12 @@ void* ARNETWORK_Receiver_ThreadRun (void *data)
                             /** unlock the IOBuffer */
                             ARNETWORK_IOBuffer_Unlock(outBufferPtrTemp);
 
+                            /** deliver the data in place, out of the lock */
+                            if ((error == ARNETWORK_OK) && (directRead != NULL))
+                            {
+                                directRead (frame.id, frame.dataPtr, frame.size - offsetof (ARNETWORKAL_Frame_t, dataPtr), directReadCustomData);
+                            }
+
                             if(error != ARNETWORK_OK)
                             {
                                 ARSAL_PRINT (ARSAL_PRINT_ERROR, ARNETWORK_RECEIVER_TAG, "[%p] data received, error: %s", receiverPtr, ARNETWORK_Error_ToString (error));
@@ -295,9 +306,12 @@ void* ARNETWORK_Receiver_ThreadRun (void *data)
                         if(error == ARNETWORK_OK)
                         {
                             int accept = ARNETWORK_IOBuffer_ShouldAcceptData (outBufferPtrTemp, frame.seq);
+                            directRead = NULL;
                             if (accept > 0)
                             {
                                 error = ARNETWORK_Receiver_CopyDataRecv(receiverPtr, outBufferPtrTemp, &frame);
+                                directRead = outBufferPtrTemp->directReadCallback;
+                                directReadCustomData = outBufferPtrTemp->directReadCustomData;
                             }
                             else if (accept == 0)
                             {
@@ -311,6 +325,12 @@ void* ARNETWORK_Receiver_ThreadRun (void *data)
                             /** unlock the IOBuffer */
                             ARNETWORK_IOBuffer_Unlock(outBufferPtrTemp);
 
+                            /** deliver the data in place, out of the lock */
+                            if ((error == ARNETWORK_OK) && (directRead != NULL))
+                            {
+                                directRead (frame.id, frame.dataPtr, frame.size - offsetof (ARNETWORKAL_Frame_t, dataPtr), directReadCustomData);
+                            }
+
                             if(error != ARNETWORK_OK)
                             {
                                 ARSAL_PRINT (ARSAL_PRINT_ERROR, ARNETWORK_RECEIVER_TAG, "[%p] data received, error: %s", receiverPtr, ARNETWORK_Error_ToString (error));
@@ -335,9 +355,12 @@ void* ARNETWORK_Receiver_ThreadRun (void *data)
                         {
                             /** OutBuffer->seqWaitAck used to save the last seq */
                             int accept = ARNETWORK_IOBuffer_ShouldAcceptData (outBufferPtrTemp, frame.seq);
+                            directRead = NULL;
                             if (accept > 0)
                             {
                                 error = ARNETWORK_Receiver_CopyDataRecv(receiverPtr, outBufferPtrTemp, &frame);
+                                directRead = outBufferPtrTemp->directReadCallback;
+                                directReadCustomData = outBufferPtrTemp->directReadCustomData;
                             }
                             else if (accept == 0)
                             {
@@ -351,6 +374,12 @@ void* ARNETWORK_Receiver_ThreadRun (void *data)
                             /** unlock the IOBuffer */
                             ARNETWORK_IOBuffer_Unlock(outBufferPtrTemp);
 
+                            /** deliver the data in place, out of the lock */
+                            if ((error == ARNETWORK_OK) && (directRead != NULL))
+                            {
+                                directRead (frame.id, frame.dataPtr, frame.size - offsetof (ARNETWORKAL_Frame_t, dataPtr), directReadCustomData);
+                            }
+
                             // data are copied to the IOBuffer, send ACK
                             if (error == ARNETWORK_OK)
                             {
@@ -403,14 +432,14 @@ eARNETWORK_ERROR ARNETWORK_Receiver_ReturnACK (ARNETWORK_Receiver_t *receiverPtr
 
     if (ACKIOBufferPtr != NULL)
     {
-        int isEmpty = ARNETWORK_RingBuffer_IsEmpty(ACKIOBufferPtr->dataDescriptorRBuffer);
 		error = ARNETWORK_IOBuffer_Lock(ACKIOBufferPtr);
         error = ARNETWORK_IOBuffer_AddData (ACKIOBufferPtr, (uint8_t*) &seq, sizeof(seq), NULL, NULL, 1);
 		ACKIOBufferPtr->waitTimeCount = 0;
 		ARNETWORK_IOBuffer_Unlock(ACKIOBufferPtr);
-        if (error == ARNETWORK_OK && isEmpty > 0)
+        /* the ack is due now, even if the buffer was not empty */
+        if (error == ARNETWORK_OK)
         {
-            ARNETWORK_Sender_SignalNewData (receiverPtr->senderPtr);
+            ARNETWORK_Sender_SignalNewData (receiverPtr->senderPtr, ACKIOBufferPtr->ID);
         }
     }
 
@@ -492,8 +521,13 @@ eARNETWORK_ERROR ARNETWORK_Receiver_CopyDataRecv (ARNETWORK_Receiver_t *receiver
     /** get the data size*/
     dataSize = framePtr->size - offsetof (ARNETWORKAL_Frame_t, dataPtr);
 
+    /** if the data is delivered in place by the receiver thread, nothing to copy */
+    if (outputBufferPtr->directReadCallback != NULL)
+    {
+        error = ARNETWORK_OK;
+    }
     /** if the output buffer can copy the data */
-    if (ARNETWORK_IOBuffer_CanCopyData (outputBufferPtr))
+    else if (ARNETWORK_IOBuffer_CanCopyData (outputBufferPtr))
     {
         /** copy the data in the IOBuffer */
         error = ARNETWORK_IOBuffer_AddData (outputBufferPtr, framePtr->dataPtr, dataSize, NULL, NULL, 1);
@@ -510,12 +544,16 @@ eARNETWORK_ERROR ARNETWORK_Receiver_CopyDataRecv (ARNETWORK_Receiver_t *receiver
         outputBufferPtr->nbPackets++;
         outputBufferPtr->nbNetwork += nbNew;
         outputBufferPtr->seq = framePtr->seq;
-        /** post a semaphore to indicate data ready to be read */
-        semError = ARSAL_Sem_Post (&(outputBufferPtr->outputSem));
 
-        if (semError)
+        if (outputBufferPtr->directReadCallback == NULL)
         {
-            error = ARNETWORK_ERROR_SEMAPHORE;
+            /** post a semaphore to indicate data ready to be read */
+            semError = ARSAL_Sem_Post (&(outputBufferPtr->outputSem));
+
+            if (semError)
+            {
+                error = ARNETWORK_ERROR_SEMAPHORE;
+            }
         }
 
 #ifdef ENABLE_MONITOR_INCOMING_DATA
@@ -66,17 +66,15 @@
  *
  ******************************************/
 
-/* Normalize indices if they are both larger than the entire buffer size
- * so that they do not overflow. */
-static inline void ARNETWORK_RingBuffer_NormalizeIndexes(ARNETWORK_RingBuffer_t *ringBuffer)
+/**
+ * @brief Return the address of a cell
+ * @param ringBuffer the ring buffer
+ * @param index index of the cell, not masked
+ * @return address of the cell in the data buffer
+**/
+static inline uint8_t *ARNETWORK_RingBuffer_GetCell(const ARNETWORK_RingBuffer_t *ringBuffer, unsigned int index)
 {
-    size_t buffer_size = ringBuffer->cellSize * ringBuffer->numberOfCell;
-    if (ringBuffer->indexInput >= buffer_size && ringBuffer->indexOutput >= buffer_size)
-    {
-        ringBuffer->indexInput %= buffer_size;
-        ringBuffer->indexOutput %= buffer_size;
-    }
-    /* No else: the Indexes are already normalized. */
+    return ringBuffer->dataBuffer + ((index & ringBuffer->cellIndexMask) * ringBuffer->cellSize);
 }
 
 /**
@@ -86,7 +84,8 @@ static inline void ARNETWORK_RingBuffer_NormalizeIndexes(ARNETWORK_RingBuffer_t
 **/
 static inline int ARNETWORK_RingBuffer_GetFreeCellNumberUnlocked(const ARNETWORK_RingBuffer_t *ringBuffer)
 {
-    return ringBuffer->numberOfCell - ( (ringBuffer->indexInput - ringBuffer->indexOutput) / ringBuffer->cellSize );
+    /* the indexes are free-running: their difference stays right when they wrap */
+    return ringBuffer->numberOfCell - (ringBuffer->indexInput - ringBuffer->indexOutput);
 }
 
 /**
@@ -117,16 +116,24 @@ ARNETWORK_RingBuffer_t* ARNETWORK_RingBuffer_NewWithOverwriting(unsigned int num
 
     /* local declarations */
     ARNETWORK_RingBuffer_t* ringBuffer =  malloc( sizeof(ARNETWORK_RingBuffer_t) );
+    unsigned int numberOfAllocatedCell = 1;
 
     if(ringBuffer)
     {
+        /* round the allocation up to a power of two */
+        while (numberOfAllocatedCell < numberOfCell)
+        {
+            numberOfAllocatedCell <<= 1;
+        }
+
         ringBuffer->numberOfCell = numberOfCell;
         ringBuffer->cellSize = cellSize;
+        ringBuffer->cellIndexMask = numberOfAllocatedCell - 1;
         ringBuffer->indexInput = 0;
         ringBuffer->indexOutput = 0;
         ringBuffer->isOverwriting = isOverwriting;
         ARSAL_Mutex_Init( &(ringBuffer->mutex) );
-        ringBuffer->dataBuffer = malloc( cellSize * numberOfCell );
+        ringBuffer->dataBuffer = malloc( cellSize * numberOfAllocatedCell );
 
         if( ringBuffer->dataBuffer == NULL)
         {
@@ -174,19 +181,22 @@ eARNETWORK_ERROR ARNETWORK_RingBuffer_PushBackWithSize(ARNETWORK_RingBuffer_t *r
     /* local declarations */
     int error = ARNETWORK_OK;
     uint8_t* buffer = NULL;
+    int numberOfFreeCell = 0;
 
     ARSAL_Mutex_Lock(&(ringBuffer->mutex));
 
+    numberOfFreeCell = ARNETWORK_RingBuffer_GetFreeCellNumberUnlocked(ringBuffer);
+
     /* check if the has enough free cell or the buffer is overwriting */
-    if ((ARNETWORK_RingBuffer_GetFreeCellNumberUnlocked(ringBuffer)) || (ringBuffer->isOverwriting))
+    if ((numberOfFreeCell) || (ringBuffer->isOverwriting))
     {
-        if (!ARNETWORK_RingBuffer_GetFreeCellNumberUnlocked(ringBuffer))
+        if (!numberOfFreeCell)
         {
-            (ringBuffer->indexOutput) += ringBuffer->cellSize;
+            (ringBuffer->indexOutput)++;
         }
         /* No else: the ringBuffer is not full */
 
-        buffer = ringBuffer->dataBuffer + ( ringBuffer->indexInput % (ringBuffer->numberOfCell * ringBuffer->cellSize) );
+        buffer = ARNETWORK_RingBuffer_GetCell(ringBuffer, ringBuffer->indexInput);
 
         memcpy(buffer, newData, dataSize);
 
@@ -197,8 +207,7 @@ eARNETWORK_ERROR ARNETWORK_RingBuffer_PushBackWithSize(ARNETWORK_RingBuffer_t *r
         }
         /* No else: data are not returned */
 
-        ringBuffer->indexInput += ringBuffer->cellSize;
-        ARNETWORK_RingBuffer_NormalizeIndexes(ringBuffer);
+        (ringBuffer->indexInput)++;
     }
     else
     {
@@ -232,12 +241,11 @@ eARNETWORK_ERROR ARNETWORK_RingBuffer_PopFrontWithSize(ARNETWORK_RingBuffer_t *r
         if(dataPop != NULL)
         {
             /* get the address of the front data */
-            buffer = ringBuffer->dataBuffer + (ringBuffer->indexOutput % (ringBuffer->numberOfCell * ringBuffer->cellSize));
+            buffer = ARNETWORK_RingBuffer_GetCell(ringBuffer, ringBuffer->indexOutput);
             memcpy(dataPop, buffer, dataSize);
         }
         /* No else: the data popped is not returned  */
-        (ringBuffer->indexOutput) += ringBuffer->cellSize;
-        ARNETWORK_RingBuffer_NormalizeIndexes(ringBuffer);
+        (ringBuffer->indexOutput)++;
     }
     else
     {
@@ -260,7 +268,7 @@ eARNETWORK_ERROR ARNETWORK_RingBuffer_Front(ARNETWORK_RingBuffer_t *ringBuffer,
     ARSAL_Mutex_Lock(&(ringBuffer->mutex));
 
     /* get the address of the front data */
-    buffer = ringBuffer->dataBuffer + (ringBuffer->indexOutput % (ringBuffer->numberOfCell * ringBuffer->cellSize));
+    buffer = ARNETWORK_RingBuffer_GetCell(ringBuffer, ringBuffer->indexOutput);
 
     if( !ARNETWORK_RingBuffer_IsEmptyUnlocked(ringBuffer) )
     {
@@ -307,9 +315,9 @@ void ARNETWORK_RingBuffer_DataPrint(ARNETWORK_RingBuffer_t *ringBuffer)
     ARSAL_Mutex_Lock(&(ringBuffer->mutex));
 
     /* for all cell of the ringBuffer */
-    for (cellIndex = ringBuffer->indexOutput ; cellIndex < ringBuffer->indexInput ; cellIndex += ringBuffer->cellSize )
+    for (cellIndex = ringBuffer->indexOutput ; cellIndex != ringBuffer->indexInput ; ++cellIndex )
     {
-        byteIterator = ringBuffer->dataBuffer + (cellIndex % (ringBuffer->numberOfCell * ringBuffer->cellSize) );
+        byteIterator = ARNETWORK_RingBuffer_GetCell(ringBuffer, cellIndex);
 
         ARSAL_PRINT(ARSAL_PRINT_WARNING, ARNETWORK_RINGBUFFER_TAG,"    - 0x: ");
 
@@ -331,7 +339,7 @@ int ARNETWORK_RingBuffer_GetFreeCellNumber(ARNETWORK_RingBuffer_t *ringBuffer)
     
     ARSAL_Mutex_Lock(&(ringBuffer->mutex));
     
-    numberOfFreeCell = ringBuffer->numberOfCell - ( (ringBuffer->indexInput - ringBuffer->indexOutput) / ringBuffer->cellSize );
+    numberOfFreeCell = ARNETWORK_RingBuffer_GetFreeCellNumberUnlocked(ringBuffer);
     
     ARSAL_Mutex_Unlock(&(ringBuffer->mutex));
     
@@ -345,7 +353,7 @@ int ARNETWORK_RingBuffer_IsEmpty(ARNETWORK_RingBuffer_t *ringBuffer)
     
     ARSAL_Mutex_Lock(&(ringBuffer->mutex));
     
-    isEmpty = (ringBuffer->indexInput == ringBuffer->indexOutput) ? 1 : 0;
+    isEmpty = ARNETWORK_RingBuffer_IsEmptyUnlocked(ringBuffer);
     
     ARSAL_Mutex_Unlock(&(ringBuffer->mutex));
     
@@ -52,9 +52,10 @@ typedef struct
     unsigned int numberOfCell; /**< Maximum number of data stored*/
     unsigned int cellSize; /**< Size of one data in byte*/
     unsigned int isOverwriting; /**< Indicator of overwriting possibility (1 = true | 0 = false)*/
+    unsigned int cellIndexMask; /**< Number of cells allocated minus one ; the allocation is rounded up to a power of two so that the indexes are masked instead of computing a modulo*/
     
-    unsigned int indexInput; /**< Index of the data input*/
-    unsigned int indexOutput; /**< Index of the data output*/
+    unsigned int indexInput; /**< Number of cells pushed*/
+    unsigned int indexOutput; /**< Number of cells popped*/
     
     ARSAL_Mutex_t mutex; /**< Mutex to take before to use the ringBuffer*/
 
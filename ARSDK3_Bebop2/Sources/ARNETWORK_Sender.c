@@ -70,6 +70,7 @@
 
 #define ARNETWORK_SENDER_TAG "ARNETWORK_Sender"
 #define ARNETWORK_SENDER_MILLISECOND 1
+#define ARNETWORK_SENDER_TIME_TO_MS(time) (((int64_t)(time)->tv_sec * 1000) + ((time)->tv_nsec / 1000000))
 
 /*****************************************
  *
@@ -112,6 +113,51 @@ void ARNETWORK_Sender_ManageTimeOut (ARNETWORK_Sender_t *senderPtr, ARNETWORK_IO
 
 void ARNETWORK_Sender_ManageIOBufferIsInRemovingStatus(ARNETWORK_IOBuffer_t *inputBufferPtr, eARNETWORK_MANAGER_CALLBACK_STATUS callbackStatus);
 
+/**
+ * @brief compute the deadline of a buffer from its state and update it in the deadline heap
+ * @param senderPtr the pointer on the Sender
+ * @param inputBufferPtr Pointer on the input buffer
+ * @note only call by ARNETWORK_Sender_ThreadRun()
+ */
+void ARNETWORK_Sender_ScheduleBuffer (ARNETWORK_Sender_t *senderPtr, ARNETWORK_IOBuffer_t *inputBufferPtr);
+
+/**
+ * @brief schedule the buffers signaled by ARNETWORK_Sender_SignalNewData()
+ * @param senderPtr the pointer on the Sender
+ * @note only call by ARNETWORK_Sender_ThreadRun()
+ */
+void ARNETWORK_Sender_SchedulePendingBuffers (ARNETWORK_Sender_t *senderPtr);
+
+/**
+ * @brief get the date of the next ping
+ * @param senderPtr the pointer on the Sender
+ * @param[out] deadlineMs date, in ms, at which the next ping must be sent
+ * @return 1 if a ping is scheduled, 0 if the pings are disabled
+ */
+int ARNETWORK_Sender_GetPingDeadline (ARNETWORK_Sender_t *senderPtr, int64_t *deadlineMs);
+
+/**
+ * @brief add or move the deadline of a buffer in the heap
+ * @param senderPtr the pointer on the Sender
+ * @param bufferId identifier of the buffer
+ * @param timeMs date, in ms, of the deadline
+ */
+void ARNETWORK_Sender_SetDeadline (ARNETWORK_Sender_t *senderPtr, int bufferId, int64_t timeMs);
+
+/**
+ * @brief remove the deadline of a buffer from the heap ; nothing is done if the buffer has no deadline
+ * @param senderPtr the pointer on the Sender
+ * @param bufferId identifier of the buffer
+ */
+void ARNETWORK_Sender_RemoveDeadline (ARNETWORK_Sender_t *senderPtr, int bufferId);
+
+/**
+ * @brief restore the heap order around a moved deadline
+ * @param senderPtr the pointer on the Sender
+ * @param position position of the moved deadline in the heap
+ */
+void ARNETWORK_Sender_SiftDeadline (ARNETWORK_Sender_t *senderPtr, int position);
+
 /*****************************************
  *
  *             implementation :
@@ -181,6 +227,43 @@ ARNETWORK_Sender_t* ARNETWORK_Sender_New (ARNETWORKAL_Manager_t *networkALManage
             error = ARNETWORK_ERROR_NEW_BUFFER;
         }
 
+        /* Create the deadline heap and the pending list, indexed by buffer identifier */
+        senderPtr->pendingBufferIds = NULL;
+        senderPtr->isBufferPending = NULL;
+        senderPtr->pendingBufferCount = 0;
+        senderPtr->deadlineHeap = NULL;
+        senderPtr->deadlinePositions = NULL;
+        senderPtr->deadlineCount = 0;
+        senderPtr->dueBufferIds = NULL;
+
+        if (error == ARNETWORK_OK)
+        {
+            int maxIds = networkALManager->maxIds;
+            int bufferId = 0;
+
+            senderPtr->pendingBufferIds = malloc (maxIds * sizeof (int));
+            senderPtr->isBufferPending = calloc (maxIds, sizeof (uint8_t));
+            senderPtr->deadlineHeap = malloc (maxIds * sizeof (ARNETWORK_Sender_Deadline_t));
+            senderPtr->deadlinePositions = malloc (maxIds * sizeof (int));
+            senderPtr->dueBufferIds = malloc (maxIds * sizeof (int));
+
+            if ((senderPtr->pendingBufferIds == NULL) ||
+                (senderPtr->isBufferPending == NULL) ||
+                (senderPtr->deadlineHeap == NULL) ||
+                (senderPtr->deadlinePositions == NULL) ||
+                (senderPtr->dueBufferIds == NULL))
+            {
+                error = ARNETWORK_ERROR_ALLOC;
+            }
+            else
+            {
+                for (bufferId = 0; bufferId < maxIds; bufferId++)
+                {
+                    senderPtr->deadlinePositions[bufferId] = -1;
+                }
+            }
+        }
+
         /** delete the sender if an error occurred */
         if (error != ARNETWORK_OK)
         {
@@ -209,6 +292,12 @@ void ARNETWORK_Sender_Delete (ARNETWORK_Sender_t **senderPtrAddr)
             ARSAL_Mutex_Destroy (&(senderPtr->nextSendMutex));
             ARSAL_Mutex_Destroy (&(senderPtr->pingMutex));
 
+            free (senderPtr->pendingBufferIds);
+            free (senderPtr->isBufferPending);
+            free (senderPtr->deadlineHeap);
+            free (senderPtr->deadlinePositions);
+            free (senderPtr->dueBufferIds);
+
             free (senderPtr);
             senderPtr = NULL;
         }
@@ -224,67 +313,42 @@ void* ARNETWORK_Sender_ThreadRun (void* data)
     ARNETWORK_Sender_t *senderPtr = data;
     int inputBufferIndex = 0;
     ARNETWORK_IOBuffer_t *inputBufferPtrTemp = NULL; /**< pointer of the input buffer in processing */
-    eARNETWORK_ERROR error = ARNETWORK_OK;
     int waitTimeMs = 0;
     struct timespec now;
-    struct timespec sleepStart;
-    int sleepDurationMs = 0;
+    int64_t nowMs = 0;
+    int64_t nextDeadlineMs = 0;
+    int64_t pingDeadlineMs = 0;
+    int dueBufferCount = 0;
     int timeDiffMs;
 
+    /** schedule all the buffers once, the later changes are signaled through ARNETWORK_Sender_SignalNewData() */
+    for (inputBufferIndex = 0; inputBufferIndex < senderPtr->networkALManager->maxIds ; inputBufferIndex++)
+    {
+        inputBufferPtrTemp = senderPtr->inputBufferPtrMap[inputBufferIndex];
+        if (inputBufferPtrTemp != NULL)
+        {
+            ARNETWORK_Sender_ScheduleBuffer (senderPtr, inputBufferPtrTemp);
+        }
+    }
+
     while (senderPtr->isAlive)
     {
-        waitTimeMs = 100;
-        for (inputBufferIndex = 0; inputBufferIndex < senderPtr->numberOfInputBuff && waitTimeMs > 0; ++inputBufferIndex)
+        /** sleep until the earliest deadline of the buffers or of the ping */
+        ARSAL_Time_GetTime(&now);
+        nowMs = ARNETWORK_SENDER_TIME_TO_MS(&now);
+        nextDeadlineMs = nowMs + ARNETWORK_SENDER_MAXIMUM_WAIT_TIME_MS;
+        if ((senderPtr->deadlineCount > 0) &&
+            (senderPtr->deadlineHeap[0].timeMs < nextDeadlineMs))
         {
-            inputBufferPtrTemp = senderPtr->inputBufferPtrArr[inputBufferIndex];
-            error = ARNETWORK_IOBuffer_Lock(inputBufferPtrTemp);
-            switch (inputBufferPtrTemp->dataType)
-            {
-                // Low latency : no wait if any data available
-            case ARNETWORKAL_FRAME_TYPE_DATA_LOW_LATENCY:
-                if ((error == ARNETWORK_OK) &&
-                    (!ARNETWORK_RingBuffer_IsEmpty (inputBufferPtrTemp->dataDescriptorRBuffer)))
-                {
-                    waitTimeMs = 0;
-                }
-                break;
-                // Acknowledged buffer :
-                //  - If waiting an ack, wait time = time before ack timeout
-                //  - If not waiting an ack and not empty, wait time = time before next send
-            case ARNETWORKAL_FRAME_TYPE_DATA_WITH_ACK:
-                if (error == ARNETWORK_OK)
-                {
-                    if (ARNETWORK_IOBuffer_IsWaitAck(inputBufferPtrTemp))
-                    {
-                        if (inputBufferPtrTemp->ackWaitTimeCount < waitTimeMs)
-                        {
-                            waitTimeMs = inputBufferPtrTemp->ackWaitTimeCount;
-                        }
-                    }
-                    else if (!ARNETWORK_RingBuffer_IsEmpty (inputBufferPtrTemp->dataDescriptorRBuffer))
-                    {
-                        if (inputBufferPtrTemp->waitTimeCount < waitTimeMs)
-                        {
-                            waitTimeMs = inputBufferPtrTemp->waitTimeCount;
-                        }
-                    }
-                }
-                break;
-                // All non Ack buffers
-                //  - 
-            default:
-                if ((error == ARNETWORK_OK) &&
-                    (!ARNETWORK_RingBuffer_IsEmpty (inputBufferPtrTemp->dataDescriptorRBuffer)))
-                {
-                    if (inputBufferPtrTemp->waitTimeCount < waitTimeMs)
-                    {
-                        waitTimeMs = inputBufferPtrTemp->waitTimeCount;
-                    }
-                }
-                break;
-            }
-            ARNETWORK_IOBuffer_Unlock(inputBufferPtrTemp);
+            nextDeadlineMs = senderPtr->deadlineHeap[0].timeMs;
         }
+        if ((ARNETWORK_Sender_GetPingDeadline (senderPtr, &pingDeadlineMs)) &&
+            (pingDeadlineMs < nextDeadlineMs))
+        {
+            nextDeadlineMs = pingDeadlineMs;
+        }
+        waitTimeMs = (nextDeadlineMs > nowMs) ? (int)(nextDeadlineMs - nowMs) : 0;
+
         // Force a minimum wait time after an ARNetworkAL Overflow
         if ((senderPtr->hadARNetworkALOverflowOnPreviousRun > 0) &&
             (waitTimeMs < ARNETWORK_SENDER_WAIT_TIME_ON_ARNETWORKAL_OVERFLOW_MS))
@@ -293,7 +357,6 @@ void* ARNETWORK_Sender_ThreadRun (void* data)
         }
         senderPtr->hadARNetworkALOverflowOnPreviousRun = 0;
 
-        ARSAL_Time_GetTime(&sleepStart);
         if (waitTimeMs > 0)
         {
             if (waitTimeMs < senderPtr->minimumTimeBetweenSendsMs)
@@ -301,15 +364,19 @@ void* ARNETWORK_Sender_ThreadRun (void* data)
                 waitTimeMs = senderPtr->minimumTimeBetweenSendsMs;
             }
             ARSAL_Mutex_Lock (&(senderPtr->nextSendMutex));
-            ARSAL_Cond_Timedwait (&(senderPtr->nextSendCond), &(senderPtr->nextSendMutex), waitTimeMs);
+            /* a buffer signaled before the lock must not be missed */
+            if ((senderPtr->pendingBufferCount == 0) && (senderPtr->isAlive))
+            {
+                ARSAL_Cond_Timedwait (&(senderPtr->nextSendCond), &(senderPtr->nextSendMutex), waitTimeMs);
+            }
             ARSAL_Mutex_Unlock (&(senderPtr->nextSendMutex));
         }
 
         /** Process internal input buffers */
         ARSAL_Time_GetTime(&now);
-        sleepDurationMs = ARSAL_Time_ComputeTimespecMsTimeDiff (&sleepStart, &now);
+        nowMs = ARNETWORK_SENDER_TIME_TO_MS(&now);
         ARSAL_Mutex_Lock (&(senderPtr->pingMutex));
-        timeDiffMs = ARSAL_Time_ComputeTimespecMsTimeDiff (&(senderPtr->pingStartTime), &now);
+        timeDiffMs = (int)(nowMs - ARNETWORK_SENDER_TIME_TO_MS(&(senderPtr->pingStartTime)));
         /* Send only new pings if ping function is active (min time > 0) */
         if (senderPtr->minTimeBetweenPings > 0)
         {
@@ -335,6 +402,7 @@ void* ARNETWORK_Sender_ThreadRun (void* data)
                 ARNETWORK_IOBuffer_Lock (inputBufferPtrTemp);
                 ARNETWORK_IOBuffer_AddData (inputBufferPtrTemp, (uint8_t *)&now, sizeof (now), NULL, NULL, 1);
                 ARNETWORK_IOBuffer_Unlock (inputBufferPtrTemp);
+                ARNETWORK_Sender_ScheduleBuffer (senderPtr, inputBufferPtrTemp);
                 senderPtr->pingStartTime.tv_sec = now.tv_sec;
                 senderPtr->pingStartTime.tv_nsec = now.tv_nsec;
                 senderPtr->isPingRunning = 1;
@@ -343,13 +411,23 @@ void* ARNETWORK_Sender_ThreadRun (void* data)
 
         ARSAL_Mutex_Unlock (&(senderPtr->pingMutex));
 
-        for (inputBufferIndex = 0; inputBufferIndex < senderPtr->networkALManager->maxIds ; inputBufferIndex++)
+        ARNETWORK_Sender_SchedulePendingBuffers (senderPtr);
+
+        /** take the due buffers out of the heap first, so that each one is processed once per run */
+        dueBufferCount = 0;
+        while ((senderPtr->deadlineCount > 0) &&
+               (senderPtr->deadlineHeap[0].timeMs <= nowMs))
         {
-            inputBufferPtrTemp = senderPtr->inputBufferPtrMap[inputBufferIndex];
-            if (inputBufferPtrTemp != NULL)
-            {
-                ARNETWORK_Sender_ProcessBufferToSend (senderPtr, inputBufferPtrTemp, (waitTimeMs > 0) ? sleepDurationMs : 0);
-            }
+            senderPtr->dueBufferIds[dueBufferCount] = senderPtr->deadlineHeap[0].bufferId;
+            ARNETWORK_Sender_RemoveDeadline (senderPtr, senderPtr->dueBufferIds[dueBufferCount]);
+            dueBufferCount++;
+        }
+
+        for (inputBufferIndex = 0; inputBufferIndex < dueBufferCount; inputBufferIndex++)
+        {
+            inputBufferPtrTemp = senderPtr->inputBufferPtrMap[senderPtr->dueBufferIds[inputBufferIndex]];
+            ARNETWORK_Sender_ProcessBufferToSend (senderPtr, inputBufferPtrTemp, &now);
+            ARNETWORK_Sender_ScheduleBuffer (senderPtr, inputBufferPtrTemp);
         }
 
         senderPtr->networkALManager->send(senderPtr->networkALManager);
@@ -358,15 +436,20 @@ void* ARNETWORK_Sender_ThreadRun (void* data)
     return NULL;
 }
 
-void ARNETWORK_Sender_ProcessBufferToSend (ARNETWORK_Sender_t *senderPtr, ARNETWORK_IOBuffer_t *buffer, int hasWaitedMs)
+void ARNETWORK_Sender_ProcessBufferToSend (ARNETWORK_Sender_t *senderPtr, ARNETWORK_IOBuffer_t *buffer, const struct timespec *now)
 {
     eARNETWORK_MANAGER_CALLBACK_RETURN callbackReturn = ARNETWORK_MANAGER_CALLBACK_RETURN_DEFAULT;
     eARNETWORK_ERROR error = ARNETWORK_OK;
+    int hasWaitedMs = 0;
     /** lock the IOBuffer */
     error = ARNETWORK_IOBuffer_Lock(buffer);
 
     if(error == ARNETWORK_OK)
     {
+        /** the counters run from countersTime, only apply the elapsed time now */
+        hasWaitedMs = (int)(ARNETWORK_SENDER_TIME_TO_MS(now) - ARNETWORK_SENDER_TIME_TO_MS(&(buffer->countersTime)));
+        buffer->countersTime = *now;
+
         /** decrement the time to wait */
         if ((buffer->waitTimeCount > 0) && (hasWaitedMs > 0))
         {
@@ -480,12 +563,25 @@ void ARNETWORK_Sender_ProcessBufferToSend (ARNETWORK_Sender_t *senderPtr, ARNETW
 void ARNETWORK_Sender_Stop (ARNETWORK_Sender_t *senderPtr)
 {
     /** -- Stop the sending -- */
+    ARSAL_Mutex_Lock (&(senderPtr->nextSendMutex));
     senderPtr->isAlive = 0;
+    ARSAL_Cond_Signal (&(senderPtr->nextSendCond));
+    ARSAL_Mutex_Unlock (&(senderPtr->nextSendMutex));
 }
 
-void ARNETWORK_Sender_SignalNewData (ARNETWORK_Sender_t *senderPtr)
+void ARNETWORK_Sender_SignalNewData (ARNETWORK_Sender_t *senderPtr, int bufferId)
 {
+    ARSAL_Mutex_Lock (&(senderPtr->nextSendMutex));
+    if ((bufferId >= 0) &&
+        (bufferId < senderPtr->networkALManager->maxIds) &&
+        (senderPtr->isBufferPending[bufferId] == 0))
+    {
+        senderPtr->isBufferPending[bufferId] = 1;
+        senderPtr->pendingBufferIds[senderPtr->pendingBufferCount] = bufferId;
+        senderPtr->pendingBufferCount++;
+    }
     ARSAL_Cond_Signal (&(senderPtr->nextSendCond));
+    ARSAL_Mutex_Unlock (&(senderPtr->nextSendMutex));
 }
 
 eARNETWORK_ERROR ARNETWORK_Sender_AckReceived (ARNETWORK_Sender_t *senderPtr, int identifier, uint8_t seqNumber)
@@ -515,7 +611,7 @@ eARNETWORK_ERROR ARNETWORK_Sender_AckReceived (ARNETWORK_Sender_t *senderPtr, in
             ARNETWORK_IOBuffer_Unlock (inputBufferPtr);
 
             /* Wake up the send thread to update the wait time of buffers */
-            ARNETWORK_Sender_SignalNewData (senderPtr);
+            ARNETWORK_Sender_SignalNewData (senderPtr, identifier);
         }
     }
     else
@@ -730,4 +826,190 @@ void ARNETWORK_Sender_SendPong (ARNETWORK_Sender_t *senderPtr, uint8_t *data, in
     ARNETWORK_IOBuffer_Lock (inputBufferPtrTemp);
     ARNETWORK_IOBuffer_AddData (inputBufferPtrTemp, data, dataSize, NULL, NULL, 1);
     ARNETWORK_IOBuffer_Unlock (inputBufferPtrTemp);
+    ARNETWORK_Sender_SignalNewData (senderPtr, ARNETWORK_MANAGER_INTERNAL_BUFFER_ID_PONG);
+}
+
+void ARNETWORK_Sender_ScheduleBuffer (ARNETWORK_Sender_t *senderPtr, ARNETWORK_IOBuffer_t *inputBufferPtr)
+{
+    /** -- compute the deadline of a buffer and update it in the heap -- */
+
+    /** local declarations */
+    int hasDeadline = 0;
+    int64_t deadlineMs = 0;
+
+    if (ARNETWORK_IOBuffer_Lock (inputBufferPtr) == ARNETWORK_OK)
+    {
+        deadlineMs = ARNETWORK_SENDER_TIME_TO_MS(&(inputBufferPtr->countersTime));
+
+        if ((inputBufferPtr->dataType == ARNETWORKAL_FRAME_TYPE_DATA_WITH_ACK) &&
+            (ARNETWORK_IOBuffer_IsWaitAck (inputBufferPtr)))
+        {
+            /** waiting an ack : deadline = ack timeout */
+            hasDeadline = 1;
+            deadlineMs += inputBufferPtr->ackWaitTimeCount;
+        }
+        else if (!ARNETWORK_RingBuffer_IsEmpty (inputBufferPtr->dataDescriptorRBuffer))
+        {
+            /** data to send : deadline = next send */
+            hasDeadline = 1;
+            deadlineMs += inputBufferPtr->waitTimeCount;
+        }
+        /** No else: nothing to do until new data are signaled */
+
+        ARNETWORK_IOBuffer_Unlock (inputBufferPtr);
+
+        if (hasDeadline)
+        {
+            ARNETWORK_Sender_SetDeadline (senderPtr, inputBufferPtr->ID, deadlineMs);
+        }
+        else
+        {
+            ARNETWORK_Sender_RemoveDeadline (senderPtr, inputBufferPtr->ID);
+        }
+    }
+}
+
+void ARNETWORK_Sender_SchedulePendingBuffers (ARNETWORK_Sender_t *senderPtr)
+{
+    /** -- schedule the buffers signaled by the other threads -- */
+
+    /** local declarations */
+    int pendingCount = 0;
+    int pendingIndex = 0;
+    int bufferId = 0;
+    ARNETWORK_IOBuffer_t *inputBufferPtr = NULL;
+
+    /** copy the list so that the buffers are not locked under nextSendMutex */
+    ARSAL_Mutex_Lock (&(senderPtr->nextSendMutex));
+    pendingCount = senderPtr->pendingBufferCount;
+    for (pendingIndex = 0; pendingIndex < pendingCount; pendingIndex++)
+    {
+        bufferId = senderPtr->pendingBufferIds[pendingIndex];
+        senderPtr->dueBufferIds[pendingIndex] = bufferId;
+        senderPtr->isBufferPending[bufferId] = 0;
+    }
+    senderPtr->pendingBufferCount = 0;
+    ARSAL_Mutex_Unlock (&(senderPtr->nextSendMutex));
+
+    for (pendingIndex = 0; pendingIndex < pendingCount; pendingIndex++)
+    {
+        inputBufferPtr = senderPtr->inputBufferPtrMap[senderPtr->dueBufferIds[pendingIndex]];
+        if (inputBufferPtr != NULL)
+        {
+            ARNETWORK_Sender_ScheduleBuffer (senderPtr, inputBufferPtr);
+        }
+    }
+}
+
+int ARNETWORK_Sender_GetPingDeadline (ARNETWORK_Sender_t *senderPtr, int64_t *deadlineMs)
+{
+    /** -- get the date of the next ping -- */
+
+    /** local declarations */
+    int hasDeadline = 0;
+    int delayMs = 0;
+
+    ARSAL_Mutex_Lock (&(senderPtr->pingMutex));
+    if (senderPtr->minTimeBetweenPings > 0)
+    {
+        /* same conditions as in ARNETWORK_Sender_ThreadRun(), which waits strictly more than the delay */
+        delayMs = senderPtr->minTimeBetweenPings;
+        if ((senderPtr->isPingRunning != 0) &&
+            (ARNETWORK_SENDER_PING_TIMEOUT_MS > delayMs))
+        {
+            delayMs = ARNETWORK_SENDER_PING_TIMEOUT_MS;
+        }
+        *deadlineMs = ARNETWORK_SENDER_TIME_TO_MS(&(senderPtr->pingStartTime)) + delayMs + 1;
+        hasDeadline = 1;
+    }
+    ARSAL_Mutex_Unlock (&(senderPtr->pingMutex));
+
+    return hasDeadline;
+}
+
+void ARNETWORK_Sender_SetDeadline (ARNETWORK_Sender_t *senderPtr, int bufferId, int64_t timeMs)
+{
+    /** -- add or move the deadline of a buffer -- */
+
+    /** local declarations */
+    int position = senderPtr->deadlinePositions[bufferId];
+
+    if (position < 0)
+    {
+        /** add the deadline at the end of the heap */
+        position = senderPtr->deadlineCount;
+        senderPtr->deadlineCount++;
+        senderPtr->deadlineHeap[position].bufferId = bufferId;
+        senderPtr->deadlinePositions[bufferId] = position;
+    }
+
+    senderPtr->deadlineHeap[position].timeMs = timeMs;
+    ARNETWORK_Sender_SiftDeadline (senderPtr, position);
+}
+
+void ARNETWORK_Sender_RemoveDeadline (ARNETWORK_Sender_t *senderPtr, int bufferId)
+{
+    /** -- remove the deadline of a buffer -- */
+
+    /** local declarations */
+    int position = senderPtr->deadlinePositions[bufferId];
+    int lastPosition = senderPtr->deadlineCount - 1;
+
+    if (position >= 0)
+    {
+        senderPtr->deadlinePositions[bufferId] = -1;
+        senderPtr->deadlineCount--;
+
+        if (position != lastPosition)
+        {
+            /** fill the hole with the last deadline */
+            senderPtr->deadlineHeap[position] = senderPtr->deadlineHeap[lastPosition];
+            senderPtr->deadlinePositions[senderPtr->deadlineHeap[position].bufferId] = position;
+            ARNETWORK_Sender_SiftDeadline (senderPtr, position);
+        }
+    }
+}
+
+void ARNETWORK_Sender_SiftDeadline (ARNETWORK_Sender_t *senderPtr, int position)
+{
+    /** -- restore the heap order around a moved deadline -- */
+
+    /** local declarations */
+    ARNETWORK_Sender_Deadline_t *heap = senderPtr->deadlineHeap;
+    ARNETWORK_Sender_Deadline_t moved = heap[position];
+    int parent = 0;
+    int child = 0;
+
+    /** move up while earlier than the parent */
+    while (position > 0)
+    {
+        parent = (position - 1) / 2;
+        if (heap[parent].timeMs <= moved.timeMs)
+        {
+            break;
+        }
+        heap[position] = heap[parent];
+        senderPtr->deadlinePositions[heap[position].bufferId] = position;
+        position = parent;
+    }
+
+    /** move down while later than the earliest child */
+    while ((child = (2 * position) + 1) < senderPtr->deadlineCount)
+    {
+        if ((child + 1 < senderPtr->deadlineCount) &&
+            (heap[child + 1].timeMs < heap[child].timeMs))
+        {
+            child++;
+        }
+        if (moved.timeMs <= heap[child].timeMs)
+        {
+            break;
+        }
+        heap[position] = heap[child];
+        senderPtr->deadlinePositions[heap[position].bufferId] = position;
+        position = child;
+    }
+
+    heap[position] = moved;
+    senderPtr->deadlinePositions[moved.bufferId] = position;
 }
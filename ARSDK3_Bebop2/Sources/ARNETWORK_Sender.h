@@ -63,6 +63,21 @@
  */
 #define ARNETWORK_SENDER_WAIT_TIME_ON_ARNETWORKAL_OVERFLOW_MS (10)
 
+/**
+ * Maximum wait time of the sender when no buffer has a deadline.
+ * The buffers are scheduled when their data change, this only bounds the sleep.
+ */
+#define ARNETWORK_SENDER_MAXIMUM_WAIT_TIME_MS (1000)
+
+/**
+ * @brief Date at which an input buffer must be processed by the sender
+ */
+typedef struct
+{
+    int64_t timeMs; /**< Date, in ms, of the next send, retry or acknowledgement timeout of the buffer */
+    int bufferId; /**< Identifier of the input buffer */
+}ARNETWORK_Sender_Deadline_t;
+
 /**
  * @brief sending manager
  * @warning before to be used the sender must be created through ARNETWORK_Sender_New()
@@ -80,6 +95,14 @@ typedef struct
 
     ARSAL_Mutex_t nextSendMutex; /**< Mutex for the nextSendCond condition */
     ARSAL_Cond_t nextSendCond; /**< Condition to wait on to force synchronous send */
+    int *pendingBufferIds; /**< Identifiers of the buffers changed since the last run, to schedule again. Protected by nextSendMutex */
+    uint8_t *isBufferPending; /**< 1 if the buffer, by identifier, is in pendingBufferIds. Protected by nextSendMutex */
+    int pendingBufferCount; /**< Number of identifiers in pendingBufferIds. Protected by nextSendMutex */
+
+    ARNETWORK_Sender_Deadline_t *deadlineHeap; /**< Binary min-heap of the buffer deadlines ; only used by the sending thread */
+    int *deadlinePositions; /**< Position of each buffer, by identifier, in deadlineHeap ; -1 if the buffer has nothing to do */
+    int deadlineCount; /**< Number of deadlines in deadlineHeap */
+    int *dueBufferIds; /**< Identifiers of the buffers processed by the current run */
 
     int isAlive; /**< Indicator of aliving used for kill the thread calling the ARNETWORK_Sender_ThreadRun function (1 = alive | 0 = dead). Must be accessed through ARNETWORK_Sender_Stop()*/
 
@@ -134,9 +157,9 @@ void* ARNETWORK_Sender_ThreadRun (void* data);
  * It should not be called anywhere else (not thread safe, not reentrant ...)
  * @param senderPtr the pointer on the Sender
  * @param buffer the buffer to process
- * @param hasWaited flag to indicate that a milisecond has passed since the last call for this buffer
+ * @param now current date ; the time elapsed since the buffer countersTime is removed from its counters
  */
-void ARNETWORK_Sender_ProcessBufferToSend (ARNETWORK_Sender_t *senderPtr, ARNETWORK_IOBuffer_t *buffer, int hasWaited);
+void ARNETWORK_Sender_ProcessBufferToSend (ARNETWORK_Sender_t *senderPtr, ARNETWORK_IOBuffer_t *buffer, const struct timespec *now);
 
 /**
  * @brief Stop the sending
@@ -147,10 +170,12 @@ void ARNETWORK_Sender_ProcessBufferToSend (ARNETWORK_Sender_t *senderPtr, ARNETW
 void ARNETWORK_Sender_Stop (ARNETWORK_Sender_t *senderPtr);
 
 /**
- * @brief Signals to the sender that new data are available in a low latency buffer
+ * @brief Signals to the sender that the data or the counters of an input buffer changed
+ * @details The buffer deadline is computed again by the sending thread, which is woken up.
  * @param senderPtr pointer on the Sender
+ * @param bufferId identifier of the input buffer that changed
  */
-void ARNETWORK_Sender_SignalNewData (ARNETWORK_Sender_t *senderPtr);
+void ARNETWORK_Sender_SignalNewData (ARNETWORK_Sender_t *senderPtr, int bufferId);
 
 /**
  * @brief Receive an acknowledgment fo a data.
@@ -0,0 +1,488 @@
+/*
+    Copyright (C) 2014 Parrot SA
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions
+    are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the 
+      distribution.
+    * Neither the name of Parrot nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+    "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+    LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+    FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+    COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+    INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+    OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED 
+    AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+    OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+    SUCH DAMAGE.
+*/
+/**
+ * @file libARSAL/ARSAL_Trace.c
+ * @brief Latency trace of the video frames, kept in a lock-free ring.
+ */
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#define ARSAL_TRACE_INCREMENT64(pointer) InterlockedIncrement64 ((volatile LONGLONG *)(pointer))
+#define ARSAL_TRACE_EXCHANGE64(pointer, value) InterlockedExchange64 ((volatile LONGLONG *)(pointer), (LONGLONG)(value))
+#define ARSAL_TRACE_LOAD64(pointer) InterlockedCompareExchange64 ((volatile LONGLONG *)(pointer), 0, 0)
+#define ARSAL_TRACE_BARRIER() MemoryBarrier()
+#else
+#include <pthread.h>
+#include <time.h>
+#define ARSAL_TRACE_INCREMENT64(pointer) __sync_add_and_fetch ((pointer), 1)
+#define ARSAL_TRACE_EXCHANGE64(pointer, value) __sync_lock_test_and_set ((pointer), (value))
+#define ARSAL_TRACE_LOAD64(pointer) __sync_fetch_and_add ((pointer), 0)
+#define ARSAL_TRACE_BARRIER() __sync_synchronize()
+#endif
+
+#include <libARSAL/ARSAL_Trace.h>
+
+#define ARSAL_TRACE_RING_MASK (ARSAL_TRACE_RING_SIZE - 1)
+
+/**
+ * @brief Slot of the ring.
+ * @note The sequence of the slot holding the record number N is 2N+1 while it is written and 2N+2
+ * once written, so a reader detects both a write in progress and a record overwritten by a later one.
+ */
+typedef struct
+{
+    volatile int64_t sequence; /**< Write sequence of the slot */
+    ARSAL_Trace_Record_t record; /**< The record */
+} ARSAL_TRACE_SLOT_t;
+
+/**
+ * @brief Latencies of one stage transition.
+ */
+typedef struct
+{
+    uint64_t *durationsUs; /**< Latencies, sorted before being written */
+    int count; /**< Number of latencies */
+} ARSAL_TRACE_SERIES_t;
+
+static ARSAL_TRACE_SLOT_t ARSAL_Trace_ring[ARSAL_TRACE_RING_SIZE];
+static volatile int64_t ARSAL_Trace_head = 0; /**< Number of records ever written */
+static volatile int64_t ARSAL_Trace_tail = 0; /**< First record kept since the last clear */
+static volatile int32_t ARSAL_Trace_enabled = 0;
+static volatile int64_t ARSAL_Trace_pendingCommand = 0; /**< Frame of the last decision not sent yet, 0 if none */
+
+static const char *ARSAL_Trace_stageNames[ARSAL_TRACE_STAGE_MAX] =
+{
+    "rtp_arrival",
+    "au_complete",
+    "decoded",
+    "detected",
+    "decided",
+    "pcmd_sent",
+};
+
+/* Upper bounds of the histogram buckets in milliseconds ; the last bucket has none */
+static const uint32_t ARSAL_Trace_bucketsMs[] = { 1, 2, 5, 10, 20, 50, 100, 200, 500, 1000 };
+#define ARSAL_TRACE_BUCKET_COUNT ((int)(sizeof (ARSAL_Trace_bucketsMs) / sizeof (ARSAL_Trace_bucketsMs[0])) + 1)
+
+/*************************
+ * Private functions
+ *************************/
+
+static uint32_t ARSAL_Trace_GetThreadId (void)
+{
+#ifdef _WIN32
+    return (uint32_t)GetCurrentThreadId ();
+#else
+    return (uint32_t)(uintptr_t)pthread_self ();
+#endif
+}
+
+static int ARSAL_Trace_CompareRecords (const void *a, const void *b)
+{
+    // -- Order by frame, then by time --
+
+    const ARSAL_Trace_Record_t *recordA = a;
+    const ARSAL_Trace_Record_t *recordB = b;
+
+    if (recordA->frameId != recordB->frameId)
+    {
+        return (recordA->frameId < recordB->frameId) ? -1 : 1;
+    }
+    if (recordA->timeUs != recordB->timeUs)
+    {
+        return (recordA->timeUs < recordB->timeUs) ? -1 : 1;
+    }
+    return (int)recordA->stage - (int)recordB->stage;
+}
+
+static int ARSAL_Trace_CompareDurations (const void *a, const void *b)
+{
+    uint64_t durationA = *(const uint64_t *)a;
+    uint64_t durationB = *(const uint64_t *)b;
+
+    return (durationA < durationB) ? -1 : ((durationA > durationB) ? 1 : 0);
+}
+
+static ARSAL_Trace_Record_t *ARSAL_Trace_SnapshotSorted (int *count)
+{
+    // -- Copy the ring, grouped by frame --
+
+    ARSAL_Trace_Record_t *records = malloc (ARSAL_TRACE_RING_SIZE * sizeof (ARSAL_Trace_Record_t));
+
+    *count = 0;
+    if (records != NULL)
+    {
+        *count = ARSAL_Trace_Snapshot (records, ARSAL_TRACE_RING_SIZE);
+        qsort (records, *count, sizeof (ARSAL_Trace_Record_t), ARSAL_Trace_CompareRecords);
+    }
+
+    return records;
+}
+
+static uint64_t ARSAL_Trace_Percentile (const ARSAL_TRACE_SERIES_t *series, int percent)
+{
+    // -- Nearest-rank percentile of a sorted series --
+
+    int rank = (series->count * percent + 99) / 100;
+
+    if (rank < 1)
+    {
+        rank = 1;
+    }
+    return series->durationsUs[rank - 1];
+}
+
+static void ARSAL_Trace_WriteSeries (FILE *file, const char *name, ARSAL_TRACE_SERIES_t *series)
+{
+    // -- One line of the histogram table --
+
+    int buckets[ARSAL_TRACE_BUCKET_COUNT];
+    int i = 0, bucket = 0;
+
+    memset (buckets, 0, sizeof (buckets));
+    qsort (series->durationsUs, series->count, sizeof (uint64_t), ARSAL_Trace_CompareDurations);
+
+    for (i = 0; i < series->count; i++)
+    {
+        for (bucket = 0; bucket < ARSAL_TRACE_BUCKET_COUNT - 1; bucket++)
+        {
+            if (series->durationsUs[i] < (uint64_t)ARSAL_Trace_bucketsMs[bucket] * 1000)
+            {
+                break;
+            }
+        }
+        buckets[bucket]++;
+    }
+
+    fprintf (file, "%-26s %6d", name, series->count);
+    if (series->count > 0)
+    {
+        fprintf (file, " %8.2f %8.2f %8.2f %8.2f",
+                 ARSAL_Trace_Percentile (series, 50) / 1000.0, ARSAL_Trace_Percentile (series, 90) / 1000.0,
+                 ARSAL_Trace_Percentile (series, 99) / 1000.0, series->durationsUs[series->count - 1] / 1000.0);
+    }
+    else
+    {
+        fprintf (file, " %8s %8s %8s %8s", "-", "-", "-", "-");
+    }
+    for (bucket = 0; bucket < ARSAL_TRACE_BUCKET_COUNT; bucket++)
+    {
+        fprintf (file, " %6d", buckets[bucket]);
+    }
+    fprintf (file, "\n");
+}
+
+/*************************
+ * Implementation
+ *************************/
+
+void ARSAL_Trace_SetEnabled (int enabled)
+{
+    ARSAL_Trace_enabled = (enabled != 0) ? 1 : 0;
+    ARSAL_TRACE_BARRIER();
+}
+
+int ARSAL_Trace_IsEnabled (void)
+{
+    return ARSAL_Trace_enabled;
+}
+
+uint64_t ARSAL_Trace_GetTimeUs (void)
+{
+#ifdef _WIN32
+    static LARGE_INTEGER frequency = { 0 };
+    LARGE_INTEGER counter;
+
+    if (frequency.QuadPart == 0)
+    {
+        QueryPerformanceFrequency (&frequency);
+    }
+    QueryPerformanceCounter (&counter);
+
+    return (uint64_t)(counter.QuadPart / frequency.QuadPart) * 1000000 + (uint64_t)(counter.QuadPart % frequency.QuadPart) * 1000000 / frequency.QuadPart;
+#else
+    struct timespec now;
+
+    clock_gettime (CLOCK_MONOTONIC, &now);
+
+    return (uint64_t)now.tv_sec * 1000000 + (uint64_t)now.tv_nsec / 1000;
+#endif
+}
+
+void ARSAL_Trace_Record (eARSAL_TRACE_STAGE stage, uint64_t frameId)
+{
+    // -- Record a stage of a frame --
+
+    int64_t index = 0;
+    ARSAL_TRACE_SLOT_t *slot = NULL;
+
+    if ((!ARSAL_Trace_enabled) || (frameId == 0) || (stage >= ARSAL_TRACE_STAGE_MAX))
+    {
+        return;
+    }
+
+    index = ARSAL_TRACE_INCREMENT64 (&ARSAL_Trace_head) - 1;
+    slot = &ARSAL_Trace_ring[index & ARSAL_TRACE_RING_MASK];
+
+    ARSAL_TRACE_EXCHANGE64 (&(slot->sequence), 2 * index + 1);
+    slot->record.frameId = frameId;
+    slot->record.timeUs = ARSAL_Trace_GetTimeUs ();
+    slot->record.stage = (uint32_t)stage;
+    slot->record.threadId = ARSAL_Trace_GetThreadId ();
+    ARSAL_TRACE_EXCHANGE64 (&(slot->sequence), 2 * index + 2);
+}
+
+void ARSAL_Trace_SetPendingCommand (uint64_t frameId)
+{
+    if (ARSAL_Trace_enabled)
+    {
+        ARSAL_TRACE_EXCHANGE64 (&ARSAL_Trace_pendingCommand, frameId);
+    }
+}
+
+void ARSAL_Trace_RecordPendingCommand (void)
+{
+    // -- Attribute the piloting command to the last decision --
+
+    uint64_t frameId = 0;
+
+    if (!ARSAL_Trace_enabled)
+    {
+        return;
+    }
+
+    frameId = (uint64_t)ARSAL_TRACE_EXCHANGE64 (&ARSAL_Trace_pendingCommand, 0);
+    if (frameId != 0)
+    {
+        ARSAL_Trace_Record (ARSAL_TRACE_STAGE_PCMD_SENT, frameId);
+    }
+}
+
+int ARSAL_Trace_Snapshot (ARSAL_Trace_Record_t *records, int maxCount)
+{
+    // -- Copy the readable records, oldest first --
+
+    int64_t head = ARSAL_TRACE_LOAD64 (&ARSAL_Trace_head);
+    int64_t start = ARSAL_TRACE_LOAD64 (&ARSAL_Trace_tail);
+    int64_t index = 0, before = 0, after = 0;
+    int count = 0;
+    ARSAL_TRACE_SLOT_t *slot = NULL;
+
+    if ((records == NULL) || (maxCount <= 0))
+    {
+        return 0;
+    }
+
+    if (head - start > ARSAL_TRACE_RING_SIZE)
+    {
+        start = head - ARSAL_TRACE_RING_SIZE;
+    }
+    if (head - start > maxCount)
+    {
+        start = head - maxCount;
+    }
+
+    for (index = start; index < head; index++)
+    {
+        slot = &ARSAL_Trace_ring[index & ARSAL_TRACE_RING_MASK];
+
+        before = ARSAL_TRACE_LOAD64 (&(slot->sequence));
+        ARSAL_TRACE_BARRIER();
+        records[count] = slot->record;
+        ARSAL_TRACE_BARRIER();
+        after = ARSAL_TRACE_LOAD64 (&(slot->sequence));
+
+        // Skip the records being written or already overwritten by a writer that lapped the reader
+        if ((before == after) && (before == 2 * index + 2))
+        {
+            count++;
+        }
+    }
+
+    return count;
+}
+
+void ARSAL_Trace_Clear (void)
+{
+    ARSAL_TRACE_EXCHANGE64 (&ARSAL_Trace_tail, ARSAL_TRACE_LOAD64 (&ARSAL_Trace_head));
+    ARSAL_TRACE_EXCHANGE64 (&ARSAL_Trace_pendingCommand, 0);
+}
+
+const char *ARSAL_Trace_StageToString (eARSAL_TRACE_STAGE stage)
+{
+    if (stage >= ARSAL_TRACE_STAGE_MAX)
+    {
+        return "unknown";
+    }
+    return ARSAL_Trace_stageNames[stage];
+}
+
+int ARSAL_Trace_WriteChromeJson (FILE *file)
+{
+    // -- Write every frame as an async track of chrome://tracing --
+
+    ARSAL_Trace_Record_t *records = NULL;
+    int count = 0, i = 0, first = 1;
+    uint64_t origin = UINT64_MAX;
+
+    if (file == NULL)
+    {
+        return -1;
+    }
+
+    records = ARSAL_Trace_SnapshotSorted (&count);
+    if (records == NULL)
+    {
+        return -1;
+    }
+
+    for (i = 0; i < count; i++)
+    {
+        if (records[i].timeUs < origin)
+        {
+            origin = records[i].timeUs;
+        }
+    }
+
+    fprintf (file, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+    for (i = 0; i < count; i++)
+    {
+        const ARSAL_Trace_Record_t *record = &records[i];
+
+        // Instant event on the thread that reached the stage
+        fprintf (file, "%s\n{\"name\":\"%s\",\"cat\":\"stage\",\"ph\":\"i\",\"s\":\"t\",\"ts\":%" PRIu64 ",\"pid\":1,\"tid\":%u,\"args\":{\"frame\":%" PRIu64 "}}",
+                 first ? "" : ",", ARSAL_Trace_StageToString (record->stage), record->timeUs - origin, record->threadId, record->frameId);
+        first = 0;
+
+        // Slice of the frame track, from its previous stage
+        if ((i > 0) && (records[i - 1].frameId == record->frameId))
+        {
+            fprintf (file, ",\n{\"name\":\"%s\",\"cat\":\"frame\",\"ph\":\"b\",\"id\":\"0x%" PRIx64 "\",\"ts\":%" PRIu64 ",\"pid\":1,\"tid\":0}",
+                     ARSAL_Trace_StageToString (record->stage), record->frameId, records[i - 1].timeUs - origin);
+            fprintf (file, ",\n{\"name\":\"%s\",\"cat\":\"frame\",\"ph\":\"e\",\"id\":\"0x%" PRIx64 "\",\"ts\":%" PRIu64 ",\"pid\":1,\"tid\":0}",
+                     ARSAL_Trace_StageToString (record->stage), record->frameId, record->timeUs - origin);
+        }
+    }
+    fprintf (file, "\n]}\n");
+
+    free (records);
+
+    return ferror (file) ? -1 : 0;
+}
+
+int ARSAL_Trace_WriteHistograms (FILE *file)
+{
+    // -- Write the latency of each transition between consecutive stages, and of the whole path --
+
+    ARSAL_TRACE_SERIES_t series[ARSAL_TRACE_STAGE_MAX];
+    ARSAL_Trace_Record_t *records = NULL;
+    uint64_t stageTimes[ARSAL_TRACE_STAGE_MAX];
+    int count = 0, i = 0, begin = 0, stage = 0, bucket = 0, error = 0;
+    char name[64];
+
+    if (file == NULL)
+    {
+        return -1;
+    }
+
+    records = ARSAL_Trace_SnapshotSorted (&count);
+    if (records == NULL)
+    {
+        return -1;
+    }
+
+    // series[0] is the whole path, series[s] the transition from the stage s-1 to the stage s
+    memset (series, 0, sizeof (series));
+    for (stage = 0; stage < ARSAL_TRACE_STAGE_MAX; stage++)
+    {
+        series[stage].durationsUs = malloc ((count + 1) * sizeof (uint64_t));
+        if (series[stage].durationsUs == NULL)
+        {
+            error = 1;
+        }
+    }
+
+    for (begin = 0; (!error) && (begin < count); begin = i)
+    {
+        // The first record of each stage of the frame
+        memset (stageTimes, 0, sizeof (stageTimes));
+        for (i = begin; (i < count) && (records[i].frameId == records[begin].frameId); i++)
+        {
+            if (stageTimes[records[i].stage] == 0)
+            {
+                stageTimes[records[i].stage] = records[i].timeUs;
+            }
+        }
+
+        for (stage = 1; stage < ARSAL_TRACE_STAGE_MAX; stage++)
+        {
+            if ((stageTimes[stage - 1] != 0) && (stageTimes[stage] >= stageTimes[stage - 1]) && (stageTimes[stage] != 0))
+            {
+                series[stage].durationsUs[series[stage].count++] = stageTimes[stage] - stageTimes[stage - 1];
+            }
+        }
+
+        // Glass to command: only the frames seen from the RTP reception to the piloting command
+        if ((stageTimes[ARSAL_TRACE_STAGE_RTP_ARRIVAL] != 0) && (stageTimes[ARSAL_TRACE_STAGE_PCMD_SENT] >= stageTimes[ARSAL_TRACE_STAGE_RTP_ARRIVAL]))
+        {
+            series[0].durationsUs[series[0].count++] = stageTimes[ARSAL_TRACE_STAGE_PCMD_SENT] - stageTimes[ARSAL_TRACE_STAGE_RTP_ARRIVAL];
+        }
+    }
+
+    if (!error)
+    {
+        fprintf (file, "%-26s %6s %8s %8s %8s %8s", "transition", "count", "p50 ms", "p90 ms", "p99 ms", "max ms");
+        for (bucket = 0; bucket < ARSAL_TRACE_BUCKET_COUNT - 1; bucket++)
+        {
+            snprintf (name, sizeof (name), "<%ums", ARSAL_Trace_bucketsMs[bucket]);
+            fprintf (file, " %6s", name);
+        }
+        snprintf (name, sizeof (name), ">=%ums", ARSAL_Trace_bucketsMs[ARSAL_TRACE_BUCKET_COUNT - 2]);
+        fprintf (file, " %6s\n", name);
+
+        for (stage = 1; stage < ARSAL_TRACE_STAGE_MAX; stage++)
+        {
+            snprintf (name, sizeof (name), "%s>%s", ARSAL_Trace_StageToString (stage - 1), ARSAL_Trace_StageToString (stage));
+            ARSAL_Trace_WriteSeries (file, name, &series[stage]);
+        }
+        ARSAL_Trace_WriteSeries (file, "glass_to_command", &series[0]);
+    }
+
+    for (stage = 0; stage < ARSAL_TRACE_STAGE_MAX; stage++)
+    {
+        free (series[stage].durationsUs);
+    }
+    free (records);
+
+    return (error || ferror (file)) ? -1 : 0;
+}
@@ -66,6 +66,8 @@
 #define ARNETWORKAL_WIFINETWORK_TAG                     "ARNETWORKAL_WifiNetwork"
 #define ARNETWORKAL_WIFINETWORK_SENDING_BUFFER_SIZE     (ARNETWORKAL_WIFINETWORK_MAX_DATA_BUFFER_SIZE + offsetof(ARNETWORKAL_Frame_t, dataPtr))
 #define ARNETWORKAL_WIFINETWORK_RECEIVING_BUFFER_SIZE   (ARNETWORKAL_WIFINETWORK_MAX_DATA_BUFFER_SIZE + offsetof(ARNETWORKAL_Frame_t, dataPtr))
+#define ARNETWORKAL_WIFINETWORK_RECEIVING_BATCH_SIZE    (2 * ARNETWORKAL_WIFINETWORK_RECEIVING_BUFFER_SIZE) /* room to receive a datagram after up to one full datagram of batched data */
+#define ARNETWORKAL_WIFINETWORK_RECEIVING_BATCH_MAX     64 /* maximum number of datagrams received per select() */
 
 #define ARNETWORKAL_BW_PROGRESS_EACH_SEC 1
 #define ARNETWORKAL_BW_NB_ELEMS 10
@@ -107,6 +109,22 @@ typedef struct _ARNETWORKAL_WifiNetworkObject_
 static uint8_t ARNETWORKAL_WifiNetwork_IsTooLongWithoutReceive(ARNETWORKAL_Manager_t *manager, ARNETWORKAL_WifiNetworkObject *receiverObject);
 
 
+/**
+ * @brief Receive the datagrams already queued on the socket after the receiving buffer content.
+ * @note The frames of the datagrams follow each other in the buffer, so PopFrame() reads them as if they had come in one datagram.
+ * @param receiverObject wifi receiver object
+ * @return number of datagrams received
+ */
+static int ARNETWORKAL_WifiNetwork_ReceiveBatch (ARNETWORKAL_Manager_t *manager, ARNETWORKAL_WifiNetworkObject *receiverObject);
+
+/**
+ * @brief Check that a datagram is made of whole frames.
+ * @param data datagram
+ * @param size size of the datagram
+ * @return 1 if the frames fill the datagram exactly, otherwise 0
+ */
+static int ARNETWORKAL_WifiNetwork_IsWholeFrames (const uint8_t *data, int size);
+
 /**
  * @brief Flush the receive socket.
  * @param receiverObject wifi receiver object
@@ -217,7 +235,7 @@ eARNETWORKAL_ERROR ARNETWORKAL_WifiNetwork_New (ARNETWORKAL_Manager_t *manager)
     /* Allocate receiver buffer */
     if(error == ARNETWORKAL_OK)
     {
-        ((ARNETWORKAL_WifiNetworkObject *)manager->receiverObject)->buffer = (uint8_t *)malloc(sizeof(uint8_t) * ARNETWORKAL_WIFINETWORK_RECEIVING_BUFFER_SIZE);
+        ((ARNETWORKAL_WifiNetworkObject *)manager->receiverObject)->buffer = (uint8_t *)malloc(sizeof(uint8_t) * ARNETWORKAL_WIFINETWORK_RECEIVING_BATCH_SIZE);
         if(((ARNETWORKAL_WifiNetworkObject *)manager->receiverObject)->buffer != NULL)
         {
             ((ARNETWORKAL_WifiNetworkObject *)manager->receiverObject)->size = 0;
@@ -868,18 +886,30 @@ eARNETWORKAL_MANAGER_RETURN ARNETWORKAL_WifiNetwork_Receive(ARNETWORKAL_Manager_
             else
             {
                 // If the socket is ready, read data
+                receiverObject->size = 0;
                 int size = ARSAL_Socket_Recv (receiverObject->socket, receiverObject->buffer, ARNETWORKAL_WIFINETWORK_RECEIVING_BUFFER_SIZE, 0);
                 if (size > 0)
                 {
-                    // Save the number of bytes read
-                    receiverObject->size = size;
                     receiverObject->bw_current += size;
 
                     if (manager->dumpFile != NULL)
                     {
-                        ARSAL_Print_DumpData (manager->dumpFile, ARNETWORKAL_DUMP_TAG_DATA_RECEIVED, receiverObject->buffer, receiverObject->size, 0, NULL);
+                        ARSAL_Print_DumpData (manager->dumpFile, ARNETWORKAL_DUMP_TAG_DATA_RECEIVED, receiverObject->buffer, size, 0, NULL);
+                    }
+
+                    // Save the number of bytes read ; a malformed datagram would make the batched ones unreadable
+                    if (ARNETWORKAL_WifiNetwork_IsWholeFrames (receiverObject->buffer, size))
+                    {
+                        receiverObject->size = size;
+                    }
+                    else
+                    {
+                        ARSAL_PRINT(ARSAL_PRINT_WARNING, ARNETWORKAL_WIFINETWORK_TAG, "[%p] malformed datagram of %d bytes dropped", manager, size);
                     }
 
+                    // Take the datagrams queued behind it without another select()
+                    ARNETWORKAL_WifiNetwork_ReceiveBatch (manager, receiverObject);
+
                     /* Data received reset the reception flush state */
                     receiverObject->recvIsFlushed = 0;
                 }
@@ -1170,6 +1200,71 @@ static uint8_t ARNETWORKAL_WifiNetwork_IsTooLongWithoutReceive (ARNETWORKAL_Mana
     return isTooLongWithoutReceive;
 }
 
+static int ARNETWORKAL_WifiNetwork_ReceiveBatch (ARNETWORKAL_Manager_t *manager, ARNETWORKAL_WifiNetworkObject *receiverObject)
+{
+    /* -- receive the datagrams queued on the socket -- */
+
+    int count = 0;
+    int size = 0;
+    uint8_t *data = NULL;
+
+    /* the socket is non blocking: stop when no datagram is queued anymore, or when the next one may not fit */
+    while ((count < ARNETWORKAL_WIFINETWORK_RECEIVING_BATCH_MAX) &&
+           (receiverObject->size + ARNETWORKAL_WIFINETWORK_RECEIVING_BUFFER_SIZE <= ARNETWORKAL_WIFINETWORK_RECEIVING_BATCH_SIZE))
+    {
+        data = receiverObject->buffer + receiverObject->size;
+        size = ARSAL_Socket_Recv (receiverObject->socket, data, ARNETWORKAL_WIFINETWORK_RECEIVING_BUFFER_SIZE, 0);
+        if (size <= 0)
+        {
+            /* WSAEWOULDBLOCK or error ; an error is reported by the next select() */
+            break;
+        }
+
+        count++;
+        receiverObject->bw_current += size;
+
+        if (manager->dumpFile != NULL)
+        {
+            ARSAL_Print_DumpData (manager->dumpFile, ARNETWORKAL_DUMP_TAG_DATA_RECEIVED, data, size, 0, NULL);
+        }
+
+        if (ARNETWORKAL_WifiNetwork_IsWholeFrames (data, size))
+        {
+            receiverObject->size += size;
+        }
+        else
+        {
+            ARSAL_PRINT(ARSAL_PRINT_WARNING, ARNETWORKAL_WIFINETWORK_TAG, "[%p] malformed datagram of %d bytes dropped", manager, size);
+        }
+    }
+
+    return count;
+}
+
+static int ARNETWORKAL_WifiNetwork_IsWholeFrames (const uint8_t *data, int size)
+{
+    /* -- check the frame sizes of a datagram -- */
+
+    const int headerSize = (int)offsetof (ARNETWORKAL_Frame_t, dataPtr);
+    uint32_t frameSize = 0;
+    int offset = 0;
+
+    while (offset + headerSize <= size)
+    {
+        /* the size follows the type, id and seq bytes */
+        memcpy (&frameSize, data + offset + 3 * sizeof (uint8_t), sizeof (uint32_t));
+        frameSize = dtohl (frameSize);
+
+        if ((frameSize < (uint32_t)headerSize) || (frameSize > (uint32_t)(size - offset)))
+        {
+            return 0;
+        }
+        offset += (int)frameSize;
+    }
+
+    return (offset == size) ? 1 : 0;
+}
+
 static void ARNETWORKAL_WifiNetwork_FlushReceiveSocket (ARNETWORKAL_Manager_t *manager, ARNETWORKAL_WifiNetworkObject *receiverObject)
 {
     /* -- flush the receive socket -- */
@@ -12,6 +12,7 @@
 #include <libARSAL/ARSAL_Print.h>
 #include <libARSAL/ARSAL_Mutex.h>
 #include <libARSAL/ARSAL_Thread.h>
+#include <libARSAL/ARSAL_Trace.h>
 
 #include <libARStream2/arstream2_rtp_receiver.h>
 #include <libARStream2/arstream2_h264_filter.h>
@@ -25,7 +26,8 @@
 
 #define ARSTREAM2_H264_FILTER_TAG "ARSTREAM2_H264Filter"
 
-#define ARSTREAM2_H264_FILTER_AU_BUFFER_SIZE (128 * 1024)
+/* access units are assembled in place in the pool items, so they must hold the largest IDR frame */
+#define ARSTREAM2_H264_FILTER_AU_BUFFER_SIZE (1024 * 1024)
 #define ARSTREAM2_H264_FILTER_AU_BUFFER_POOL_SIZE (60)
 #define ARSTREAM2_H264_FILTER_AU_METADATA_BUFFER_SIZE (1024)
 #define ARSTREAM2_H264_FILTER_AU_USER_DATA_BUFFER_SIZE (1024)
@@ -81,13 +83,9 @@ typedef struct ARSTREAM2_H264Filter_AuBufferItem_s
 {
     uint8_t *buffer;
     unsigned int bufferSize;
-    unsigned int auSize;
     uint8_t *metadataBuffer;
     unsigned int metadataBufferSize;
-    uint32_t naluCount;
-    uint32_t naluSize[ARSTREAM2_STREAM_RECORDER_NALU_MAX_COUNT];
-    uint8_t *naluData[ARSTREAM2_STREAM_RECORDER_NALU_MAX_COUNT];
-    int pushed;
+    int refCount;               // the access unit being assembled and the recorder each hold a reference
 
     struct ARSTREAM2_H264Filter_AuBufferItem_s* prev;
     struct ARSTREAM2_H264Filter_AuBufferItem_s* next;
@@ -137,9 +135,9 @@ typedef struct ARSTREAM2_H264Filter_s
     int generateSkippedPSlices;
     int generateFirstGrayIFrame;
 
-    ARSTREAM2_H264Filter_AuBufferPool_t recordAuBufferPool;
-    ARSAL_Mutex_t recordAuBufferPoolMutex;
-    ARSTREAM2_H264Filter_AuBufferItem_t *recordAuBufferItem;
+    ARSTREAM2_H264Filter_AuBufferPool_t auBufferPool;
+    ARSAL_Mutex_t auBufferPoolMutex;
+    ARSTREAM2_H264Filter_AuBufferItem_t *currentAuItem;
 
     uint8_t *currentAuBuffer;
     int currentAuBufferSize;
@@ -151,6 +149,13 @@ typedef struct ARSTREAM2_H264Filter_s
 
     int currentAuOutputIndex;
     int currentAuSize;
+    /* NAL units of the current access unit, in currentAuBuffer order; NAL units filtered
+     * out of the output are only kept in the buffer for the recorder */
+    uint32_t currentAuNaluCount;
+    uint32_t currentAuNaluSize[ARSTREAM2_STREAM_RECORDER_NALU_MAX_COUNT];
+    uint8_t *currentAuNaluData[ARSTREAM2_STREAM_RECORDER_NALU_MAX_COUNT];
+    uint8_t currentAuNaluIsOutput[ARSTREAM2_STREAM_RECORDER_NALU_MAX_COUNT];
+    int currentAuNaluOverflow;
     uint64_t currentAuTimestamp;
     uint64_t currentAuTimestampShifted;
     uint64_t currentAuFirstNaluInputTime;
@@ -378,6 +383,22 @@ static int ARSTREAM2_H264Filter_AuBufferPoolPushFreeItem(ARSTREAM2_H264Filter_Au
 }
 
 
+static void ARSTREAM2_H264Filter_AuBufferItemUnref(ARSTREAM2_H264Filter_t *filter, ARSTREAM2_H264Filter_AuBufferItem_t *item)
+{
+    ARSAL_Mutex_Lock(&(filter->auBufferPoolMutex));
+    item->refCount--;
+    if (item->refCount <= 0)
+    {
+        item->refCount = 0;
+        if (ARSTREAM2_H264Filter_AuBufferPoolPushFreeItem(&filter->auBufferPool, item) != 0)
+        {
+            ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_FILTER_TAG, "Failed to push free item to AU buffer pool");
+        }
+    }
+    ARSAL_Mutex_Unlock(&(filter->auBufferPoolMutex));
+}
+
+
 static void ARSTREAM2_H264Filter_StreamRecorderAuCallback(eARSTREAM2_STREAM_RECORDER_AU_STATUS status, void *auUserPtr, void *userPtr)
 {
     ARSTREAM2_H264Filter_t *filter = (ARSTREAM2_H264Filter_t*)userPtr;
@@ -396,13 +417,7 @@ static void ARSTREAM2_H264Filter_StreamRecorderAuCallback(eARSTREAM2_STREAM_RECO
         return;
     }
 
-    ARSAL_Mutex_Lock(&(filter->recordAuBufferPoolMutex));
-    int ret = ARSTREAM2_H264Filter_AuBufferPoolPushFreeItem(&filter->recordAuBufferPool, item);
-    ARSAL_Mutex_Unlock(&(filter->recordAuBufferPoolMutex));
-    if (ret != 0)
-    {
-        ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_FILTER_TAG, "Failed to push free item to AU buffer pool");
-    }
+    ARSTREAM2_H264Filter_AuBufferItemUnref(filter, item);
 }
 
 
@@ -457,20 +472,8 @@ static int ARSTREAM2_H264Filter_StreamRecorderStart(ARSTREAM2_H264Filter_t *filt
 
     if (filter->recorder)
     {
-        ARSAL_Mutex_Lock(&(filter->recordAuBufferPoolMutex));
-        filter->recordAuBufferItem = ARSTREAM2_H264Filter_AuBufferPoolPopFreeItem(&filter->recordAuBufferPool);
-        ARSAL_Mutex_Unlock(&(filter->recordAuBufferPoolMutex));
-        if (filter->recordAuBufferItem)
-        {
-            filter->recordAuBufferItem->pushed = 0;
-            filter->recordAuBufferItem->auSize = 0;
-            filter->recordAuBufferItem->naluCount = 0;
-        }
-        else
-        {
-            ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_FILTER_TAG, "Failed to get free item in AU buffer pool");
-            ARSTREAM2_StreamRecorder_Flush(filter->recorder);
-        }
+        /* the recorder shares the access unit buffers: recording starts with the next NAL unit */
+        ret = 0;
     }
 
     return ret;
@@ -813,33 +816,45 @@ static int ARSTREAM2_H264Filter_getNewAuBuffer(ARSTREAM2_H264Filter_t *filter)
 {
     int ret = 0;
 
-    filter->currentAuBuffer = filter->tempAuBuffer;
-    filter->currentAuBufferSize = filter->tempAuBufferSize;
     filter->auBufferChangePending = 0;
 
-    if (filter->recorder)
+    ARSAL_Mutex_Lock(&(filter->auBufferPoolMutex));
+    if ((filter->currentAuItem) && (filter->currentAuItem->refCount > 1))
+    {
+        /* the recorder still uses the buffer: leave it its reference */
+        filter->currentAuItem->refCount--;
+        filter->currentAuItem = NULL;
+    }
+    ARSAL_Mutex_Unlock(&(filter->auBufferPoolMutex));
+
+    if (!filter->currentAuItem)
     {
-        if (filter->recordAuBufferItem->pushed)
+        ARSAL_Mutex_Lock(&(filter->auBufferPoolMutex));
+        filter->currentAuItem = ARSTREAM2_H264Filter_AuBufferPoolPopFreeItem(&filter->auBufferPool);
+        if (filter->currentAuItem)
         {
-            ARSAL_Mutex_Lock(&(filter->recordAuBufferPoolMutex));
-            filter->recordAuBufferItem = ARSTREAM2_H264Filter_AuBufferPoolPopFreeItem(&filter->recordAuBufferPool);
-            ARSAL_Mutex_Unlock(&(filter->recordAuBufferPoolMutex));
-            if (!filter->recordAuBufferItem)
-            {
-                ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_FILTER_TAG, "Failed to get free item in AU buffer pool");
-                ARSTREAM2_StreamRecorder_Flush(filter->recorder);
-            }
-            else
-            {
-                filter->recordAuBufferItem->pushed = 0;
-            }
+            filter->currentAuItem->refCount = 1;
         }
-        else
+        ARSAL_Mutex_Unlock(&(filter->auBufferPoolMutex));
+        if ((!filter->currentAuItem) && (filter->recorder))
         {
-            ARSAL_Mutex_Unlock(&(filter->recordAuBufferPoolMutex));
+            ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_FILTER_TAG, "Failed to get free item in AU buffer pool");
+            ARSTREAM2_StreamRecorder_Flush(filter->recorder);
         }
     }
 
+    if (filter->currentAuItem)
+    {
+        filter->currentAuBuffer = filter->currentAuItem->buffer;
+        filter->currentAuBufferSize = filter->currentAuItem->bufferSize;
+    }
+    else
+    {
+        /* no pooled buffer: assemble in the temporary buffer, without recording */
+        filter->currentAuBuffer = filter->tempAuBuffer;
+        filter->currentAuBufferSize = filter->tempAuBufferSize;
+    }
+
     return ret;
 }
 
@@ -870,11 +885,8 @@ static void ARSTREAM2_H264Filter_resetCurrentAu(ARSTREAM2_H264Filter_t *filter)
     if (filter->currentAuIsRef) filter->previousAuFrameNum = filter->currentAuFrameNum;
     filter->currentAuFrameNum = -1;
     filter->currentAuIsRef = 0;
-    if (filter->recordAuBufferItem)
-    {
-        filter->recordAuBufferItem->auSize = 0;
-        filter->recordAuBufferItem->naluCount = 0;
-    }
+    filter->currentAuNaluCount = 0;
+    filter->currentAuNaluOverflow = 0;
 }
 
 
@@ -937,23 +949,148 @@ static void ARSTREAM2_H264Filter_updateCurrentAu(ARSTREAM2_H264Filter_t *filter,
 }
 
 
-static void ARSTREAM2_H264Filter_addNaluToCurrentAu(ARSTREAM2_H264Filter_t *filter, ARSTREAM2_H264Filter_H264NaluType_t naluType, uint8_t *naluBuffer, int naluSize)
+static void ARSTREAM2_H264Filter_addNaluSlice(ARSTREAM2_H264Filter_t *filter, uint8_t *naluBuffer, int naluSize, int isOutput)
 {
-    int filterOut = 0;
+    if (filter->currentAuNaluCount < ARSTREAM2_STREAM_RECORDER_NALU_MAX_COUNT)
+    {
+        filter->currentAuNaluData[filter->currentAuNaluCount] = naluBuffer;
+        filter->currentAuNaluSize[filter->currentAuNaluCount] = naluSize;
+        filter->currentAuNaluIsOutput[filter->currentAuNaluCount] = (uint8_t)isOutput;
+        filter->currentAuNaluCount++;
+    }
+    else
+    {
+        filter->currentAuNaluOverflow = 1;
+    }
+}
+
 
-    if ((filter->recorder) && (filter->recordAuBufferItem)
-            && (filter->recordAuBufferItem->auSize + naluSize <= filter->recordAuBufferItem->bufferSize))
+static void ARSTREAM2_H264Filter_restoreNaluSlices(ARSTREAM2_H264Filter_t *filter, uint32_t naluCount, const uint32_t *naluSize, const uint8_t *naluIsOutput, int naluOverflow)
+{
+    uint32_t i, offset;
+
+    /* the NAL units are back at the start of a possibly different buffer */
+    for (i = 0, offset = 0; i < naluCount; i++)
     {
-        memcpy(filter->recordAuBufferItem->buffer + filter->recordAuBufferItem->auSize, naluBuffer, naluSize);
-        if (filter->recordAuBufferItem->naluCount < ARSTREAM2_STREAM_RECORDER_NALU_MAX_COUNT)
+        filter->currentAuNaluData[i] = filter->currentAuBuffer + offset;
+        filter->currentAuNaluSize[i] = naluSize[i];
+        filter->currentAuNaluIsOutput[i] = naluIsOutput[i];
+        offset += naluSize[i];
+    }
+    filter->currentAuNaluCount = naluCount;
+    filter->currentAuNaluOverflow = naluOverflow;
+}
+
+
+static int ARSTREAM2_H264Filter_keepFilteredOutNalus(ARSTREAM2_H264Filter_t *filter)
+{
+    /* NAL units filtered out of the output are only kept in the buffer if they are recorded */
+    return ((filter->recorder) && (filter->currentAuItem)) ? 1 : 0;
+}
+
+
+static void ARSTREAM2_H264Filter_setCurrentAuStartCodes(ARSTREAM2_H264Filter_t *filter, int naluSizePrefix)
+{
+    uint32_t i;
+
+    for (i = 0; i < filter->currentAuNaluCount; i++)
+    {
+        if ((filter->currentAuNaluIsOutput[i]) && (filter->currentAuNaluSize[i] >= 4))
+        {
+            // Replace the NAL unit 4 bytes start code with the NALU size, or restore it
+            *((uint32_t*)filter->currentAuNaluData[i]) = (naluSizePrefix) ? htonl(filter->currentAuNaluSize[i] - 4) : htonl(0x00000001);
+        }
+    }
+}
+
+
+static uint8_t* ARSTREAM2_H264Filter_getContiguousCurrentAu(ARSTREAM2_H264Filter_t *filter, int *auSize)
+{
+    uint32_t i, first = 0, last = 0;
+    int found = 0;
+
+    if ((filter->currentAuNaluOverflow) || (filter->currentAuNaluCount == 0))
+    {
+        *auSize = filter->currentAuSize;
+        return filter->currentAuBuffer;
+    }
+
+    for (i = 0; i < filter->currentAuNaluCount; i++)
+    {
+        if (filter->currentAuNaluIsOutput[i])
+        {
+            if ((found) && (last != i - 1))
+            {
+                /* a filtered out NAL unit is in the way */
+                return NULL;
+            }
+            if (!found)
+            {
+                first = i;
+                found = 1;
+            }
+            last = i;
+        }
+    }
+
+    if (!found)
+    {
+        *auSize = 0;
+        return filter->currentAuBuffer;
+    }
+
+    *auSize = (int)(filter->currentAuNaluData[last] + filter->currentAuNaluSize[last] - filter->currentAuNaluData[first]);
+    return filter->currentAuNaluData[first];
+}
+
+
+static int ARSTREAM2_H264Filter_gatherCurrentAu(ARSTREAM2_H264Filter_t *filter, uint8_t *auBuffer, int auBufferSize)
+{
+    uint8_t *auData;
+    int auSize = 0;
+    uint32_t i;
+
+    auData = ARSTREAM2_H264Filter_getContiguousCurrentAu(filter, &auSize);
+    if (!auData)
+    {
+        for (i = 0, auSize = 0; i < filter->currentAuNaluCount; i++)
         {
-            filter->recordAuBufferItem->naluData[filter->recordAuBufferItem->naluCount] = filter->recordAuBufferItem->buffer + filter->recordAuBufferItem->auSize;
-            filter->recordAuBufferItem->naluSize[filter->recordAuBufferItem->naluCount] = naluSize;
-            filter->recordAuBufferItem->naluCount++;
+            if (filter->currentAuNaluIsOutput[i])
+            {
+                auSize += (int)filter->currentAuNaluSize[i];
+            }
         }
-        filter->recordAuBufferItem->auSize += naluSize;
     }
 
+    if (auSize > auBufferSize)
+    {
+        ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_FILTER_TAG, "Access unit does not fit in the output buffer (size %d, buffer size %d)", auSize, auBufferSize);
+        return -1;
+    }
+
+    if (auData)
+    {
+        memcpy(auBuffer, auData, auSize);
+        return auSize;
+    }
+
+    for (i = 0, auSize = 0; i < filter->currentAuNaluCount; i++)
+    {
+        if (filter->currentAuNaluIsOutput[i])
+        {
+            memcpy(auBuffer + auSize, filter->currentAuNaluData[i], filter->currentAuNaluSize[i]);
+            auSize += (int)filter->currentAuNaluSize[i];
+        }
+    }
+
+    return auSize;
+}
+
+
+static void ARSTREAM2_H264Filter_addNaluToCurrentAu(ARSTREAM2_H264Filter_t *filter, ARSTREAM2_H264Filter_H264NaluType_t naluType, uint8_t *naluBuffer, int naluSize)
+{
+    int filterOut = 0;
+
     if ((filter->filterOutSpsPps) && ((naluType == ARSTREAM2_H264_FILTER_H264_NALU_TYPE_SPS) || (naluType == ARSTREAM2_H264_FILTER_H264_NALU_TYPE_PPS)))
     {
         filterOut = 1;
@@ -964,14 +1101,9 @@ static void ARSTREAM2_H264Filter_addNaluToCurrentAu(ARSTREAM2_H264Filter_t *filt
         filterOut = 1;
     }
 
-    if (!filterOut)
+    if ((!filterOut) || (ARSTREAM2_H264Filter_keepFilteredOutNalus(filter)))
     {
-        if (filter->replaceStartCodesWithNaluSize)
-        {
-            // Replace the NAL unit 4 bytes start code with the NALU size
-            *((uint32_t*)naluBuffer) = htonl((uint32_t)naluSize - 4);
-        }
-
+        ARSTREAM2_H264Filter_addNaluSlice(filter, naluBuffer, naluSize, !filterOut);
         filter->currentAuSize += naluSize;
     }
 }
@@ -1028,7 +1160,13 @@ static int ARSTREAM2_H264Filter_enqueueCurrentAu(ARSTREAM2_H264Filter_t *filter)
         int auBufferSize = 0;
         void *auBufferUserPtr = NULL;
 
+        int auSize = 0;
+
         filter->callbackInProgress = 1;
+        if (filter->replaceStartCodesWithNaluSize)
+        {
+            ARSTREAM2_H264Filter_setCurrentAuStartCodes(filter, 1);
+        }
         if (filter->getAuBufferCallback)
         {
             /* call the getAuBufferCallback */
@@ -1037,11 +1175,32 @@ static int ARSTREAM2_H264Filter_enqueueCurrentAu(ARSTREAM2_H264Filter_t *filter)
             cbRet = filter->getAuBufferCallback(&auBuffer, &auBufferSize, &auBufferUserPtr, filter->getAuBufferCallbackUserPtr);
 
             ARSAL_Mutex_Lock(&(filter->mutex));
+
+            if ((cbRet == ARSTREAM2_OK) && (auBuffer) && (auBufferSize))
+            {
+                /* the consumer wants its own contiguous buffer */
+                auSize = ARSTREAM2_H264Filter_gatherCurrentAu(filter, auBuffer, auBufferSize);
+            }
+        }
+        else if (filter->auReadyCallback)
+        {
+            /* output the access unit in place, unless filtered out NAL units have to be skipped */
+            auBuffer = ARSTREAM2_H264Filter_getContiguousCurrentAu(filter, &auSize);
+            if (!auBuffer)
+            {
+                auBuffer = filter->tempAuBuffer;
+                auSize = ARSTREAM2_H264Filter_gatherCurrentAu(filter, filter->tempAuBuffer, filter->tempAuBufferSize);
+            }
+            auBufferSize = filter->currentAuBufferSize;
         }
 
-        if ((cbRet != ARSTREAM2_OK) || (!auBuffer) || (!auBufferSize))
+        if ((cbRet != ARSTREAM2_OK) || (!auBuffer) || (!auBufferSize) || (auSize < 0))
         {
             ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_FILTER_TAG, "getAuBufferCallback failed: %s", ARSTREAM2_Error_ToString(cbRet));
+            if (filter->replaceStartCodesWithNaluSize)
+            {
+                ARSTREAM2_H264Filter_setCurrentAuStartCodes(filter, 0);
+            }
             filter->callbackInProgress = 0;
             ARSAL_Mutex_Unlock(&(filter->mutex));
             ARSAL_Cond_Signal(&(filter->callbackCond));
@@ -1049,12 +1208,11 @@ static int ARSTREAM2_H264Filter_enqueueCurrentAu(ARSTREAM2_H264Filter_t *filter)
         }
         else
         {
-            int auSize = (filter->currentAuSize < auBufferSize) ? filter->currentAuSize : auBufferSize;
-            memcpy(auBuffer, filter->currentAuBuffer, auSize);
-
             ARSAL_Time_GetTime(&t1);
             curTime = (uint64_t)t1.tv_sec * 1000000 + (uint64_t)t1.tv_nsec / 1000;
 
+            ARSAL_Trace_Record(ARSAL_TRACE_STAGE_AU_COMPLETE, filter->currentAuTimestamp);
+
             if (filter->auReadyCallback)
             {
                 /* call the auReadyCallback */
@@ -1067,6 +1225,11 @@ static int ARSTREAM2_H264Filter_enqueueCurrentAu(ARSTREAM2_H264Filter_t *filter)
 
                 ARSAL_Mutex_Lock(&(filter->mutex));
             }
+            if (filter->replaceStartCodesWithNaluSize)
+            {
+                /* the recorder and the next access unit need the start codes back */
+                ARSTREAM2_H264Filter_setCurrentAuStartCodes(filter, 0);
+            }
             filter->callbackInProgress = 0;
             ARSAL_Mutex_Unlock(&(filter->mutex));
             ARSAL_Cond_Signal(&(filter->callbackCond));
@@ -1088,20 +1251,21 @@ static int ARSTREAM2_H264Filter_enqueueCurrentAu(ARSTREAM2_H264Filter_t *filter)
     }
 
     /* stream recording */
-    if ((ret == 1) && (filter->recorder) && (filter->recordAuBufferItem) && (filter->recordAuBufferItem->auSize > 0))
+    if ((ret == 1) && (filter->recorder) && (filter->currentAuItem) && (filter->currentAuSize > 0))
     {
         ARSTREAM2_StreamRecorder_AccessUnit_t accessUnit;
         memset(&accessUnit, 0, sizeof(ARSTREAM2_StreamRecorder_AccessUnit_t));
         accessUnit.timestamp = filter->currentAuTimestamp;
         accessUnit.index = filter->currentAuOutputIndex;
-        if (filter->recordAuBufferItem->naluCount > 0)
+        if ((filter->currentAuNaluCount > 0) && (!filter->currentAuNaluOverflow))
         {
-            accessUnit.naluCount = filter->recordAuBufferItem->naluCount;
+            /* the recorder references the NAL units in the access unit buffer */
+            accessUnit.naluCount = filter->currentAuNaluCount;
             unsigned int i;
-            for (i = 0; i < filter->recordAuBufferItem->naluCount; i++)
+            for (i = 0; i < filter->currentAuNaluCount; i++)
             {
-                accessUnit.naluData[i] = filter->recordAuBufferItem->naluData[i];
-                accessUnit.naluSize[i] = filter->recordAuBufferItem->naluSize[i];
+                accessUnit.naluData[i] = filter->currentAuNaluData[i];
+                accessUnit.naluSize[i] = filter->currentAuNaluSize[i];
             }
             accessUnit.auData = NULL;
             accessUnit.auSize = 0;
@@ -1109,14 +1273,14 @@ static int ARSTREAM2_H264Filter_enqueueCurrentAu(ARSTREAM2_H264Filter_t *filter)
         else
         {
             accessUnit.naluCount = 0;
-            accessUnit.auData = filter->recordAuBufferItem->buffer;
-            accessUnit.auSize = filter->recordAuBufferItem->auSize;
+            accessUnit.auData = filter->currentAuBuffer;
+            accessUnit.auSize = filter->currentAuSize;
         }
         accessUnit.auSyncType = filter->currentAuSyncType;
-        if ((filter->currentAuMetadataSize > 0) && ((unsigned)filter->currentAuMetadataSize <= filter->recordAuBufferItem->metadataBufferSize))
+        if ((filter->currentAuMetadataSize > 0) && ((unsigned)filter->currentAuMetadataSize <= filter->currentAuItem->metadataBufferSize))
         {
-            memcpy(filter->recordAuBufferItem->metadataBuffer, filter->currentAuMetadata, filter->currentAuMetadataSize);
-            accessUnit.auMetadata = filter->recordAuBufferItem->metadataBuffer;
+            memcpy(filter->currentAuItem->metadataBuffer, filter->currentAuMetadata, filter->currentAuMetadataSize);
+            accessUnit.auMetadata = filter->currentAuItem->metadataBuffer;
             accessUnit.auMetadataSize = filter->currentAuMetadataSize;
         }
         else
@@ -1124,17 +1288,17 @@ static int ARSTREAM2_H264Filter_enqueueCurrentAu(ARSTREAM2_H264Filter_t *filter)
             accessUnit.auMetadata = NULL;
             accessUnit.auMetadataSize = 0;
         }
-        accessUnit.auUserPtr = filter->recordAuBufferItem;
+        accessUnit.auUserPtr = filter->currentAuItem;
         eARSTREAM2_ERROR err;
+        ARSAL_Mutex_Lock(&(filter->auBufferPoolMutex));
+        filter->currentAuItem->refCount++;
+        ARSAL_Mutex_Unlock(&(filter->auBufferPoolMutex));
         err = ARSTREAM2_StreamRecorder_PushAccessUnit(filter->recorder, &accessUnit);
         if (err != ARSTREAM2_OK)
         {
             ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_FILTER_TAG, "ARSTREAM2_StreamRecorder_PushAccessUnit() failed: %d (%s)",
                         err, ARSTREAM2_Error_ToString(err));
-        }
-        else
-        {
-            filter->recordAuBufferItem->pushed = 1;
+            ARSTREAM2_H264Filter_AuBufferItemUnref(filter, filter->currentAuItem);
         }
     }
 
@@ -1285,7 +1449,6 @@ static int ARSTREAM2_H264Filter_generateGrayIFrame(ARSTREAM2_H264Filter_t *filte
         else
         {
             uint8_t *tmpBuf = NULL;
-            uint8_t *tmpBuf2 = NULL;
             int savedAuSize = filter->currentAuSize;
             int savedAuIncomplete = filter->currentAuIncomplete;
             eARSTREAM2_H264_FILTER_AU_SYNC_TYPE savedAuSyncType = filter->currentAuSyncType;
@@ -1301,21 +1464,14 @@ static int ARSTREAM2_H264Filter_generateGrayIFrame(ARSTREAM2_H264Filter_t *filte
             int savedAuIsRef = filter->currentAuIsRef;
             int savedAuFrameNum = filter->currentAuFrameNum;
             uint64_t savedAuFirstNaluInputTime = filter->currentAuFirstNaluInputTime;
-            unsigned int savedRecAuSize = 0;
-            uint32_t savedNaluCount = 0;
+            uint32_t savedNaluCount = filter->currentAuNaluCount;
+            int savedNaluOverflow = filter->currentAuNaluOverflow;
             uint32_t savedNaluSize[ARSTREAM2_STREAM_RECORDER_NALU_MAX_COUNT];
-            if (filter->recordAuBufferItem)
+            uint8_t savedNaluIsOutput[ARSTREAM2_STREAM_RECORDER_NALU_MAX_COUNT];
+            if (savedNaluCount > 0)
             {
-                savedRecAuSize = filter->recordAuBufferItem->auSize;
-                savedNaluCount = filter->recordAuBufferItem->naluCount;
-                if (savedNaluCount > 0)
-                {
-                    unsigned int i;
-                    for (i = 0; i < filter->recordAuBufferItem->naluCount; i++)
-                    {
-                        savedNaluSize[i] = filter->recordAuBufferItem->naluSize[i];
-                    }
-                }
+                memcpy(savedNaluSize, filter->currentAuNaluSize, savedNaluCount * sizeof(uint32_t));
+                memcpy(savedNaluIsOutput, filter->currentAuNaluIsOutput, savedNaluCount * sizeof(uint8_t));
             }
             ret = 0;
 
@@ -1329,14 +1485,6 @@ static int ARSTREAM2_H264Filter_generateGrayIFrame(ARSTREAM2_H264Filter_t *filte
                     memcpy(tmpBuf, filter->currentAuBuffer, filter->currentAuSize + naluSize);
                 }
             }
-            if ((filter->recorder) && (filter->recordAuBufferItem) && (filter->recordAuBufferItem->auSize > 0))
-            {
-                tmpBuf2 = malloc(filter->recordAuBufferItem->auSize); //TODO
-                if (tmpBuf2)
-                {
-                    memcpy(tmpBuf2, filter->recordAuBufferItem->buffer, filter->recordAuBufferItem->auSize);
-                }
-            }
 
             ARSTREAM2_H264Filter_resetCurrentAu(filter);
             filter->currentAuSyncType = ARSTREAM2_H264_FILTER_AU_SYNC_TYPE_IDR;
@@ -1347,28 +1495,12 @@ static int ARSTREAM2_H264Filter_generateGrayIFrame(ARSTREAM2_H264Filter_t *filte
             // Insert SPS+PPS before the I-frame
             if (ret == 0)
             {
-                if ((filter->recorder) && (filter->recordAuBufferItem)
-                        && (filter->recordAuBufferItem->auSize + filter->spsSize <= filter->recordAuBufferItem->bufferSize))
-                {
-                    memcpy(filter->recordAuBufferItem->buffer + filter->recordAuBufferItem->auSize, filter->pSps, filter->spsSize);
-                    if (filter->recordAuBufferItem->naluCount < ARSTREAM2_STREAM_RECORDER_NALU_MAX_COUNT)
-                    {
-                        filter->recordAuBufferItem->naluData[filter->recordAuBufferItem->naluCount] = filter->recordAuBufferItem->buffer + filter->recordAuBufferItem->auSize;
-                        filter->recordAuBufferItem->naluSize[filter->recordAuBufferItem->naluCount] = filter->spsSize;
-                        filter->recordAuBufferItem->naluCount++;
-                    }
-                    filter->recordAuBufferItem->auSize += filter->spsSize;
-                }
-                if (!filter->filterOutSpsPps)
+                if ((!filter->filterOutSpsPps) || (ARSTREAM2_H264Filter_keepFilteredOutNalus(filter)))
                 {
                     if (filter->currentAuSize + filter->spsSize <= filter->currentAuBufferSize)
                     {
                         memcpy(filter->currentAuBuffer + filter->currentAuSize, filter->pSps, filter->spsSize);
-                        if (filter->replaceStartCodesWithNaluSize)
-                        {
-                            // Replace the NAL unit 4 bytes start code with the NALU size
-                            *((uint32_t*)(filter->currentAuBuffer + filter->currentAuSize)) = htonl((uint32_t)filter->spsSize - 4);
-                        }
+                        ARSTREAM2_H264Filter_addNaluSlice(filter, filter->currentAuBuffer + filter->currentAuSize, filter->spsSize, !filter->filterOutSpsPps);
                         filter->currentAuSize += filter->spsSize;
                     }
                     else
@@ -1380,28 +1512,12 @@ static int ARSTREAM2_H264Filter_generateGrayIFrame(ARSTREAM2_H264Filter_t *filte
             }
             if (ret == 0)
             {
-                if ((filter->recorder) && (filter->recordAuBufferItem)
-                        && (filter->recordAuBufferItem->auSize + filter->ppsSize <= filter->recordAuBufferItem->bufferSize))
-                {
-                    memcpy(filter->recordAuBufferItem->buffer + filter->recordAuBufferItem->auSize, filter->pPps, filter->ppsSize);
-                    if (filter->recordAuBufferItem->naluCount < ARSTREAM2_STREAM_RECORDER_NALU_MAX_COUNT)
-                    {
-                        filter->recordAuBufferItem->naluData[filter->recordAuBufferItem->naluCount] = filter->recordAuBufferItem->buffer + filter->recordAuBufferItem->auSize;
-                        filter->recordAuBufferItem->naluSize[filter->recordAuBufferItem->naluCount] = filter->ppsSize;
-                        filter->recordAuBufferItem->naluCount++;
-                    }
-                    filter->recordAuBufferItem->auSize += filter->ppsSize;
-                }
-                if (!filter->filterOutSpsPps)
+                if ((!filter->filterOutSpsPps) || (ARSTREAM2_H264Filter_keepFilteredOutNalus(filter)))
                 {
                     if (filter->currentAuSize + filter->ppsSize <= filter->currentAuBufferSize)
                     {
                         memcpy(filter->currentAuBuffer + filter->currentAuSize, filter->pPps, filter->ppsSize);
-                        if (filter->replaceStartCodesWithNaluSize)
-                        {
-                            // Replace the NAL unit 4 bytes start code with the NALU size
-                            *((uint32_t*)(filter->currentAuBuffer + filter->currentAuSize)) = htonl((uint32_t)filter->spsSize - 4);
-                        }
+                        ARSTREAM2_H264Filter_addNaluSlice(filter, filter->currentAuBuffer + filter->currentAuSize, filter->ppsSize, !filter->filterOutSpsPps);
                         filter->currentAuSize += filter->ppsSize;
                     }
                     else
@@ -1415,26 +1531,10 @@ static int ARSTREAM2_H264Filter_generateGrayIFrame(ARSTREAM2_H264Filter_t *filte
             // Copy the gray I-frame
             if (ret == 0)
             {
-                if ((filter->recorder) && (filter->recordAuBufferItem)
-                        && (filter->recordAuBufferItem->auSize + outputSize <= filter->recordAuBufferItem->bufferSize))
-                {
-                    memcpy(filter->recordAuBufferItem->buffer + filter->recordAuBufferItem->auSize, filter->tempSliceNaluBuffer, outputSize);
-                    if (filter->recordAuBufferItem->naluCount < ARSTREAM2_STREAM_RECORDER_NALU_MAX_COUNT)
-                    {
-                        filter->recordAuBufferItem->naluData[filter->recordAuBufferItem->naluCount] = filter->recordAuBufferItem->buffer + filter->recordAuBufferItem->auSize;
-                        filter->recordAuBufferItem->naluSize[filter->recordAuBufferItem->naluCount] = outputSize;
-                        filter->recordAuBufferItem->naluCount++;
-                    }
-                    filter->recordAuBufferItem->auSize += outputSize;
-                }
                 if (filter->currentAuSize + (int)outputSize <= filter->currentAuBufferSize)
                 {
-                    if (filter->replaceStartCodesWithNaluSize)
-                    {
-                        // Replace the NAL unit 4 bytes start code with the NALU size
-                        *((uint32_t*)filter->tempSliceNaluBuffer) = htonl((uint32_t)outputSize - 4);
-                    }
                     memcpy(filter->currentAuBuffer + filter->currentAuSize, filter->tempSliceNaluBuffer, outputSize);
+                    ARSTREAM2_H264Filter_addNaluSlice(filter, filter->currentAuBuffer + filter->currentAuSize, outputSize, 1);
                     filter->currentAuSize += outputSize;
                 }
                 else
@@ -1476,30 +1576,11 @@ static int ARSTREAM2_H264Filter_generateGrayIFrame(ARSTREAM2_H264Filter_t *filte
                         filter->currentAuCurrentSliceFirstMb = savedAuCurrentSliceFirstMb;
                         filter->currentAuIsRef = savedAuIsRef;
                         filter->currentAuFrameNum = savedAuFrameNum;
-                        if (filter->recordAuBufferItem)
-                        {
-                            filter->recordAuBufferItem->auSize = savedRecAuSize;
-                            filter->recordAuBufferItem->naluCount = savedNaluCount;
-                            if (savedNaluCount > 0)
-                            {
-                                unsigned int i, offset;
-                                for (i = 0, offset = 0; i < filter->recordAuBufferItem->naluCount; i++)
-                                {
-                                    filter->recordAuBufferItem->naluData[i] = filter->recordAuBufferItem->buffer + offset;
-                                    filter->recordAuBufferItem->naluSize[i] = savedNaluSize[i];
-                                    offset += savedNaluSize[i];
-                                }
-                            }
-                        }
-
                         if (tmpBuf)
                         {
                             memcpy(filter->currentAuBuffer, tmpBuf, savedAuSize + naluSize);
                         }
-                        if ((filter->recorder) && (filter->recordAuBufferItem) && (savedRecAuSize > 0) && (tmpBuf2))
-                        {
-                            memcpy(filter->recordAuBufferItem->buffer, tmpBuf2, savedRecAuSize);
-                        }
+                        ARSTREAM2_H264Filter_restoreNaluSlices(filter, savedNaluCount, savedNaluSize, savedNaluIsOutput, savedNaluOverflow);
 
                         filter->currentNaluBuffer = filter->currentAuBuffer + filter->currentAuSize;
                         filter->currentNaluBufferSize = filter->currentAuBufferSize - filter->currentAuSize;
@@ -1529,35 +1610,15 @@ static int ARSTREAM2_H264Filter_generateGrayIFrame(ARSTREAM2_H264Filter_t *filte
                     filter->currentAuCurrentSliceFirstMb = savedAuCurrentSliceFirstMb;
                     filter->currentAuIsRef = savedAuIsRef;
                     filter->currentAuFrameNum = savedAuFrameNum;
-                    if (filter->recordAuBufferItem)
-                    {
-                        filter->recordAuBufferItem->auSize = savedRecAuSize;
-                        filter->recordAuBufferItem->naluCount = savedNaluCount;
-                        if (savedNaluCount > 0)
-                        {
-                            unsigned int i, offset;
-                            for (i = 0, offset = 0; i < filter->recordAuBufferItem->naluCount; i++)
-                            {
-                                filter->recordAuBufferItem->naluData[i] = filter->recordAuBufferItem->buffer + offset;
-                                filter->recordAuBufferItem->naluSize[i] = savedNaluSize[i];
-                                offset += savedNaluSize[i];
-                            }
-                        }
-                    }
-
                     if (tmpBuf)
                     {
                         memcpy(filter->currentAuBuffer, tmpBuf, savedAuSize + naluSize);
                     }
-                    if ((filter->recorder) && (filter->recordAuBufferItem) && (savedRecAuSize > 0) && (tmpBuf2))
-                    {
-                        memcpy(filter->recordAuBufferItem->buffer, tmpBuf2, savedRecAuSize);
-                    }
+                    ARSTREAM2_H264Filter_restoreNaluSlices(filter, savedNaluCount, savedNaluSize, savedNaluIsOutput, savedNaluOverflow);
                 }
             }
 
             if (tmpBuf) free(tmpBuf);
-            if (tmpBuf2) free(tmpBuf2);
         }
     }
 
@@ -1733,27 +1794,11 @@ static int ARSTREAM2_H264Filter_fillMissingSlices(ARSTREAM2_H264Filter_t *filter
             else
             {
                 ARSAL_PRINT(ARSAL_PRINT_WARNING, ARSTREAM2_H264_FILTER_TAG, "#%d AUTS:%llu Skipped P slice NALU output size: %d", filter->currentAuOutputIndex, auTimestamp, outputSize); //TODO: debug
-                if ((filter->recorder) && (filter->recordAuBufferItem)
-                        && (filter->recordAuBufferItem->auSize + outputSize <= filter->recordAuBufferItem->bufferSize))
-                {
-                    memcpy(filter->recordAuBufferItem->buffer + filter->recordAuBufferItem->auSize, filter->tempSliceNaluBuffer, outputSize);
-                    if (filter->recordAuBufferItem->naluCount < ARSTREAM2_STREAM_RECORDER_NALU_MAX_COUNT)
-                    {
-                        filter->recordAuBufferItem->naluData[filter->recordAuBufferItem->naluCount] = filter->recordAuBufferItem->buffer + filter->recordAuBufferItem->auSize;
-                        filter->recordAuBufferItem->naluSize[filter->recordAuBufferItem->naluCount] = outputSize;
-                        filter->recordAuBufferItem->naluCount++;
-                    }
-                    filter->recordAuBufferItem->auSize += outputSize;
-                }
                 if (filter->currentAuSize + naluSize + (int)outputSize <= filter->currentAuBufferSize)
                 {
-                    if (filter->replaceStartCodesWithNaluSize)
-                    {
-                        // Replace the NAL unit 4 bytes start code with the NALU size
-                        *((uint32_t*)filter->tempSliceNaluBuffer) = htonl((uint32_t)outputSize - 4);
-                    }
                     memmove(naluBuffer + outputSize, naluBuffer, naluSize); //TODO
                     memcpy(naluBuffer, filter->tempSliceNaluBuffer, outputSize);
+                    ARSTREAM2_H264Filter_addNaluSlice(filter, naluBuffer, outputSize, 1);
                     filter->currentAuSize += outputSize;
                     if (offset) *offset = outputSize;
                     if (filter->currentAuMacroblockStatus)
@@ -1908,26 +1953,10 @@ static int ARSTREAM2_H264Filter_fillMissingEndOfFrame(ARSTREAM2_H264Filter_t *fi
             else
             {
                 ARSAL_PRINT(ARSAL_PRINT_WARNING, ARSTREAM2_H264_FILTER_TAG, "#%d AUTS:%llu Skipped P slice NALU output size: %d", filter->currentAuOutputIndex, auTimestamp, outputSize); //TODO: debug
-                if ((filter->recorder) && (filter->recordAuBufferItem)
-                        && (filter->recordAuBufferItem->auSize + outputSize <= filter->recordAuBufferItem->bufferSize))
-                {
-                    memcpy(filter->recordAuBufferItem->buffer + filter->recordAuBufferItem->auSize, filter->tempSliceNaluBuffer, outputSize);
-                    if (filter->recordAuBufferItem->naluCount < ARSTREAM2_STREAM_RECORDER_NALU_MAX_COUNT)
-                    {
-                        filter->recordAuBufferItem->naluData[filter->recordAuBufferItem->naluCount] = filter->recordAuBufferItem->buffer + filter->recordAuBufferItem->auSize;
-                        filter->recordAuBufferItem->naluSize[filter->recordAuBufferItem->naluCount] = outputSize;
-                        filter->recordAuBufferItem->naluCount++;
-                    }
-                    filter->recordAuBufferItem->auSize += outputSize;
-                }
                 if (filter->currentAuSize + (int)outputSize <= filter->currentAuBufferSize)
                 {
-                    if (filter->replaceStartCodesWithNaluSize)
-                    {
-                        // Replace the NAL unit 4 bytes start code with the NALU size
-                        *((uint32_t*)filter->tempSliceNaluBuffer) = htonl((uint32_t)outputSize - 4);
-                    }
                     memcpy(filter->currentAuBuffer + filter->currentAuSize, filter->tempSliceNaluBuffer, outputSize);
+                    ARSTREAM2_H264Filter_addNaluSlice(filter, filter->currentAuBuffer + filter->currentAuSize, outputSize, 1);
                     filter->currentAuSize += outputSize;
                     if (filter->currentAuMacroblockStatus)
                     {
@@ -2176,6 +2205,10 @@ uint8_t* ARSTREAM2_H264Filter_RtpReceiverNaluCallback(eARSTREAM2_RTP_RECEIVER_CA
             ret = 1;
             if ((filter->currentAuBuffer) && (filter->currentAuSize > 0))
             {
+                // The NALU did not fit in the rest of the buffer: the access unit is missing data
+                ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_FILTER_TAG, "Access unit buffer is too small (access unit size %d, buffer size %d), the access unit is incomplete", filter->currentAuSize, filter->currentAuBufferSize);
+                filter->currentAuIncomplete = 1;
+
                 // Output the access unit
                 ret = ARSTREAM2_H264Filter_enqueueCurrentAu(filter);
             }
@@ -2438,11 +2471,6 @@ eARSTREAM2_ERROR ARSTREAM2_H264Filter_Start(ARSTREAM2_H264Filter_Handle filterHa
     {
         return ARSTREAM2_ERROR_BAD_PARAMETERS;
     }
-    if (!getAuBufferCallback)
-    {
-        ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_FILTER_TAG, "Invalid getAuBufferCallback function pointer");
-        return ARSTREAM2_ERROR_BAD_PARAMETERS;
-    }
     if (!auReadyCallback)
     {
         ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_FILTER_TAG, "Invalid auReadyCallback function pointer");
@@ -2527,7 +2555,7 @@ eARSTREAM2_ERROR ARSTREAM2_H264Filter_Init(ARSTREAM2_H264Filter_Handle *filterHa
 {
     ARSTREAM2_H264Filter_t* filter;
     eARSTREAM2_ERROR ret = ARSTREAM2_OK;
-    int mutexWasInit = 0, startCondWasInit = 0, callbackCondWasInit = 0, recordAuBufferPoolMutexWasInit = 0;
+    int mutexWasInit = 0, startCondWasInit = 0, callbackCondWasInit = 0, auBufferPoolMutexWasInit = 0;
 
     if (!filterHandle)
     {
@@ -2615,7 +2643,7 @@ eARSTREAM2_ERROR ARSTREAM2_H264Filter_Init(ARSTREAM2_H264Filter_Handle *filterHa
     }
     if (ret == ARSTREAM2_OK)
     {
-        int mutexInitRet = ARSAL_Mutex_Init(&(filter->recordAuBufferPoolMutex));
+        int mutexInitRet = ARSAL_Mutex_Init(&(filter->auBufferPoolMutex));
         if (mutexInitRet != 0)
         {
             ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_FILTER_TAG, "Mutex creation failed (%d)", mutexInitRet);
@@ -2623,13 +2651,13 @@ eARSTREAM2_ERROR ARSTREAM2_H264Filter_Init(ARSTREAM2_H264Filter_Handle *filterHa
         }
         else
         {
-            recordAuBufferPoolMutexWasInit = 1;
+            auBufferPoolMutexWasInit = 1;
         }
     }
 
     if (ret == ARSTREAM2_OK)
     {
-        int poolRet = ARSTREAM2_H264Filter_AuBufferPoolInit(&filter->recordAuBufferPool, ARSTREAM2_H264_FILTER_AU_BUFFER_POOL_SIZE,
+        int poolRet = ARSTREAM2_H264Filter_AuBufferPoolInit(&filter->auBufferPool, ARSTREAM2_H264_FILTER_AU_BUFFER_POOL_SIZE,
                                                             ARSTREAM2_H264_FILTER_AU_BUFFER_SIZE, ARSTREAM2_H264_FILTER_AU_METADATA_BUFFER_SIZE);
         if (poolRet != 0)
         {
@@ -2790,8 +2818,8 @@ eARSTREAM2_ERROR ARSTREAM2_H264Filter_Init(ARSTREAM2_H264Filter_Handle *filterHa
             if (mutexWasInit) ARSAL_Mutex_Destroy(&(filter->mutex));
             if (startCondWasInit) ARSAL_Cond_Destroy(&(filter->startCond));
             if (callbackCondWasInit) ARSAL_Cond_Destroy(&(filter->callbackCond));
-            if (recordAuBufferPoolMutexWasInit) ARSAL_Mutex_Destroy(&(filter->recordAuBufferPoolMutex));
-            if (filter->recordAuBufferPool.size != 0) ARSTREAM2_H264Filter_AuBufferPoolFree(&filter->recordAuBufferPool);
+            if (auBufferPoolMutexWasInit) ARSAL_Mutex_Destroy(&(filter->auBufferPoolMutex));
+            if (filter->auBufferPool.size != 0) ARSTREAM2_H264Filter_AuBufferPoolFree(&filter->auBufferPool);
             if (filter->parser) ARSTREAM2_H264Parser_Free(filter->parser);
             if (filter->tempAuBuffer) free(filter->tempAuBuffer);
             if (filter->tempSliceNaluBuffer) free(filter->tempSliceNaluBuffer);
@@ -2834,8 +2862,8 @@ eARSTREAM2_ERROR ARSTREAM2_H264Filter_Free(ARSTREAM2_H264Filter_Handle *filterHa
         ARSAL_Mutex_Destroy(&(filter->mutex));
         ARSAL_Cond_Destroy(&(filter->startCond));
         ARSAL_Cond_Destroy(&(filter->callbackCond));
-        ARSAL_Mutex_Destroy(&(filter->recordAuBufferPoolMutex));
-        ARSTREAM2_H264Filter_AuBufferPoolFree(&filter->recordAuBufferPool);
+        ARSAL_Mutex_Destroy(&(filter->auBufferPoolMutex));
+        ARSTREAM2_H264Filter_AuBufferPoolFree(&filter->auBufferPool);
         ARSTREAM2_H264Parser_Free(filter->parser);
         ARSTREAM2_H264Writer_Free(filter->writer);
         int recErr = ARSTREAM2_H264Filter_StreamRecorderFree(filter);
@@ -10,16 +10,35 @@
 #include <stdint.h>
 #include <string.h>
 #include <math.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
 
 #include <libARSAL/ARSAL_Print.h>
 
 #include <libARStream2/arstream2_h264_parser.h>
 #include "arstream2_h264.h"
 
+#ifdef _WIN32
+#include <windows.h>
+#include <io.h>
+#define ARSTREAM2_H264_PARSER_FTELL(fp) _ftelli64(fp)
+#define ARSTREAM2_H264_PARSER_FSEEK(fp, offset) _fseeki64((fp), (offset), SEEK_SET)
+#else
+#include <sys/mman.h>
+#define ARSTREAM2_H264_PARSER_FTELL(fp) ftello(fp)
+#define ARSTREAM2_H264_PARSER_FSEEK(fp, offset) fseeko((fp), (offset), SEEK_SET)
+#endif
+
 
 #define ARSTREAM2_H264_PARSER_TAG "ARSTREAM2_H264Parser"
 
 #define ARSTREAM2_H264_PARSER_MAX_USER_DATA_SEI_COUNT (16)
+#define ARSTREAM2_H264_PARSER_RBSP_CHUNK_SIZE (64)
+#define ARSTREAM2_H264_PARSER_MAP_WINDOW_SIZE (64 * 1024 * 1024)
+#define ARSTREAM2_H264_PARSER_MAP_ALIGNMENT (64 * 1024)
 #define log2(x) (log(x) / log(2)) //TODO
 
 
@@ -35,10 +54,29 @@ typedef struct ARSTREAM2_H264Parser_s
     unsigned int naluSize;      // in bytes
     unsigned int remNaluSize;   // in bytes
     
+    // File mapping, identified by the path, size and modification time of the file it was opened from
+    // (pNaluBuf is then only used if the file cannot be mapped)
+    char* mapPath;
+    unsigned long long mapFileSize;
+    long long mapFileTime;
+    FILE* mapFile;
+    int mapFailed;
+    uint8_t* pMapView;
+    unsigned long long mapViewOffset;
+    size_t mapViewSize;
+#ifdef _WIN32
+    HANDLE mapHandle;
+#endif
+
+    // RBSP chunk (NALU bytes with the emulation prevention bytes removed)
+    uint8_t rbspBuf[ARSTREAM2_H264_PARSER_RBSP_CHUNK_SIZE];
+    unsigned int rbspSize;      // in bytes
+    unsigned int rbspPos;       // in bytes
+    int zeroCount;              // zero bytes at the end of the last unescaped chunk
+
     // Bitstream cache
-    uint32_t cache;
+    uint64_t cache;
     int cacheLength;   // in bits
-    int oldZeroCount;
 
     // SPS/PPS context
     ARSTREAM2_H264_SpsContext_t spsContext;
@@ -165,230 +203,219 @@ static int ARSTREAM2_H264Parser_picStructToNumClockTS[16] =
 { 1, 1, 1, 2, 2, 3, 3, 2, 3, 0, 0, 0, 0, 0, 0, 0};
 
 
-static inline int bitstreamByteAlign(ARSTREAM2_H264Parser_t* _parser)
+static inline int countLeadingZeros64(uint64_t _v)
 {
-    int _align = 0;
+#if defined(_MSC_VER)
+    unsigned long _index;
 
-    if (_parser->cacheLength & 7)
+    if (_BitScanReverse(&_index, (unsigned long)(_v >> 32)))
     {
-        _align = _parser->cacheLength & 7;
-        _parser->cache <<= _align;
-        _parser->cacheLength -= _align;
+        return 31 - (int)_index;
+    }
+    if (_BitScanReverse(&_index, (unsigned long)_v))
+    {
+        return 63 - (int)_index;
     }
+    return 64;
+#else
+    return (_v) ? __builtin_clzll(_v) : 64;
+#endif
+}
 
-    return _align;
+
+static inline void bitstreamReset(ARSTREAM2_H264Parser_t* _parser)
+{
+    _parser->cache = 0;
+    _parser->cacheLength = 0;
+    _parser->rbspSize = 0;
+    _parser->rbspPos = 0;
+    _parser->zeroCount = 0;
 }
 
 
-static inline int readBits(ARSTREAM2_H264Parser_t* _parser, unsigned int _numBits, uint32_t *_value, int _emulationPrevention)
+static void bitstreamUnescape(ARSTREAM2_H264Parser_t* _parser)
 {
-    unsigned int _count, _remBits = _numBits;
-    uint32_t _val = 0, _bitMask;
-    uint8_t _read8;
+    const uint8_t *_start = _parser->pNaluBufCur, *_src = _start, *_end, *_p;
+    unsigned int _size = 0, _chunkSize;
+    int _zeros;
 
-    while (_parser->cacheLength < (int)_remBits)
-    {
-        // Not enough bits in the cache
+    // Unescape at most one chunk; the output is never larger than the input
+    _chunkSize = (_parser->remNaluSize > ARSTREAM2_H264_PARSER_RBSP_CHUNK_SIZE) ? ARSTREAM2_H264_PARSER_RBSP_CHUNK_SIZE : _parser->remNaluSize;
+    _end = _start + _chunkSize;
 
-        if (_parser->remNaluSize == 0)
+    while (_src < _end)
+    {
+        // Copy up to the next 0x03 byte
+        _p = (const uint8_t*)memchr(_src, 0x03, _end - _src);
+        if (!_p)
         {
-            // No more bytes to read
-            return -1;
+            _p = _end;
         }
-
-        // Get the cache remaining bits
-        _remBits -= _parser->cacheLength;
-        _val = (_parser->cache >> (32 - _parser->cacheLength)) << _remBits;
-
-        // Read at most 4 bytes in the buffer
-        _parser->cache = 0;
-        _parser->cacheLength = 0;
-        _count = 0;
-        while ((_parser->remNaluSize) && (_count < 4))
+        memcpy(_parser->rbspBuf + _size, _src, _p - _src);
+        _size += (unsigned int)(_p - _src);
+        if (_p == _end)
         {
-            _read8 = *(_parser->pNaluBufCur++);
-            _parser->remNaluSize--;
-            _parser->cache |= (_read8 << (24 - _parser->cacheLength));
-            _parser->cacheLength += 8;
-            _count++;
+            break;
         }
 
-        // Emulation prevention
-        if (_emulationPrevention)
+        // The 0x03 byte is an emulation prevention byte if it follows exactly two zero bytes
+        for (_zeros = 0; (_zeros < 3) && (_p - _zeros > _start) && (_p[-_zeros - 1] == 0x00); _zeros++);
+        if ((_zeros < 3) && (_p - _zeros == _start))
         {
-            int _zeroCount = _parser->oldZeroCount;
-            int _bitPos = 24; //32 - _parser->cacheLength;
-            uint8_t _byteVal;
-            uint32_t _cacheLeft, _cacheRight;
+            _zeros += _parser->zeroCount;
+        }
+        if (_zeros != 2)
+        {
+            _parser->rbspBuf[_size++] = 0x03;
+        }
+        _src = _p + 1;
+    }
+
+    // Zero bytes ending the chunk count for the next one
+    for (_zeros = 0; (_zeros < 3) && (_end - _zeros > _start) && (_end[-_zeros - 1] == 0x00); _zeros++);
+    if ((_zeros < 3) && (_end - _zeros == _start))
+    {
+        _zeros += _parser->zeroCount;
+    }
+    _parser->zeroCount = (_zeros < 3) ? _zeros : 3;
+
+    _parser->pNaluBufCur += _chunkSize;
+    _parser->remNaluSize -= _chunkSize;
+    _parser->rbspSize = _size;
+    _parser->rbspPos = 0;
+}
 
-            while (_bitPos >= 32 - _parser->cacheLength)
+
+static inline void bitstreamRefill(ARSTREAM2_H264Parser_t* _parser)
+{
+    while (_parser->cacheLength <= 56)
+    {
+        if (_parser->rbspPos == _parser->rbspSize)
+        {
+            if (_parser->remNaluSize == 0)
             {
-                _byteVal = ((_parser->cache >> _bitPos) & 0xFF);
-                if ((_zeroCount == 2) && (_byteVal == 0x03))
-                {
-                    // Remove the 0x03 byte
-                    _cacheLeft = (_bitPos < 24) ? (_parser->cache >> (_bitPos + 8)) << (_bitPos + 8) : 0;
-                    _cacheRight = (_bitPos > 0) ? (_parser->cache << (32 - _bitPos)) >> (32 - _bitPos - 8) : 0;
-                    _parser->cache = _cacheLeft | _cacheRight;
-                    _parser->cacheLength -= 8;
-                    _zeroCount = 0;
-                }
-                else if (_byteVal == 0x00)
-                {
-                    _zeroCount++;
-                    _bitPos -= 8;
-                }
-                else
-                {
-                    _zeroCount = 0;
-                    _bitPos -= 8;
-                }
+                // No more bytes to read
+                break;
             }
-            _parser->oldZeroCount = _zeroCount;
+            bitstreamUnescape(_parser);
+            continue;
         }
+
+        _parser->cache |= (uint64_t)_parser->rbspBuf[_parser->rbspPos++] << (56 - _parser->cacheLength);
+        _parser->cacheLength += 8;
     }
+}
 
-    // Get the bits from the cache and shift
-    _val |= _parser->cache >> (32 - _remBits);
-    _parser->cache <<= _remBits;
-    _parser->cacheLength -= _remBits;
 
-    _bitMask = (uint32_t)-1 >> (32 - _numBits);
-    if (_value) *_value = _val & _bitMask;
-    return _numBits;
+static inline int bitstreamByteAlign(ARSTREAM2_H264Parser_t* _parser)
+{
+    int _align = 0;
+
+    if (_parser->cacheLength & 7)
+    {
+        _align = _parser->cacheLength & 7;
+        _parser->cache <<= _align;
+        _parser->cacheLength -= _align;
+    }
+
+    return _align;
 }
 
 
-static inline int peekBits(ARSTREAM2_H264Parser_t* _parser, unsigned int _numBits, uint32_t *_value, int _emulationPrevention)
+static inline int readBits(ARSTREAM2_H264Parser_t* _parser, unsigned int _numBits, uint32_t *_value)
 {
-    unsigned int _count, _remBits = _numBits;
-    uint32_t _val = 0, _bitMask;
-    uint8_t _read8;
-    int _cacheLength = _parser->cacheLength;
-    int _remNaluSize = _parser->remNaluSize;
-    int _oldZeroCount = _parser->oldZeroCount;
-    int _offset = 0;
-    uint32_t _cache = _parser->cache;
+    uint32_t _val = 0;
 
-    while (_cacheLength < (int)_remBits)
+    if (_numBits > 32)
     {
-        // Not enough bits in the cache
+        return -1;
+    }
 
-        if (_remNaluSize == 0)
+    if (_parser->cacheLength < (int)_numBits)
+    {
+        bitstreamRefill(_parser);
+        if (_parser->cacheLength < (int)_numBits)
         {
-            // No more bytes to read
+            // Not enough bits available
             return -1;
         }
+    }
 
-        // Get the cache remaining bits
-        _remBits -= _cacheLength;
-        _val = (_cache >> (32 - _cacheLength)) << _remBits;
+    if (_numBits)
+    {
+        // Get the bits from the cache and shift
+        _val = (uint32_t)(_parser->cache >> (64 - _numBits));
+        _parser->cache <<= _numBits;
+        _parser->cacheLength -= _numBits;
+    }
 
-        // Read at most 4 bytes in the buffer
-        _cache = 0;
-        _cacheLength = 0;
-        _count = 0;
-        while ((_remNaluSize) && (_count < 4))
-        {
-            _read8 = *(_parser->pNaluBufCur + _offset);
-            _offset++;
-            _remNaluSize--;
-            _cache |= (_read8 << (24 - _cacheLength));
-            _cacheLength += 8;
-            _count++;
-        }
+    if (_value) *_value = _val;
+    return _numBits;
+}
 
-        // Emulation prevention
-        if (_emulationPrevention)
-        {
-            int _zeroCount = _oldZeroCount;
-            int _bitPos = 24; //32 - _cacheLength;
-            uint8_t _byteVal;
-            uint32_t _cacheLeft, _cacheRight;
 
-            while (_bitPos >= 32 - _cacheLength)
-            {
-                _byteVal = ((_cache >> _bitPos) & 0xFF);
-                if ((_zeroCount == 2) && (_byteVal == 0x03))
-                {
-                    // Remove the 0x03 byte
-                    _cacheLeft = (_bitPos < 24) ? (_cache >> (_bitPos + 8)) << (_bitPos + 8) : 0;
-                    _cacheRight = (_bitPos > 0) ? (_cache << (32 - _bitPos)) >> (32 - _bitPos - 8) : 0;
-                    _cache = _cacheLeft | _cacheRight;
-                    _cacheLength -= 8;
-                    _zeroCount = 0;
-                }
-                else if (_byteVal == 0x00)
-                {
-                    _zeroCount++;
-                    _bitPos -= 8;
-                }
-                else
-                {
-                    _zeroCount = 0;
-                    _bitPos -= 8;
-                }
-            }
-            _oldZeroCount = _zeroCount;
+static inline int peekBits(ARSTREAM2_H264Parser_t* _parser, unsigned int _numBits, uint32_t *_value)
+{
+    if (_parser->cacheLength < (int)_numBits)
+    {
+        bitstreamRefill(_parser);
+        if (_parser->cacheLength < (int)_numBits)
+        {
+            // Not enough bits available
+            return -1;
         }
     }
 
-    // Get the bits from the cache and shift
-    _val |= _cache >> (32 - _remBits);
-    _cache <<= _remBits;
-    _cacheLength -= _remBits;
-
-    _bitMask = (uint32_t)-1 >> (32 - _numBits);
-    if (_value) *_value = _val & _bitMask;
+    if (_value) *_value = (_numBits) ? (uint32_t)(_parser->cache >> (64 - _numBits)) : 0;
     return _numBits;
 }
 
 
-static inline int readBits_expGolomb_ue(ARSTREAM2_H264Parser_t* _parser, uint32_t *_value, int _emulationPrevention)
+static inline int readBits_expGolomb_ue(ARSTREAM2_H264Parser_t* _parser, uint32_t *_value)
 {
-    int _ret, _leadingZeroBits = -1;
-    uint32_t _b, _val;
+    int _ret, _leadingZeroBits, _codeLength;
+    uint32_t _b;
 
-    for (_b = 0; !_b; _leadingZeroBits++)
+    bitstreamRefill(_parser);
+
+    // The cache bits past cacheLength are zero, so this also catches a truncated code
+    _leadingZeroBits = countLeadingZeros64(_parser->cache);
+    if ((_leadingZeroBits > 31) || (_leadingZeroBits >= _parser->cacheLength))
     {
-        _ret = readBits(_parser, 1, &_b, _emulationPrevention);
-        if (_ret != 1) return -1;
+        return -1;
     }
 
-    _b = 0;
-    if (_leadingZeroBits)
+    _codeLength = _leadingZeroBits * 2 + 1;
+    if (_codeLength <= _parser->cacheLength)
     {
-        _ret = readBits(_parser, _leadingZeroBits, &_b, _emulationPrevention);
+        // The whole code is in the cache: its value plus one is the code itself
+        *_value = (uint32_t)((_parser->cache >> (64 - _codeLength)) - 1);
+        _parser->cache <<= _codeLength;
+        _parser->cacheLength -= _codeLength;
+    }
+    else
+    {
+        _parser->cache <<= _leadingZeroBits + 1;
+        _parser->cacheLength -= _leadingZeroBits + 1;
+        _ret = readBits(_parser, _leadingZeroBits, &_b);
         if (_ret < 0) return -1;
+        *_value = ((uint32_t)1 << _leadingZeroBits) - 1 + _b;
     }
 
-    _val = (1 << _leadingZeroBits) - 1 + _b;
-    *_value = _val;
-    return _leadingZeroBits * 2 + 1;
+    return _codeLength;
 }
 
 
-static inline int readBits_expGolomb_se(ARSTREAM2_H264Parser_t* _parser, int32_t *_value, int _emulationPrevention)
+static inline int readBits_expGolomb_se(ARSTREAM2_H264Parser_t* _parser, int32_t *_value)
 {
-    int _ret, _leadingZeroBits = -1;
-    uint32_t _b, _val;
-
-    for (_b = 0; !_b; _leadingZeroBits++)
-    {
-        _ret = readBits(_parser, 1, &_b, _emulationPrevention);
-        if (_ret != 1) return -1;
-    }
+    int _ret;
+    uint32_t _val;
 
-    _b = 0;
-    if (_leadingZeroBits)
-    {
-        _ret = readBits(_parser, _leadingZeroBits, &_b, _emulationPrevention);
-        if (_ret < 0) return -1;
-    }
+    _ret = readBits_expGolomb_ue(_parser, &_val);
+    if (_ret < 0) return -1;
 
-    _val = (1 << _leadingZeroBits) - 1 + _b;
     *_value = (_val & 1) ? (((int32_t)_val + 1) / 2) : (-((int32_t)_val + 1) / 2);
-    return _leadingZeroBits * 2 + 1;
+    return _ret;
 }
 
 
@@ -399,7 +426,7 @@ static inline int skipBytes(ARSTREAM2_H264Parser_t* _parser, int _byteCount)
 
     for (_i = 0; _i < _byteCount; _i++)
     {
-        _ret = readBits(_parser, 8, &_val, 1);
+        _ret = readBits(_parser, 8, &_val);
         if (_ret < 0)
         {
             ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -416,13 +443,14 @@ static inline int moreRbspData(ARSTREAM2_H264Parser_t* _parser)
 {
     int _ret, _retval = 0;
     uint32_t _val;
+    int _remaining = _parser->cacheLength + (_parser->rbspSize - _parser->rbspPos) * 8 + _parser->remNaluSize * 8;
 
-    if ((_parser->cacheLength == 0) && (_parser->remNaluSize == 0))
+    if (_remaining == 0)
     {
         // No more bits available
         _retval = 0;
     }
-    else if (_parser->cacheLength + _parser->remNaluSize * 8 > 8)
+    else if (_remaining > 8)
     {
         // More than 1 byte remaining
         _retval = 1;
@@ -430,10 +458,9 @@ static inline int moreRbspData(ARSTREAM2_H264Parser_t* _parser)
     else
     {
         // 8 bits max remaining
-        int _remaining = _parser->cacheLength + _parser->remNaluSize * 8;
         int _i = 1;
 
-        _ret = peekBits(_parser, _remaining, &_val, 1);
+        _ret = peekBits(_parser, _remaining, &_val);
         if (_ret < 0)
         {
             ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -459,7 +486,7 @@ static inline int moreRbspData(ARSTREAM2_H264Parser_t* _parser)
             ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed on moreRbspData()");
         }
     }
-    
+
     return _retval;
 }
 
@@ -480,7 +507,7 @@ static int ARSTREAM2_H264Parser_ParseScalingList(ARSTREAM2_H264Parser_t* parser,
         if (nextScale != 0)
         {
             // delta_scale
-            ret = readBits_expGolomb_se(parser, &val_se, 1);
+            ret = readBits_expGolomb_se(parser, &val_se);
             if (ret < 0)
             {
                 ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -508,7 +535,7 @@ static int ARSTREAM2_H264Parser_ParseHrdParams(ARSTREAM2_H264Parser_t* parser)
     if (parser->config.printLogs) ARSAL_PRINT(ARSAL_PRINT_INFO, ARSTREAM2_H264_PARSER_TAG, "------ hrd_parameters()");
 
     // cpb_cnt_minus1
-    ret = readBits_expGolomb_ue(parser, &val, 1);
+    ret = readBits_expGolomb_ue(parser, &val);
     if (ret < 0)
     {
         ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -519,7 +546,7 @@ static int ARSTREAM2_H264Parser_ParseHrdParams(ARSTREAM2_H264Parser_t* parser)
     if (parser->config.printLogs) ARSAL_PRINT(ARSAL_PRINT_INFO, ARSTREAM2_H264_PARSER_TAG, "-------- cpb_cnt_minus1 = %d", val);
 
     // bit_rate_scale
-    ret = readBits(parser, 4, &val, 1);
+    ret = readBits(parser, 4, &val);
     if (ret < 0)
     {
         ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -529,7 +556,7 @@ static int ARSTREAM2_H264Parser_ParseHrdParams(ARSTREAM2_H264Parser_t* parser)
     if (parser->config.printLogs) ARSAL_PRINT(ARSAL_PRINT_INFO, ARSTREAM2_H264_PARSER_TAG, "-------- bit_rate_scale = %d", val);
 
     // cpb_size_scale
-    ret = readBits(parser, 4, &val, 1);
+    ret = readBits(parser, 4, &val);
     if (ret < 0)
     {
         ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -541,7 +568,7 @@ static int ARSTREAM2_H264Parser_ParseHrdParams(ARSTREAM2_H264Parser_t* parser)
     for (i = 0; i <= parser->spsContext.cpb_cnt_minus1; i++)
     {
         // bit_rate_value_minus1
-        ret = readBits_expGolomb_ue(parser, &val, 1);
+        ret = readBits_expGolomb_ue(parser, &val);
         if (ret < 0)
         {
             ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -551,7 +578,7 @@ static int ARSTREAM2_H264Parser_ParseHrdParams(ARSTREAM2_H264Parser_t* parser)
         if (parser->config.printLogs) ARSAL_PRINT(ARSAL_PRINT_INFO, ARSTREAM2_H264_PARSER_TAG, "-------- bit_rate_value_minus1[%d] = %d", i, val);
 
         // cpb_size_value_minus1
-        ret = readBits_expGolomb_ue(parser, &val, 1);
+        ret = readBits_expGolomb_ue(parser, &val);
         if (ret < 0)
         {
             ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -561,7 +588,7 @@ static int ARSTREAM2_H264Parser_ParseHrdParams(ARSTREAM2_H264Parser_t* parser)
         if (parser->config.printLogs) ARSAL_PRINT(ARSAL_PRINT_INFO, ARSTREAM2_H264_PARSER_TAG, "-------- cpb_size_value_minus1[%d] = %d", i, val);
 
         // cbr_flag
-        ret = readBits(parser, 1, &val, 1);
+        ret = readBits(parser, 1, &val);
         if (ret < 0)
         {
             ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -572,7 +599,7 @@ static int ARSTREAM2_H264Parser_ParseHrdParams(ARSTREAM2_H264Parser_t* parser)
     }
 
     // initial_cpb_removal_delay_length_minus1
-    ret = readBits(parser, 5, &val, 1);
+    ret = readBits(parser, 5, &val);
     if (ret < 0)
     {
         ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -583,7 +610,7 @@ static int ARSTREAM2_H264Parser_ParseHrdParams(ARSTREAM2_H264Parser_t* parser)
     if (parser->config.printLogs) ARSAL_PRINT(ARSAL_PRINT_INFO, ARSTREAM2_H264_PARSER_TAG, "-------- initial_cpb_removal_delay_length_minus1 = %d", val);
 
     // cpb_removal_delay_length_minus1
-    ret = readBits(parser, 5, &val, 1);
+    ret = readBits(parser, 5, &val);
     if (ret < 0)
     {
         ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -594,7 +621,7 @@ static int ARSTREAM2_H264Parser_ParseHrdParams(ARSTREAM2_H264Parser_t* parser)
     if (parser->config.printLogs) ARSAL_PRINT(ARSAL_PRINT_INFO, ARSTREAM2_H264_PARSER_TAG, "-------- cpb_removal_delay_length_minus1 = %d", val);
 
     // dpb_output_delay_length_minus1
-    ret = readBits(parser, 5, &val, 1);
+    ret = readBits(parser, 5, &val);
     if (ret < 0)
     {
         ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -605,7 +632,7 @@ static int ARSTREAM2_H264Parser_ParseHrdParams(ARSTREAM2_H264Parser_t* parser)
     if (parser->config.printLogs) ARSAL_PRINT(ARSAL_PRINT_INFO, ARSTREAM2_H264_PARSER_TAG, "-------- dpb_output_delay_length_minus1 = %d", val);
 
     // time_offset_length
-    ret = readBits(parser, 5, &val, 1);
+    ret = readBits(parser, 5, &val);
     if (ret < 0)
     {
         ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -629,7 +656,7 @@ static int ARSTREAM2_H264Parser_ParseVui(ARSTREAM2_H264Parser_t* parser)
     if (parser->config.printLogs) ARSAL_PRINT(ARSAL_PRINT_INFO, ARSTREAM2_H264_PARSER_TAG, "---- vui_parameters()");
 
     // aspect_ratio_info_present_flag
-    ret = readBits(parser, 1, &val, 1);
+    ret = readBits(parser, 1, &val);
     if (ret < 0)
     {
         ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -641,7 +668,7 @@ static int ARSTREAM2_H264Parser_ParseVui(ARSTREAM2_H264Parser_t* parser)
     if (val)
     {
         // aspect_ratio_idc
-        ret = readBits(parser, 8, &val, 1);
+        ret = readBits(parser, 8, &val);
         if (ret < 0)
         {
             ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -653,7 +680,7 @@ static int ARSTREAM2_H264Parser_ParseVui(ARSTREAM2_H264Parser_t* parser)
         if (val == 255)
         {
             // sar_width
-            ret = readBits(parser, 16, &val, 1);
+            ret = readBits(parser, 16, &val);
             if (ret < 0)
             {
                 ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -663,7 +690,7 @@ static int ARSTREAM2_H264Parser_ParseVui(ARSTREAM2_H264Parser_t* parser)
             if (parser->config.printLogs) ARSAL_PRINT(ARSAL_PRINT_INFO, ARSTREAM2_H264_PARSER_TAG, "------ sar_width = %d", val);
 
             // sar_height
-            ret = readBits(parser, 16, &val, 1);
+            ret = readBits(parser, 16, &val);
             if (ret < 0)
             {
                 ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -675,7 +702,7 @@ static int ARSTREAM2_H264Parser_ParseVui(ARSTREAM2_H264Parser_t* parser)
     }
 
     // overscan_info_present_flag
-    ret = readBits(parser, 1, &val, 1);
+    ret = readBits(parser, 1, &val);
     if (ret < 0)
     {
         ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -687,7 +714,7 @@ static int ARSTREAM2_H264Parser_ParseVui(ARSTREAM2_H264Parser_t* parser)
     if (val)
     {
         // overscan_appropriate_flag
-        ret = readBits(parser, 1, &val, 1);
+        ret = readBits(parser, 1, &val);
         if (ret < 0)
         {
             ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -698,7 +725,7 @@ static int ARSTREAM2_H264Parser_ParseVui(ARSTREAM2_H264Parser_t* parser)
     }
 
     // video_signal_type_present_flag
-    ret = readBits(parser, 1, &val, 1);
+    ret = readBits(parser, 1, &val);
     if (ret < 0)
     {
         ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -710,7 +737,7 @@ static int ARSTREAM2_H264Parser_ParseVui(ARSTREAM2_H264Parser_t* parser)
     if (val)
     {
         // video_format
-        ret = readBits(parser, 3, &val, 1);
+        ret = readBits(parser, 3, &val);
         if (ret < 0)
         {
             ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -720,7 +747,7 @@ static int ARSTREAM2_H264Parser_ParseVui(ARSTREAM2_H264Parser_t* parser)
         if (parser->config.printLogs) ARSAL_PRINT(ARSAL_PRINT_INFO, ARSTREAM2_H264_PARSER_TAG, "------ video_format = %d", val);
 
         // video_full_range_flag
-        ret = readBits(parser, 1, &val, 1);
+        ret = readBits(parser, 1, &val);
         if (ret < 0)
         {
             ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -730,7 +757,7 @@ static int ARSTREAM2_H264Parser_ParseVui(ARSTREAM2_H264Parser_t* parser)
         if (parser->config.printLogs) ARSAL_PRINT(ARSAL_PRINT_INFO, ARSTREAM2_H264_PARSER_TAG, "------ video_full_range_flag = %d", val);
 
         // colour_description_present_flag
-        ret = readBits(parser, 1, &val, 1);
+        ret = readBits(parser, 1, &val);
         if (ret < 0)
         {
             ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -742,7 +769,7 @@ static int ARSTREAM2_H264Parser_ParseVui(ARSTREAM2_H264Parser_t* parser)
         if (val)
         {
             // colour_primaries
-            ret = readBits(parser, 8, &val, 1);
+            ret = readBits(parser, 8, &val);
             if (ret < 0)
             {
                 ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -752,7 +779,7 @@ static int ARSTREAM2_H264Parser_ParseVui(ARSTREAM2_H264Parser_t* parser)
             if (parser->config.printLogs) ARSAL_PRINT(ARSAL_PRINT_INFO, ARSTREAM2_H264_PARSER_TAG, "------ colour_primaries = %d", val);
 
             // transfer_characteristics
-            ret = readBits(parser, 8, &val, 1);
+            ret = readBits(parser, 8, &val);
             if (ret < 0)
             {
                 ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -762,7 +789,7 @@ static int ARSTREAM2_H264Parser_ParseVui(ARSTREAM2_H264Parser_t* parser)
             if (parser->config.printLogs) ARSAL_PRINT(ARSAL_PRINT_INFO, ARSTREAM2_H264_PARSER_TAG, "------ transfer_characteristics = %d", val);
 
             // matrix_coefficients
-            ret = readBits(parser, 8, &val, 1);
+            ret = readBits(parser, 8, &val);
             if (ret < 0)
             {
                 ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -775,7 +802,7 @@ static int ARSTREAM2_H264Parser_ParseVui(ARSTREAM2_H264Parser_t* parser)
     }
 
     // chroma_loc_info_present_flag
-    ret = readBits(parser, 1, &val, 1);
+    ret = readBits(parser, 1, &val);
     if (ret < 0)
     {
         ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -787,7 +814,7 @@ static int ARSTREAM2_H264Parser_ParseVui(ARSTREAM2_H264Parser_t* parser)
     if (val)
     {
         // chroma_sample_loc_type_top_field
-        ret = readBits_expGolomb_ue(parser, &val, 1);
+        ret = readBits_expGolomb_ue(parser, &val);
         if (ret < 0)
         {
             ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -797,7 +824,7 @@ static int ARSTREAM2_H264Parser_ParseVui(ARSTREAM2_H264Parser_t* parser)
         if (parser->config.printLogs) ARSAL_PRINT(ARSAL_PRINT_INFO, ARSTREAM2_H264_PARSER_TAG, "------ chroma_sample_loc_type_top_field = %d", val);
 
         // chroma_sample_loc_type_bottom_field
-        ret = readBits_expGolomb_ue(parser, &val, 1);
+        ret = readBits_expGolomb_ue(parser, &val);
         if (ret < 0)
         {
             ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -808,7 +835,7 @@ static int ARSTREAM2_H264Parser_ParseVui(ARSTREAM2_H264Parser_t* parser)
     }
 
     // timing_info_present_flag
-    ret = readBits(parser, 1, &val, 1);
+    ret = readBits(parser, 1, &val);
     if (ret < 0)
     {
         ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -820,7 +847,7 @@ static int ARSTREAM2_H264Parser_ParseVui(ARSTREAM2_H264Parser_t* parser)
     if (val)
     {
         // num_units_in_tick
-        ret = readBits(parser, 32, &val, 1);
+        ret = readBits(parser, 32, &val);
         if (ret < 0)
         {
             ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -831,7 +858,7 @@ static int ARSTREAM2_H264Parser_ParseVui(ARSTREAM2_H264Parser_t* parser)
         if (parser->config.printLogs) ARSAL_PRINT(ARSAL_PRINT_INFO, ARSTREAM2_H264_PARSER_TAG, "------ num_units_in_tick = %d", val);
         
         // time_scale
-        ret = readBits(parser, 32, &val, 1);
+        ret = readBits(parser, 32, &val);
         if (ret < 0)
         {
             ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -842,7 +869,7 @@ static int ARSTREAM2_H264Parser_ParseVui(ARSTREAM2_H264Parser_t* parser)
         if (parser->config.printLogs) ARSAL_PRINT(ARSAL_PRINT_INFO, ARSTREAM2_H264_PARSER_TAG, "------ time_scale = %d", val);
         
         // fixed_frame_rate_flag
-        ret = readBits(parser, 1, &val, 1);
+        ret = readBits(parser, 1, &val);
         if (ret < 0)
         {
             ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -853,7 +880,7 @@ static int ARSTREAM2_H264Parser_ParseVui(ARSTREAM2_H264Parser_t* parser)
     }
 
     // nal_hrd_parameters_present_flag
-    ret = readBits(parser, 1, &val, 1);
+    ret = readBits(parser, 1, &val);
     if (ret < 0)
     {
         ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -876,7 +903,7 @@ static int ARSTREAM2_H264Parser_ParseVui(ARSTREAM2_H264Parser_t* parser)
     }
 
     // vcl_hrd_parameters_present_flag
-    ret = readBits(parser, 1, &val, 1);
+    ret = readBits(parser, 1, &val);
     if (ret < 0)
     {
         ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -901,7 +928,7 @@ static int ARSTREAM2_H264Parser_ParseVui(ARSTREAM2_H264Parser_t* parser)
     if (parser->spsContext.nal_hrd_parameters_present_flag || parser->spsContext.vcl_hrd_parameters_present_flag)
     {
         // low_delay_hrd_flag
-        ret = readBits(parser, 1, &val, 1);
+        ret = readBits(parser, 1, &val);
         if (ret < 0)
         {
             ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -912,7 +939,7 @@ static int ARSTREAM2_H264Parser_ParseVui(ARSTREAM2_H264Parser_t* parser)
     }
 
     // pic_struct_present_flag
-    ret = readBits(parser, 1, &val, 1);
+    ret = readBits(parser, 1, &val);
     if (ret < 0)
     {
         ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -923,7 +950,7 @@ static int ARSTREAM2_H264Parser_ParseVui(ARSTREAM2_H264Parser_t* parser)
     if (parser->config.printLogs) ARSAL_PRINT(ARSAL_PRINT_INFO, ARSTREAM2_H264_PARSER_TAG, "------ pic_struct_present_flag = %d", val);
     
     // bitstream_restriction_flag
-    ret = readBits(parser, 1, &val, 1);
+    ret = readBits(parser, 1, &val);
     if (ret < 0)
     {
         ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -935,7 +962,7 @@ static int ARSTREAM2_H264Parser_ParseVui(ARSTREAM2_H264Parser_t* parser)
     if (val)
     {
         // motion_vectors_over_pic_boundaries_flag
-        ret = readBits(parser, 1, &val, 1);
+        ret = readBits(parser, 1, &val);
         if (ret < 0)
         {
             ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -945,7 +972,7 @@ static int ARSTREAM2_H264Parser_ParseVui(ARSTREAM2_H264Parser_t* parser)
         if (parser->config.printLogs) ARSAL_PRINT(ARSAL_PRINT_INFO, ARSTREAM2_H264_PARSER_TAG, "------ motion_vectors_over_pic_boundaries_flag = %d", val);
 
         // max_bytes_per_pic_denom
-        ret = readBits_expGolomb_ue(parser, &val, 1);
+        ret = readBits_expGolomb_ue(parser, &val);
         if (ret < 0)
         {
             ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -955,7 +982,7 @@ static int ARSTREAM2_H264Parser_ParseVui(ARSTREAM2_H264Parser_t* parser)
         if (parser->config.printLogs) ARSAL_PRINT(ARSAL_PRINT_INFO, ARSTREAM2_H264_PARSER_TAG, "------ max_bytes_per_pic_denom = %d", val);
 
         // max_bits_per_mb_denom
-        ret = readBits_expGolomb_ue(parser, &val, 1);
+        ret = readBits_expGolomb_ue(parser, &val);
         if (ret < 0)
         {
             ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -965,7 +992,7 @@ static int ARSTREAM2_H264Parser_ParseVui(ARSTREAM2_H264Parser_t* parser)
         if (parser->config.printLogs) ARSAL_PRINT(ARSAL_PRINT_INFO, ARSTREAM2_H264_PARSER_TAG, "------ max_bits_per_mb_denom = %d", val);
 
         // log2_max_mv_length_horizontal
-        ret = readBits_expGolomb_ue(parser, &val, 1);
+        ret = readBits_expGolomb_ue(parser, &val);
         if (ret < 0)
         {
             ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -975,7 +1002,7 @@ static int ARSTREAM2_H264Parser_ParseVui(ARSTREAM2_H264Parser_t* parser)
         if (parser->config.printLogs) ARSAL_PRINT(ARSAL_PRINT_INFO, ARSTREAM2_H264_PARSER_TAG, "------ log2_max_mv_length_horizontal = %d", val);
 
         // log2_max_mv_length_vertical
-        ret = readBits_expGolomb_ue(parser, &val, 1);
+        ret = readBits_expGolomb_ue(parser, &val);
         if (ret < 0)
         {
             ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -985,7 +1012,7 @@ static int ARSTREAM2_H264Parser_ParseVui(ARSTREAM2_H264Parser_t* parser)
         if (parser->config.printLogs) ARSAL_PRINT(ARSAL_PRINT_INFO, ARSTREAM2_H264_PARSER_TAG, "------ log2_max_mv_length_vertical = %d", val);
 
         // max_num_reorder_frames
-        ret = readBits_expGolomb_ue(parser, &val, 1);
+        ret = readBits_expGolomb_ue(parser, &val);
         if (ret < 0)
         {
             ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -995,7 +1022,7 @@ static int ARSTREAM2_H264Parser_ParseVui(ARSTREAM2_H264Parser_t* parser)
         if (parser->config.printLogs) ARSAL_PRINT(ARSAL_PRINT_INFO, ARSTREAM2_H264_PARSER_TAG, "------ max_num_reorder_frames = %d", val);
 
         // max_dec_frame_buffering
-        ret = readBits_expGolomb_ue(parser, &val, 1);
+        ret = readBits_expGolomb_ue(parser, &val);
         if (ret < 0)
         {
             ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -1022,7 +1049,7 @@ static int ARSTREAM2_H264Parser_ParseSps(ARSTREAM2_H264Parser_t* parser)
     
     // seq_parameter_set_data
 
-    ret = readBits(parser, 24, &val, 1);
+    ret = readBits(parser, 24, &val);
     if (ret < 0)
     {
         ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -1059,7 +1086,7 @@ static int ARSTREAM2_H264Parser_ParseSps(ARSTREAM2_H264Parser_t* parser)
     if (parser->config.printLogs) ARSAL_PRINT(ARSAL_PRINT_INFO, ARSTREAM2_H264_PARSER_TAG, "---- level_idc = %d", val & 0xFF);
 
     // seq_parameter_set_id
-    ret = readBits_expGolomb_ue(parser, &val, 1);
+    ret = readBits_expGolomb_ue(parser, &val);
     if (ret < 0)
     {
         ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -1073,7 +1100,7 @@ static int ARSTREAM2_H264Parser_ParseSps(ARSTREAM2_H264Parser_t* parser)
             || profile_idc == 118 || profile_idc == 128 || profile_idc == 138)
     {
         // chroma_format_idc
-        ret = readBits_expGolomb_ue(parser, &val, 1);
+        ret = readBits_expGolomb_ue(parser, &val);
         if (ret < 0)
         {
             ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -1086,7 +1113,7 @@ static int ARSTREAM2_H264Parser_ParseSps(ARSTREAM2_H264Parser_t* parser)
         if (val == 3)
         {
             // separate_colour_plane_flag
-            ret = readBits(parser, 1, &val, 1);
+            ret = readBits(parser, 1, &val);
             if (ret < 0)
             {
                 ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -1098,7 +1125,7 @@ static int ARSTREAM2_H264Parser_ParseSps(ARSTREAM2_H264Parser_t* parser)
         }
 
         // bit_depth_luma_minus8
-        ret = readBits_expGolomb_ue(parser, &val, 1);
+        ret = readBits_expGolomb_ue(parser, &val);
         if (ret < 0)
         {
             ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -1108,7 +1135,7 @@ static int ARSTREAM2_H264Parser_ParseSps(ARSTREAM2_H264Parser_t* parser)
         if (parser->config.printLogs) ARSAL_PRINT(ARSAL_PRINT_INFO, ARSTREAM2_H264_PARSER_TAG, "---- bit_depth_luma_minus8 = %d", val);
 
         // bit_depth_chroma_minus8
-        ret = readBits_expGolomb_ue(parser, &val, 1);
+        ret = readBits_expGolomb_ue(parser, &val);
         if (ret < 0)
         {
             ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -1118,7 +1145,7 @@ static int ARSTREAM2_H264Parser_ParseSps(ARSTREAM2_H264Parser_t* parser)
         if (parser->config.printLogs) ARSAL_PRINT(ARSAL_PRINT_INFO, ARSTREAM2_H264_PARSER_TAG, "---- bit_depth_chroma_minus8 = %d", val);
 
         // qpprime_y_zero_transform_bypass_flag
-        ret = readBits(parser, 1, &val, 1);
+        ret = readBits(parser, 1, &val);
         if (ret < 0)
         {
             ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -1128,7 +1155,7 @@ static int ARSTREAM2_H264Parser_ParseSps(ARSTREAM2_H264Parser_t* parser)
         if (parser->config.printLogs) ARSAL_PRINT(ARSAL_PRINT_INFO, ARSTREAM2_H264_PARSER_TAG, "---- qpprime_y_zero_transform_bypass_flag = %d", val);
 
         // seq_scaling_matrix_present_flag
-        ret = readBits(parser, 1, &val, 1);
+        ret = readBits(parser, 1, &val);
         if (ret < 0)
         {
             ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -1142,7 +1169,7 @@ static int ARSTREAM2_H264Parser_ParseSps(ARSTREAM2_H264Parser_t* parser)
             for (i = 0; i < ((parser->spsContext.chroma_format_idc != 3) ? 8 : 12); i++)
             {
                 // seq_scaling_list_present_flag
-                ret = readBits(parser, 1, &val, 1);
+                ret = readBits(parser, 1, &val);
                 if (ret < 0)
                 {
                     ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -1166,7 +1193,7 @@ static int ARSTREAM2_H264Parser_ParseSps(ARSTREAM2_H264Parser_t* parser)
     }
 
     // log2_max_frame_num_minus4
-    ret = readBits_expGolomb_ue(parser, &val, 1);
+    ret = readBits_expGolomb_ue(parser, &val);
     if (ret < 0)
     {
         ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -1177,7 +1204,7 @@ static int ARSTREAM2_H264Parser_ParseSps(ARSTREAM2_H264Parser_t* parser)
     if (parser->config.printLogs) ARSAL_PRINT(ARSAL_PRINT_INFO, ARSTREAM2_H264_PARSER_TAG, "---- log2_max_frame_num_minus4 = %d", val);
 
     // pic_order_cnt_type
-    ret = readBits_expGolomb_ue(parser, &val, 1);
+    ret = readBits_expGolomb_ue(parser, &val);
     if (ret < 0)
     {
         ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -1190,7 +1217,7 @@ static int ARSTREAM2_H264Parser_ParseSps(ARSTREAM2_H264Parser_t* parser)
     if (parser->spsContext.pic_order_cnt_type == 0)
     {
         // log2_max_pic_order_cnt_lsb_minus4
-        ret = readBits_expGolomb_ue(parser, &val, 1);
+        ret = readBits_expGolomb_ue(parser, &val);
         if (ret < 0)
         {
             ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -1203,7 +1230,7 @@ static int ARSTREAM2_H264Parser_ParseSps(ARSTREAM2_H264Parser_t* parser)
     else if (parser->spsContext.pic_order_cnt_type == 1)
     {
         // delta_pic_order_always_zero_flag
-        ret = readBits(parser, 1, &val, 1);
+        ret = readBits(parser, 1, &val);
         if (ret < 0)
         {
             ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -1214,7 +1241,7 @@ static int ARSTREAM2_H264Parser_ParseSps(ARSTREAM2_H264Parser_t* parser)
         if (parser->config.printLogs) ARSAL_PRINT(ARSAL_PRINT_INFO, ARSTREAM2_H264_PARSER_TAG, "---- delta_pic_order_always_zero_flag = %d", val);
 
         // offset_for_non_ref_pic
-        ret = readBits_expGolomb_se(parser, &val_se, 1);
+        ret = readBits_expGolomb_se(parser, &val_se);
         if (ret < 0)
         {
             ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -1224,7 +1251,7 @@ static int ARSTREAM2_H264Parser_ParseSps(ARSTREAM2_H264Parser_t* parser)
         if (parser->config.printLogs) ARSAL_PRINT(ARSAL_PRINT_INFO, ARSTREAM2_H264_PARSER_TAG, "---- offset_for_non_ref_pic = %d", val_se);
 
         // offset_for_top_to_bottom_field
-        ret = readBits_expGolomb_se(parser, &val_se, 1);
+        ret = readBits_expGolomb_se(parser, &val_se);
         if (ret < 0)
         {
             ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -1234,7 +1261,7 @@ static int ARSTREAM2_H264Parser_ParseSps(ARSTREAM2_H264Parser_t* parser)
         if (parser->config.printLogs) ARSAL_PRINT(ARSAL_PRINT_INFO, ARSTREAM2_H264_PARSER_TAG, "---- offset_for_top_to_bottom_field = %d", val_se);
 
         // num_ref_frames_in_pic_order_cnt_cycle
-        ret = readBits_expGolomb_ue(parser, &val, 1);
+        ret = readBits_expGolomb_ue(parser, &val);
         if (ret < 0)
         {
             ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -1247,7 +1274,7 @@ static int ARSTREAM2_H264Parser_ParseSps(ARSTREAM2_H264Parser_t* parser)
         for (i = 0; i < num_ref_frames_in_pic_order_cnt_cycle; i++)
         {
             // offset_for_ref_frame
-            ret = readBits_expGolomb_se(parser, &val_se, 1);
+            ret = readBits_expGolomb_se(parser, &val_se);
             if (ret < 0)
             {
                 ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -1259,7 +1286,7 @@ static int ARSTREAM2_H264Parser_ParseSps(ARSTREAM2_H264Parser_t* parser)
     }
 
     // max_num_ref_frames
-    ret = readBits_expGolomb_ue(parser, &val, 1);
+    ret = readBits_expGolomb_ue(parser, &val);
     if (ret < 0)
     {
         ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -1269,7 +1296,7 @@ static int ARSTREAM2_H264Parser_ParseSps(ARSTREAM2_H264Parser_t* parser)
     if (parser->config.printLogs) ARSAL_PRINT(ARSAL_PRINT_INFO, ARSTREAM2_H264_PARSER_TAG, "---- max_num_ref_frames = %d", val);
 
     // gaps_in_frame_num_value_allowed_flag
-    ret = readBits(parser, 1, &val, 1);
+    ret = readBits(parser, 1, &val);
     if (ret < 0)
     {
         ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -1279,7 +1306,7 @@ static int ARSTREAM2_H264Parser_ParseSps(ARSTREAM2_H264Parser_t* parser)
     if (parser->config.printLogs) ARSAL_PRINT(ARSAL_PRINT_INFO, ARSTREAM2_H264_PARSER_TAG, "---- gaps_in_frame_num_value_allowed_flag = %d", val);
 
     // pic_width_in_mbs_minus1
-    ret = readBits_expGolomb_ue(parser, &val, 1);
+    ret = readBits_expGolomb_ue(parser, &val);
     if (ret < 0)
     {
         ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -1291,7 +1318,7 @@ static int ARSTREAM2_H264Parser_ParseSps(ARSTREAM2_H264Parser_t* parser)
     if (parser->config.printLogs) ARSAL_PRINT(ARSAL_PRINT_INFO, ARSTREAM2_H264_PARSER_TAG, "---- pic_width_in_mbs_minus1 = %d (width = %d pixels)", val, width);
 
     // pic_height_in_map_units_minus1
-    ret = readBits_expGolomb_ue(parser, &val, 1);
+    ret = readBits_expGolomb_ue(parser, &val);
     if (ret < 0)
     {
         ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -1303,7 +1330,7 @@ static int ARSTREAM2_H264Parser_ParseSps(ARSTREAM2_H264Parser_t* parser)
     if (parser->config.printLogs) ARSAL_PRINT(ARSAL_PRINT_INFO, ARSTREAM2_H264_PARSER_TAG, "---- pic_height_in_map_units_minus1 = %d", val);
 
     // frame_mbs_only_flag
-    ret = readBits(parser, 1, &val, 1);
+    ret = readBits(parser, 1, &val);
     if (ret < 0)
     {
         ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -1317,7 +1344,7 @@ static int ARSTREAM2_H264Parser_ParseSps(ARSTREAM2_H264Parser_t* parser)
     if (!val)
     {
         // mb_adaptive_frame_field_flag
-        ret = readBits(parser, 1, &val, 1);
+        ret = readBits(parser, 1, &val);
         if (ret < 0)
         {
             ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -1328,7 +1355,7 @@ static int ARSTREAM2_H264Parser_ParseSps(ARSTREAM2_H264Parser_t* parser)
     }
 
     // direct_8x8_inference_flag
-    ret = readBits(parser, 1, &val, 1);
+    ret = readBits(parser, 1, &val);
     if (ret < 0)
     {
         ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -1338,7 +1365,7 @@ static int ARSTREAM2_H264Parser_ParseSps(ARSTREAM2_H264Parser_t* parser)
     if (parser->config.printLogs) ARSAL_PRINT(ARSAL_PRINT_INFO, ARSTREAM2_H264_PARSER_TAG, "---- direct_8x8_inference_flag = %d", val);
 
     // frame_cropping_flag
-    ret = readBits(parser, 1, &val, 1);
+    ret = readBits(parser, 1, &val);
     if (ret < 0)
     {
         ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -1350,7 +1377,7 @@ static int ARSTREAM2_H264Parser_ParseSps(ARSTREAM2_H264Parser_t* parser)
     if (val)
     {
         // frame_crop_left_offset
-        ret = readBits_expGolomb_ue(parser, &val, 1);
+        ret = readBits_expGolomb_ue(parser, &val);
         if (ret < 0)
         {
             ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -1360,7 +1387,7 @@ static int ARSTREAM2_H264Parser_ParseSps(ARSTREAM2_H264Parser_t* parser)
         if (parser->config.printLogs) ARSAL_PRINT(ARSAL_PRINT_INFO, ARSTREAM2_H264_PARSER_TAG, "---- frame_crop_left_offset = %d", val);
 
         // frame_crop_right_offset
-        ret = readBits_expGolomb_ue(parser, &val, 1);
+        ret = readBits_expGolomb_ue(parser, &val);
         if (ret < 0)
         {
             ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -1370,7 +1397,7 @@ static int ARSTREAM2_H264Parser_ParseSps(ARSTREAM2_H264Parser_t* parser)
         if (parser->config.printLogs) ARSAL_PRINT(ARSAL_PRINT_INFO, ARSTREAM2_H264_PARSER_TAG, "---- frame_crop_right_offset = %d", val);
 
         // frame_crop_top_offset
-        ret = readBits_expGolomb_ue(parser, &val, 1);
+        ret = readBits_expGolomb_ue(parser, &val);
         if (ret < 0)
         {
             ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -1380,7 +1407,7 @@ static int ARSTREAM2_H264Parser_ParseSps(ARSTREAM2_H264Parser_t* parser)
         if (parser->config.printLogs) ARSAL_PRINT(ARSAL_PRINT_INFO, ARSTREAM2_H264_PARSER_TAG, "---- frame_crop_top_offset = %d", val);
 
         // frame_crop_bottom_offset
-        ret = readBits_expGolomb_ue(parser, &val, 1);
+        ret = readBits_expGolomb_ue(parser, &val);
         if (ret < 0)
         {
             ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -1391,7 +1418,7 @@ static int ARSTREAM2_H264Parser_ParseSps(ARSTREAM2_H264Parser_t* parser)
     }
 
     // vui_parameters_present_flag
-    ret = readBits(parser, 1, &val, 1);
+    ret = readBits(parser, 1, &val);
     if (ret < 0)
     {
         ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -1413,7 +1440,7 @@ static int ARSTREAM2_H264Parser_ParseSps(ARSTREAM2_H264Parser_t* parser)
     }
 
     // rbsp_trailing_bits
-    ret = readBits(parser, 1, &val, 1);
+    ret = readBits(parser, 1, &val);
     if (ret < 0)
     {
         ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -1447,7 +1474,7 @@ static int ARSTREAM2_H264Parser_ParsePps(ARSTREAM2_H264Parser_t* parser)
     if (parser->config.printLogs) ARSAL_PRINT(ARSAL_PRINT_INFO, ARSTREAM2_H264_PARSER_TAG, "-- pic_parameter_set_rbsp()");
 
     // pic_parameter_set_id
-    ret = readBits_expGolomb_ue(parser, &val, 1);
+    ret = readBits_expGolomb_ue(parser, &val);
     if (ret < 0)
     {
         ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -1457,7 +1484,7 @@ static int ARSTREAM2_H264Parser_ParsePps(ARSTREAM2_H264Parser_t* parser)
     if (parser->config.printLogs) ARSAL_PRINT(ARSAL_PRINT_INFO, ARSTREAM2_H264_PARSER_TAG, "---- pic_parameter_set_id = %d", val);
 
     // seq_parameter_set_id
-    ret = readBits_expGolomb_ue(parser, &val, 1);
+    ret = readBits_expGolomb_ue(parser, &val);
     if (ret < 0)
     {
         ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -1467,7 +1494,7 @@ static int ARSTREAM2_H264Parser_ParsePps(ARSTREAM2_H264Parser_t* parser)
     if (parser->config.printLogs) ARSAL_PRINT(ARSAL_PRINT_INFO, ARSTREAM2_H264_PARSER_TAG, "---- seq_parameter_set_id = %d", val);
 
     // entropy_coding_mode_flag
-    ret = readBits(parser, 1, &val, 1);
+    ret = readBits(parser, 1, &val);
     if (ret < 0)
     {
         ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -1478,7 +1505,7 @@ static int ARSTREAM2_H264Parser_ParsePps(ARSTREAM2_H264Parser_t* parser)
     if (parser->config.printLogs) ARSAL_PRINT(ARSAL_PRINT_INFO, ARSTREAM2_H264_PARSER_TAG, "---- entropy_coding_mode_flag = %d", val);
 
     // bottom_field_pic_order_in_frame_present_flag
-    ret = readBits(parser, 1, &val, 1);
+    ret = readBits(parser, 1, &val);
     if (ret < 0)
     {
         ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -1489,7 +1516,7 @@ static int ARSTREAM2_H264Parser_ParsePps(ARSTREAM2_H264Parser_t* parser)
     if (parser->config.printLogs) ARSAL_PRINT(ARSAL_PRINT_INFO, ARSTREAM2_H264_PARSER_TAG, "---- bottom_field_pic_order_in_frame_present_flag = %d", val);
 
     // num_slice_groups_minus1
-    ret = readBits_expGolomb_ue(parser, &val, 1);
+    ret = readBits_expGolomb_ue(parser, &val);
     if (ret < 0)
     {
         ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -1502,7 +1529,7 @@ static int ARSTREAM2_H264Parser_ParsePps(ARSTREAM2_H264Parser_t* parser)
     if (parser->ppsContext.num_slice_groups_minus1 > 0)
     {
         // slice_group_map_type
-        ret = readBits_expGolomb_ue(parser, &val, 1);
+        ret = readBits_expGolomb_ue(parser, &val);
         if (ret < 0)
         {
             ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -1517,7 +1544,7 @@ static int ARSTREAM2_H264Parser_ParsePps(ARSTREAM2_H264Parser_t* parser)
             for (i = 0; i <= parser->ppsContext.num_slice_groups_minus1; i++)
             {
                 // run_length_minus1[i]
-                ret = readBits_expGolomb_ue(parser, &val, 1);
+                ret = readBits_expGolomb_ue(parser, &val);
                 if (ret < 0)
                 {
                     ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -1532,7 +1559,7 @@ static int ARSTREAM2_H264Parser_ParsePps(ARSTREAM2_H264Parser_t* parser)
             for (i = 0; i < parser->ppsContext.num_slice_groups_minus1; i++)
             {
                 // top_left[i]
-                ret = readBits_expGolomb_ue(parser, &val, 1);
+                ret = readBits_expGolomb_ue(parser, &val);
                 if (ret < 0)
                 {
                     ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -1542,7 +1569,7 @@ static int ARSTREAM2_H264Parser_ParsePps(ARSTREAM2_H264Parser_t* parser)
                 if (parser->config.printLogs) ARSAL_PRINT(ARSAL_PRINT_INFO, ARSTREAM2_H264_PARSER_TAG, "---- top_left[%d] = %d", i, val);
 
                 // bottom_right[i]
-                ret = readBits_expGolomb_ue(parser, &val, 1);
+                ret = readBits_expGolomb_ue(parser, &val);
                 if (ret < 0)
                 {
                     ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -1555,7 +1582,7 @@ static int ARSTREAM2_H264Parser_ParsePps(ARSTREAM2_H264Parser_t* parser)
         else if ((parser->ppsContext.slice_group_map_type == 3) || (parser->ppsContext.slice_group_map_type == 4) || (parser->ppsContext.slice_group_map_type == 5))
         {
             // slice_group_change_direction_flag
-            ret = readBits(parser, 1, &val, 1);
+            ret = readBits(parser, 1, &val);
             if (ret < 0)
             {
                 ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -1565,7 +1592,7 @@ static int ARSTREAM2_H264Parser_ParsePps(ARSTREAM2_H264Parser_t* parser)
             if (parser->config.printLogs) ARSAL_PRINT(ARSAL_PRINT_INFO, ARSTREAM2_H264_PARSER_TAG, "---- slice_group_change_direction_flag = %d", val);
 
             // slice_group_change_rate_minus1
-            ret = readBits_expGolomb_ue(parser, &val, 1);
+            ret = readBits_expGolomb_ue(parser, &val);
             if (ret < 0)
             {
                 ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -1578,7 +1605,7 @@ static int ARSTREAM2_H264Parser_ParsePps(ARSTREAM2_H264Parser_t* parser)
         else if (parser->ppsContext.slice_group_map_type == 6)
         {
             // pic_size_in_map_units_minus1
-            ret = readBits_expGolomb_ue(parser, &val, 1);
+            ret = readBits_expGolomb_ue(parser, &val);
             if (ret < 0)
             {
                 ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -1592,7 +1619,7 @@ static int ARSTREAM2_H264Parser_ParsePps(ARSTREAM2_H264Parser_t* parser)
             {
                 // slice_group_id[i]
                 len = (int)ceil(log2(parser->ppsContext.num_slice_groups_minus1 + 1));
-                ret = readBits(parser, len, &val, 1);
+                ret = readBits(parser, len, &val);
                 if (ret < 0)
                 {
                     ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -1605,7 +1632,7 @@ static int ARSTREAM2_H264Parser_ParsePps(ARSTREAM2_H264Parser_t* parser)
     }
 
     // num_ref_idx_l0_default_active_minus1
-    ret = readBits_expGolomb_ue(parser, &val, 1);
+    ret = readBits_expGolomb_ue(parser, &val);
     if (ret < 0)
     {
         ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -1616,7 +1643,7 @@ static int ARSTREAM2_H264Parser_ParsePps(ARSTREAM2_H264Parser_t* parser)
     if (parser->config.printLogs) ARSAL_PRINT(ARSAL_PRINT_INFO, ARSTREAM2_H264_PARSER_TAG, "---- num_ref_idx_l0_default_active_minus1 = %d", val);
 
     // num_ref_idx_l1_default_active_minus1
-    ret = readBits_expGolomb_ue(parser, &val, 1);
+    ret = readBits_expGolomb_ue(parser, &val);
     if (ret < 0)
     {
         ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -1627,7 +1654,7 @@ static int ARSTREAM2_H264Parser_ParsePps(ARSTREAM2_H264Parser_t* parser)
     if (parser->config.printLogs) ARSAL_PRINT(ARSAL_PRINT_INFO, ARSTREAM2_H264_PARSER_TAG, "---- num_ref_idx_l1_default_active_minus1 = %d", val);
 
     // weighted_pred_flag
-    ret = readBits(parser, 1, &val, 1);
+    ret = readBits(parser, 1, &val);
     if (ret < 0)
     {
         ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -1638,7 +1665,7 @@ static int ARSTREAM2_H264Parser_ParsePps(ARSTREAM2_H264Parser_t* parser)
     if (parser->config.printLogs) ARSAL_PRINT(ARSAL_PRINT_INFO, ARSTREAM2_H264_PARSER_TAG, "---- weighted_pred_flag = %d", val);
 
     // weighted_bipred_idc
-    ret = readBits(parser, 2, &val, 1);
+    ret = readBits(parser, 2, &val);
     if (ret < 0)
     {
         ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -1649,7 +1676,7 @@ static int ARSTREAM2_H264Parser_ParsePps(ARSTREAM2_H264Parser_t* parser)
     if (parser->config.printLogs) ARSAL_PRINT(ARSAL_PRINT_INFO, ARSTREAM2_H264_PARSER_TAG, "---- weighted_bipred_idc = %d", val);
 
     // pic_init_qp_minus26
-    ret = readBits_expGolomb_se(parser, &val_se, 1);
+    ret = readBits_expGolomb_se(parser, &val_se);
     if (ret < 0)
     {
         ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -1659,7 +1686,7 @@ static int ARSTREAM2_H264Parser_ParsePps(ARSTREAM2_H264Parser_t* parser)
     if (parser->config.printLogs) ARSAL_PRINT(ARSAL_PRINT_INFO, ARSTREAM2_H264_PARSER_TAG, "---- pic_init_qp_minus26 = %d", val_se);
 
     // pic_init_qs_minus26
-    ret = readBits_expGolomb_se(parser, &val_se, 1);
+    ret = readBits_expGolomb_se(parser, &val_se);
     if (ret < 0)
     {
         ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -1669,7 +1696,7 @@ static int ARSTREAM2_H264Parser_ParsePps(ARSTREAM2_H264Parser_t* parser)
     if (parser->config.printLogs) ARSAL_PRINT(ARSAL_PRINT_INFO, ARSTREAM2_H264_PARSER_TAG, "---- pic_init_qs_minus26 = %d", val_se);
 
     // chroma_qp_index_offset
-    ret = readBits_expGolomb_se(parser, &val_se, 1);
+    ret = readBits_expGolomb_se(parser, &val_se);
     if (ret < 0)
     {
         ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -1679,7 +1706,7 @@ static int ARSTREAM2_H264Parser_ParsePps(ARSTREAM2_H264Parser_t* parser)
     if (parser->config.printLogs) ARSAL_PRINT(ARSAL_PRINT_INFO, ARSTREAM2_H264_PARSER_TAG, "---- chroma_qp_index_offset = %d", val_se);
 
     // deblocking_filter_control_present_flag
-    ret = readBits(parser, 1, &val, 1);
+    ret = readBits(parser, 1, &val);
     if (ret < 0)
     {
         ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -1690,7 +1717,7 @@ static int ARSTREAM2_H264Parser_ParsePps(ARSTREAM2_H264Parser_t* parser)
     if (parser->config.printLogs) ARSAL_PRINT(ARSAL_PRINT_INFO, ARSTREAM2_H264_PARSER_TAG, "---- deblocking_filter_control_present_flag = %d", val);
 
     // constrained_intra_pred_flag
-    ret = readBits(parser, 1, &val, 1);
+    ret = readBits(parser, 1, &val);
     if (ret < 0)
     {
         ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -1700,7 +1727,7 @@ static int ARSTREAM2_H264Parser_ParsePps(ARSTREAM2_H264Parser_t* parser)
     if (parser->config.printLogs) ARSAL_PRINT(ARSAL_PRINT_INFO, ARSTREAM2_H264_PARSER_TAG, "---- constrained_intra_pred_flag = %d", val);
 
     // redundant_pic_cnt_present_flag
-    ret = readBits(parser, 1, &val, 1);
+    ret = readBits(parser, 1, &val);
     if (ret < 0)
     {
         ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -1714,7 +1741,7 @@ static int ARSTREAM2_H264Parser_ParsePps(ARSTREAM2_H264Parser_t* parser)
     if (moreRbspData(parser))
     {
         // transform_8x8_mode_flag
-        ret = readBits(parser, 1, &val, 1);
+        ret = readBits(parser, 1, &val);
         if (ret < 0)
         {
             ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -1725,7 +1752,7 @@ static int ARSTREAM2_H264Parser_ParsePps(ARSTREAM2_H264Parser_t* parser)
         if (parser->config.printLogs) ARSAL_PRINT(ARSAL_PRINT_INFO, ARSTREAM2_H264_PARSER_TAG, "---- transform_8x8_mode_flag = %d", val);
 
         // pic_scaling_matrix_present_flag
-        ret = readBits(parser, 1, &val, 1);
+        ret = readBits(parser, 1, &val);
         if (ret < 0)
         {
             ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -1739,7 +1766,7 @@ static int ARSTREAM2_H264Parser_ParsePps(ARSTREAM2_H264Parser_t* parser)
             for (i = 0; i < 6 + ((parser->spsContext.chroma_format_idc != 3) ? 2 : 6) * transform_8x8_mode_flag; i++)
             {
                 // pic_scaling_list_present_flag[i]
-                ret = readBits(parser, 1, &val, 1);
+                ret = readBits(parser, 1, &val);
                 if (ret < 0)
                 {
                     ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -1762,7 +1789,7 @@ static int ARSTREAM2_H264Parser_ParsePps(ARSTREAM2_H264Parser_t* parser)
         }
 
         // second_chroma_qp_index_offset
-        ret = readBits_expGolomb_se(parser, &val_se, 1);
+        ret = readBits_expGolomb_se(parser, &val_se);
         if (ret < 0)
         {
             ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -1774,7 +1801,7 @@ static int ARSTREAM2_H264Parser_ParsePps(ARSTREAM2_H264Parser_t* parser)
 
 
     // rbsp_trailing_bits
-    ret = readBits(parser, 1, &val, 1);
+    ret = readBits(parser, 1, &val);
     if (ret < 0)
     {
         ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -1812,7 +1839,7 @@ static int ARSTREAM2_H264Parser_ParseSeiPayload_userDataUnregistered(ARSTREAM2_H
     }
     
     // uuid_iso_iec_11578
-    ret = readBits(parser, 32, &val, 1);
+    ret = readBits(parser, 32, &val);
     if (ret < 0)
     {
         ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -1820,7 +1847,7 @@ static int ARSTREAM2_H264Parser_ParseSeiPayload_userDataUnregistered(ARSTREAM2_H
     }
     _readBits += ret;
     uuid1 = val;
-    ret = readBits(parser, 32, &val, 1);
+    ret = readBits(parser, 32, &val);
     if (ret < 0)
     {
         ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -1828,7 +1855,7 @@ static int ARSTREAM2_H264Parser_ParseSeiPayload_userDataUnregistered(ARSTREAM2_H
     }
     _readBits += ret;
     uuid2 = val;
-    ret = readBits(parser, 32, &val, 1);
+    ret = readBits(parser, 32, &val);
     if (ret < 0)
     {
         ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -1836,7 +1863,7 @@ static int ARSTREAM2_H264Parser_ParseSeiPayload_userDataUnregistered(ARSTREAM2_H
     }
     _readBits += ret;
     uuid3 = val;
-    ret = readBits(parser, 32, &val, 1);
+    ret = readBits(parser, 32, &val);
     if (ret < 0)
     {
         ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -1877,7 +1904,7 @@ static int ARSTREAM2_H264Parser_ParseSeiPayload_userDataUnregistered(ARSTREAM2_H
         parser->pUserDataBuf[parser->userDataCount][15] = (uint8_t)((uuid4 >> 0) & 0xFF);
         for (i = 16; i < payloadSize; i++)
         {
-            ret = readBits(parser, 8, &val, 1);
+            ret = readBits(parser, 8, &val);
             if (ret < 0)
             {
                 ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -1912,7 +1939,7 @@ static int ARSTREAM2_H264Parser_ParseSeiPayload_recoveryPoint(ARSTREAM2_H264Pars
     if (parser->config.printLogs) ARSAL_PRINT(ARSAL_PRINT_INFO, ARSTREAM2_H264_PARSER_TAG, "---- SEI: recovery_point");
 
     // recovery_frame_count
-    ret = readBits_expGolomb_ue(parser, &val, 1);
+    ret = readBits_expGolomb_ue(parser, &val);
     if (ret < 0)
     {
         ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -1922,7 +1949,7 @@ static int ARSTREAM2_H264Parser_ParseSeiPayload_recoveryPoint(ARSTREAM2_H264Pars
     if (parser->config.printLogs) ARSAL_PRINT(ARSAL_PRINT_INFO, ARSTREAM2_H264_PARSER_TAG, "------ recovery_frame_count = %d", val);
 
     // exact_match_flag
-    ret = readBits(parser, 1, &val, 1);
+    ret = readBits(parser, 1, &val);
     if (ret < 0)
     {
         ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -1932,7 +1959,7 @@ static int ARSTREAM2_H264Parser_ParseSeiPayload_recoveryPoint(ARSTREAM2_H264Pars
     if (parser->config.printLogs) ARSAL_PRINT(ARSAL_PRINT_INFO, ARSTREAM2_H264_PARSER_TAG, "------ exact_match_flag = %d", val);
 
     // broken_link_flag
-    ret = readBits(parser, 1, &val, 1);
+    ret = readBits(parser, 1, &val);
     if (ret < 0)
     {
         ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -1942,7 +1969,7 @@ static int ARSTREAM2_H264Parser_ParseSeiPayload_recoveryPoint(ARSTREAM2_H264Pars
     if (parser->config.printLogs) ARSAL_PRINT(ARSAL_PRINT_INFO, ARSTREAM2_H264_PARSER_TAG, "------ broken_link_flag = %d", val);
 
     // changing_slice_group_idc
-    ret = readBits(parser, 2, &val, 1);
+    ret = readBits(parser, 2, &val);
     if (ret < 0)
     {
         ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -1965,7 +1992,7 @@ static int ARSTREAM2_H264Parser_ParseSeiPayload_bufferingPeriod(ARSTREAM2_H264Pa
     if (parser->config.printLogs) ARSAL_PRINT(ARSAL_PRINT_INFO, ARSTREAM2_H264_PARSER_TAG, "---- SEI: buffering_period");
 
     // seq_parameter_set_id
-    ret = readBits_expGolomb_ue(parser, &val, 1);
+    ret = readBits_expGolomb_ue(parser, &val);
     if (ret < 0)
     {
         ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -1979,7 +2006,7 @@ static int ARSTREAM2_H264Parser_ParseSeiPayload_bufferingPeriod(ARSTREAM2_H264Pa
         for (i = 0; i <= parser->spsContext.cpb_cnt_minus1; i++)
         {
             // initial_cpb_removal_delay[i]
-            ret = readBits(parser, parser->spsContext.initial_cpb_removal_delay_length_minus1 + 1, &val, 1);
+            ret = readBits(parser, parser->spsContext.initial_cpb_removal_delay_length_minus1 + 1, &val);
             if (ret < 0)
             {
                 ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -1989,7 +2016,7 @@ static int ARSTREAM2_H264Parser_ParseSeiPayload_bufferingPeriod(ARSTREAM2_H264Pa
             if (parser->config.printLogs) ARSAL_PRINT(ARSAL_PRINT_INFO, ARSTREAM2_H264_PARSER_TAG, "------ initial_cpb_removal_delay[%d] = %d", i, val);
 
             // initial_cpb_removal_delay_offset[i]
-            ret = readBits(parser, parser->spsContext.initial_cpb_removal_delay_length_minus1 + 1, &val, 1);
+            ret = readBits(parser, parser->spsContext.initial_cpb_removal_delay_length_minus1 + 1, &val);
             if (ret < 0)
             {
                 ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -2005,7 +2032,7 @@ static int ARSTREAM2_H264Parser_ParseSeiPayload_bufferingPeriod(ARSTREAM2_H264Pa
         for (i = 0; i <= parser->spsContext.cpb_cnt_minus1; i++)
         {
             // initial_cpb_removal_delay[i]
-            ret = readBits(parser, parser->spsContext.initial_cpb_removal_delay_length_minus1 + 1, &val, 1);
+            ret = readBits(parser, parser->spsContext.initial_cpb_removal_delay_length_minus1 + 1, &val);
             if (ret < 0)
             {
                 ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -2015,7 +2042,7 @@ static int ARSTREAM2_H264Parser_ParseSeiPayload_bufferingPeriod(ARSTREAM2_H264Pa
             if (parser->config.printLogs) ARSAL_PRINT(ARSAL_PRINT_INFO, ARSTREAM2_H264_PARSER_TAG, "------ initial_cpb_removal_delay[%d] = %d", i, val);
 
             // initial_cpb_removal_delay_offset[i]
-            ret = readBits(parser, parser->spsContext.initial_cpb_removal_delay_length_minus1 + 1, &val, 1);
+            ret = readBits(parser, parser->spsContext.initial_cpb_removal_delay_length_minus1 + 1, &val);
             if (ret < 0)
             {
                 ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -2044,7 +2071,7 @@ static int ARSTREAM2_H264Parser_ParseSeiPayload_picTiming(ARSTREAM2_H264Parser_t
     if (parser->spsContext.nal_hrd_parameters_present_flag || parser->spsContext.vcl_hrd_parameters_present_flag)
     {
         // cpb_removal_delay
-        ret = readBits(parser, parser->spsContext.cpb_removal_delay_length_minus1 + 1, &val, 1);
+        ret = readBits(parser, parser->spsContext.cpb_removal_delay_length_minus1 + 1, &val);
         if (ret < 0)
         {
             ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -2054,7 +2081,7 @@ static int ARSTREAM2_H264Parser_ParseSeiPayload_picTiming(ARSTREAM2_H264Parser_t
         if (parser->config.printLogs) ARSAL_PRINT(ARSAL_PRINT_INFO, ARSTREAM2_H264_PARSER_TAG, "------ cpb_removal_delay = %d", val);
 
         // dpb_output_delay
-        ret = readBits(parser, parser->spsContext.dpb_output_delay_length_minus1 + 1, &val, 1);
+        ret = readBits(parser, parser->spsContext.dpb_output_delay_length_minus1 + 1, &val);
         if (ret < 0)
         {
             ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -2067,7 +2094,7 @@ static int ARSTREAM2_H264Parser_ParseSeiPayload_picTiming(ARSTREAM2_H264Parser_t
     if (parser->spsContext.pic_struct_present_flag)
     {
         // pic_struct
-        ret = readBits(parser, 4, &val, 1);
+        ret = readBits(parser, 4, &val);
         if (ret < 0)
         {
             ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -2080,7 +2107,7 @@ static int ARSTREAM2_H264Parser_ParseSeiPayload_picTiming(ARSTREAM2_H264Parser_t
         for (i = 0; i < ARSTREAM2_H264Parser_picStructToNumClockTS[pic_struct]; i++)
         {
             // clock_timestamp_flag[i]
-            ret = readBits(parser, 1, &val, 1);
+            ret = readBits(parser, 1, &val);
             if (ret < 0)
             {
                 ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -2092,7 +2119,7 @@ static int ARSTREAM2_H264Parser_ParseSeiPayload_picTiming(ARSTREAM2_H264Parser_t
             if (val)
             {
                 // ct_type
-                ret = readBits(parser, 2, &val, 1);
+                ret = readBits(parser, 2, &val);
                 if (ret < 0)
                 {
                     ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -2102,7 +2129,7 @@ static int ARSTREAM2_H264Parser_ParseSeiPayload_picTiming(ARSTREAM2_H264Parser_t
                 if (parser->config.printLogs) ARSAL_PRINT(ARSAL_PRINT_INFO, ARSTREAM2_H264_PARSER_TAG, "------ ct_type = %d", val);
 
                 // nuit_field_based_flag
-                ret = readBits(parser, 1, &val, 1);
+                ret = readBits(parser, 1, &val);
                 if (ret < 0)
                 {
                     ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -2113,7 +2140,7 @@ static int ARSTREAM2_H264Parser_ParseSeiPayload_picTiming(ARSTREAM2_H264Parser_t
                 if (parser->config.printLogs) ARSAL_PRINT(ARSAL_PRINT_INFO, ARSTREAM2_H264_PARSER_TAG, "------ nuit_field_based_flag = %d", val);
 
                 // counting_type
-                ret = readBits(parser, 5, &val, 1);
+                ret = readBits(parser, 5, &val);
                 if (ret < 0)
                 {
                     ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -2123,7 +2150,7 @@ static int ARSTREAM2_H264Parser_ParseSeiPayload_picTiming(ARSTREAM2_H264Parser_t
                 if (parser->config.printLogs) ARSAL_PRINT(ARSAL_PRINT_INFO, ARSTREAM2_H264_PARSER_TAG, "------ counting_type = %d", val);
 
                 // full_timestamp_flag
-                ret = readBits(parser, 1, &val, 1);
+                ret = readBits(parser, 1, &val);
                 if (ret < 0)
                 {
                     ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -2134,7 +2161,7 @@ static int ARSTREAM2_H264Parser_ParseSeiPayload_picTiming(ARSTREAM2_H264Parser_t
                 if (parser->config.printLogs) ARSAL_PRINT(ARSAL_PRINT_INFO, ARSTREAM2_H264_PARSER_TAG, "------ full_timestamp_flag = %d", val);
 
                 // discontinuity_flag
-                ret = readBits(parser, 1, &val, 1);
+                ret = readBits(parser, 1, &val);
                 if (ret < 0)
                 {
                     ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -2144,7 +2171,7 @@ static int ARSTREAM2_H264Parser_ParseSeiPayload_picTiming(ARSTREAM2_H264Parser_t
                 if (parser->config.printLogs) ARSAL_PRINT(ARSAL_PRINT_INFO, ARSTREAM2_H264_PARSER_TAG, "------ discontinuity_flag = %d", val);
 
                 // cnt_dropped_flag
-                ret = readBits(parser, 1, &val, 1);
+                ret = readBits(parser, 1, &val);
                 if (ret < 0)
                 {
                     ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -2154,7 +2181,7 @@ static int ARSTREAM2_H264Parser_ParseSeiPayload_picTiming(ARSTREAM2_H264Parser_t
                 if (parser->config.printLogs) ARSAL_PRINT(ARSAL_PRINT_INFO, ARSTREAM2_H264_PARSER_TAG, "------ cnt_dropped_flag = %d", val);
 
                 // n_frames
-                ret = readBits(parser, 8, &val, 1);
+                ret = readBits(parser, 8, &val);
                 if (ret < 0)
                 {
                     ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -2167,7 +2194,7 @@ static int ARSTREAM2_H264Parser_ParseSeiPayload_picTiming(ARSTREAM2_H264Parser_t
                 if (full_timestamp_flag)
                 {
                     // seconds_value
-                    ret = readBits(parser, 6, &val, 1);
+                    ret = readBits(parser, 6, &val);
                     if (ret < 0)
                     {
                         ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -2178,7 +2205,7 @@ static int ARSTREAM2_H264Parser_ParseSeiPayload_picTiming(ARSTREAM2_H264Parser_t
                     if (parser->config.printLogs) ARSAL_PRINT(ARSAL_PRINT_INFO, ARSTREAM2_H264_PARSER_TAG, "------ seconds_value = %d", val);
 
                     // minutes_value
-                    ret = readBits(parser, 6, &val, 1);
+                    ret = readBits(parser, 6, &val);
                     if (ret < 0)
                     {
                         ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -2189,7 +2216,7 @@ static int ARSTREAM2_H264Parser_ParseSeiPayload_picTiming(ARSTREAM2_H264Parser_t
                     if (parser->config.printLogs) ARSAL_PRINT(ARSAL_PRINT_INFO, ARSTREAM2_H264_PARSER_TAG, "------ minutes_value = %d", val);
 
                     // hours_value
-                    ret = readBits(parser, 5, &val, 1);
+                    ret = readBits(parser, 5, &val);
                     if (ret < 0)
                     {
                         ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -2202,7 +2229,7 @@ static int ARSTREAM2_H264Parser_ParseSeiPayload_picTiming(ARSTREAM2_H264Parser_t
                 else
                 {
                     // seconds_flag
-                    ret = readBits(parser, 1, &val, 1);
+                    ret = readBits(parser, 1, &val);
                     if (ret < 0)
                     {
                         ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -2214,7 +2241,7 @@ static int ARSTREAM2_H264Parser_ParseSeiPayload_picTiming(ARSTREAM2_H264Parser_t
                     if (val)
                     {
                         // seconds_value
-                        ret = readBits(parser, 6, &val, 1);
+                        ret = readBits(parser, 6, &val);
                         if (ret < 0)
                         {
                             ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -2225,7 +2252,7 @@ static int ARSTREAM2_H264Parser_ParseSeiPayload_picTiming(ARSTREAM2_H264Parser_t
                         if (parser->config.printLogs) ARSAL_PRINT(ARSAL_PRINT_INFO, ARSTREAM2_H264_PARSER_TAG, "------ seconds_value = %d", val);
 
                         // minutes_flag
-                        ret = readBits(parser, 1, &val, 1);
+                        ret = readBits(parser, 1, &val);
                         if (ret < 0)
                         {
                             ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -2237,7 +2264,7 @@ static int ARSTREAM2_H264Parser_ParseSeiPayload_picTiming(ARSTREAM2_H264Parser_t
                         if (val)
                         {
                             // minutes_value
-                            ret = readBits(parser, 6, &val, 1);
+                            ret = readBits(parser, 6, &val);
                             if (ret < 0)
                             {
                                 ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -2248,7 +2275,7 @@ static int ARSTREAM2_H264Parser_ParseSeiPayload_picTiming(ARSTREAM2_H264Parser_t
                             if (parser->config.printLogs) ARSAL_PRINT(ARSAL_PRINT_INFO, ARSTREAM2_H264_PARSER_TAG, "------ minutes_value = %d", val);
 
                             // hours_flag
-                            ret = readBits(parser, 1, &val, 1);
+                            ret = readBits(parser, 1, &val);
                             if (ret < 0)
                             {
                                 ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -2260,7 +2287,7 @@ static int ARSTREAM2_H264Parser_ParseSeiPayload_picTiming(ARSTREAM2_H264Parser_t
                             if (val)
                             {
                                 // hours_value
-                                ret = readBits(parser, 5, &val, 1);
+                                ret = readBits(parser, 5, &val);
                                 if (ret < 0)
                                 {
                                     ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -2277,7 +2304,7 @@ static int ARSTREAM2_H264Parser_ParseSeiPayload_picTiming(ARSTREAM2_H264Parser_t
                 if (parser->spsContext.time_offset_length)
                 {
                     // time_offset
-                    ret = readBits(parser, parser->spsContext.time_offset_length, &val, 1); //TODO: signed value
+                    ret = readBits(parser, parser->spsContext.time_offset_length, &val); //TODO: signed value
                     if (ret < 0)
                     {
                         ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -2322,7 +2349,7 @@ static int ARSTREAM2_H264Parser_ParseSei(ARSTREAM2_H264Parser_t* parser)
         // last_payload_type_byte
         do
         {
-            ret = readBits(parser, 8, &val, 1);
+            ret = readBits(parser, 8, &val);
             if (ret < 0)
             {
                 ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -2337,7 +2364,7 @@ static int ARSTREAM2_H264Parser_ParseSei(ARSTREAM2_H264Parser_t* parser)
         // last_payload_size_byte
         do
         {
-            ret = readBits(parser, 8, &val, 1);
+            ret = readBits(parser, 8, &val);
             if (ret < 0)
             {
                 ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -2430,7 +2457,7 @@ static int ARSTREAM2_H264Parser_ParseSei(ARSTREAM2_H264Parser_t* parser)
     while (moreRbspData(parser));
 
     // rbsp_trailing_bits
-    ret = readBits(parser, 1, &val, 1);
+    ret = readBits(parser, 1, &val);
     if (ret < 0)
     {
         ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -2461,7 +2488,7 @@ static int ARSTREAM2_H264Parser_ParseAud(ARSTREAM2_H264Parser_t* parser)
     if (parser->config.printLogs) ARSAL_PRINT(ARSAL_PRINT_INFO, ARSTREAM2_H264_PARSER_TAG, "-- access_unit_delimiter_rbsp()");
 
     // primary_pic_type
-    ret = readBits(parser, 3, &val, 1);
+    ret = readBits(parser, 3, &val);
     if (ret < 0)
     {
         ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -2471,7 +2498,7 @@ static int ARSTREAM2_H264Parser_ParseAud(ARSTREAM2_H264Parser_t* parser)
     if (parser->config.printLogs) ARSAL_PRINT(ARSAL_PRINT_INFO, ARSTREAM2_H264_PARSER_TAG, "---- primary_pic_type = %d", val);
 
     // rbsp_trailing_bits
-    ret = readBits(parser, 1, &val, 1);
+    ret = readBits(parser, 1, &val);
     if (ret < 0)
     {
         ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -2519,7 +2546,7 @@ static int ARSTREAM2_H264Parser_ParseRefPicListModification(ARSTREAM2_H264Parser
     if ((parser->sliceContext.sliceTypeMod5 != ARSTREAM2_H264_SLICE_TYPE_I) && (parser->sliceContext.sliceTypeMod5 != ARSTREAM2_H264_SLICE_TYPE_SI))
     {
         // ref_pic_list_modification_flag_l0
-        ret = readBits(parser, 1, &val, 1);
+        ret = readBits(parser, 1, &val);
         if (ret < 0)
         {
             ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -2535,7 +2562,7 @@ static int ARSTREAM2_H264Parser_ParseRefPicListModification(ARSTREAM2_H264Parser
             do
             {
                 // modification_of_pic_nums_idc
-                ret = readBits_expGolomb_ue(parser, &val, 1);
+                ret = readBits_expGolomb_ue(parser, &val);
                 if (ret < 0)
                 {
                     ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -2548,7 +2575,7 @@ static int ARSTREAM2_H264Parser_ParseRefPicListModification(ARSTREAM2_H264Parser
                 if ((modification_of_pic_nums_idc == 0) || (modification_of_pic_nums_idc == 1))
                 {
                     // abs_diff_pic_num_minus1
-                    ret = readBits_expGolomb_ue(parser, &val, 1);
+                    ret = readBits_expGolomb_ue(parser, &val);
                     if (ret < 0)
                     {
                         ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -2560,7 +2587,7 @@ static int ARSTREAM2_H264Parser_ParseRefPicListModification(ARSTREAM2_H264Parser
                 else if (modification_of_pic_nums_idc == 2)
                 {
                     // long_term_pic_num
-                    ret = readBits_expGolomb_ue(parser, &val, 1);
+                    ret = readBits_expGolomb_ue(parser, &val);
                     if (ret < 0)
                     {
                         ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -2578,7 +2605,7 @@ static int ARSTREAM2_H264Parser_ParseRefPicListModification(ARSTREAM2_H264Parser
     if (parser->sliceContext.sliceTypeMod5 == ARSTREAM2_H264_SLICE_TYPE_B)
     {
         // ref_pic_list_modification_flag_l1
-        ret = readBits(parser, 1, &val, 1);
+        ret = readBits(parser, 1, &val);
         if (ret < 0)
         {
             ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -2594,7 +2621,7 @@ static int ARSTREAM2_H264Parser_ParseRefPicListModification(ARSTREAM2_H264Parser
             {
                 i = 0;
                 // modification_of_pic_nums_idc
-                ret = readBits_expGolomb_ue(parser, &val, 1);
+                ret = readBits_expGolomb_ue(parser, &val);
                 if (ret < 0)
                 {
                     ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -2607,7 +2634,7 @@ static int ARSTREAM2_H264Parser_ParseRefPicListModification(ARSTREAM2_H264Parser
                 if ((modification_of_pic_nums_idc == 0) || (modification_of_pic_nums_idc == 1))
                 {
                     // abs_diff_pic_num_minus1
-                    ret = readBits_expGolomb_ue(parser, &val, 1);
+                    ret = readBits_expGolomb_ue(parser, &val);
                     if (ret < 0)
                     {
                         ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -2619,7 +2646,7 @@ static int ARSTREAM2_H264Parser_ParseRefPicListModification(ARSTREAM2_H264Parser
                 else if (modification_of_pic_nums_idc == 2)
                 {
                     // long_term_pic_num
-                    ret = readBits_expGolomb_ue(parser, &val, 1);
+                    ret = readBits_expGolomb_ue(parser, &val);
                     if (ret < 0)
                     {
                         ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -2647,7 +2674,7 @@ static int ARSTREAM2_H264Parser_ParsePredWeightTable(ARSTREAM2_H264Parser_t* par
     if (parser->config.printLogs) ARSAL_PRINT(ARSAL_PRINT_INFO, ARSTREAM2_H264_PARSER_TAG, "------ pred_weight_table()");
 
     // luma_log2_weight_denom
-    ret = readBits_expGolomb_ue(parser, &val, 1);
+    ret = readBits_expGolomb_ue(parser, &val);
     if (ret < 0)
     {
         ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -2675,7 +2702,7 @@ static int ARSTREAM2_H264Parser_ParseDecRefPicMarking(ARSTREAM2_H264Parser_t* pa
     if (parser->sliceContext.idrPicFlag)
     {
         // no_output_of_prior_pics_flag
-        ret = readBits(parser, 1, &val, 1);
+        ret = readBits(parser, 1, &val);
         if (ret < 0)
         {
             ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -2686,7 +2713,7 @@ static int ARSTREAM2_H264Parser_ParseDecRefPicMarking(ARSTREAM2_H264Parser_t* pa
         if (parser->config.printLogs) ARSAL_PRINT(ARSAL_PRINT_INFO, ARSTREAM2_H264_PARSER_TAG, "-------- no_output_of_prior_pics_flag = %d", val);
 
         // long_term_reference_flag
-        ret = readBits(parser, 1, &val, 1);
+        ret = readBits(parser, 1, &val);
         if (ret < 0)
         {
             ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -2699,7 +2726,7 @@ static int ARSTREAM2_H264Parser_ParseDecRefPicMarking(ARSTREAM2_H264Parser_t* pa
     else
     {
         // adaptive_ref_pic_marking_mode_flag
-        ret = readBits(parser, 1, &val, 1);
+        ret = readBits(parser, 1, &val);
         if (ret < 0)
         {
             ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -2716,7 +2743,7 @@ static int ARSTREAM2_H264Parser_ParseDecRefPicMarking(ARSTREAM2_H264Parser_t* pa
             do
             {
                 // memory_management_control_operation
-                ret = readBits_expGolomb_ue(parser, &val, 1);
+                ret = readBits_expGolomb_ue(parser, &val);
                 if (ret < 0)
                 {
                     ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -2729,7 +2756,7 @@ static int ARSTREAM2_H264Parser_ParseDecRefPicMarking(ARSTREAM2_H264Parser_t* pa
                 if ((memory_management_control_operation == 1) || (memory_management_control_operation == 3))
                 {
                     // difference_of_pic_nums_minus1
-                    ret = readBits_expGolomb_ue(parser, &val, 1);
+                    ret = readBits_expGolomb_ue(parser, &val);
                     if (ret < 0)
                     {
                         ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -2742,7 +2769,7 @@ static int ARSTREAM2_H264Parser_ParseDecRefPicMarking(ARSTREAM2_H264Parser_t* pa
                 if (memory_management_control_operation == 2)
                 {
                     // long_term_pic_num
-                    ret = readBits_expGolomb_ue(parser, &val, 1);
+                    ret = readBits_expGolomb_ue(parser, &val);
                     if (ret < 0)
                     {
                         ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -2755,7 +2782,7 @@ static int ARSTREAM2_H264Parser_ParseDecRefPicMarking(ARSTREAM2_H264Parser_t* pa
                 if ((memory_management_control_operation == 3) || (memory_management_control_operation == 6))
                 {
                     // long_term_frame_idx
-                    ret = readBits_expGolomb_ue(parser, &val, 1);
+                    ret = readBits_expGolomb_ue(parser, &val);
                     if (ret < 0)
                     {
                         ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -2767,7 +2794,7 @@ static int ARSTREAM2_H264Parser_ParseDecRefPicMarking(ARSTREAM2_H264Parser_t* pa
                 if (memory_management_control_operation == 4)
                 {
                     // max_long_term_frame_idx_plus1
-                    ret = readBits_expGolomb_ue(parser, &val, 1);
+                    ret = readBits_expGolomb_ue(parser, &val);
                     if (ret < 0)
                     {
                         ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -2805,7 +2832,7 @@ static int ARSTREAM2_H264Parser_ParseSlice(ARSTREAM2_H264Parser_t* parser)
     if (parser->config.printLogs) ARSAL_PRINT(ARSAL_PRINT_INFO, ARSTREAM2_H264_PARSER_TAG, "---- slice_header()");
 
     // first_mb_in_slice
-    ret = readBits_expGolomb_ue(parser, &val, 1);
+    ret = readBits_expGolomb_ue(parser, &val);
     if (ret < 0)
     {
         ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -2816,7 +2843,7 @@ static int ARSTREAM2_H264Parser_ParseSlice(ARSTREAM2_H264Parser_t* parser)
     if (parser->config.printLogs) ARSAL_PRINT(ARSAL_PRINT_INFO, ARSTREAM2_H264_PARSER_TAG, "------ first_mb_in_slice = %d", val);
 
     // slice_type
-    ret = readBits_expGolomb_ue(parser, &val, 1);
+    ret = readBits_expGolomb_ue(parser, &val);
     if (ret < 0)
     {
         ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -2828,7 +2855,7 @@ static int ARSTREAM2_H264Parser_ParseSlice(ARSTREAM2_H264Parser_t* parser)
     if (parser->config.printLogs) ARSAL_PRINT(ARSAL_PRINT_INFO, ARSTREAM2_H264_PARSER_TAG, "------ slice_type = %d (%s)", val, (val <= 9) ? ARSTREAM2_H264Parser_sliceTypeStr[val] : "(invalid)");
 
     // pic_parameter_set_id
-    ret = readBits_expGolomb_ue(parser, &val, 1);
+    ret = readBits_expGolomb_ue(parser, &val);
     if (ret < 0)
     {
         ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -2841,7 +2868,7 @@ static int ARSTREAM2_H264Parser_ParseSlice(ARSTREAM2_H264Parser_t* parser)
     if (parser->spsContext.separate_colour_plane_flag == 1)
     {
         // colour_plane_id
-        ret = readBits(parser, 2, &val, 1);
+        ret = readBits(parser, 2, &val);
         if (ret < 0)
         {
             ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -2853,7 +2880,7 @@ static int ARSTREAM2_H264Parser_ParseSlice(ARSTREAM2_H264Parser_t* parser)
     }
 
     // frame_num
-    ret = readBits(parser, parser->spsContext.log2_max_frame_num_minus4 + 4, &val, 1);
+    ret = readBits(parser, parser->spsContext.log2_max_frame_num_minus4 + 4, &val);
     if (ret < 0)
     {
         ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -2866,7 +2893,7 @@ static int ARSTREAM2_H264Parser_ParseSlice(ARSTREAM2_H264Parser_t* parser)
     if (!parser->spsContext.frame_mbs_only_flag)
     {
         // field_pic_flag
-        ret = readBits(parser, 1, &val, 1);
+        ret = readBits(parser, 1, &val);
         if (ret < 0)
         {
             ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -2879,7 +2906,7 @@ static int ARSTREAM2_H264Parser_ParseSlice(ARSTREAM2_H264Parser_t* parser)
         if (parser->sliceContext.field_pic_flag)
         {
             // bottom_field_flag
-            ret = readBits(parser, 1, &val, 1);
+            ret = readBits(parser, 1, &val);
             if (ret < 0)
             {
                 ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -2894,7 +2921,7 @@ static int ARSTREAM2_H264Parser_ParseSlice(ARSTREAM2_H264Parser_t* parser)
     if (parser->sliceContext.idrPicFlag)
     {
         // idr_pic_id
-        ret = readBits_expGolomb_ue(parser, &val, 1);
+        ret = readBits_expGolomb_ue(parser, &val);
         if (ret < 0)
         {
             ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -2908,7 +2935,7 @@ static int ARSTREAM2_H264Parser_ParseSlice(ARSTREAM2_H264Parser_t* parser)
     if (parser->spsContext.pic_order_cnt_type == 0)
     {
         // pic_order_cnt_lsb
-        ret = readBits(parser, parser->spsContext.log2_max_pic_order_cnt_lsb_minus4 + 4, &val, 1);
+        ret = readBits(parser, parser->spsContext.log2_max_pic_order_cnt_lsb_minus4 + 4, &val);
         if (ret < 0)
         {
             ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -2921,7 +2948,7 @@ static int ARSTREAM2_H264Parser_ParseSlice(ARSTREAM2_H264Parser_t* parser)
         if ((parser->ppsContext.bottom_field_pic_order_in_frame_present_flag) && (!parser->sliceContext.field_pic_flag))
         {
             // delta_pic_order_cnt_bottom
-            ret = readBits_expGolomb_se(parser, &val_se, 1);
+            ret = readBits_expGolomb_se(parser, &val_se);
             if (ret < 0)
             {
                 ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -2936,7 +2963,7 @@ static int ARSTREAM2_H264Parser_ParseSlice(ARSTREAM2_H264Parser_t* parser)
     if ((parser->spsContext.pic_order_cnt_type == 1) && (!parser->spsContext.delta_pic_order_always_zero_flag))
     {
         // delta_pic_order_cnt[0]
-        ret = readBits_expGolomb_se(parser, &val_se, 1);
+        ret = readBits_expGolomb_se(parser, &val_se);
         if (ret < 0)
         {
             ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -2949,7 +2976,7 @@ static int ARSTREAM2_H264Parser_ParseSlice(ARSTREAM2_H264Parser_t* parser)
         if ((parser->ppsContext.bottom_field_pic_order_in_frame_present_flag) && (!parser->sliceContext.field_pic_flag))
         {
             // delta_pic_order_cnt[1]
-            ret = readBits_expGolomb_se(parser, &val_se, 1);
+            ret = readBits_expGolomb_se(parser, &val_se);
             if (ret < 0)
             {
                 ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -2964,7 +2991,7 @@ static int ARSTREAM2_H264Parser_ParseSlice(ARSTREAM2_H264Parser_t* parser)
     if (parser->ppsContext.redundant_pic_cnt_present_flag)
     {
         // redundant_pic_cnt
-        ret = readBits_expGolomb_ue(parser, &val, 1);
+        ret = readBits_expGolomb_ue(parser, &val);
         if (ret < 0)
         {
             ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -2978,7 +3005,7 @@ static int ARSTREAM2_H264Parser_ParseSlice(ARSTREAM2_H264Parser_t* parser)
     if (parser->sliceContext.sliceTypeMod5 == ARSTREAM2_H264_SLICE_TYPE_B)
     {
         // direct_spatial_mv_pred_flag
-        ret = readBits(parser, 1, &val, 1);
+        ret = readBits(parser, 1, &val);
         if (ret < 0)
         {
             ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -2992,7 +3019,7 @@ static int ARSTREAM2_H264Parser_ParseSlice(ARSTREAM2_H264Parser_t* parser)
     if ((parser->sliceContext.sliceTypeMod5 == ARSTREAM2_H264_SLICE_TYPE_P) || (parser->sliceContext.sliceTypeMod5 == ARSTREAM2_H264_SLICE_TYPE_SP) || (parser->sliceContext.sliceTypeMod5 == ARSTREAM2_H264_SLICE_TYPE_B))
     {
         // num_ref_idx_active_override_flag
-        ret = readBits(parser, 1, &val, 1);
+        ret = readBits(parser, 1, &val);
         if (ret < 0)
         {
             ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -3005,7 +3032,7 @@ static int ARSTREAM2_H264Parser_ParseSlice(ARSTREAM2_H264Parser_t* parser)
         if (val)
         {
             // num_ref_idx_l0_active_minus1
-            ret = readBits_expGolomb_ue(parser, &val, 1);
+            ret = readBits_expGolomb_ue(parser, &val);
             if (ret < 0)
             {
                 ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -3018,7 +3045,7 @@ static int ARSTREAM2_H264Parser_ParseSlice(ARSTREAM2_H264Parser_t* parser)
             if (parser->sliceContext.sliceTypeMod5 == ARSTREAM2_H264_SLICE_TYPE_B)
             {
                 // num_ref_idx_l1_active_minus1
-                ret = readBits_expGolomb_ue(parser, &val, 1);
+                ret = readBits_expGolomb_ue(parser, &val);
                 if (ret < 0)
                 {
                     ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -3078,7 +3105,7 @@ static int ARSTREAM2_H264Parser_ParseSlice(ARSTREAM2_H264Parser_t* parser)
     if ((parser->ppsContext.entropy_coding_mode_flag) && (parser->sliceContext.sliceTypeMod5 != ARSTREAM2_H264_SLICE_TYPE_I) && (parser->sliceContext.sliceTypeMod5 != ARSTREAM2_H264_SLICE_TYPE_SI))
     {
         // cabac_init_idc
-        ret = readBits_expGolomb_ue(parser, &val, 1);
+        ret = readBits_expGolomb_ue(parser, &val);
         if (ret < 0)
         {
             ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -3090,7 +3117,7 @@ static int ARSTREAM2_H264Parser_ParseSlice(ARSTREAM2_H264Parser_t* parser)
     }
     
     // slice_qp_delta
-    ret = readBits_expGolomb_se(parser, &val_se, 1);
+    ret = readBits_expGolomb_se(parser, &val_se);
     if (ret < 0)
     {
         ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -3105,7 +3132,7 @@ static int ARSTREAM2_H264Parser_ParseSlice(ARSTREAM2_H264Parser_t* parser)
         if (parser->sliceContext.sliceTypeMod5 == ARSTREAM2_H264_SLICE_TYPE_SP)
         {
             // sp_for_switch_flag
-            ret = readBits(parser, 1, &val, 1);
+            ret = readBits(parser, 1, &val);
             if (ret < 0)
             {
                 ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -3117,7 +3144,7 @@ static int ARSTREAM2_H264Parser_ParseSlice(ARSTREAM2_H264Parser_t* parser)
         }
 
         // slice_qs_delta
-        ret = readBits_expGolomb_se(parser, &val_se, 1);
+        ret = readBits_expGolomb_se(parser, &val_se);
         if (ret < 0)
         {
             ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -3131,7 +3158,7 @@ static int ARSTREAM2_H264Parser_ParseSlice(ARSTREAM2_H264Parser_t* parser)
     if (parser->ppsContext.deblocking_filter_control_present_flag)
     {
         // disable_deblocking_filter_idc
-        ret = readBits_expGolomb_ue(parser, &val, 1);
+        ret = readBits_expGolomb_ue(parser, &val);
         if (ret < 0)
         {
             ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -3144,7 +3171,7 @@ static int ARSTREAM2_H264Parser_ParseSlice(ARSTREAM2_H264Parser_t* parser)
         if (val != 1)
         {
             // slice_alpha_c0_offset_div2
-            ret = readBits_expGolomb_se(parser, &val_se, 1);
+            ret = readBits_expGolomb_se(parser, &val_se);
             if (ret < 0)
             {
                 ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -3155,7 +3182,7 @@ static int ARSTREAM2_H264Parser_ParseSlice(ARSTREAM2_H264Parser_t* parser)
             if (parser->config.printLogs) ARSAL_PRINT(ARSAL_PRINT_INFO, ARSTREAM2_H264_PARSER_TAG, "------ slice_alpha_c0_offset_div2 = %d", val_se);
 
             // slice_beta_offset_div2
-            ret = readBits_expGolomb_se(parser, &val_se, 1);
+            ret = readBits_expGolomb_se(parser, &val_se);
             if (ret < 0)
             {
                 ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -3175,7 +3202,7 @@ static int ARSTREAM2_H264Parser_ParseSlice(ARSTREAM2_H264Parser_t* parser)
         n = ceil(log2((picSizeInMapUnits / (parser->ppsContext.slice_group_change_rate_minus1 + 1)) + 1));
 
         // slice_group_change_cycle
-        ret = readBits(parser, n, &val, 1);
+        ret = readBits(parser, n, &val);
         if (ret < 0)
         {
             ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -3190,7 +3217,7 @@ static int ARSTREAM2_H264Parser_ParseSlice(ARSTREAM2_H264Parser_t* parser)
     // rbsp_slice_trailing_bits
 
     // rbsp_trailing_bits
-    ret = readBits(parser, 1, &val, 1);
+    ret = readBits(parser, 1, &val);
     if (ret < 0)
     {
         ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -3229,7 +3256,7 @@ eARSTREAM2_ERROR ARSTREAM2_H264Parser_ParseNalu(ARSTREAM2_H264Parser_Handle pars
 
     memset(&parser->sliceContext, 0, sizeof(ARSTREAM2_H264_SliceContext_t));
 
-    ret = readBits(parser, 8, &val, 0);
+    ret = readBits(parser, 8, &val);
     if (ret != 8)
     {
         ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to read from the bitstream");
@@ -3324,19 +3351,12 @@ static int ARSTREAM2_H264Parser_StartcodeMatch_file(ARSTREAM2_H264Parser_t* pars
 
 
 
-eARSTREAM2_ERROR ARSTREAM2_H264Parser_ReadNextNalu_file(ARSTREAM2_H264Parser_Handle parserHandle, FILE* fp, unsigned long long fileSize, unsigned int *naluSize)
+static eARSTREAM2_ERROR ARSTREAM2_H264Parser_ReadNextNalu_fread(ARSTREAM2_H264Parser_t* parser, FILE* fp, unsigned long long fileSize, unsigned int *naluSize)
 {
-    ARSTREAM2_H264Parser_t* parser = (ARSTREAM2_H264Parser_t*)parserHandle;
     int ret = 0;
     unsigned long long naluStart, naluEnd, startcodePosition = 0;
     unsigned int _naluSize = 0;
 
-    if (!parserHandle)
-    {
-        ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Invalid handle");
-        return ARSTREAM2_ERROR_BAD_PARAMETERS;
-    }
-    
     // Search for next NALU start code
     ret = ARSTREAM2_H264Parser_StartcodeMatch_file(parser, fp, fileSize, &startcodePosition);
     if (ret >= 0)
@@ -3396,9 +3416,7 @@ eARSTREAM2_ERROR ARSTREAM2_H264Parser_ReadNextNalu_file(ARSTREAM2_H264Parser_Han
             parser->pNaluBufCur = parser->pNaluBuf;
 
             // Reset the cache
-            parser->cache = 0;
-            parser->cacheLength = 0;
-            parser->oldZeroCount = 0; // NB: this value is wrong when emulation prevention is in use (inside NAL Units)
+            bitstreamReset(parser);
         }
         else
         {
@@ -3423,35 +3441,388 @@ eARSTREAM2_ERROR ARSTREAM2_H264Parser_ReadNextNalu_file(ARSTREAM2_H264Parser_Han
 }
 
 
-static int ARSTREAM2_H264Parser_StartcodeMatch_buffer(ARSTREAM2_H264Parser_t* parser, uint8_t* pBuf, unsigned int bufSize)
+static int ARSTREAM2_H264Parser_StartcodeMatch_buffer(ARSTREAM2_H264Parser_t* parser, const uint8_t* pBuf, unsigned int bufSize)
 {
-    int ret, pos, end;
-    uint32_t shiftVal = 0;
-    uint8_t* ptr = pBuf;
+    const uint8_t *ptr, *end;
 
     if (bufSize < 4) return -2;
 
-    pos = 0;
-    end = bufSize;
+    ptr = pBuf + 3;
+    end = pBuf + bufSize;
 
-    do
+    // Look for the 0x01 byte, then check the three zero bytes before it
+    while ((ptr = (const uint8_t*)memchr(ptr, 0x01, end - ptr)) != NULL)
     {
-        shiftVal <<= 8;
-        shiftVal |= (*ptr++) & 0xFF;
-        pos++;
+        if ((ptr[-1] == 0x00) && (ptr[-2] == 0x00) && (ptr[-3] == 0x00))
+        {
+            return (int)(ptr + 1 - pBuf);
+        }
+        ptr++;
     }
-    while (((shiftVal != ARSTREAM2_H264_BYTE_STREAM_NALU_START_CODE) && (pos < end)) || (pos < 4));
 
-    if (shiftVal == ARSTREAM2_H264_BYTE_STREAM_NALU_START_CODE)
+    return -2;
+}
+
+
+static void ARSTREAM2_H264Parser_UnmapFile(ARSTREAM2_H264Parser_t* parser)
+{
+    if (parser->pMapView)
+    {
+#ifdef _WIN32
+        UnmapViewOfFile(parser->pMapView);
+#else
+        munmap(parser->pMapView, parser->mapViewSize);
+#endif
+        parser->pMapView = NULL;
+    }
+#ifdef _WIN32
+    if (parser->mapHandle)
+    {
+        CloseHandle(parser->mapHandle);
+        parser->mapHandle = NULL;
+    }
+#endif
+
+    free(parser->mapPath);
+    parser->mapPath = NULL;
+    parser->mapFile = NULL;
+    parser->mapFileSize = 0;
+    parser->mapFileTime = 0;
+    parser->mapFailed = 0;
+    parser->mapViewOffset = 0;
+    parser->mapViewSize = 0;
+}
+
+
+static uint8_t* ARSTREAM2_H264Parser_MapFileRange(ARSTREAM2_H264Parser_t* parser, unsigned long long offset, unsigned int size)
+{
+    unsigned long long viewOffset;
+    size_t viewSize;
+    void *view;
+
+    if ((parser->pMapView) && (offset >= parser->mapViewOffset) && (offset + size <= parser->mapViewOffset + parser->mapViewSize))
     {
-        ret = pos;
+        return parser->pMapView + (offset - parser->mapViewOffset);
     }
-    else
+
+    // Map a window starting at the requested offset, or the whole range if it is larger
+    viewOffset = offset - (offset % ARSTREAM2_H264_PARSER_MAP_ALIGNMENT);
+    viewSize = (offset + size - viewOffset > ARSTREAM2_H264_PARSER_MAP_WINDOW_SIZE) ? (size_t)(offset + size - viewOffset) : ARSTREAM2_H264_PARSER_MAP_WINDOW_SIZE;
+    if (viewOffset + viewSize > parser->mapFileSize)
     {
-        ret = -2;
+        viewSize = (size_t)(parser->mapFileSize - viewOffset);
     }
 
-    return ret;
+    if (parser->pMapView)
+    {
+#ifdef _WIN32
+        UnmapViewOfFile(parser->pMapView);
+#else
+        munmap(parser->pMapView, parser->mapViewSize);
+#endif
+        parser->pMapView = NULL;
+    }
+
+#ifdef _WIN32
+    view = MapViewOfFile(parser->mapHandle, FILE_MAP_READ, (DWORD)(viewOffset >> 32), (DWORD)(viewOffset & 0xFFFFFFFF), viewSize);
+    if (!view)
+    {
+        ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to map %lu bytes at offset %llu (%lu)", (unsigned long)viewSize, viewOffset, (unsigned long)GetLastError());
+        return NULL;
+    }
+#else
+    view = mmap(NULL, viewSize, PROT_READ, MAP_SHARED, fileno(parser->mapFile), (off_t)viewOffset);
+    if (view == MAP_FAILED)
+    {
+        ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to map %lu bytes at offset %llu", (unsigned long)viewSize, viewOffset);
+        return NULL;
+    }
+    madvise(view, viewSize, MADV_SEQUENTIAL);
+#endif
+
+    parser->pMapView = (uint8_t*)view;
+    parser->mapViewOffset = viewOffset;
+    parser->mapViewSize = viewSize;
+
+    return parser->pMapView + (offset - viewOffset);
+}
+
+
+static int ARSTREAM2_H264Parser_StatFile(const char* path, unsigned long long *fileSize, long long *fileTime)
+{
+#ifdef _WIN32
+    struct _stat64 st;
+
+    if (_stat64(path, &st) != 0) return -1;
+#else
+    struct stat st;
+
+    if (stat(path, &st) != 0) return -1;
+#endif
+
+    *fileSize = (unsigned long long)st.st_size;
+    *fileTime = (long long)st.st_mtime;
+    return 0;
+}
+
+
+static int ARSTREAM2_H264Parser_MapFile(ARSTREAM2_H264Parser_t* parser, FILE* fp, unsigned long long fileSize)
+{
+    parser->mapFile = fp;
+    parser->mapFileSize = fileSize;
+
+    if (fileSize < 4)
+    {
+        parser->mapFailed = 1;
+        return -1;
+    }
+
+#ifdef _WIN32
+    {
+        HANDLE fileHandle = (HANDLE)_get_osfhandle(_fileno(fp));
+
+        if (fileHandle != INVALID_HANDLE_VALUE)
+        {
+            parser->mapHandle = CreateFileMapping(fileHandle, NULL, PAGE_READONLY, 0, 0, NULL);
+        }
+        if (!parser->mapHandle)
+        {
+            parser->mapFailed = 1;
+            return -1;
+        }
+    }
+#endif
+
+    // Map the first window now so that an unmappable file falls back to reading
+    if (!ARSTREAM2_H264Parser_MapFileRange(parser, 0, 4))
+    {
+        parser->mapFailed = 1;
+        return -1;
+    }
+
+    return 0;
+}
+
+
+static int ARSTREAM2_H264Parser_StartcodeMatch_map(ARSTREAM2_H264Parser_t* parser, unsigned long long pos, unsigned long long *startcodePosition)
+{
+    int ret;
+    unsigned int size;
+    uint8_t* ptr;
+
+    while (pos + 4 <= parser->mapFileSize)
+    {
+        // A chunk always fits in a single window
+        size = (parser->mapFileSize - pos > ARSTREAM2_H264_PARSER_MAP_WINDOW_SIZE - ARSTREAM2_H264_PARSER_MAP_ALIGNMENT) ?
+            ARSTREAM2_H264_PARSER_MAP_WINDOW_SIZE - ARSTREAM2_H264_PARSER_MAP_ALIGNMENT : (unsigned int)(parser->mapFileSize - pos);
+
+        ptr = ARSTREAM2_H264Parser_MapFileRange(parser, pos, size);
+        if (!ptr) return -1;
+
+        ret = ARSTREAM2_H264Parser_StartcodeMatch_buffer(parser, ptr, size);
+        if (ret >= 0)
+        {
+            if (startcodePosition) *startcodePosition = pos + ret - 4;
+            return 0;
+        }
+
+        if (pos + size >= parser->mapFileSize)
+        {
+            break;
+        }
+
+        // A start code may straddle two chunks
+        pos += size - 3;
+    }
+
+    return -2;
+}
+
+
+eARSTREAM2_ERROR ARSTREAM2_H264Parser_OpenFile(ARSTREAM2_H264Parser_Handle parserHandle, const char* path, FILE** fp, unsigned long long *fileSize)
+{
+    ARSTREAM2_H264Parser_t* parser = (ARSTREAM2_H264Parser_t*)parserHandle;
+    unsigned long long _fileSize = 0;
+    long long fileTime = 0;
+    FILE* _fp;
+
+    if ((!parserHandle) || (!path) || (!fp))
+    {
+        ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Invalid parameters");
+        return ARSTREAM2_ERROR_BAD_PARAMETERS;
+    }
+
+    if (ARSTREAM2_H264Parser_StatFile(path, &_fileSize, &fileTime) != 0)
+    {
+        ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to stat file '%s'", path);
+        return ARSTREAM2_ERROR_NOT_FOUND;
+    }
+
+    _fp = fopen(path, "rb");
+    if (!_fp)
+    {
+        ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to open file '%s'", path);
+        return ARSTREAM2_ERROR_NOT_FOUND;
+    }
+
+    // Only one file is mapped at a time
+    ARSTREAM2_H264Parser_UnmapFile(parser);
+
+    parser->mapPath = (char*)malloc(strlen(path) + 1);
+    if (!parser->mapPath)
+    {
+        ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Allocation failed (size %zu)", strlen(path) + 1);
+        fclose(_fp);
+        return ARSTREAM2_ERROR_ALLOC;
+    }
+    strcpy(parser->mapPath, path);
+    parser->mapFileTime = fileTime;
+
+    // No else: a file that cannot be mapped is read by ARSTREAM2_H264Parser_ReadNextNalu_file()
+    ARSTREAM2_H264Parser_MapFile(parser, _fp, _fileSize);
+
+    *fp = _fp;
+    if (fileSize) *fileSize = _fileSize;
+    return ARSTREAM2_OK;
+}
+
+
+eARSTREAM2_ERROR ARSTREAM2_H264Parser_CloseFile(ARSTREAM2_H264Parser_Handle parserHandle, FILE* fp)
+{
+    ARSTREAM2_H264Parser_t* parser = (ARSTREAM2_H264Parser_t*)parserHandle;
+
+    if ((!parserHandle) || (!fp))
+    {
+        ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Invalid parameters");
+        return ARSTREAM2_ERROR_BAD_PARAMETERS;
+    }
+
+    // The mapping must not outlive the file, whose FILE* may be reused by the next fopen()
+    if (fp == parser->mapFile)
+    {
+        if ((parser->pMapView) && (parser->pNaluBufCur >= parser->pMapView) && (parser->pNaluBufCur < parser->pMapView + parser->mapViewSize))
+        {
+            parser->naluSize = 0;
+            parser->remNaluSize = 0;
+            parser->pNaluBufCur = NULL;
+        }
+        ARSTREAM2_H264Parser_UnmapFile(parser);
+    }
+
+    fclose(fp);
+
+    return ARSTREAM2_OK;
+}
+
+
+eARSTREAM2_ERROR ARSTREAM2_H264Parser_ReadNextNalu_file(ARSTREAM2_H264Parser_Handle parserHandle, FILE* fp, unsigned long long fileSize, unsigned int *naluSize)
+{
+    ARSTREAM2_H264Parser_t* parser = (ARSTREAM2_H264Parser_t*)parserHandle;
+    int ret = 0;
+    long long pos;
+    unsigned long long naluStart, naluEnd, startcodePosition = 0;
+    unsigned long long statSize = 0;
+    long long statTime = 0;
+    unsigned int _naluSize = 0;
+    uint8_t* ptr;
+
+    if (!parserHandle)
+    {
+        ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Invalid handle");
+        return ARSTREAM2_ERROR_BAD_PARAMETERS;
+    }
+
+    pos = ARSTREAM2_H264_PARSER_FTELL(fp);
+    if (pos < 0)
+    {
+        ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to get the file position");
+        return ARSTREAM2_ERROR_INVALID_STATE;
+    }
+
+    // The same file read again from the start: the mapping is only kept if the file was not replaced since it was opened
+    if ((pos == 0) && (parser->mapPath) && (fp == parser->mapFile) && (!parser->mapFailed))
+    {
+        if ((ARSTREAM2_H264Parser_StatFile(parser->mapPath, &statSize, &statTime) != 0) || (statSize != parser->mapFileSize) || (statTime != parser->mapFileTime))
+        {
+            ARSAL_PRINT(ARSAL_PRINT_WARNING, ARSTREAM2_H264_PARSER_TAG, "File '%s' has changed since it was opened, reading it instead", parser->mapPath);
+            parser->mapFailed = 1;
+        }
+    }
+
+    // Only a file opened with ARSTREAM2_H264Parser_OpenFile() is mapped, and only with the size it had then
+    if ((!parser->mapPath) || (fp != parser->mapFile) || (fileSize != parser->mapFileSize) || (parser->mapFailed))
+    {
+        return ARSTREAM2_H264Parser_ReadNextNalu_fread(parser, fp, fileSize, naluSize);
+    }
+
+    // Search for next NALU start code
+    ret = ARSTREAM2_H264Parser_StartcodeMatch_map(parser, (unsigned long long)pos, &startcodePosition);
+    if (ret == -2)
+    {
+        // No start code found
+        if (parser->config.printLogs) ARSAL_PRINT(ARSAL_PRINT_INFO, ARSTREAM2_H264_PARSER_TAG, "No start code found");
+        return ARSTREAM2_ERROR_NOT_FOUND;
+    }
+    else if (ret < 0)
+    {
+        ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "ARSTREAM2_H264Parser_StartcodeMatch_map() failed (%d)", ret);
+        return ARSTREAM2_ERROR_INVALID_STATE;
+    }
+
+    // Start code found
+    naluStart = startcodePosition + 4;
+    if (parser->config.printLogs) ARSAL_PRINT(ARSAL_PRINT_INFO, ARSTREAM2_H264_PARSER_TAG, "Start code at 0x%08X", (uint32_t)(startcodePosition));
+
+    // Search for NALU end (next NALU start code or end of file)
+    ret = ARSTREAM2_H264Parser_StartcodeMatch_map(parser, naluStart, &startcodePosition);
+    if (ret >= 0)
+    {
+        // Start code found
+        naluEnd = startcodePosition;
+    }
+    else if (ret == -2)
+    {
+        // No start code found
+        naluEnd = fileSize;
+    }
+    else //if (ret < 0)
+    {
+        ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "ARSTREAM2_H264Parser_StartcodeMatch_map() failed (%d)", ret);
+        return ARSTREAM2_ERROR_INVALID_STATE;
+    }
+
+    _naluSize = (unsigned int)(naluEnd - naluStart);
+    if (_naluSize == 0)
+    {
+        ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Invalid NALU size");
+        return ARSTREAM2_ERROR_INVALID_STATE;
+    }
+
+    // The NALU is parsed straight from the mapping
+    ptr = ARSTREAM2_H264Parser_MapFileRange(parser, naluStart, _naluSize);
+    if (!ptr)
+    {
+        return ARSTREAM2_ERROR_INVALID_STATE;
+    }
+
+    // Leave the file at the end of the NALU, as when it is read
+    ret = ARSTREAM2_H264_PARSER_FSEEK(fp, naluEnd);
+    if (ret != 0)
+    {
+        ARSAL_PRINT(ARSAL_PRINT_ERROR, ARSTREAM2_H264_PARSER_TAG, "Failed to seek in file");
+        return ARSTREAM2_ERROR_INVALID_STATE;
+    }
+
+    parser->naluBufManaged = 1;
+    parser->naluSize = _naluSize;
+    parser->remNaluSize = _naluSize;
+    parser->pNaluBufCur = ptr;
+
+    // Reset the cache
+    bitstreamReset(parser);
+
+    if (naluSize) *naluSize = _naluSize;
+    return ARSTREAM2_OK;
 }
 
 
@@ -3510,9 +3881,7 @@ eARSTREAM2_ERROR ARSTREAM2_H264Parser_ReadNextNalu_buffer(ARSTREAM2_H264Parser_H
             parser->pNaluBufCur = parser->pNaluBuf = (uint8_t*)pBuf + naluStart;
 
             // Reset the cache
-            parser->cache = 0;
-            parser->cacheLength = 0;
-            parser->oldZeroCount = 0; // NB: this value is wrong when emulation prevention is in use (inside NAL Units)
+            bitstreamReset(parser);
         }
         else
         {
@@ -3532,9 +3901,7 @@ eARSTREAM2_ERROR ARSTREAM2_H264Parser_ReadNextNalu_buffer(ARSTREAM2_H264Parser_H
         parser->pNaluBufCur = parser->pNaluBuf = (uint8_t*)pBuf;
 
         // Reset the cache
-        parser->cache = 0;
-        parser->cacheLength = 0;
-        parser->oldZeroCount = 0; // NB: this value is wrong when emulation prevention is in use (inside NAL Units)
+        bitstreamReset(parser);
 
         return ARSTREAM2_ERROR_NOT_FOUND;
     }
@@ -3569,9 +3936,7 @@ eARSTREAM2_ERROR ARSTREAM2_H264Parser_SetupNalu_buffer(ARSTREAM2_H264Parser_Hand
     parser->pNaluBufCur = parser->pNaluBuf = (uint8_t*)pNaluBuf;
 
     // Reset the cache
-    parser->cache = 0;
-    parser->cacheLength = 0;
-    parser->oldZeroCount = 0; // NB: this value is wrong when emulation prevention is in use (inside NAL Units)
+    bitstreamReset(parser);
 
     return ret;
 }
@@ -3759,8 +4124,7 @@ eARSTREAM2_ERROR ARSTREAM2_H264Parser_Init(ARSTREAM2_H264Parser_Handle* parserHa
         memcpy(&parser->config, config, sizeof(parser->config));
     }
 
-    parser->cache = 0;
-    parser->cacheLength = 0;
+    bitstreamReset(parser);
 
     parser->naluBufSize = 0;
     parser->pNaluBuf = NULL;
@@ -3788,6 +4152,8 @@ eARSTREAM2_ERROR ARSTREAM2_H264Parser_Free(ARSTREAM2_H264Parser_Handle parserHan
         free(parser->pNaluBuf);
     }
 
+    ARSTREAM2_H264Parser_UnmapFile(parser);
+
     for (i = 0; i < ARSTREAM2_H264_PARSER_MAX_USER_DATA_SEI_COUNT; i++)
     {
         if (parser->pUserDataBuf[i])
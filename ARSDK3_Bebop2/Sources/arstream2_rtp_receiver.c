@@ -22,6 +22,7 @@
 #include <libARSAL/ARSAL_Print.h>
 #include <libARSAL/ARSAL_Mutex.h>
 #include <libARSAL/ARSAL_Socket.h>
+#include <libARSAL/ARSAL_Trace.h>
 
 #if BUILD_LIBMUX
 #include <libmux.h>
@@ -44,6 +45,8 @@
 
 #define ARSTREAM2_RTP_RECEIVER_MONITORING_MAX_POINTS (2048)
 
+#define ARSTREAM2_RTP_RECEIVER_REORDER_MAX_WINDOW_PACKETS (1024)
+
 #define ARSTREAM2_RTP_RECEIVER_MONITORING_OUTPUT
 #ifdef ARSTREAM2_RTP_RECEIVER_MONITORING_OUTPUT
 #include <stdio.h>
@@ -137,6 +140,24 @@ struct ARSTREAM2_RtpReceiver_ProcessContext_t {
     int currentAuSize;
 };
 
+struct ARSTREAM2_RtpReceiver_ReorderContext_t {
+    int windowPackets;          // Number of packet slots, 0 if reordering is disabled
+    int windowMs;
+    int slotSize;
+    uint8_t *slotBuffer;        // windowPackets slots of slotSize bytes
+    int *packetSize;            // 0 if the slot is empty
+    uint64_t *recvTime;
+    int head;                   // Slot of nextSeqNum
+    int count;                  // Number of packets held
+    int nextSeqNum;             // Next sequence number to process, -1 before the first packet
+    int highestSeqNum;
+    uint32_t lastTimestamp;     // RTP timestamp of the last packet processed
+    int64_t tracedTimestamp;    // Newest RTP timestamp received, -1 before the first packet
+    uint32_t reorderedPackets;
+    uint32_t recoveredPackets;
+    uint32_t lateDroppedPackets;
+};
+
 struct ARSTREAM2_RtpReceiver_Ops_t {
     /* Stream channel */
     int (*streamChannelSetup)(ARSTREAM2_RtpReceiver_t *);
@@ -168,6 +189,8 @@ struct ARSTREAM2_RtpReceiver_t {
 
     /* Process context */
     struct ARSTREAM2_RtpReceiver_ProcessContext_t process;
+    struct ARSTREAM2_RtpReceiver_ReorderContext_t reorder;
+    int streamReadTimeoutMs;
 
     ARSTREAM2_RtpReceiver_NaluCallback_t naluCallback;
     void *naluCallbackUserPtr;
@@ -932,7 +955,7 @@ static int ARSTREAM2_RtpReceiver_NetReadData(ARSTREAM2_RtpReceiver_t *receiver,
             p.fd = receiver->net.streamSocket;
             p.events = POLLIN;
             p.revents = 0;
-            pollRet = WSAPoll(&p, 1, ARSTREAM2_RTP_RECEIVER_STREAM_DATAREAD_TIMEOUT_MS);
+            pollRet = WSAPoll(&p, 1, receiver->streamReadTimeoutMs);
             if (pollRet == 0)
             {
                 /* failed: poll timeout */
@@ -1496,6 +1519,225 @@ static void ARSTREAM2_RtpReceiver_ProcessData(ARSTREAM2_RtpReceiver_t *receiver,
     }
 }
 
+static uint64_t ARSTREAM2_RtpReceiver_GetTimeUs(void)
+{
+    struct timespec t1;
+    ARSAL_Time_GetTime(&t1);
+    return (uint64_t)t1.tv_sec * 1000000 + (uint64_t)t1.tv_nsec / 1000;
+}
+
+static void ARSTREAM2_RtpReceiver_ReorderProcess(ARSTREAM2_RtpReceiver_t *receiver, uint8_t *recvBuffer, int recvSize)
+{
+    ARSTREAM2_RTP_Header_t *header = (ARSTREAM2_RTP_Header_t*)recvBuffer;
+
+    receiver->reorder.lastTimestamp = ntohl(header->timestamp);
+    ARSTREAM2_RtpReceiver_ProcessData(receiver, recvBuffer, recvSize);
+}
+
+static void ARSTREAM2_RtpReceiver_ReorderAdvance(ARSTREAM2_RtpReceiver_t *receiver)
+{
+    struct ARSTREAM2_RtpReceiver_ReorderContext_t *reorder = &receiver->reorder;
+
+    if (reorder->packetSize[reorder->head] > 0)
+    {
+        ARSTREAM2_RtpReceiver_ReorderProcess(receiver, reorder->slotBuffer + reorder->head * reorder->slotSize, reorder->packetSize[reorder->head]);
+        reorder->packetSize[reorder->head] = 0;
+        reorder->count--;
+    }
+    /* else: the packet is missing, the gap is seen by ProcessData on the next packet */
+    reorder->head = (reorder->head + 1) % reorder->windowPackets;
+    reorder->nextSeqNum = (reorder->nextSeqNum + 1) & 0xFFFF;
+}
+
+static void ARSTREAM2_RtpReceiver_ReorderOutput(ARSTREAM2_RtpReceiver_t *receiver)
+{
+    struct ARSTREAM2_RtpReceiver_ReorderContext_t *reorder = &receiver->reorder;
+
+    /* process the packets which are now in sequence */
+    while ((reorder->count > 0) && (reorder->packetSize[reorder->head] > 0))
+    {
+        ARSTREAM2_RtpReceiver_ReorderAdvance(receiver);
+    }
+}
+
+static void ARSTREAM2_RtpReceiver_ReorderFlush(ARSTREAM2_RtpReceiver_t *receiver)
+{
+    struct ARSTREAM2_RtpReceiver_ReorderContext_t *reorder = &receiver->reorder;
+
+    /* give up on all the missing packets */
+    while (reorder->count > 0)
+    {
+        ARSTREAM2_RtpReceiver_ReorderAdvance(receiver);
+    }
+}
+
+static void ARSTREAM2_RtpReceiver_ReorderExpire(ARSTREAM2_RtpReceiver_t *receiver, uint64_t curTime)
+{
+    struct ARSTREAM2_RtpReceiver_ReorderContext_t *reorder = &receiver->reorder;
+    uint64_t oldestRecvTime;
+    int i, slot;
+
+    while (reorder->count > 0)
+    {
+        /* the head packet is missing: wait for it as long as no held packet is older than the window */
+        oldestRecvTime = curTime;
+        for (i = 1; i < reorder->windowPackets; i++)
+        {
+            slot = (reorder->head + i) % reorder->windowPackets;
+            if ((reorder->packetSize[slot] > 0) && (reorder->recvTime[slot] < oldestRecvTime))
+            {
+                oldestRecvTime = reorder->recvTime[slot];
+            }
+        }
+        if (curTime - oldestRecvTime < (uint64_t)reorder->windowMs * 1000)
+        {
+            break;
+        }
+
+        /* skip the gap up to the next held packet */
+        while (reorder->packetSize[reorder->head] == 0)
+        {
+            ARSTREAM2_RtpReceiver_ReorderAdvance(receiver);
+        }
+        ARSTREAM2_RtpReceiver_ReorderOutput(receiver);
+    }
+}
+
+static void ARSTREAM2_RtpReceiver_ReorderPacket(ARSTREAM2_RtpReceiver_t *receiver, uint8_t *recvBuffer, int recvSize, uint64_t curTime)
+{
+    struct ARSTREAM2_RtpReceiver_ReorderContext_t *reorder = &receiver->reorder;
+    ARSTREAM2_RTP_Header_t *header = (ARSTREAM2_RTP_Header_t*)recvBuffer;
+    int currentSeqNum = (int)ntohs(header->seqNum);
+    uint32_t rtpTimestamp = ntohl(header->timestamp);
+    int offset, slot, isReordered = 0;
+
+    /* trace the reception of an access unit before the reorder window may hold its first packet */
+    if ((reorder->tracedTimestamp == -1) || ((int32_t)(rtpTimestamp - (uint32_t)reorder->tracedTimestamp) > 0))
+    {
+        reorder->tracedTimestamp = rtpTimestamp;
+        /* the frame ID is the timestamp the NAL units are output with */
+        ARSAL_Trace_Record(ARSAL_TRACE_STAGE_RTP_ARRIVAL, ((((uint64_t)rtpTimestamp * 1000) + 45) / 90));
+    }
+
+    if (reorder->windowPackets == 0)
+    {
+        ARSTREAM2_RtpReceiver_ProcessData(receiver, recvBuffer, recvSize);
+        return;
+    }
+
+    if (reorder->nextSeqNum == -1)
+    {
+        reorder->nextSeqNum = currentSeqNum;
+        reorder->highestSeqNum = currentSeqNum;
+    }
+
+    offset = (currentSeqNum - reorder->nextSeqNum) & 0xFFFF;
+    if (offset >= 32768)
+    {
+        if ((int32_t)(rtpTimestamp - reorder->lastTimestamp) > 0)
+        {
+            /* an older sequence number with a newer timestamp: the sender restarted */
+            ARSAL_PRINT(ARSAL_PRINT_DEBUG, ARSTREAM2_RTP_RECEIVER_TAG, "Sequence number restart (currentSeqNum=%d, nextSeqNum=%d)", currentSeqNum, reorder->nextSeqNum);
+            ARSTREAM2_RtpReceiver_ReorderFlush(receiver);
+            reorder->nextSeqNum = currentSeqNum;
+            reorder->highestSeqNum = currentSeqNum;
+            offset = 0;
+        }
+        else
+        {
+            /* its slot was already released: late or duplicate packet */
+            ARSAL_Mutex_Lock(&(receiver->monitoringMutex));
+            reorder->reorderedPackets++;
+            reorder->lateDroppedPackets++;
+            ARSAL_Mutex_Unlock(&(receiver->monitoringMutex));
+            return;
+        }
+    }
+
+    if (((currentSeqNum - reorder->highestSeqNum) & 0xFFFF) >= 32768)
+    {
+        isReordered = 1;
+    }
+    else
+    {
+        reorder->highestSeqNum = currentSeqNum;
+    }
+
+    if ((offset >= reorder->windowPackets) && (reorder->count == 0))
+    {
+        /* nothing held: jump directly to the packet */
+        reorder->nextSeqNum = currentSeqNum;
+        offset = 0;
+    }
+    while (offset >= reorder->windowPackets)
+    {
+        /* the window is full: release its oldest sequence number and the packets now in sequence */
+        do
+        {
+            ARSTREAM2_RtpReceiver_ReorderAdvance(receiver);
+            offset--;
+        }
+        while (reorder->packetSize[reorder->head] > 0);
+    }
+    if (offset < 0)
+    {
+        /* duplicate of a packet released above */
+        ARSAL_Mutex_Lock(&(receiver->monitoringMutex));
+        reorder->lateDroppedPackets++;
+        ARSAL_Mutex_Unlock(&(receiver->monitoringMutex));
+        return;
+    }
+
+    if (offset == 0)
+    {
+        /* in sequence: process from the receive buffer, then the held packets that follow */
+        ARSTREAM2_RtpReceiver_ReorderProcess(receiver, recvBuffer, recvSize);
+        reorder->head = (reorder->head + 1) % reorder->windowPackets;
+        reorder->nextSeqNum = (reorder->nextSeqNum + 1) & 0xFFFF;
+        ARSTREAM2_RtpReceiver_ReorderOutput(receiver);
+    }
+    else
+    {
+        slot = (reorder->head + offset) % reorder->windowPackets;
+        if (reorder->packetSize[slot] > 0)
+        {
+            /* duplicate packet */
+            ARSAL_Mutex_Lock(&(receiver->monitoringMutex));
+            reorder->lateDroppedPackets++;
+            ARSAL_Mutex_Unlock(&(receiver->monitoringMutex));
+            return;
+        }
+        memcpy(reorder->slotBuffer + slot * reorder->slotSize, recvBuffer, recvSize);
+        reorder->packetSize[slot] = recvSize;
+        reorder->recvTime[slot] = curTime;
+        reorder->count++;
+    }
+
+    if (isReordered)
+    {
+        ARSAL_Mutex_Lock(&(receiver->monitoringMutex));
+        reorder->reorderedPackets++;
+        reorder->recoveredPackets++;
+        ARSAL_Mutex_Unlock(&(receiver->monitoringMutex));
+    }
+}
+
+static void ARSTREAM2_RtpReceiver_ReorderReset(ARSTREAM2_RtpReceiver_t *receiver)
+{
+    struct ARSTREAM2_RtpReceiver_ReorderContext_t *reorder = &receiver->reorder;
+
+    reorder->head = 0;
+    reorder->count = 0;
+    reorder->nextSeqNum = -1;
+    reorder->highestSeqNum = -1;
+    reorder->lastTimestamp = 0;
+    reorder->tracedTimestamp = -1;
+    if (reorder->packetSize)
+    {
+        memset(reorder->packetSize, 0, reorder->windowPackets * sizeof(int));
+    }
+}
+
 void ARSTREAM2_RtpReceiver_Stop(ARSTREAM2_RtpReceiver_t *receiver)
 {
     int i, ret;
@@ -1630,6 +1872,16 @@ ARSTREAM2_RtpReceiver_t* ARSTREAM2_RtpReceiver_New(ARSTREAM2_RtpReceiver_Config_
         retReceiver->maxLatencyMs = (config->maxLatencyMs > 0) ? config->maxLatencyMs : 0;
         retReceiver->maxNetworkLatencyMs = (config->maxNetworkLatencyMs > 0) ? config->maxNetworkLatencyMs : 0;
         retReceiver->insertStartCodes = (config->insertStartCodes > 0) ? 1 : 0;
+        retReceiver->streamReadTimeoutMs = ARSTREAM2_RTP_RECEIVER_STREAM_DATAREAD_TIMEOUT_MS;
+        if (config->reorderWindowPackets >= 0)
+        {
+            retReceiver->reorder.windowPackets = (config->reorderWindowPackets > 0) ? config->reorderWindowPackets : ARSTREAM2_RTP_RECEIVER_DEFAULT_REORDER_WINDOW_PACKETS;
+            if (retReceiver->reorder.windowPackets > ARSTREAM2_RTP_RECEIVER_REORDER_MAX_WINDOW_PACKETS)
+            {
+                retReceiver->reorder.windowPackets = ARSTREAM2_RTP_RECEIVER_REORDER_MAX_WINDOW_PACKETS;
+            }
+            retReceiver->reorder.windowMs = (config->reorderWindowMs > 0) ? config->reorderWindowMs : ARSTREAM2_RTP_RECEIVER_DEFAULT_REORDER_WINDOW_MS;
+        }
 
         if (net_config)
         {
@@ -1746,6 +1998,17 @@ ARSTREAM2_RtpReceiver_t* ARSTREAM2_RtpReceiver_New(ARSTREAM2_RtpReceiver_Config_
             internalError = ARSTREAM2_ERROR_ALLOC;
         }
     }
+    if ((internalError == ARSTREAM2_OK) && (retReceiver->reorder.windowPackets > 0))
+    {
+        retReceiver->reorder.slotSize = retReceiver->maxPacketSize + sizeof(ARSTREAM2_RTP_Header_t);
+        retReceiver->reorder.slotBuffer = malloc(retReceiver->reorder.windowPackets * retReceiver->reorder.slotSize);
+        retReceiver->reorder.packetSize = calloc(retReceiver->reorder.windowPackets, sizeof(int));
+        retReceiver->reorder.recvTime = calloc(retReceiver->reorder.windowPackets, sizeof(uint64_t));
+        if ((!retReceiver->reorder.slotBuffer) || (!retReceiver->reorder.packetSize) || (!retReceiver->reorder.recvTime))
+        {
+            internalError = ARSTREAM2_ERROR_ALLOC;
+        }
+    }
 
 #ifdef ARSTREAM2_RTP_RECEIVER_MONITORING_OUTPUT
     if (internalError == ARSTREAM2_OK)
@@ -1852,6 +2115,12 @@ ARSTREAM2_RtpReceiver_t* ARSTREAM2_RtpReceiver_New(ARSTREAM2_RtpReceiver_Config_
         {
             free(retReceiver->naluMetadata);
         }
+        if (retReceiver)
+        {
+            free(retReceiver->reorder.slotBuffer);
+            free(retReceiver->reorder.packetSize);
+            free(retReceiver->reorder.recvTime);
+        }
 
 #if BUILD_LIBMUX
         if ((retReceiver) && (retReceiver->mux.mux))
@@ -1986,6 +2255,9 @@ eARSTREAM2_ERROR ARSTREAM2_RtpReceiver_Delete(ARSTREAM2_RtpReceiver_t **receiver
             {
                 free((*receiver)->naluMetadata);
             }
+            free((*receiver)->reorder.slotBuffer);
+            free((*receiver)->reorder.packetSize);
+            free((*receiver)->reorder.recvTime);
             free(*receiver);
             *receiver = NULL;
             retVal = ARSTREAM2_OK;
@@ -2048,6 +2320,7 @@ void* ARSTREAM2_RtpReceiver_RunStreamThread(void *ARSTREAM2_RtpReceiver_t_Param)
     receiver->process.auStartSeqNum = -1;
     receiver->process.naluStartSeqNum = -1;
     receiver->process.gapsInSeqNumAu = 0;
+    ARSTREAM2_RtpReceiver_ReorderReset(receiver);
 
     while (shouldStop == 0)
     {
@@ -2068,8 +2341,15 @@ void* ARSTREAM2_RtpReceiver_RunStreamThread(void *ARSTREAM2_RtpReceiver_t_Param)
         }
         else if (recvSize >= 0 && (size_t)recvSize >= sizeof(ARSTREAM2_RTP_Header_t))
         {
-            ARSTREAM2_RtpReceiver_ProcessData(receiver, recvBuffer, recvSize);
+            ARSTREAM2_RtpReceiver_ReorderPacket(receiver, recvBuffer, recvSize, ARSTREAM2_RtpReceiver_GetTimeUs());
+        }
+
+        if (receiver->reorder.count > 0)
+        {
+            /* release the gaps which waited too long, and do not sleep longer than the window while packets are held */
+            ARSTREAM2_RtpReceiver_ReorderExpire(receiver, ARSTREAM2_RtpReceiver_GetTimeUs());
         }
+        receiver->streamReadTimeoutMs = (receiver->reorder.count > 0) ? receiver->reorder.windowMs : ARSTREAM2_RTP_RECEIVER_STREAM_DATAREAD_TIMEOUT_MS;
 
         ARSAL_Mutex_Lock(&(receiver->streamMutex));
         if (shouldStop == 0)
@@ -2170,6 +2450,23 @@ void* ARSTREAM2_RtpReceiver_GetNaluCallbackUserPtr(ARSTREAM2_RtpReceiver_t *rece
 }
 
 
+eARSTREAM2_ERROR ARSTREAM2_RtpReceiver_GetReorderCounters(ARSTREAM2_RtpReceiver_t *receiver, uint32_t *reorderedPackets, uint32_t *recoveredPackets, uint32_t *lateDroppedPackets)
+{
+    if (receiver == NULL)
+    {
+        return ARSTREAM2_ERROR_BAD_PARAMETERS;
+    }
+
+    ARSAL_Mutex_Lock(&(receiver->monitoringMutex));
+    SET_WITH_CHECK(reorderedPackets, receiver->reorder.reorderedPackets);
+    SET_WITH_CHECK(recoveredPackets, receiver->reorder.recoveredPackets);
+    SET_WITH_CHECK(lateDroppedPackets, receiver->reorder.lateDroppedPackets);
+    ARSAL_Mutex_Unlock(&(receiver->monitoringMutex));
+
+    return ARSTREAM2_OK;
+}
+
+
 eARSTREAM2_ERROR ARSTREAM2_RtpReceiver_GetMonitoring(ARSTREAM2_RtpReceiver_t *receiver, uint64_t startTime, uint32_t timeIntervalUs, uint32_t *realTimeIntervalUs, uint32_t *receptionTimeJitter,
                                                      uint32_t *bytesReceived, uint32_t *meanPacketSize, uint32_t *packetSizeStdDev, uint32_t *packetsReceived, uint32_t *packetsMissed)
 {
@@ -101,6 +101,8 @@ eARSTREAM2_ERROR ARSTREAM2_StreamReceiver_Init(ARSTREAM2_StreamReceiver_Handle *
         receiverConfig.maxLatencyMs = config->maxLatencyMs;
         receiverConfig.maxNetworkLatencyMs = config->maxNetworkLatencyMs;
         receiverConfig.insertStartCodes = 1;
+        receiverConfig.reorderWindowPackets = config->reorderWindowPackets;
+        receiverConfig.reorderWindowMs = config->reorderWindowMs;
 
         if (usemux) {
             receiver_mux_config.mux = mux_config->mux;
@@ -0,0 +1,790 @@
+#define TAG "Bebop2Simulator"
+
+#include <WinSock2.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+
+extern "C" {
+#include <libARSAL/ARSAL_Print.h>
+#include <libARSAL/ARSAL_Time.h>
+#include <json/json.h>
+}
+
+#include "Bebop2Simulator.h"
+#include "bebop2_device.h"
+
+// Buffer IDs of the Bebop network configuration, seen from the drone.
+#define SIMULATOR_C2D_NONACK_ID 10
+#define SIMULATOR_C2D_ACK_ID 11
+#define SIMULATOR_C2D_EMERGENCY_ID 12
+#define SIMULATOR_D2C_NAVDATA_ID ((ARNETWORKAL_MANAGER_WIFI_ID_MAX / 2) - 1)
+#define SIMULATOR_D2C_EVENT_ID ((ARNETWORKAL_MANAGER_WIFI_ID_MAX / 2) - 2)
+
+// Flight model
+#define SIMULATOR_MAX_TILT_DEG 20.0
+#define SIMULATOR_MAX_HORIZONTAL_SPEED 5.0
+#define SIMULATOR_MAX_VERTICAL_SPEED 1.0
+#define SIMULATOR_MAX_ROTATION_SPEED_DEG 100.0
+#define SIMULATOR_TAKEOFF_ALTITUDE 1.0
+#define SIMULATOR_BATTERY_FLIGHT_MINUTES 20.0
+
+namespace
+{
+	const double PI = 3.14159265358979323846;
+
+	// Sent by the drone, received by the controller
+	ARNETWORK_IOBufferParam_t d2cParams[] =
+	{
+		{ SIMULATOR_D2C_NAVDATA_ID, ARNETWORKAL_FRAME_TYPE_DATA, 20, ARNETWORK_IOBUFFERPARAM_INFINITE_NUMBER, ARNETWORK_IOBUFFERPARAM_INFINITE_NUMBER, 20, SIMULATOR_COMMAND_BUFFER_SIZE, 1 },
+		{ SIMULATOR_D2C_EVENT_ID, ARNETWORKAL_FRAME_TYPE_DATA_WITH_ACK, 0, 150, 5, 256, SIMULATOR_COMMAND_BUFFER_SIZE, 0 },
+	};
+
+	// Sent by the controller, received by the drone
+	ARNETWORK_IOBufferParam_t c2dParams[] =
+	{
+		{ SIMULATOR_C2D_NONACK_ID, ARNETWORKAL_FRAME_TYPE_DATA, 0, ARNETWORK_IOBUFFERPARAM_INFINITE_NUMBER, ARNETWORK_IOBUFFERPARAM_INFINITE_NUMBER, 2, SIMULATOR_COMMAND_BUFFER_SIZE, 1 },
+		{ SIMULATOR_C2D_ACK_ID, ARNETWORKAL_FRAME_TYPE_DATA_WITH_ACK, 0, 150, 5, 20, SIMULATOR_COMMAND_BUFFER_SIZE, 0 },
+		{ SIMULATOR_C2D_EMERGENCY_ID, ARNETWORKAL_FRAME_TYPE_DATA_WITH_ACK, 0, 150, ARNETWORK_IOBUFFERPARAM_INFINITE_NUMBER, 1, SIMULATOR_COMMAND_BUFFER_SIZE, 0 },
+	};
+
+	const int d2cParamsCount = sizeof(d2cParams) / sizeof(d2cParams[0]);
+	const int c2dParamsCount = sizeof(c2dParams) / sizeof(c2dParams[0]);
+
+	uint64_t nowUs()
+	{
+		struct timespec now;
+		ARSAL_Time_GetTime(&now);
+		return static_cast<uint64_t>(now.tv_sec) * 1000000 + now.tv_nsec / 1000;
+	}
+
+	double degToRad(double deg)
+	{
+		return deg * PI / 180.0;
+	}
+}
+
+Bebop2Simulator::Config Bebop2Simulator::defaultConfig(const std::string& videoPath)
+{
+	Config config;
+	config.videoPath = videoPath;
+	config.fps = SIMULATOR_DEFAULT_FPS;
+	config.telemetryHz = SIMULATOR_DEFAULT_TELEMETRY_HZ;
+	config.lossRate = 0;
+	config.lossBurst = 1;
+	config.seed = 0;
+	return config;
+}
+
+Bebop2Simulator::Bebop2Simulator(const Config& config)
+	: mConfig(config), mConnection(nullptr), mD2cPort(0), mClientStreamPort(0), mClientControlPort(0),
+	mSessionRunning(false), mNetworkAL(nullptr), mNetwork(nullptr), mRtpSender(nullptr),
+	mVideoEnabled(false), mLastBatteryPercent(100),
+	mAccessUnitsSent(0), mNalusDropped(0), mCommandsReceived(0)
+{
+	if (mConfig.fps <= 0) mConfig.fps = SIMULATOR_DEFAULT_FPS;
+	if (mConfig.telemetryHz <= 0) mConfig.telemetryHz = SIMULATOR_DEFAULT_TELEMETRY_HZ;
+	if (mConfig.lossBurst < 1) mConfig.lossBurst = 1;
+
+	memset(&mFlight, 0, sizeof(mFlight));
+	mFlight.flyingState = ARCOMMANDS_ARDRONE3_PILOTINGSTATE_FLYINGSTATECHANGED_STATE_LANDED;
+	mFlight.battery = 100;
+}
+
+Bebop2Simulator::~Bebop2Simulator()
+{
+	stop();
+}
+
+bool Bebop2Simulator::load()
+{
+	// Same access units as ReplayBenchmark; the RTP sender takes their NAL units without the start codes.
+	if (!ReplayBenchmark::loadAccessUnits(mConfig.videoPath, mData, mNalus, mAccessUnits))
+	{
+		return false;
+	}
+
+	ARSAL_PRINT(ARSAL_PRINT_INFO, TAG, "%s: %u NAL units, %u access units.", mConfig.videoPath.c_str(), static_cast<unsigned>(mNalus.size()), static_cast<unsigned>(mAccessUnits.size()));
+
+	return true;
+}
+
+bool Bebop2Simulator::start()
+{
+	if (mConnection != nullptr)
+	{
+		return true;
+	}
+
+	if (!load())
+	{
+		return false;
+	}
+
+	eARDISCOVERY_ERROR error = ARDISCOVERY_OK;
+	mConnection = ARDISCOVERY_Connection_New(onSendJson, onReceiveJson, this, &error);
+	if (error != ARDISCOVERY_OK)
+	{
+		ARSAL_PRINT(ARSAL_PRINT_ERROR, TAG, "ARDISCOVERY_Connection_New failed: %s", ARDISCOVERY_Error_ToString(error));
+		mConnection = nullptr;
+		return false;
+	}
+
+	mListeningThread = std::thread([this]()
+	{
+		auto listeningError = ARDISCOVERY_Connection_DeviceListeningLoop(mConnection, BEBOP_DISCOVERY_PORT);
+		if (listeningError != ARDISCOVERY_OK)
+		{
+			ARSAL_PRINT(ARSAL_PRINT_ERROR, TAG, "Discovery listening loop failed: %s", ARDISCOVERY_Error_ToString(listeningError));
+		}
+	});
+
+	ARSAL_PRINT(ARSAL_PRINT_INFO, TAG, "Waiting for a controller on port %d.", BEBOP_DISCOVERY_PORT);
+
+	return true;
+}
+
+void Bebop2Simulator::stop()
+{
+	if (mConnection == nullptr)
+	{
+		return;
+	}
+
+	ARDISCOVERY_Connection_Device_StopListening(mConnection);
+	if (mListeningThread.joinable())
+	{
+		mListeningThread.join();
+	}
+	ARDISCOVERY_Connection_Delete(&mConnection);
+
+	stopSession();
+
+	ARSAL_PRINT(ARSAL_PRINT_INFO, TAG, "Stopped: %llu access units sent, %llu NAL units dropped, %llu commands received.",
+		static_cast<unsigned long long>(mAccessUnitsSent), static_cast<unsigned long long>(mNalusDropped), static_cast<unsigned long long>(mCommandsReceived));
+}
+
+bool Bebop2Simulator::startSession()
+{
+	std::lock_guard<std::mutex> lock(mSessionMutex);
+
+	eARNETWORKAL_ERROR alError = ARNETWORKAL_OK;
+	eARNETWORK_ERROR netError = ARNETWORK_OK;
+	eARSTREAM2_ERROR streamError = ARSTREAM2_OK;
+
+	mNetworkAL = ARNETWORKAL_Manager_New(&alError);
+	if (alError == ARNETWORKAL_OK)
+	{
+		alError = ARNETWORKAL_Manager_InitWifiNetwork(mNetworkAL, mControllerAddress.c_str(), mD2cPort, SIMULATOR_C2D_PORT, 1);
+	}
+	if (alError != ARNETWORKAL_OK)
+	{
+		ARSAL_PRINT(ARSAL_PRINT_ERROR, TAG, "ARNetworkAL init failed: %s", ARNETWORKAL_Error_ToString(alError));
+		ARNETWORKAL_Manager_Delete(&mNetworkAL);
+		return false;
+	}
+
+	mNetwork = ARNETWORK_Manager_New(mNetworkAL, d2cParamsCount, d2cParams, c2dParamsCount, c2dParams, 0, onDisconnect, this, &netError);
+	if (netError != ARNETWORK_OK)
+	{
+		ARSAL_PRINT(ARSAL_PRINT_ERROR, TAG, "ARNETWORK_Manager_New failed: %s", ARNETWORK_Error_ToString(netError));
+		ARNETWORKAL_Manager_CloseWifiNetwork(mNetworkAL);
+		ARNETWORKAL_Manager_Delete(&mNetworkAL);
+		return false;
+	}
+
+	ARSTREAM2_RtpSender_Config_t senderConfig;
+	memset(&senderConfig, 0, sizeof(senderConfig));
+	senderConfig.clientAddr = mControllerAddress.c_str();
+	senderConfig.serverStreamPort = ARSTREAM2_RTP_SENDER_DEFAULT_SERVER_STREAM_PORT;
+	senderConfig.serverControlPort = ARSTREAM2_RTP_SENDER_DEFAULT_SERVER_CONTROL_PORT;
+	senderConfig.clientStreamPort = mClientStreamPort;
+	senderConfig.clientControlPort = mClientControlPort;
+	senderConfig.classSelector = ARSAL_SOCKET_CLASS_SELECTOR_UNSPECIFIED;
+	senderConfig.naluFifoSize = ARSTREAM2_RTP_SENDER_DEFAULT_NALU_FIFO_SIZE;
+	senderConfig.maxPacketSize = SIMULATOR_MAX_PACKET_SIZE;
+	senderConfig.targetPacketSize = SIMULATOR_TARGET_PACKET_SIZE;
+	senderConfig.maxNetworkLatencyMs = SIMULATOR_MAX_NETWORK_LATENCY_MS;
+
+	mRtpSender = ARSTREAM2_RtpSender_New(&senderConfig, &streamError);
+	if (streamError != ARSTREAM2_OK)
+	{
+		// Commands and telemetry still work without the video.
+		ARSAL_PRINT(ARSAL_PRINT_ERROR, TAG, "ARSTREAM2_RtpSender_New failed: %s", ARSTREAM2_Error_ToString(streamError));
+		mRtpSender = nullptr;
+	}
+
+	mSessionRunning = true;
+
+	mSessionThreads.emplace_back(ARNETWORK_Manager_SendingThreadRun, mNetwork);
+	mSessionThreads.emplace_back(ARNETWORK_Manager_ReceivingThreadRun, mNetwork);
+	for (int i = 0; i < c2dParamsCount; ++i)
+	{
+		mSessionThreads.emplace_back(&Bebop2Simulator::readLoop, this, c2dParams[i].ID);
+	}
+	if (mRtpSender != nullptr)
+	{
+		mSessionThreads.emplace_back(ARSTREAM2_RtpSender_RunStreamThread, mRtpSender);
+		mSessionThreads.emplace_back(ARSTREAM2_RtpSender_RunControlThread, mRtpSender);
+		mSessionThreads.emplace_back(&Bebop2Simulator::videoLoop, this);
+	}
+	mSessionThreads.emplace_back(&Bebop2Simulator::telemetryLoop, this);
+
+	ARSAL_PRINT(ARSAL_PRINT_INFO, TAG, "Controller %s connected: d2c %d, video %d/%d.", mControllerAddress.c_str(), mD2cPort, mClientStreamPort, mClientControlPort);
+
+	return true;
+}
+
+void Bebop2Simulator::stopSession()
+{
+	std::lock_guard<std::mutex> lock(mSessionMutex);
+
+	if (mNetwork == nullptr)
+	{
+		return;
+	}
+
+	mSessionRunning = false;
+	{
+		std::lock_guard<std::mutex> videoLock(mVideoMutex);
+		mVideoEnabled = false;
+	}
+	mVideoCondition.notify_all();
+
+	if (mRtpSender != nullptr)
+	{
+		ARSTREAM2_RtpSender_Stop(mRtpSender);
+	}
+	ARNETWORK_Manager_Stop(mNetwork);
+	ARNETWORKAL_Manager_Unlock(mNetworkAL);
+
+	for (auto& thread : mSessionThreads)
+	{
+		thread.join();
+	}
+	mSessionThreads.clear();
+
+	if (mRtpSender != nullptr)
+	{
+		ARSTREAM2_RtpSender_Delete(&mRtpSender);
+	}
+	ARNETWORK_Manager_Delete(&mNetwork);
+	ARNETWORKAL_Manager_CloseWifiNetwork(mNetworkAL);
+	ARNETWORKAL_Manager_Delete(&mNetworkAL);
+}
+
+void Bebop2Simulator::readLoop(int bufferId)
+{
+	eARCOMMANDS_DECODER_ERROR decoderError = ARCOMMANDS_DECODER_OK;
+	ARCOMMANDS_Decoder_t* decoder = ARCOMMANDS_Decoder_NewDecoder(&decoderError);
+	if (decoderError != ARCOMMANDS_DECODER_OK)
+	{
+		ARSAL_PRINT(ARSAL_PRINT_ERROR, TAG, "Can not create the command decoder for buffer %d.", bufferId);
+		return;
+	}
+
+	ARCOMMANDS_Decoder_SetARDrone3PilotingPCMDCb(decoder, onPcmd, this);
+	ARCOMMANDS_Decoder_SetARDrone3PilotingTakeOffCb(decoder, onTakeOff, this);
+	ARCOMMANDS_Decoder_SetARDrone3PilotingLandingCb(decoder, onLanding, this);
+	ARCOMMANDS_Decoder_SetARDrone3PilotingEmergencyCb(decoder, onEmergency, this);
+	ARCOMMANDS_Decoder_SetARDrone3MediaStreamingVideoEnableCb(decoder, onVideoEnable, this);
+	ARCOMMANDS_Decoder_SetCommonCommonAllStatesCb(decoder, onAllStates, this);
+	ARCOMMANDS_Decoder_SetCommonSettingsAllSettingsCb(decoder, onAllSettings, this);
+
+	uint8_t buffer[SIMULATOR_COMMAND_BUFFER_SIZE];
+	while (mSessionRunning)
+	{
+		int readSize = 0;
+		auto error = ARNETWORK_Manager_ReadDataWithTimeout(mNetwork, bufferId, buffer, sizeof(buffer), &readSize, 1000);
+		if (error == ARNETWORK_OK)
+		{
+			++mCommandsReceived;
+			// Commands the simulator does not handle decode to nothing.
+			ARCOMMANDS_Decoder_DecodeCommand(decoder, buffer, readSize);
+		}
+		else if (error != ARNETWORK_ERROR_BUFFER_EMPTY)
+		{
+			ARSAL_PRINT(ARSAL_PRINT_DEBUG, TAG, "Read on buffer %d: %s", bufferId, ARNETWORK_Error_ToString(error));
+		}
+	}
+
+	ARCOMMANDS_Decoder_DeleteDecoder(&decoder);
+}
+
+void Bebop2Simulator::videoLoop()
+{
+	std::mt19937 random(mConfig.seed);
+	std::uniform_real_distribution<double> uniform(0.0, 1.0);
+	int lossRemaining = 0;
+	int discontinuity = 0;
+
+	const auto period = std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(1.0 / mConfig.fps));
+	std::vector<ARSTREAM2_RtpSender_H264NaluDesc_t> descs;
+	size_t index = 0;
+
+	while (mSessionRunning)
+	{
+		{
+			std::unique_lock<std::mutex> lock(mVideoMutex);
+			mVideoCondition.wait(lock, [this]() { return mVideoEnabled || !mSessionRunning; });
+		}
+		if (!mSessionRunning)
+		{
+			break;
+		}
+
+		auto next = std::chrono::steady_clock::now();
+		while (mSessionRunning && mVideoEnabled)
+		{
+			const auto& accessUnit = mAccessUnits[index];
+			const uint64_t timestamp = nowUs();
+
+			descs.clear();
+			for (size_t i = 0; i < accessUnit.naluCount; ++i)
+			{
+				const auto& nalu = mNalus[accessUnit.firstNalu + i];
+
+				if (lossRemaining == 0 && mConfig.lossRate > 0 && uniform(random) < mConfig.lossRate)
+				{
+					lossRemaining = mConfig.lossBurst;
+				}
+				if (lossRemaining > 0)
+				{
+					// Let the receiver see the hole in the RTP sequence numbers.
+					--lossRemaining;
+					++discontinuity;
+					++mNalusDropped;
+					continue;
+				}
+
+				ARSTREAM2_RtpSender_H264NaluDesc_t desc;
+				memset(&desc, 0, sizeof(desc));
+				desc.naluBuffer = &mData[nalu.offset];
+				desc.naluSize = static_cast<uint32_t>(nalu.size);
+				desc.auTimestamp = timestamp;
+				desc.seqNumForcedDiscontinuity = discontinuity;
+				descs.push_back(desc);
+				discontinuity = 0;
+			}
+
+			if (!descs.empty())
+			{
+				descs.back().isLastNaluInAu = 1;
+				auto error = ARSTREAM2_RtpSender_SendNNewNalu(mRtpSender, &descs[0], static_cast<int>(descs.size()));
+				if (error == ARSTREAM2_OK)
+				{
+					++mAccessUnitsSent;
+				}
+				else
+				{
+					ARSAL_PRINT(ARSAL_PRINT_WARNING, TAG, "Access unit %u not sent: %s", static_cast<unsigned>(index), ARSTREAM2_Error_ToString(error));
+				}
+			}
+
+			// The recording loops, the receiver only sees a jump back in the pictures.
+			index = (index + 1) % mAccessUnits.size();
+
+			next += period;
+			std::this_thread::sleep_until(next);
+		}
+	}
+}
+
+void Bebop2Simulator::telemetryLoop()
+{
+	const auto period = std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(1.0 / mConfig.telemetryHz));
+	auto next = std::chrono::steady_clock::now();
+	auto last = next;
+	uint8_t command[SIMULATOR_COMMAND_BUFFER_SIZE];
+	int32_t size = 0;
+
+	while (mSessionRunning)
+	{
+		next += period;
+		std::this_thread::sleep_until(next);
+
+		const auto now = std::chrono::steady_clock::now();
+		const double dt = std::chrono::duration<double>(now - last).count();
+		last = now;
+
+		FlightState flight;
+		auto previousState = ARCOMMANDS_ARDRONE3_PILOTINGSTATE_FLYINGSTATECHANGED_STATE_MAX;
+		{
+			std::lock_guard<std::mutex> lock(mFlightMutex);
+			previousState = mFlight.flyingState;
+			updateFlight(mFlight, dt);
+			flight = mFlight;
+		}
+
+		if (flight.flyingState != previousState)
+		{
+			setFlyingState(flight.flyingState);
+		}
+
+		if (ARCOMMANDS_Generator_GenerateARDrone3PilotingStateAttitudeChanged(command, sizeof(command), &size, flight.roll, flight.pitch, flight.yaw) == ARCOMMANDS_GENERATOR_OK)
+		{
+			sendCommand(SIMULATOR_D2C_NAVDATA_ID, command, size);
+		}
+		if (ARCOMMANDS_Generator_GenerateARDrone3PilotingStateSpeedChanged(command, sizeof(command), &size, flight.speedX, flight.speedY, flight.speedZ) == ARCOMMANDS_GENERATOR_OK)
+		{
+			sendCommand(SIMULATOR_D2C_NAVDATA_ID, command, size);
+		}
+		if (ARCOMMANDS_Generator_GenerateARDrone3PilotingStateAltitudeChanged(command, sizeof(command), &size, flight.altitude) == ARCOMMANDS_GENERATOR_OK)
+		{
+			sendCommand(SIMULATOR_D2C_NAVDATA_ID, command, size);
+		}
+
+		// The battery is an event: only sent when the percentage changes.
+		const auto percent = static_cast<uint8_t>(std::ceil(flight.battery));
+		if (percent != mLastBatteryPercent)
+		{
+			mLastBatteryPercent = percent;
+			if (ARCOMMANDS_Generator_GenerateCommonCommonStateBatteryStateChanged(command, sizeof(command), &size, percent) == ARCOMMANDS_GENERATOR_OK)
+			{
+				sendCommand(SIMULATOR_D2C_EVENT_ID, command, size);
+			}
+		}
+	}
+}
+
+void Bebop2Simulator::updateFlight(FlightState& flight, double dt) const
+{
+	const double maxTilt = degToRad(SIMULATOR_MAX_TILT_DEG);
+	const bool airborne =
+		(flight.flyingState == ARCOMMANDS_ARDRONE3_PILOTINGSTATE_FLYINGSTATECHANGED_STATE_HOVERING) ||
+		(flight.flyingState == ARCOMMANDS_ARDRONE3_PILOTINGSTATE_FLYINGSTATECHANGED_STATE_FLYING);
+
+	double forward = 0;
+	double right = 0;
+	double climb = 0;
+
+	switch (flight.flyingState)
+	{
+	case ARCOMMANDS_ARDRONE3_PILOTINGSTATE_FLYINGSTATECHANGED_STATE_TAKINGOFF:
+		climb = SIMULATOR_MAX_VERTICAL_SPEED;
+		if (flight.altitude + climb * dt >= SIMULATOR_TAKEOFF_ALTITUDE)
+		{
+			flight.flyingState = ARCOMMANDS_ARDRONE3_PILOTINGSTATE_FLYINGSTATECHANGED_STATE_HOVERING;
+		}
+		break;
+	case ARCOMMANDS_ARDRONE3_PILOTINGSTATE_FLYINGSTATECHANGED_STATE_LANDING:
+		climb = -SIMULATOR_MAX_VERTICAL_SPEED;
+		break;
+	case ARCOMMANDS_ARDRONE3_PILOTINGSTATE_FLYINGSTATECHANGED_STATE_EMERGENCY:
+		// Motors cut: the drone is on the ground at the next update.
+		flight.altitude = 0;
+		flight.flyingState = ARCOMMANDS_ARDRONE3_PILOTINGSTATE_FLYINGSTATECHANGED_STATE_LANDED;
+		break;
+	default:
+		break;
+	}
+
+	if (airborne)
+	{
+		if (flight.pcmdFlag)
+		{
+			forward = flight.pcmdPitch / 100.0 * SIMULATOR_MAX_HORIZONTAL_SPEED;
+			right = flight.pcmdRoll / 100.0 * SIMULATOR_MAX_HORIZONTAL_SPEED;
+		}
+		climb = flight.pcmdGaz / 100.0 * SIMULATOR_MAX_VERTICAL_SPEED;
+		flight.yaw += static_cast<float>(flight.pcmdYaw / 100.0 * degToRad(SIMULATOR_MAX_ROTATION_SPEED_DEG) * dt);
+		flight.yaw = static_cast<float>(std::remainder(flight.yaw, 2 * PI));
+
+		const bool moving = (forward != 0) || (right != 0) || (climb != 0) || (flight.pcmdYaw != 0);
+		flight.flyingState = moving ? ARCOMMANDS_ARDRONE3_PILOTINGSTATE_FLYINGSTATECHANGED_STATE_FLYING : ARCOMMANDS_ARDRONE3_PILOTINGSTATE_FLYINGSTATECHANGED_STATE_HOVERING;
+	}
+
+	flight.roll = static_cast<float>(right / SIMULATOR_MAX_HORIZONTAL_SPEED * maxTilt);
+	flight.pitch = static_cast<float>(forward / SIMULATOR_MAX_HORIZONTAL_SPEED * maxTilt);
+	flight.speedX = static_cast<float>(forward * std::cos(flight.yaw) - right * std::sin(flight.yaw));
+	flight.speedY = static_cast<float>(forward * std::sin(flight.yaw) + right * std::cos(flight.yaw));
+	flight.speedZ = static_cast<float>(-climb);
+
+	flight.altitude = std::max(0.0, flight.altitude + climb * dt);
+	if ((flight.flyingState == ARCOMMANDS_ARDRONE3_PILOTINGSTATE_FLYINGSTATECHANGED_STATE_LANDING) && (flight.altitude <= 0))
+	{
+		flight.flyingState = ARCOMMANDS_ARDRONE3_PILOTINGSTATE_FLYINGSTATECHANGED_STATE_LANDED;
+	}
+
+	if (flight.flyingState != ARCOMMANDS_ARDRONE3_PILOTINGSTATE_FLYINGSTATECHANGED_STATE_LANDED)
+	{
+		flight.battery = std::max(0.0, flight.battery - dt * 100.0 / (SIMULATOR_BATTERY_FLIGHT_MINUTES * 60.0));
+	}
+}
+
+void Bebop2Simulator::setFlyingState(eARCOMMANDS_ARDRONE3_PILOTINGSTATE_FLYINGSTATECHANGED_STATE state)
+{
+	uint8_t command[SIMULATOR_COMMAND_BUFFER_SIZE];
+	int32_t size = 0;
+
+	ARSAL_PRINT(ARSAL_PRINT_INFO, TAG, "Flying state %d", state);
+
+	if (ARCOMMANDS_Generator_GenerateARDrone3PilotingStateFlyingStateChanged(command, sizeof(command), &size, state) == ARCOMMANDS_GENERATOR_OK)
+	{
+		sendCommand(SIMULATOR_D2C_EVENT_ID, command, size);
+	}
+}
+
+void Bebop2Simulator::sendAllStates()
+{
+	uint8_t command[SIMULATOR_COMMAND_BUFFER_SIZE];
+	int32_t size = 0;
+	FlightState flight;
+	{
+		std::lock_guard<std::mutex> lock(mFlightMutex);
+		flight = mFlight;
+	}
+
+	if (ARCOMMANDS_Generator_GenerateCommonCommonStateBatteryStateChanged(command, sizeof(command), &size, static_cast<uint8_t>(std::ceil(flight.battery))) == ARCOMMANDS_GENERATOR_OK)
+	{
+		sendCommand(SIMULATOR_D2C_EVENT_ID, command, size);
+	}
+	setFlyingState(flight.flyingState);
+
+	// Ends the initial states of ARCONTROLLER_Device_GetInitialStates
+	if (ARCOMMANDS_Generator_GenerateCommonCommonStateAllStatesChanged(command, sizeof(command), &size) == ARCOMMANDS_GENERATOR_OK)
+	{
+		sendCommand(SIMULATOR_D2C_EVENT_ID, command, size);
+	}
+}
+
+void Bebop2Simulator::sendCommand(int bufferId, const uint8_t* command, int32_t size)
+{
+	auto error = ARNETWORK_Manager_SendData(mNetwork, bufferId, const_cast<uint8_t*>(command), size, nullptr, onCommandSent, 1);
+	if (error != ARNETWORK_OK)
+	{
+		ARSAL_PRINT(ARSAL_PRINT_WARNING, TAG, "Send on buffer %d: %s", bufferId, ARNETWORK_Error_ToString(error));
+	}
+}
+
+eARDISCOVERY_ERROR Bebop2Simulator::onReceiveJson(uint8_t* dataRx, uint32_t dataRxSize, char* ip, void* customData)
+{
+	auto* simulator = static_cast<Bebop2Simulator*>(customData);
+	if (simulator == nullptr || dataRx == nullptr || dataRxSize == 0 || ip == nullptr)
+	{
+		return ARDISCOVERY_ERROR_BAD_PARAMETER;
+	}
+
+	// A new handshake replaces the previous controller, if any.
+	simulator->stopSession();
+
+	// The received JSON is not null terminated.
+	std::string json(reinterpret_cast<char*>(dataRx), dataRxSize);
+	json_object* jsonObj = json_tokener_parse(json.c_str());
+	if (is_error(jsonObj))
+	{
+		return ARDISCOVERY_ERROR_JSON_PARSSING;
+	}
+
+	auto getInt = [jsonObj](const char* key)
+	{
+		json_object* valueJsonObj = json_object_object_get(jsonObj, key);
+		return (valueJsonObj != nullptr) ? json_object_get_int(valueJsonObj) : 0;
+	};
+
+	simulator->mControllerAddress = ip;
+	simulator->mD2cPort = getInt(ARDISCOVERY_CONNECTION_JSON_D2CPORT_KEY);
+	simulator->mClientStreamPort = getInt(ARDISCOVERY_CONNECTION_JSON_ARSTREAM2_CLIENT_STREAM_PORT_KEY);
+	simulator->mClientControlPort = getInt(ARDISCOVERY_CONNECTION_JSON_ARSTREAM2_CLIENT_CONTROL_PORT_KEY);
+
+	json_object_put(jsonObj);
+
+	return (simulator->mD2cPort != 0) ? ARDISCOVERY_OK : ARDISCOVERY_ERROR_JSON_PARSSING;
+}
+
+eARDISCOVERY_ERROR Bebop2Simulator::onSendJson(uint8_t* dataTx, uint32_t* dataTxSize, void* customData)
+{
+	auto* simulator = static_cast<Bebop2Simulator*>(customData);
+	if (simulator == nullptr || dataTx == nullptr || dataTxSize == nullptr)
+	{
+		return ARDISCOVERY_ERROR_BAD_PARAMETER;
+	}
+
+	// The sockets are bound before the answer goes out, so the first commands of the controller are not lost.
+	const int status = simulator->startSession() ? 0 : -1;
+
+	auto length = snprintf(reinterpret_cast<char*>(dataTx), ARDISCOVERY_CONNECTION_TX_BUFFER_SIZE,
+		"{ \"%s\": %d, \"%s\": %d, \"%s\": %d, \"%s\": %d, \"%s\": %d, \"%s\": %d }",
+		ARDISCOVERY_CONNECTION_JSON_STATUS_KEY, status,
+		ARDISCOVERY_CONNECTION_JSON_C2DPORT_KEY, SIMULATOR_C2D_PORT,
+		ARDISCOVERY_CONNECTION_JSON_ARSTREAM2_SERVER_STREAM_PORT_KEY, ARSTREAM2_RTP_SENDER_DEFAULT_SERVER_STREAM_PORT,
+		ARDISCOVERY_CONNECTION_JSON_ARSTREAM2_SERVER_CONTROL_PORT_KEY, ARSTREAM2_RTP_SENDER_DEFAULT_SERVER_CONTROL_PORT,
+		ARDISCOVERY_CONNECTION_JSON_ARSTREAM2_MAX_PACKET_SIZE_KEY, SIMULATOR_MAX_PACKET_SIZE,
+		ARDISCOVERY_CONNECTION_JSON_ARSTREAM2_MAX_NETWORK_LATENCY_KEY, SIMULATOR_MAX_NETWORK_LATENCY_MS);
+	if ((length < 0) || (length >= ARDISCOVERY_CONNECTION_TX_BUFFER_SIZE))
+	{
+		return ARDISCOVERY_ERROR_JSON_BUFFER_SIZE;
+	}
+
+	// The connection sends the terminating null character too.
+	*dataTxSize = static_cast<uint32_t>(length) + 1;
+
+	return ARDISCOVERY_OK;
+}
+
+void Bebop2Simulator::onDisconnect(ARNETWORK_Manager_t* manager, ARNETWORKAL_Manager_t* alManager, void* customData)
+{
+	auto* simulator = static_cast<Bebop2Simulator*>(customData);
+	if (simulator == nullptr)
+	{
+		return;
+	}
+
+	// Called from the receiving thread: the session is torn down by the next connection or by stop().
+	ARSAL_PRINT(ARSAL_PRINT_INFO, TAG, "Controller %s disconnected.", simulator->mControllerAddress.c_str());
+	{
+		std::lock_guard<std::mutex> lock(simulator->mVideoMutex);
+		simulator->mVideoEnabled = false;
+	}
+}
+
+eARNETWORK_MANAGER_CALLBACK_RETURN Bebop2Simulator::onCommandSent(int bufferId, uint8_t* data, void* customData, eARNETWORK_MANAGER_CALLBACK_STATUS status)
+{
+	return ARNETWORK_MANAGER_CALLBACK_RETURN_DEFAULT;
+}
+
+void Bebop2Simulator::onPcmd(uint8_t flag, int8_t roll, int8_t pitch, int8_t yaw, int8_t gaz, uint32_t timestampAndSeqNum, void* customData)
+{
+	auto* simulator = static_cast<Bebop2Simulator*>(customData);
+	std::lock_guard<std::mutex> lock(simulator->mFlightMutex);
+	simulator->mFlight.pcmdFlag = flag;
+	simulator->mFlight.pcmdRoll = roll;
+	simulator->mFlight.pcmdPitch = pitch;
+	simulator->mFlight.pcmdYaw = yaw;
+	simulator->mFlight.pcmdGaz = gaz;
+}
+
+void Bebop2Simulator::onTakeOff(void* customData)
+{
+	auto* simulator = static_cast<Bebop2Simulator*>(customData);
+	bool changed = false;
+	{
+		std::lock_guard<std::mutex> lock(simulator->mFlightMutex);
+		if (simulator->mFlight.flyingState == ARCOMMANDS_ARDRONE3_PILOTINGSTATE_FLYINGSTATECHANGED_STATE_LANDED)
+		{
+			simulator->mFlight.flyingState = ARCOMMANDS_ARDRONE3_PILOTINGSTATE_FLYINGSTATECHANGED_STATE_TAKINGOFF;
+			changed = true;
+		}
+	}
+	if (changed)
+	{
+		simulator->setFlyingState(ARCOMMANDS_ARDRONE3_PILOTINGSTATE_FLYINGSTATECHANGED_STATE_TAKINGOFF);
+	}
+}
+
+void Bebop2Simulator::onLanding(void* customData)
+{
+	auto* simulator = static_cast<Bebop2Simulator*>(customData);
+	bool changed = false;
+	{
+		std::lock_guard<std::mutex> lock(simulator->mFlightMutex);
+		auto state = simulator->mFlight.flyingState;
+		if ((state == ARCOMMANDS_ARDRONE3_PILOTINGSTATE_FLYINGSTATECHANGED_STATE_TAKINGOFF) ||
+			(state == ARCOMMANDS_ARDRONE3_PILOTINGSTATE_FLYINGSTATECHANGED_STATE_HOVERING) ||
+			(state == ARCOMMANDS_ARDRONE3_PILOTINGSTATE_FLYINGSTATECHANGED_STATE_FLYING))
+		{
+			simulator->mFlight.flyingState = ARCOMMANDS_ARDRONE3_PILOTINGSTATE_FLYINGSTATECHANGED_STATE_LANDING;
+			changed = true;
+		}
+	}
+	if (changed)
+	{
+		simulator->setFlyingState(ARCOMMANDS_ARDRONE3_PILOTINGSTATE_FLYINGSTATECHANGED_STATE_LANDING);
+	}
+}
+
+void Bebop2Simulator::onEmergency(void* customData)
+{
+	auto* simulator = static_cast<Bebop2Simulator*>(customData);
+	{
+		std::lock_guard<std::mutex> lock(simulator->mFlightMutex);
+		simulator->mFlight.flyingState = ARCOMMANDS_ARDRONE3_PILOTINGSTATE_FLYINGSTATECHANGED_STATE_EMERGENCY;
+	}
+	simulator->setFlyingState(ARCOMMANDS_ARDRONE3_PILOTINGSTATE_FLYINGSTATECHANGED_STATE_EMERGENCY);
+}
+
+void Bebop2Simulator::onVideoEnable(uint8_t enable, void* customData)
+{
+	auto* simulator = static_cast<Bebop2Simulator*>(customData);
+	ARSAL_PRINT(ARSAL_PRINT_INFO, TAG, "Video %s", enable ? "enabled" : "disabled");
+	{
+		std::lock_guard<std::mutex> lock(simulator->mVideoMutex);
+		simulator->mVideoEnabled = (enable != 0);
+	}
+	simulator->mVideoCondition.notify_all();
+}
+
+void Bebop2Simulator::onAllStates(void* customData)
+{
+	static_cast<Bebop2Simulator*>(customData)->sendAllStates();
+}
+
+void Bebop2Simulator::onAllSettings(void* customData)
+{
+	auto* simulator = static_cast<Bebop2Simulator*>(customData);
+	uint8_t command[SIMULATOR_COMMAND_BUFFER_SIZE];
+	int32_t size = 0;
+
+	// No settings are simulated, only the end of ARCONTROLLER_Device_GetInitialSettings.
+	if (ARCOMMANDS_Generator_GenerateCommonSettingsStateAllSettingsChanged(command, sizeof(command), &size) == ARCOMMANDS_GENERATOR_OK)
+	{
+		simulator->sendCommand(SIMULATOR_D2C_EVENT_ID, command, size);
+	}
+}
+
+int Bebop2Simulator::runFromCommandLine(int argc, char* argv[])
+{
+	auto config = defaultConfig("");
+
+	for (int i = 0; i < argc; ++i)
+	{
+		if (strcmp(argv[i], "--fps") == 0 && i + 1 < argc)
+		{
+			config.fps = atof(argv[++i]);
+		}
+		else if (strcmp(argv[i], "--telemetry") == 0 && i + 1 < argc)
+		{
+			config.telemetryHz = atof(argv[++i]);
+		}
+		else if (strcmp(argv[i], "--loss") == 0 && i + 1 < argc)
+		{
+			config.lossRate = atof(argv[++i]);
+		}
+		else if (strcmp(argv[i], "--burst") == 0 && i + 1 < argc)
+		{
+			config.lossBurst = atoi(argv[++i]);
+		}
+		else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc)
+		{
+			config.seed = static_cast<unsigned int>(strtoul(argv[++i], nullptr, 10));
+		}
+		else if (argv[i][0] != '-')
+		{
+			config.videoPath = argv[i];
+		}
+	}
+
+	if (config.videoPath.empty())
+	{
+		printf("usage: cppDrone --simulate <file.h264> [--fps <n>] [--telemetry <hz>] [--loss <rate>] [--burst <n>] [--seed <n>]\n");
+		return 1;
+	}
+
+	Bebop2Simulator simulator(config);
+	if (!simulator.start())
+	{
+		return 1;
+	}
+
+	printf("Simulating a Bebop 2, press Enter to stop.\n");
+	getchar();
+
+	simulator.stop();
+
+	return 0;
+}
@@ -0,0 +1,164 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+extern "C" {
+#include <libARCommands/ARCommands.h>
+#include <libARDiscovery/ARDiscovery.h>
+#include <libARNetwork/ARNetwork.h>
+#include <libARNetworkAL/ARNetworkAL.h>
+#include <libARStream2/arstream2_rtp_sender.h>
+}
+
+#include "ReplayBenchmark.h"
+
+#define SIMULATOR_DEFAULT_FPS 30.0
+#define SIMULATOR_DEFAULT_TELEMETRY_HZ 5.0
+// Port the simulator receives the controller commands on, sent to the controller as c2d_port.
+#define SIMULATOR_C2D_PORT 54321
+#define SIMULATOR_MAX_PACKET_SIZE 1500
+#define SIMULATOR_TARGET_PACKET_SIZE 1400
+#define SIMULATOR_MAX_NETWORK_LATENCY_MS 200
+#define SIMULATOR_COMMAND_BUFFER_SIZE 128
+
+/**
+ * Stands in for a Bebop 2 on the local machine, so that the whole
+ * start_bebop2 -> Oni pipeline can run under a repeatable load without a
+ * drone. Run it with "cppDrone --simulate <file.h264>" and point the app at
+ * it with "cppDrone --drone 127.0.0.1".
+ *
+ * It is built from the device side of the SDK:
+ * - ARDISCOVERY_Connection_DeviceListeningLoop answers the JSON handshake.
+ * - ARNETWORK_Manager carries the command buffers, with the IDs of the
+ *   Bebop network configuration mirrored.
+ * - ARCOMMANDS_Decoder handles PCMD, take off, landing, emergency, video
+ *   enable and the initial AllStates/AllSettings requests, and
+ *   ARCOMMANDS_Generator encodes the state events.
+ * - ARSTREAM2_RtpSender streams the H.264 recording, in a loop, once the
+ *   controller enables the video.
+ *
+ * A simple flight model turns the PCMD values into attitude, speed and
+ * altitude, which are sent with the battery level at the telemetry rate.
+ * NAL units are dropped on purpose according to the loss profile, which
+ * the receiver sees as lost RTP packets.
+ */
+class Bebop2Simulator
+{
+public:
+	struct Config
+	{
+		std::string videoPath;
+		double fps;                // access units streamed per second
+		double telemetryHz;        // attitude, speed, altitude and battery updates per second
+		double lossRate;           // probability that a loss starts at a NAL unit, 0 disables the losses
+		int lossBurst;             // NAL units dropped in a row once a loss starts
+		unsigned int seed;         // seed of the loss generator, so that a profile can be replayed
+	};
+
+	static Config defaultConfig(const std::string& videoPath);
+
+private:
+	typedef ReplayBenchmark::Nalu Nalu;
+	typedef ReplayBenchmark::AccessUnit AccessUnit;
+
+	struct FlightState
+	{
+		eARCOMMANDS_ARDRONE3_PILOTINGSTATE_FLYINGSTATECHANGED_STATE flyingState;
+		uint8_t pcmdFlag;
+		int8_t pcmdRoll;
+		int8_t pcmdPitch;
+		int8_t pcmdYaw;
+		int8_t pcmdGaz;
+		float roll;                // rad
+		float pitch;               // rad
+		float yaw;                 // rad
+		float speedX;              // m/s, north
+		float speedY;              // m/s, east
+		float speedZ;              // m/s, down
+		double altitude;           // m
+		double battery;            // percent
+	};
+
+	Config mConfig;
+
+	std::vector<uint8_t> mData;
+	std::vector<Nalu> mNalus;
+	std::vector<AccessUnit> mAccessUnits;
+
+	ARDISCOVERY_Connection_ConnectionData_t* mConnection;
+	std::thread mListeningThread;
+
+	// One session per controller connection, set up during the handshake.
+	std::string mControllerAddress;
+	int mD2cPort;
+	int mClientStreamPort;
+	int mClientControlPort;
+
+	std::mutex mSessionMutex;
+	std::atomic<bool> mSessionRunning;
+	ARNETWORKAL_Manager_t* mNetworkAL;
+	ARNETWORK_Manager_t* mNetwork;
+	ARSTREAM2_RtpSender_t* mRtpSender;
+	std::vector<std::thread> mSessionThreads;
+
+	std::mutex mVideoMutex;
+	std::condition_variable mVideoCondition;
+	std::atomic<bool> mVideoEnabled;
+
+	std::mutex mFlightMutex;
+	FlightState mFlight;
+	uint8_t mLastBatteryPercent;
+
+	// Counters, reported when the simulator stops.
+	std::atomic<uint64_t> mAccessUnitsSent;
+	std::atomic<uint64_t> mNalusDropped;
+	std::atomic<uint64_t> mCommandsReceived;
+
+public:
+	explicit Bebop2Simulator(const Config& config);
+	~Bebop2Simulator();
+
+	Bebop2Simulator(const Bebop2Simulator&) = delete;
+	Bebop2Simulator& operator=(const Bebop2Simulator&) = delete;
+
+	// Loads the recording and waits for a controller on the discovery port.
+	bool start();
+	void stop();
+
+	// Entry point of "cppDrone --simulate <file.h264> [--fps <n>] [--telemetry <hz>] [--loss <rate>] [--burst <n>] [--seed <n>]".
+	static int runFromCommandLine(int argc, char* argv[]);
+
+private:
+	bool load();
+
+	bool startSession();
+	void stopSession();
+
+	void readLoop(int bufferId);
+	void videoLoop();
+	void telemetryLoop();
+
+	void updateFlight(FlightState& flight, double dt) const;
+	void setFlyingState(eARCOMMANDS_ARDRONE3_PILOTINGSTATE_FLYINGSTATECHANGED_STATE state);
+	void sendAllStates();
+	void sendCommand(int bufferId, const uint8_t* command, int32_t size);
+
+	static eARDISCOVERY_ERROR onReceiveJson(uint8_t* dataRx, uint32_t dataRxSize, char* ip, void* customData);
+	static eARDISCOVERY_ERROR onSendJson(uint8_t* dataTx, uint32_t* dataTxSize, void* customData);
+	static void onDisconnect(ARNETWORK_Manager_t* manager, ARNETWORKAL_Manager_t* alManager, void* customData);
+	static eARNETWORK_MANAGER_CALLBACK_RETURN onCommandSent(int bufferId, uint8_t* data, void* customData, eARNETWORK_MANAGER_CALLBACK_STATUS status);
+
+	static void onPcmd(uint8_t flag, int8_t roll, int8_t pitch, int8_t yaw, int8_t gaz, uint32_t timestampAndSeqNum, void* customData);
+	static void onTakeOff(void* customData);
+	static void onLanding(void* customData);
+	static void onEmergency(void* customData);
+	static void onVideoEnable(uint8_t enable, void* customData);
+	static void onAllStates(void* customData);
+	static void onAllSettings(void* customData);
+};
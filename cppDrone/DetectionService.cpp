@@ -0,0 +1,307 @@
+#define TAG "DetectionService"
+
+#include <algorithm>
+#include <chrono>
+
+extern "C" {
+#include <libARSAL/ARSAL_Print.h>
+#include <libARSAL/ARSAL_Trace.h>
+}
+
+#include "DetectionService.h"
+
+DetectionService::DetectionService(bebop_driver::VideoDecoder* decoder, bebop_driver::VideoView view, size_t workerCount)
+	: mDecoder(decoder), mView(view), mRunning(false), mActive(false), mClaimedSequence(0),
+	mTrackingMode(false), mTargetId(-1), mTargetMisses(0), mLastDetectionSequence(0), mVersion(0), mActivatedSequence(0)
+{
+	workerCount = std::max<size_t>(1, workerCount);
+
+	// Split the remaining cores between the workers as scale bands, without oversubscribing.
+	auto cores = std::max<size_t>(1, std::thread::hardware_concurrency());
+	auto bands = static_cast<int>(std::max<size_t>(1, cores / workerCount));
+
+	for (size_t i = 0; i < workerCount; ++i)
+	{
+		mDetectors.push_back(std::unique_ptr<OniTracker>(new OniTracker(bands)));
+	}
+}
+
+DetectionService::~DetectionService()
+{
+	stop();
+}
+
+size_t DetectionService::defaultWorkerCount()
+{
+	// Two workers keep the pipeline busy while one publishes; the other cores go to
+	// scale bands inside each worker, which lowers latency rather than only throughput.
+	auto cores = std::thread::hardware_concurrency();
+	return cores >= 4 ? 2 : 1;
+}
+
+void DetectionService::start()
+{
+	if (mRunning.exchange(true))
+	{
+		return;
+	}
+
+	for (size_t i = 0; i < mDetectors.size(); ++i)
+	{
+		mWorkers.push_back(std::thread(&DetectionService::workerLoop, this, i));
+	}
+
+	ARSAL_PRINT(ARSAL_PRINT_INFO, TAG, "Started %u detection workers.", static_cast<unsigned>(mWorkers.size()));
+}
+
+void DetectionService::stop()
+{
+	if (!mRunning.exchange(false))
+	{
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(mStateMutex);
+	}
+	mStateCondition.notify_all();
+
+	for (auto& worker : mWorkers)
+	{
+		worker.join();
+	}
+	mWorkers.clear();
+}
+
+void DetectionService::setActive(bool active)
+{
+	if (mActive == active)
+	{
+		return;
+	}
+
+	if (active)
+	{
+		// Only frames decoded from now on are worth detecting.
+		std::lock_guard<std::mutex> lock(mPublishMutex);
+		mActivatedSequence = mClaimedSequence;
+		std::atomic_store(&mLatestResult, ResultPtr());
+
+		std::lock_guard<std::mutex> trackerLock(mPersonTrackerMutex);
+		mPersonTracker.clear();
+		mLastDetectionSequence = 0;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(mStateMutex);
+		mActive = active;
+	}
+	mStateCondition.notify_all();
+}
+
+void DetectionService::setTrackingMode(bool tracking)
+{
+	std::lock_guard<std::mutex> lock(mTargetMutex);
+	if (mTrackingMode == tracking)
+	{
+		return;
+	}
+
+	mTrackingMode = tracking;
+	mTargetMisses = 0;
+	mTarget = cv::Rect();
+	mTargetId = -1;
+
+	auto latest = getLatestResult();
+	if (tracking && latest != nullptr && !latest->people.empty())
+	{
+		mTarget = latest->people[0];
+		mTargetId = latest->ids[0];
+	}
+}
+
+void DetectionService::updateTarget(const Result& result)
+{
+	std::lock_guard<std::mutex> lock(mTargetMutex);
+	if (!mTrackingMode)
+	{
+		return;
+	}
+
+	if (!result.people.empty())
+	{
+		auto it = std::find(result.ids.begin(), result.ids.end(), mTargetId);
+		auto index = it != result.ids.end() ? it - result.ids.begin() : 0;
+		mTarget = result.people[index];
+		mTargetId = result.ids[index];
+		mTargetMisses = 0;
+	}
+	else if (result.searchRegion.size() == result.imageSize)
+	{
+		// Lost in a full scan too: keep scanning the full frame until someone shows up.
+		mTarget = cv::Rect();
+	}
+}
+
+void DetectionService::publish(const std::shared_ptr<Result>& result)
+{
+	std::lock_guard<std::mutex> lock(mPublishMutex);
+
+	if (result->frameSequence <= mActivatedSequence)
+	{
+		return;
+	}
+
+	// Workers finish out of order; never replace a result with an older frame's one.
+	auto latest = std::atomic_load(&mLatestResult);
+	if (latest != nullptr && latest->frameSequence >= result->frameSequence)
+	{
+		return;
+	}
+
+	result->version = ++mVersion;
+	std::atomic_store(&mLatestResult, ResultPtr(result));
+
+	if (mResultCallback)
+	{
+		mResultCallback(*result);
+	}
+}
+
+void DetectionService::workerLoop(size_t index)
+{
+	auto& detector = *mDetectors[index];
+
+	while (mRunning)
+	{
+		if (!mActive)
+		{
+			std::unique_lock<std::mutex> lock(mStateMutex);
+			mStateCondition.wait(lock, [this] { return mActive || !mRunning; });
+			continue;
+		}
+
+		auto claimed = mClaimedSequence.load();
+		if (!mDecoder->WaitForNewFrame(claimed, 100))
+		{
+			continue;
+		}
+
+		auto frame = mDecoder->GetLatestFrame(mView);
+		if (frame == nullptr || frame->sequence <= claimed)
+		{
+			continue;
+		}
+
+		// Another worker may have taken this frame already; then wait for the next one.
+		if (!mClaimedSequence.compare_exchange_strong(claimed, frame->sequence))
+		{
+			continue;
+		}
+
+		cv::Mat image(frame->height, frame->width, frame->channels == 1 ? CV_8UC1 : CV_8UC3, frame->data);
+
+		auto result = std::make_shared<Result>();
+		result->frameSequence = frame->sequence;
+		result->frameTimestamp = frame->timestamp;
+		result->frameDecodedTimeUs = frame->decoded_time_us;
+		result->imageSize = image.size();
+
+		bool detect;
+		{
+			std::lock_guard<std::mutex> lock(mPersonTrackerMutex);
+			detect = mPersonTracker.empty() || frame->sequence >= mLastDetectionSequence + DETECTION_INTERVAL_FRAMES;
+			if (detect)
+			{
+				mLastDetectionSequence = frame->sequence;
+			}
+		}
+
+		if (!detect)
+		{
+			auto started = std::chrono::steady_clock::now();
+			{
+				std::lock_guard<std::mutex> lock(mPersonTrackerMutex);
+				mPersonTracker.update(image, frame->sequence);
+				mPersonTracker.getVisible(result->people, result->ids);
+			}
+			auto finished = std::chrono::steady_clock::now();
+
+			result->latencyMs = std::chrono::duration<double, std::milli>(finished - started).count();
+			result->detected = false;
+			ARSAL_Trace_Record(ARSAL_TRACE_STAGE_DETECTED, frame->timestamp);
+
+			image.release();
+			frame.reset();
+
+			if (mActive)
+			{
+				updateTarget(*result);
+				publish(result);
+			}
+			continue;
+		}
+
+		cv::Rect target;
+		{
+			std::lock_guard<std::mutex> lock(mTargetMutex);
+			if (mTrackingMode && mTargetMisses < TRACKING_ROI_MISS_LIMIT)
+			{
+				target = mTarget;
+			}
+		}
+
+		auto started = std::chrono::steady_clock::now();
+		std::vector<cv::Rect> people;
+		cv::Rect searchRegion(0, 0, image.cols, image.rows);
+		if (target.area() > 0)
+		{
+			people = detector.getPeopleAround(image, target);
+			if (people.empty())
+			{
+				bool fallback;
+				{
+					std::lock_guard<std::mutex> lock(mTargetMutex);
+					fallback = ++mTargetMisses >= TRACKING_ROI_MISS_LIMIT;
+				}
+
+				if (!fallback)
+				{
+					// A single miss is not worth reporting; the next frame is searched around the target again.
+					continue;
+				}
+				people = detector.getPeople(image);
+			}
+			else
+			{
+				searchRegion = target;
+			}
+		}
+		else
+		{
+			people = detector.getPeople(image);
+		}
+		auto finished = std::chrono::steady_clock::now();
+
+		{
+			std::lock_guard<std::mutex> lock(mPersonTrackerMutex);
+			mPersonTracker.correct(image, people, frame->sequence);
+			mPersonTracker.getVisible(result->people, result->ids);
+		}
+
+		result->latencyMs = std::chrono::duration<double, std::milli>(finished - started).count();
+		result->detected = true;
+		ARSAL_Trace_Record(ARSAL_TRACE_STAGE_DETECTED, frame->timestamp);
+		result->searchRegion = searchRegion;
+
+		// Release the frame slot before publishing.
+		image.release();
+		frame.reset();
+
+		if (mActive)
+		{
+			updateTarget(*result);
+			publish(result);
+		}
+	}
+}
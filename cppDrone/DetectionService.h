@@ -0,0 +1,119 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <opencv2/core.hpp>
+
+#include "bebop_video_decoder.h"
+#include "OniTracker.h"
+#include "PersonTracker.h"
+
+// Consecutive region-of-interest misses after which tracking falls back to a full-frame scan.
+#define TRACKING_ROI_MISS_LIMIT 3
+// The cascade runs on every Nth frame while people are tracked; PersonTracker follows them in between.
+#define DETECTION_INTERVAL_FRAMES 3
+
+/**
+ * Runs OniTracker::getPeople on a pool of worker threads, always on the
+ * latest decoded frame, and publishes versioned results.
+ *
+ * The state loop reads the freshest result with getLatestResult(), which
+ * never blocks on detection, when the result callback tells it one was
+ * published. Each worker owns its own detector because
+ * cv::CascadeClassifier must not be shared between threads.
+ *
+ * In tracking mode only the surroundings of the last detected person are
+ * searched (OniTracker::getPeopleAround). The full frame is scanned again
+ * after TRACKING_ROI_MISS_LIMIT consecutive misses.
+ *
+ * Once someone was detected, the cascade only runs on every
+ * DETECTION_INTERVAL_FRAMES-th frame. The frames in between are handled by a
+ * shared PersonTracker, which also gives every person a stable id.
+ */
+class DetectionService
+{
+public:
+	struct Result
+	{
+		uint64_t version;          // increments with every published result
+		uint64_t frameSequence;    // VideoFrame::sequence the detection ran on
+		uint64_t frameTimestamp;   // VideoFrame::timestamp
+		uint64_t frameDecodedTimeUs;
+		double latencyMs;          // time spent in getPeople or in the tracker update
+		bool detected;             // false if the people were only followed by the tracker
+		cv::Size imageSize;        // size of the image the rects refer to
+		cv::Rect searchRegion;     // previous target the search was restricted to; the whole image for a full scan; empty if not detected
+		std::vector<cv::Rect> people; // sorted by area, largest first
+		std::vector<int> ids;      // PersonTracker id of each entry in people
+	};
+
+	typedef std::shared_ptr<const Result> ResultPtr;
+	typedef std::function<void(const Result&)> ResultCallback;
+
+private:
+	bebop_driver::VideoDecoder* mDecoder;
+	bebop_driver::VideoView mView;
+
+	std::vector<std::unique_ptr<OniTracker>> mDetectors;
+	std::vector<std::thread> mWorkers;
+
+	std::atomic<bool> mRunning;
+	std::atomic<bool> mActive;
+	std::atomic<uint64_t> mClaimedSequence;
+
+	std::mutex mStateMutex;
+	std::condition_variable mStateCondition;
+
+	std::mutex mTargetMutex;
+	bool mTrackingMode;
+	cv::Rect mTarget;
+	int mTargetId;
+	int mTargetMisses;
+
+	// Shared by all workers, so it sees the frames in order no matter which worker runs them.
+	std::mutex mPersonTrackerMutex;
+	PersonTracker mPersonTracker;
+	uint64_t mLastDetectionSequence;
+
+	std::mutex mPublishMutex;
+	uint64_t mVersion;
+	uint64_t mActivatedSequence;
+	ResultPtr mLatestResult;
+	ResultCallback mResultCallback;
+
+public:
+	DetectionService(bebop_driver::VideoDecoder* decoder, bebop_driver::VideoView view, size_t workerCount);
+	~DetectionService();
+
+	void start();
+	void stop();
+
+	// Pauses or resumes detection. Resuming discards the previous result so callers never act on a stale one.
+	void setActive(bool active);
+	bool isActive() const { return mActive; }
+
+	// Restricts detection to the last detected person while enabled. Enabling starts from the latest result.
+	void setTrackingMode(bool tracking);
+
+	// Returns the freshest result, or nullptr if nothing was detected since the service was activated.
+	ResultPtr getLatestResult() const { return std::atomic_load(&mLatestResult); }
+
+	// Called from the worker that published a result, in publishing order. Must be set before start() and return quickly.
+	void setResultCallback(const ResultCallback& callback) { mResultCallback = callback; }
+
+	size_t getWorkerCount() const { return mDetectors.size(); }
+
+	// Number of workers that fits the machine; each worker also splits its detection into scale bands.
+	static size_t defaultWorkerCount();
+
+private:
+	void workerLoop(size_t index);
+	void publish(const std::shared_ptr<Result>& result);
+	void updateTarget(const Result& result);
+};
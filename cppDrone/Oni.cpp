@@ -8,41 +8,39 @@
 
 #include "Oni.h"
 
+const eARCONTROLLER_DICTIONARY_KEY Oni::oniEventKeys[] = {
+	ARCONTROLLER_DICTIONARY_KEY_ARDRONE3_PICTURESETTINGSSTATE_VIDEOFRAMERATECHANGED,
+	ARCONTROLLER_DICTIONARY_KEY_ARDRONE3_PICTURESETTINGSSTATE_VIDEORESOLUTIONSCHANGED,
+	ARCONTROLLER_DICTIONARY_KEY_ARDRONE3_MEDIASTREAMINGSTATE_VIDEOSTREAMMODECHANGED,
+	ARCONTROLLER_DICTIONARY_KEY_ARDRONE3_PILOTINGSTATE_FLYINGSTATECHANGED,
+	// Periodic states; their values are read from the telemetry snapshots.
+	ARCONTROLLER_DICTIONARY_KEY_COMMON_COMMONSTATE_BATTERYSTATECHANGED,
+	ARCONTROLLER_DICTIONARY_KEY_ARDRONE3_PILOTINGSTATE_ATTITUDECHANGED,
+	ARCONTROLLER_DICTIONARY_KEY_ARDRONE3_PILOTINGSTATE_SPEEDCHANGED,
+	ARCONTROLLER_DICTIONARY_KEY_ARDRONE3_PILOTINGSTATE_ALTITUDECHANGED,
+	ARCONTROLLER_DICTIONARY_KEY_ARDRONE3_CAMERASTATE_ORIENTATION,
+};
+const int Oni::oniEventKeysCount = sizeof(oniEventKeys) / sizeof(oniEventKeys[0]);
+
 void Oni::oni_event_loop(eARCONTROLLER_DICTIONARY_KEY commandKey, ARCONTROLLER_DICTIONARY_ELEMENT_t *elementDictionary, void *customData)
 {
-	auto *status = static_cast<DroneStatus*>(customData);
+	auto *oni = static_cast<Oni*>(customData);
 
-	if (status == nullptr)
+	if (oni == nullptr)
 	{
-		ARSAL_PRINT(ARSAL_PRINT_ERROR, TAG, "DroneStatus is NULL!");
+		ARSAL_PRINT(ARSAL_PRINT_ERROR, TAG, "Oni is NULL!");
 		return;
 	}
 
-	if (commandKey == ARCONTROLLER_DICTIONARY_KEY_COMMON_COMMONSTATE_BATTERYSTATECHANGED && elementDictionary != nullptr)
-	{
-		ARCONTROLLER_DICTIONARY_ARG_t *arg = nullptr;
-		ARCONTROLLER_DICTIONARY_ELEMENT_t *singleElement = nullptr;
-
-		// get the command received in the device controller
-		HASH_FIND_STR(elementDictionary, ARCONTROLLER_DICTIONARY_SINGLE_KEY, singleElement);
-
-		if (singleElement == nullptr)
-		{
-			return;
-		}
-
-		// get the value
-		HASH_FIND_STR(singleElement->arguments, ARCONTROLLER_DICTIONARY_KEY_COMMON_COMMONSTATE_BATTERYSTATECHANGED_PERCENT, arg);
-
-		if (arg == nullptr)
-		{
-			return;
-		}
+	auto *status = oni->mDroneStatus;
 
-		status->battery = arg->value.U8;
+	// Only this thread writes the telemetry into mDroneStatus, whichever command woke it up.
+	updateTelemetry(oni);
 
+	if (commandKey == ARCONTROLLER_DICTIONARY_KEY_COMMON_COMMONSTATE_BATTERYSTATECHANGED)
+	{
 		// update UI
-		ARSAL_PRINT(ARSAL_PRINT_INFO, TAG, "Battery state has changed: %d %%", arg->value.U8);
+		ARSAL_PRINT(ARSAL_PRINT_INFO, TAG, "Battery state has changed: %d %%", status->battery);
 	}
 
 	if (commandKey == ARCONTROLLER_DICTIONARY_KEY_ARDRONE3_PICTURESETTINGSSTATE_VIDEOFRAMERATECHANGED && elementDictionary != nullptr)
@@ -151,97 +149,74 @@ void Oni::oni_event_loop(eARCONTROLLER_DICTIONARY_KEY commandKey, ARCONTROLLER_D
 		ARSAL_PRINT(ARSAL_PRINT_INFO, TAG, "Video stream mode is %s.", mode);
 	}
 
-	if ((commandKey == ARCONTROLLER_DICTIONARY_KEY_ARDRONE3_CAMERASTATE_ORIENTATION) && (elementDictionary != nullptr))
+	if ((commandKey == ARCONTROLLER_DICTIONARY_KEY_ARDRONE3_PILOTINGSTATE_FLYINGSTATECHANGED) && (elementDictionary != nullptr))
 	{
 		ARCONTROLLER_DICTIONARY_ARG_t *arg = nullptr;
 		ARCONTROLLER_DICTIONARY_ELEMENT_t *element = nullptr;
 		HASH_FIND_STR(elementDictionary, ARCONTROLLER_DICTIONARY_SINGLE_KEY, element);
-		if (element != nullptr)
+		if (element == nullptr)
 		{
-			HASH_FIND_STR(element->arguments, ARCONTROLLER_DICTIONARY_KEY_ARDRONE3_CAMERASTATE_ORIENTATION_TILT, arg);
-			if (arg != nullptr)
-			{
-				status->tilt = arg->value.I8;
-			}
-			HASH_FIND_STR(element->arguments, ARCONTROLLER_DICTIONARY_KEY_ARDRONE3_CAMERASTATE_ORIENTATION_PAN, arg);
-			if (arg != nullptr)
-			{
-				status->pan = arg->value.I8;
-			}
+			return;
+		}
+
+		HASH_FIND_STR(element->arguments, ARCONTROLLER_DICTIONARY_KEY_ARDRONE3_PILOTINGSTATE_FLYINGSTATECHANGED_STATE, arg);
+		if (arg == nullptr)
+		{
+			return;
 		}
 
-		ARSAL_PRINT(ARSAL_PRINT_INFO, TAG, "Camera orientation is tilt=%d, pan=%d.", status->tilt, status->pan);
+		StateController::EVENT event;
+		event.type = StateController::EVENT_TELEMETRY;
+		event.telemetry.flyingState = static_cast<eARCOMMANDS_ARDRONE3_PILOTINGSTATE_FLYINGSTATECHANGED_STATE>(arg->value.I32);
+		oni->mStateController->postEvent(event);
+
+		ARSAL_PRINT(ARSAL_PRINT_INFO, TAG, "Flying state has changed: %d", event.telemetry.flyingState);
 	}
+}
 
-	if ((commandKey == ARCONTROLLER_DICTIONARY_KEY_ARDRONE3_PILOTINGSTATE_SPEEDCHANGED) && (elementDictionary != nullptr))
+void Oni::updateTelemetry(Oni* oni)
+{
+	if (oni->mDeviceController == nullptr)
 	{
-		ARCONTROLLER_DICTIONARY_ARG_t *arg = nullptr;
-		ARCONTROLLER_DICTIONARY_ELEMENT_t *element = nullptr;
-		HASH_FIND_STR(elementDictionary, ARCONTROLLER_DICTIONARY_SINGLE_KEY, element);
-		if (element != nullptr)
-		{
-			HASH_FIND_STR(element->arguments, ARCONTROLLER_DICTIONARY_KEY_ARDRONE3_PILOTINGSTATE_SPEEDCHANGED_SPEEDX, arg);
-			if (arg != nullptr)
-			{
-				status->speedX = arg->value.Float;
-			}
-			HASH_FIND_STR(element->arguments, ARCONTROLLER_DICTIONARY_KEY_ARDRONE3_PILOTINGSTATE_SPEEDCHANGED_SPEEDY, arg);
-			if (arg != nullptr)
-			{
-				status->speedY = arg->value.Float;
-			}
-			HASH_FIND_STR(element->arguments, ARCONTROLLER_DICTIONARY_KEY_ARDRONE3_PILOTINGSTATE_SPEEDCHANGED_SPEEDZ, arg);
-			if (arg != nullptr)
-			{
-				status->speedZ = arg->value.Float;
-			}
-		}
+		return;
+	}
 
-		ARSAL_PRINT(ARSAL_PRINT_INFO, TAG, "Speed is (%.3f, %.3f, %.3f).", status->speedX, status->speedY, status->speedZ);
+	// Lock-free copies of the latest periodic states; no dictionary lookup involved.
+	ARCONTROLLER_TELEMETRY_COMMON_t common;
+	if (ARCONTROLLER_FEATURE_Common_GetTelemetry(oni->mDeviceController->common, &common) == ARCONTROLLER_OK && common.batterySequence != 0)
+	{
+		oni->mDroneStatus->battery = common.batteryPercent;
 	}
 
-	if ((commandKey == ARCONTROLLER_DICTIONARY_KEY_ARDRONE3_PILOTINGSTATE_ATTITUDECHANGED) && (elementDictionary != nullptr))
+	ARCONTROLLER_TELEMETRY_ARDRONE3_t telemetry;
+	if (ARCONTROLLER_FEATURE_ARDrone3_GetTelemetry(oni->mDeviceController->aRDrone3, &telemetry) != ARCONTROLLER_OK)
 	{
-		ARCONTROLLER_DICTIONARY_ARG_t *arg = nullptr;
-		ARCONTROLLER_DICTIONARY_ELEMENT_t *element = nullptr;
-		HASH_FIND_STR(elementDictionary, ARCONTROLLER_DICTIONARY_SINGLE_KEY, element);
-		if (element != nullptr)
-		{
-			HASH_FIND_STR(element->arguments, ARCONTROLLER_DICTIONARY_KEY_ARDRONE3_PILOTINGSTATE_ATTITUDECHANGED_ROLL, arg);
-			if (arg != nullptr)
-			{
-				status->roll = arg->value.Float;
-			}
-			HASH_FIND_STR(element->arguments, ARCONTROLLER_DICTIONARY_KEY_ARDRONE3_PILOTINGSTATE_ATTITUDECHANGED_PITCH, arg);
-			if (arg != nullptr)
-			{
-				status->pitch = arg->value.Float;
-			}
-			HASH_FIND_STR(element->arguments, ARCONTROLLER_DICTIONARY_KEY_ARDRONE3_PILOTINGSTATE_ATTITUDECHANGED_YAW, arg);
-			if (arg != nullptr)
-			{
-				status->yaw = arg->value.Float;
-			}
-		}
+		return;
+	}
 
-		ARSAL_PRINT(ARSAL_PRINT_INFO, TAG, "Current (roll, pitch, yaw) is (%.3f, %.3f, %.3f).", status->roll, status->pitch, status->yaw);
+	if (telemetry.attitudeSequence != 0)
+	{
+		oni->mDroneStatus->roll = telemetry.roll;
+		oni->mDroneStatus->pitch = telemetry.pitch;
+		oni->mDroneStatus->yaw = telemetry.yaw;
 	}
 
-	if ((commandKey == ARCONTROLLER_DICTIONARY_KEY_ARDRONE3_PILOTINGSTATE_ALTITUDECHANGED) && (elementDictionary != nullptr))
+	if (telemetry.speedSequence != 0)
 	{
-		ARCONTROLLER_DICTIONARY_ARG_t *arg = nullptr;
-		ARCONTROLLER_DICTIONARY_ELEMENT_t *element = nullptr;
-		HASH_FIND_STR(elementDictionary, ARCONTROLLER_DICTIONARY_SINGLE_KEY, element);
-		if (element != nullptr)
-		{
-			HASH_FIND_STR(element->arguments, ARCONTROLLER_DICTIONARY_KEY_ARDRONE3_PILOTINGSTATE_ALTITUDECHANGED_ALTITUDE, arg);
-			if (arg != nullptr)
-			{
-				status->altitude = arg->value.Double;
-			}
-		}
+		oni->mDroneStatus->speedX = telemetry.speedX;
+		oni->mDroneStatus->speedY = telemetry.speedY;
+		oni->mDroneStatus->speedZ = telemetry.speedZ;
+	}
+
+	if (telemetry.altitudeSequence != 0)
+	{
+		oni->mDroneStatus->altitude = telemetry.altitude;
+	}
 
-		ARSAL_PRINT(ARSAL_PRINT_INFO, TAG, "Current altitude is %.3lf.", status->altitude);
+	if (telemetry.cameraOrientationSequence != 0)
+	{
+		oni->mDroneStatus->tilt = telemetry.tilt;
+		oni->mDroneStatus->pan = telemetry.pan;
 	}
 }
 
@@ -268,24 +243,19 @@ eARCONTROLLER_ERROR Oni::oni_image_loop(ARCONTROLLER_Frame_t *frame, void *custo
 		return ARCONTROLLER_ERROR;
 	}
 
-	if (!true)
-	{
-		cv::Size size(decoder->GetFrameWidth(), decoder->GetFrameHeight());
-		cv::Mat image(size, CV_8UC3, (void*)decoder->GetFrameRGBRawCstPtr());
-
-		if (!image.empty()) {
-			cv::imshow(MONITOR_WINDOW_NAME, image);
-			cv::waitKey(1);
-		}
-	}
-
 	return ARCONTROLLER_OK;
 }
 
 cv::Mat Oni::getCameraImage(double ratioX, double ratioY) const
 {
-	cv::Size size(mVideoDecoder->GetFrameWidth(), mVideoDecoder->GetFrameHeight());
-	cv::Mat image(size, CV_8UC3, (void*)mVideoDecoder->GetFrameRGBRawCstPtr());
+	// Holding the frame keeps the decoder off this slot until resize() is done.
+	auto frame = mVideoDecoder->GetLatestFrame();
+	if (frame == nullptr)
+	{
+		return cv::Mat();
+	}
+
+	cv::Mat image(frame->height, frame->width, CV_8UC3, frame->data);
 	cv::Mat resized;
 
 	cv::resize(image, resized, cv::Size(), ratioX, ratioY);
@@ -294,28 +264,76 @@ cv::Mat Oni::getCameraImage(double ratioX, double ratioY) const
 	return resized;
 }
 
-void Oni::processCoolScreen(Oni* oni, const cv::Mat& wanted_base)
+cv::Mat Oni::wrapFrame(const bebop_driver::VideoFramePtr& frame)
+{
+	if (frame == nullptr)
+	{
+		return cv::Mat();
+	}
+
+	return cv::Mat(frame->height, frame->width, frame->channels == 1 ? CV_8UC1 : CV_8UC3, frame->data);
+}
+
+void Oni::captureTarget(Oni* oni, const cv::Rect& person, const cv::Rect& target)
+{
+	// Prefer the full resolution color frame for the wanted poster.
+	auto frame = oni->mVideoDecoder->GetLatestFrame(bebop_driver::VIDEO_VIEW_BGR);
+	if (frame != nullptr)
+	{
+		auto image = wrapFrame(frame);
+		auto region = target & cv::Rect(0, 0, image.cols, image.rows);
+		if (region.area() > 0)
+		{
+			oni->mTracker->addCaptured(image, region);
+			return;
+		}
+	}
+
+	frame = oni->mVideoDecoder->GetLatestFrame(bebop_driver::VIDEO_VIEW_GRAY);
+	if (frame == nullptr)
+	{
+		return;
+	}
+
+	cv::Mat color;
+	cv::cvtColor(wrapFrame(frame), color, CV_GRAY2BGR);
+	auto region = person & cv::Rect(0, 0, color.cols, color.rows);
+	if (region.area() > 0)
+	{
+		oni->mTracker->addCaptured(color, region);
+	}
+}
+
+void Oni::processCoolScreen(Oni* oni)
 {
 	using namespace cv;
 
-	Mat origin = oni->getCameraImage(1.0, 1.0);
-	Mat result;
-	// Make image red tone.
-	{
-		int rows = origin.rows, cols = origin.cols;
-		Mat hsv_orig, hsv_channel[3];
-		cvtColor(origin, hsv_orig, CV_BGR2HSV);
-		split(hsv_orig, hsv_channel);
-		hsv_orig.release();
-		hsv_channel[0].release();
-		hsv_channel[0] = Mat::zeros(rows, cols, CV_8UC1);
-		merge(hsv_channel, 3, hsv_orig);
-		hsv_channel[0].release();
-		hsv_channel[1].release();
-		hsv_channel[2].release();
-		cvtColor(hsv_orig, result, CV_HSV2BGR);
-		hsv_orig.release();
+	// Layers of the overlay, so each text only runs putText again when it changes.
+	enum
+	{
+		LAYER_CLOCK = 0,
+		LAYER_STATE,
+		LAYER_TITLE,
+		LAYER_TELEMETRY,
+		LAYER_CONSOLE = LAYER_TELEMETRY + 16,
+	};
+
+	const OverlayCompositor::TextStyle clockStyle = { CV_FONT_HERSHEY_DUPLEX, 0.6, 1, Scalar::all(255) };
+	const OverlayCompositor::TextStyle consoleStyle = { CV_FONT_HERSHEY_PLAIN, 0.35, 1, Scalar::all(255) };
+	const OverlayCompositor::TextStyle telemetryStyle = { CV_FONT_HERSHEY_DUPLEX, 0.6, 1, Scalar::all(255) };
+	const OverlayCompositor::TextStyle stateStyle = { CV_FONT_HERSHEY_TRIPLEX, 0.7, 1, Scalar(255, 255, 255) };
+	const OverlayCompositor::TextStyle titleStyle = { CV_FONT_HERSHEY_TRIPLEX, 3.5, 3, Scalar::all(0) };
+
+	auto overlay = oni->mOverlay;
+
+	// Read the decoded frame in place; it is only used as a source for the tint below.
+	auto frame = oni->mVideoDecoder->GetLatestFrame();
+	if (frame == nullptr)
+	{
+		return;
 	}
+	Mat& result = overlay->beginFrame(Mat(frame->height, frame->width, CV_8UC3, frame->data));
+	frame.reset();
 
 	// Print current date-time.
 	{
@@ -326,16 +344,11 @@ void Oni::processCoolScreen(Oni* oni, const cv::Mat& wanted_base)
 		char buffer[80];
 		strftime(buffer, sizeof(buffer), "%F %T %z", timeinfo);
 
-		String text(buffer);
-		int fontFace = CV_FONT_HERSHEY_DUPLEX;
-		double fontScale = 0.6;
-		int thickness = 1;
 		int baseline = 0;
-		Size textSize = getTextSize(text, fontFace, fontScale, thickness, &baseline);
-		baseline += thickness;
+		Size textSize = getTextSize(buffer, clockStyle.fontFace, clockStyle.fontScale, clockStyle.thickness, &baseline);
 		Point textOrg(5, 20 + textSize.height / 2);
 
-		putText(result, text, textOrg, fontFace, fontScale, Scalar::all(255), thickness, CV_AA);
+		overlay->drawText(LAYER_CLOCK, buffer, textOrg, clockStyle);
 	}
 
 	// Print console output
@@ -356,26 +369,25 @@ void Oni::processCoolScreen(Oni* oni, const cv::Mat& wanted_base)
 
 		ReadConsoleOutput(hStdout, chiBuffer, coordBufSize, coordBufCoord, &srctReadRect);
 
-		int console_face = CV_FONT_HERSHEY_PLAIN;
-		double console_scale = 0.35;
-		int console_thickness = 1;
+		// The height of a Hershey line does not depend on its text.
+		int console_baseline = 0;
+		Size lineSize = getTextSize("0", consoleStyle.fontFace, consoleStyle.fontScale, consoleStyle.thickness, &console_baseline);
+		console_baseline += consoleStyle.thickness;
+
 		int offset = 40;
+		std::string console_text;
 		for (int i = 0; i < coordBufSize.Y; ++i)
 		{
-			String console_text;
+			console_text.clear();
 			for (int j = 0; j < coordBufSize.X; ++j)
 			{
-				console_text += chiBuffer[i * coordBufSize.X + j].Char.UnicodeChar;
+				console_text += static_cast<char>(chiBuffer[i * coordBufSize.X + j].Char.UnicodeChar);
 			}
 
-			int console_baseline = 0;
-			Size textSize = getTextSize(console_text, console_face, console_scale, console_thickness, &console_baseline);
-			console_baseline += console_thickness;
+			Point console_textOrg(5, offset + lineSize.height / 2);
+			offset += lineSize.height + console_baseline;
 
-			Point console_textOrg(5, offset + textSize.height / 2);
-			offset += textSize.height + console_baseline;
-
-			putText(result, console_text, console_textOrg, console_face, console_scale, Scalar::all(255), console_thickness, CV_AA);
+			overlay->drawText(LAYER_CONSOLE + i, console_text, console_textOrg, consoleStyle);
 		}
 	}
 
@@ -398,176 +410,71 @@ void Oni::processCoolScreen(Oni* oni, const cv::Mat& wanted_base)
 			format("Pan      : %8d", oni->mDroneStatus->pan) };
 
 		int offset = 50;
-		for (auto text : text_arr) {
-			int fontFace = CV_FONT_HERSHEY_DUPLEX;
-			double fontScale = 0.6;
-			int thickness = 1;
+		int layer = LAYER_TELEMETRY;
+		for (const auto& text : text_arr) {
 			int baseline = 0;
-			Size textSize = getTextSize(text, fontFace, fontScale, thickness, &baseline);
-			baseline += thickness;
+			Size textSize = getTextSize(text, telemetryStyle.fontFace, telemetryStyle.fontScale, telemetryStyle.thickness, &baseline);
+			baseline += telemetryStyle.thickness;
 			Point textOrg(result.cols - 300, offset + textSize.height / 2);
 			offset += textSize.height + baseline;
 
-			putText(result, text, textOrg, fontFace, fontScale, Scalar::all(255), thickness, CV_AA);
+			overlay->drawText(layer++, text, textOrg, telemetryStyle);
 		}
 	}
 
 	// Print all captured
-	{
-		int offset = 40;
-		for(auto captured : oni->mTracker->getCaptured())
-		{
-			Mat wanted(wanted_base.rows, wanted_base.cols, wanted_base.type());
-			wanted_base.copyTo(wanted);
-			Mat target;
-			resize(captured, target, Size(325, 270));
-			target.copyTo(wanted(Rect(Point(40, 140), Size(325, 270))));
-
-			Mat channels[3];
-			cvtColor(wanted, wanted, CV_BGR2HSV);
-			split(wanted, channels);
-			channels[0].release();
-			channels[0] = Mat::zeros(wanted.rows, wanted.cols, CV_8UC1);
-			merge(channels, 3, wanted);
-			cvtColor(wanted, wanted, CV_HSV2BGR);
-
-			resize(wanted, wanted, Size(135, 240));
-
-			wanted.copyTo(result(Rect(Point(offset, result.rows - wanted.rows - 20), wanted.size())));
-			offset += wanted.cols + 10;
-		}
-	}
+	overlay->drawPosterRow(Point(40, result.rows - OVERLAY_POSTER_THUMBNAIL_SIZE.height - 20), 10);
+
+	auto state = oni->mStateController->getState();
 
 	// Print main title
-	if (oni->mStateController->getState() == StateController::STATE_READY) {
+	if (state == StateController::STATE_READY) {
 		String text = "DRONE_TAGGER";
-		int fontFace = CV_FONT_HERSHEY_TRIPLEX;
-		double fontScale = 3.5;
-		int thickness = 3;
 		int baseline = 0;
-		Size textSize = getTextSize(text, fontFace, fontScale, thickness, &baseline);
-		baseline += thickness;
+		Size textSize = getTextSize(text, titleStyle.fontFace, titleStyle.fontScale, titleStyle.thickness, &baseline);
+		baseline += titleStyle.thickness;
 		Point textOrg((result.cols - textSize.width) / 2, result.rows / 2 + textSize.height / 2);
 
-		rectangle(result, textOrg + Point(-40, thickness + 40), textOrg + Point(textSize.width + 40, -textSize.height - 40), Scalar(255, 255, 255), CV_FILLED);
-		putText(result, text, textOrg, fontFace, fontScale, Scalar::all(0), thickness, CV_AA);
-	}
-
-	// Print taking off message
-	if (oni->mStateController->getState() == StateController::STATE_TAKINGOFF)
-	{
-		String text = "> TAKING OFF_";
-		int fontFace = CV_FONT_HERSHEY_TRIPLEX;
-		double fontScale = 0.7;
-		int thickness = 1;
-		int baseline = 0;
-		Size textSize = getTextSize(text, fontFace, fontScale, thickness, &baseline);
-		baseline += thickness;
-		Point textOrg(result.cols - 300, 20 + textSize.height / 2);
-
-		putText(result, text, textOrg, fontFace, fontScale, Scalar(255, 255, 255), thickness, CV_AA);
+		rectangle(result, textOrg + Point(-40, titleStyle.thickness + 40), textOrg + Point(textSize.width + 40, -textSize.height - 40), Scalar(255, 255, 255), CV_FILLED);
+		overlay->drawText(LAYER_TITLE, text, textOrg, titleStyle);
 	}
 
-	// Print ready message
-	if (oni->mStateController->getState() == StateController::STATE_HOVERING)
+	// Print the state message
+	const char* stateText = nullptr;
+	switch (state)
 	{
-		String text = "> HOVERING_";
-		int fontFace = CV_FONT_HERSHEY_TRIPLEX;
-		double fontScale = 0.7;
-		int thickness = 1;
-		int baseline = 0;
-		Size textSize = getTextSize(text, fontFace, fontScale, thickness, &baseline);
-		baseline += thickness;
-		Point textOrg(result.cols - 300, 20 + textSize.height / 2);
-
-		putText(result, text, textOrg, fontFace, fontScale, Scalar(255, 255, 255), thickness, CV_AA);
+	case StateController::STATE_TAKINGOFF: stateText = "> TAKING OFF_"; break;
+	case StateController::STATE_HOVERING: stateText = "> HOVERING_"; break;
+	case StateController::STATE_SEARCHING: stateText = "> SEARCHING_"; break;
+	case StateController::STATE_TRACKING:
+	case StateController::STATE_MISSING: stateText = "> TRACKING_"; break;
+	case StateController::STATE_CAPTURED: stateText = "> CAPTURED_"; break;
+	case StateController::STATE_LANDING: stateText = "> LANDING_"; break;
+	default: break;
 	}
-
-	// Print searching target message
-	if (oni->mStateController->getState() == StateController::STATE_SEARCHING)
+	if (stateText != nullptr)
 	{
-		String text = "> SEARCHING_";
-		int fontFace = CV_FONT_HERSHEY_TRIPLEX;
-		double fontScale = 0.7;
-		int thickness = 1;
 		int baseline = 0;
-		Size textSize = getTextSize(text, fontFace, fontScale, thickness, &baseline);
-		baseline += thickness;
+		Size textSize = getTextSize(stateText, stateStyle.fontFace, stateStyle.fontScale, stateStyle.thickness, &baseline);
 		Point textOrg(result.cols - 300, 20 + textSize.height / 2);
 
-		putText(result, text, textOrg, fontFace, fontScale, Scalar(255, 255, 255), thickness, CV_AA);
+		overlay->drawText(LAYER_STATE, stateText, textOrg, stateStyle);
 	}
 
-	// Print tracking message
-	if (oni->mStateController->getState() == StateController::STATE_TRACKING ||
-		oni->mStateController->getState() == StateController::STATE_MISSING)
+	// Print the tracked person
+	if (state == StateController::STATE_TRACKING || state == StateController::STATE_MISSING)
 	{
-		String text = "> TRACKING_";
-		int fontFace = CV_FONT_HERSHEY_TRIPLEX;
-		double fontScale = 0.7;
-		int thickness = 1;
-		int baseline = 0;
-		Size textSize = getTextSize(text, fontFace, fontScale, thickness, &baseline);
-		baseline += thickness;
-		Point textOrg(result.cols - 300, 20 + textSize.height / 2);
-
-		putText(result, text, textOrg, fontFace, fontScale, Scalar(255, 255, 255), thickness, CV_AA);
-
 		auto target = oni->mDroneStatus->currentTarget;
 		rectangle(result, target, Scalar(255, 255, 255, 255), 3);
 	}
 
 	// Print captured
-	if (oni->mStateController->getState() == StateController::STATE_CAPTURED)
-	{
-		String text = "> CAPTURED_";
-		int fontFace = CV_FONT_HERSHEY_TRIPLEX;
-		double fontScale = 0.7;
-		int thickness = 1;
-		int baseline = 0;
-		Size textSize = getTextSize(text, fontFace, fontScale, thickness, &baseline);
-		baseline += thickness;
-		Point textOrg(result.cols - 300, 20 + textSize.height / 2);
-
-		putText(result, text, textOrg, fontFace, fontScale, Scalar(255, 255, 255), thickness, CV_AA);
-
-		auto captured = *oni->mTracker->getCaptured().rbegin();
-		Mat wanted(wanted_base.rows, wanted_base.cols, wanted_base.type());
-		wanted_base.copyTo(wanted);
-		Mat target;
-		resize(captured, target, Size(325, 270));
-		target.copyTo(wanted(Rect(Point(40, 140), Size(325, 270))));
-
-		Mat channels[3];
-		cvtColor(wanted, wanted, CV_BGR2HSV);
-		split(wanted, channels);
-		channels[0].release();
-		channels[0] = Mat::zeros(wanted.rows, wanted.cols, CV_8UC1);
-		merge(channels, 3, wanted);
-		cvtColor(wanted, wanted, CV_HSV2BGR);
-
-		resize(wanted, wanted, Size(180, 320));
-
-		wanted.copyTo(result(Rect(Point((result.cols - wanted.cols) / 2, (result.rows - wanted.rows) / 2), wanted.size())));
-	}
-
-	// Print landing message
-	if (oni->mStateController->getState() == StateController::STATE_LANDING)
+	if (state == StateController::STATE_CAPTURED)
 	{
-		String text = "> LANDING_";
-		int fontFace = CV_FONT_HERSHEY_TRIPLEX;
-		double fontScale = 0.7;
-		int thickness = 1;
-		int baseline = 0;
-		Size textSize = getTextSize(text, fontFace, fontScale, thickness, &baseline);
-		baseline += thickness;
-		Point textOrg(result.cols - 300, 20 + textSize.height / 2);
-
-		putText(result, text, textOrg, fontFace, fontScale, Scalar(255, 255, 255), thickness, CV_AA);
+		overlay->drawLastPoster();
 	}
 
 	imshow(COOL_SCREEN_WINDOW_NAME, result);
-	result.release();
 }
 
 DWORD WINAPI Oni::user_command_loop(LPVOID lpParam)
@@ -581,11 +488,11 @@ DWORD WINAPI Oni::user_command_loop(LPVOID lpParam)
 
 	Sleep(2000);
 
-	auto wanted_base = cv::imread("tehai.png");
+	oni->mVideoDecoder->SetBGRViewEnabled(true);
 
 	while (oni->mStateController->getState() != StateController::STATE_FINISHED)
 	{
-		processCoolScreen(oni, wanted_base);
+		processCoolScreen(oni);
 
 		auto commandKey = cv::waitKey(100);
 
@@ -594,260 +501,161 @@ DWORD WINAPI Oni::user_command_loop(LPVOID lpParam)
 		case 'E': // Emergency
 		case 'e':
 		{
-			oni->mReceivedCommand = OniCommand::Emergency;
+			postCommand(oni, StateController::COMMAND_EMERGENCY);
 		}
 		break;
 
 		case 'T': // Take Off
 		case 't':
 		{
-			oni->mReceivedCommand = OniCommand::TakeOff;
+			postCommand(oni, StateController::COMMAND_TAKEOFF);
 		}
 		break;
 
 		case 'S': // Search
 		case 's':
 		{
-			oni->mReceivedCommand = OniCommand::Search;
+			postCommand(oni, StateController::COMMAND_SEARCH);
 		}
 		break;
 
 		case 'L': // Land
 		case 'l':
 		{
-			oni->mReceivedCommand = OniCommand::Land;
+			postCommand(oni, StateController::COMMAND_LAND);
 		}
 		break;
 
 		case 'D': // Disconnect
 		case 'd':
 		{
-			oni->mReceivedCommand = OniCommand::Disconnect;
+			postCommand(oni, StateController::COMMAND_DISCONNECT);
 		}
 		default:
 			break;
 		}
 	}
 
+	oni->mVideoDecoder->SetBGRViewEnabled(false);
+
 	return 0;
 }
 
-void Oni::processStateStart(StateController::STATE_PARAMETER*& currentParameter)
+void Oni::postCommand(Oni* oni, StateController::COMMAND command)
 {
-	auto param = dynamic_cast<StateController::STATE_PARAMETER_START*>(currentParameter);
-	if (param == nullptr)
-	{
-		delete currentParameter;
-		currentParameter = new StateController::STATE_PARAMETER_START;
-	}
-	else
-	{
-		param->connected = true;
-	}
+	StateController::EVENT event;
+	event.type = StateController::EVENT_COMMAND;
+	event.command = command;
+	oni->mStateController->postEvent(event);
 }
 
-void Oni::processStateReady(StateController::STATE_PARAMETER*& currentParameter, Oni::OniCommand command)
+bool Oni::classifyDetection(Oni* oni, StateController::EVENT_DETECTION_DATA& detection)
 {
-	auto param = dynamic_cast<StateController::STATE_PARAMETER_READY*>(currentParameter);
-	if (param == nullptr)
-	{
-		param = new StateController::STATE_PARAMETER_READY;
-		delete currentParameter;
-		currentParameter = param;
-	}
-
-	switch (command)
+	// Several events may have been coalesced into this one; only the freshest result matters.
+	auto result = oni->mDetectionService->getLatestResult();
+	if (result == nullptr || result->version <= oni->mStateController->getLastDetectionVersion())
 	{
-	case TakeOff:
-		param->command = StateController::STATE_PARAMETER_READY::COMMAND_TAKEOFF;
-		break;
-	case Disconnect:
-		param->command = StateController::STATE_PARAMETER_READY::COMMAND_DISCONNECT;
-		break;
-	case None:
-	case Emergency:
-	case Search:
-	case Land:
-	default:
-		break;
+		return false;
 	}
-}
 
-void Oni::processStateTakingOff(StateController::STATE_PARAMETER*& currentParameter)
-{
-	auto param = dynamic_cast<StateController::STATE_PARAMETER_TAKINGOFF*>(currentParameter);
-	if (param == nullptr)
-	{
-		param = new StateController::STATE_PARAMETER_TAKINGOFF(GetTickCount64());
-		delete currentParameter;;
-		currentParameter = param;
-	}
-}
+	detection.version = result->version;
+	detection.frameId = result->frameTimestamp;
+	detection.direction = StateController::DIRECTION_NONE;
 
-void Oni::processStateHovering(StateController::STATE_PARAMETER*& currentParameter, Oni::OniCommand command)
-{
-	auto param = dynamic_cast<StateController::STATE_PARAMETER_HOVERING*>(currentParameter);
-	if (param == nullptr)
-	{
-		param = new StateController::STATE_PARAMETER_HOVERING(StateController::STATE_PARAMETER_HOVERING::COMMAND_NONE);
-		delete currentParameter;
-		currentParameter = param;
-	}
+	auto& peopleList = result->people;
 
-	switch (command)
+	switch (oni->mStateController->getState())
 	{
-	case Search:
-		param->command = StateController::STATE_PARAMETER_HOVERING::COMMAND_SEARCH;
-		break;
-	case Land:
-		param->command = StateController::STATE_PARAMETER_HOVERING::COMMAND_LAND;
-		break;
-	case None:
-	case Emergency:
-	case TakeOff:
-	default:
-		break;
-	}
-}
-
-void Oni::processStateSearching(Oni* oni, StateController::STATE_PARAMETER*& currentParameter)
-{
-	auto param = dynamic_cast<StateController::STATE_PARAMETER_SEARCHING*>(currentParameter);
-	if (param == nullptr)
+	case StateController::STATE_SEARCHING:
 	{
-		param = new StateController::STATE_PARAMETER_SEARCHING(GetTickCount64(), false);
-		delete currentParameter;
-		currentParameter = param;
-	}
-
-	auto image = oni->getCameraImage(oni->mTracker->resize_rate, oni->mTracker->resize_rate);
-
-	auto peopleList = oni->mTracker->getPeople(image);
-
-	bool found = !peopleList.empty();
+		if (peopleList.empty())
+		{
+			detection.status = StateController::DETECTION_MISSED;
+			break;
+		}
 
-	param->found = found;
-	if(found)
-	{
+		detection.status = StateController::DETECTION_FOUND;
 		auto newRect = cv::Rect(
 			peopleList[0].tl() / oni->mTracker->resize_rate,
 			cv::Size(peopleList[0].width / oni->mTracker->resize_rate, peopleList[0].height / oni->mTracker->resize_rate));
 		oni->mDroneStatus->currentTarget = newRect;
+		oni->mDroneStatus->currentTargetId = result->ids[0];
 	}
-	image.release();
-}
-
-void Oni::processStateTracking(Oni* oni, StateController::STATE_PARAMETER*& currentParameter)
-{
-	auto param = dynamic_cast<StateController::STATE_PARAMETER_TRACKING*>(currentParameter);
-	if (param == nullptr)
+	break;
+	case StateController::STATE_TRACKING:
 	{
-		param = new StateController::STATE_PARAMETER_TRACKING(oni->mTracker, StateController::STATE_PARAMETER_TRACKING::STATUS_NONE, StateController::STATE_PARAMETER_TRACKING::DIRECTION_NONE);
-		delete currentParameter;
-		currentParameter = param;
-	}
-
-	auto image = oni->getCameraImage(oni->mTracker->resize_rate, oni->mTracker->resize_rate);
-	auto peopleList = oni->mTracker->getPeople(image);
+		if (peopleList.empty())
+		{
+			detection.status = StateController::DETECTION_MISSED;
+			break;
+		}
 
-	if(peopleList.empty())
-	{
-		param->status = StateController::STATE_PARAMETER_TRACKING::STATUS_MISSED;
-	}
-	else
-	{
-		int trackingPerson = 0;
+		// Stay on the same person while the tracker follows it; otherwise take the largest one.
+		auto& ids = result->ids;
+		auto it = std::find(ids.begin(), ids.end(), oni->mDroneStatus->currentTargetId);
+		int trackingPerson = it != ids.end() ? static_cast<int>(it - ids.begin()) : 0;
+		oni->mDroneStatus->currentTargetId = ids[trackingPerson];
 		auto person = peopleList[trackingPerson];
 		auto newRect = cv::Rect(person.tl() / oni->mTracker->resize_rate, cv::Size(person.width / oni->mTracker->resize_rate, person.height / oni->mTracker->resize_rate));
 		oni->mDroneStatus->currentTarget = newRect;
 
-		if (oni->mTracker->isPersonInBorder(image, person))
+		if (oni->mTracker->isPersonInBorder(person))
 		{
-			param->status = StateController::STATE_PARAMETER_TRACKING::STATUS_CAPTURED;
-			oni->mTracker->addCaptured(image, person);
+			detection.status = StateController::DETECTION_CAPTURED;
+			captureTarget(oni, person, newRect);
 			printf("STATUS_CAPTURED\n");
+			break;
 		}
-		else
-		{
-			param->status = StateController::STATE_PARAMETER_TRACKING::STATUS_FOUND;
 
-			double leftBorder = image.cols / 3.0;
-			double rightBorder = image.cols * 2.0 / 3.0;
-			double personLocation = person.x + person.width/2;
+		detection.status = StateController::DETECTION_FOUND;
 
-			if (personLocation < leftBorder)
-			{
-				param->direction = StateController::STATE_PARAMETER_TRACKING::DIRECTION_LEFT;
-				printf("STATUS_FOUND: DIRECTION_LEFT\n");
-			}
-			else if (rightBorder < personLocation)
-			{
-				param->direction = StateController::STATE_PARAMETER_TRACKING::DIRECTION_RIGHT;
-				printf("STATUS_FOUND: DIRECTION_RIGHT\n");
-			}
-			else if (leftBorder <= personLocation && personLocation <= rightBorder)
-			{
-				param->direction = StateController::STATE_PARAMETER_TRACKING::DIRECTION_FORWARD;
-				printf("STATUS_FOUND: DIRECTION_FORWARD\n");
-			}
+		double leftBorder = result->imageSize.width / 3.0;
+		double rightBorder = result->imageSize.width * 2.0 / 3.0;
+		double personLocation = person.x + person.width/2;
+
+		if (personLocation < leftBorder)
+		{
+			detection.direction = StateController::DIRECTION_LEFT;
+			printf("STATUS_FOUND: DIRECTION_LEFT\n");
+		}
+		else if (rightBorder < personLocation)
+		{
+			detection.direction = StateController::DIRECTION_RIGHT;
+			printf("STATUS_FOUND: DIRECTION_RIGHT\n");
+		}
+		else if (leftBorder <= personLocation && personLocation <= rightBorder)
+		{
+			detection.direction = StateController::DIRECTION_FORWARD;
+			printf("STATUS_FOUND: DIRECTION_FORWARD\n");
 		}
 	}
-}
-
-void Oni::processStateMissing(Oni* oni, StateController::STATE_PARAMETER*& currentParameter)
-{
-	auto param = dynamic_cast<StateController::STATE_PARAMETER_MISSING*>(currentParameter);
-	if (param == nullptr)
+	break;
+	case StateController::STATE_MISSING:
 	{
-		param = new StateController::STATE_PARAMETER_MISSING(oni->mTracker, GetTickCount64(), false);
-		delete currentParameter;
-		currentParameter = param;
+		detection.status = peopleList.empty() ? StateController::DETECTION_MISSED : StateController::DETECTION_FOUND;
+	}
+	break;
+	default:
+		return false;
 	}
 
-	auto image = oni->getCameraImage(oni->mTracker->resize_rate, oni->mTracker->resize_rate);
-
-	auto peopleList = oni->mTracker->getPeople(image);
-
-	param->found = !peopleList.empty();
+	return true;
 }
 
-void Oni::processStateCaptured(Oni* oni, StateController::STATE_PARAMETER*& currentParameter)
+void Oni::onStateChanged(Oni* oni, StateController::STATE state)
 {
-	auto param = dynamic_cast<StateController::STATE_PARAMETER_CAPTURED*>(currentParameter);
-	if (param == nullptr)
-	{
-		param = new StateController::STATE_PARAMETER_CAPTURED(oni->mTracker, GetTickCount64());
-		delete currentParameter;
-		currentParameter = param;
-	}
-}
+	oni->mDetectionService->setActive(
+		state == StateController::STATE_SEARCHING ||
+		state == StateController::STATE_TRACKING ||
+		state == StateController::STATE_MISSING);
+	oni->mDetectionService->setTrackingMode(state == StateController::STATE_TRACKING);
 
-void Oni::processStateLanding(Oni* oni, StateController::STATE_PARAMETER*& currentParameter)
-{
-	auto param = dynamic_cast<StateController::STATE_PARAMETER_LANDING*>(currentParameter);
-	if (param == nullptr)
+	if (state == StateController::STATE_LANDING)
 	{
-		param = new StateController::STATE_PARAMETER_LANDING(GetTickCount64());
-		delete currentParameter;
-		currentParameter = param;
-
 		oni->mTracker->clearCaptured();
 	}
 }
 
-void Oni::processStateFinished(Oni* oni, StateController::STATE_PARAMETER*& currentParameter)
-{
-	auto param = dynamic_cast<StateController::STATE_PARAMETER_FINISHED*>(currentParameter);
-	if (param == nullptr)
-	{
-		param = new StateController::STATE_PARAMETER_FINISHED;
-		delete currentParameter;
-		currentParameter = param;
-	}
-
-	oni->mStateController->processState(currentParameter);
-}
-
 DWORD WINAPI Oni::oni_state_loop(LPVOID lpParam)
 {
 	auto oni = static_cast<Oni*>(lpParam);
@@ -857,105 +665,32 @@ DWORD WINAPI Oni::oni_state_loop(LPVOID lpParam)
 		return -1;
 	}
 
-	static StateController::STATE_PARAMETER* currentParameter = nullptr;
+	auto stateController = oni->mStateController;
+	auto previousState = stateController->getState();
+	onStateChanged(oni, previousState);
 
-	while (true)
+	StateController::EVENT event;
+	event.type = StateController::EVENT_CONNECTED;
+	stateController->postEvent(event);
+
+	// Sleeps until something happens: a command, a detection, a telemetry change or the deadline of the state.
+	while (previousState != StateController::STATE_FINISHED)
 	{
-		auto command = oni->mReceivedCommand;
-		oni->mReceivedCommand = None;
-		if(command == Emergency)
-		{
-			oni->mStateController->setState(StateController::STATE_EMERGENCY);
-			oni->mStateController->processState(nullptr);
-			continue;
-		}
+		stateController->waitEvent(event);
 
-		auto state = oni->mStateController->getState();
-		switch (state)
-		{
-		case StateController::STATE_EMERGENCY:
-			delete currentParameter;
-			currentParameter = nullptr;
-		break;
-		case StateController::STATE_START:
-			processStateStart(currentParameter);
-		break;
-		case StateController::STATE_READY:
-			processStateReady(currentParameter, command);
-		break;
-		case StateController::STATE_TAKINGOFF:
-			processStateTakingOff(currentParameter);
-		break;
-		case StateController::STATE_HOVERING:
-			processStateHovering(currentParameter, command);
-		break;
-		case StateController::STATE_SEARCHING:
+		if (event.type == StateController::EVENT_DETECTION && !classifyDetection(oni, event.detection))
 		{
-			if (command == Land)
-			{
-				oni->mStateController->setState(StateController::STATE_LANDING);
-				delete currentParameter;
-				currentParameter = nullptr;
-				oni->mStateController->processState(currentParameter);
-				continue;
-			}
-
-			processStateSearching(oni, currentParameter);
+			continue;
 		}
-		break;
-		case StateController::STATE_TRACKING:
-		{
-			if (command == Land)
-			{
-				oni->mStateController->setState(StateController::STATE_LANDING);
-				delete currentParameter;
-				currentParameter = nullptr;
-				oni->mStateController->processState(currentParameter);
-				continue;
-			}
 
-			processStateTracking(oni, currentParameter);
-		}
-		break;
-		case StateController::STATE_MISSING:
-		{
-			if (command == Land)
-			{
-				oni->mStateController->setState(StateController::STATE_LANDING);
-				delete currentParameter;
-				currentParameter = nullptr;
-				oni->mStateController->processState(currentParameter);
-				continue;
-			}
+		stateController->dispatch(event);
 
-			processStateMissing(oni, currentParameter);
-		}
-		break;
-		case StateController::STATE_CAPTURED:
+		auto state = stateController->getState();
+		if (state != previousState)
 		{
-			if (command == Land)
-			{
-				oni->mStateController->setState(StateController::STATE_LANDING);
-				delete currentParameter;
-				currentParameter = nullptr;
-				oni->mStateController->processState(currentParameter);
-				continue;
-			}
-
-			processStateCaptured(oni, currentParameter);
+			onStateChanged(oni, state);
+			previousState = state;
 		}
-		break;
-		case StateController::STATE_LANDING:
-			processStateLanding(oni, currentParameter);
-			break;
-		case StateController::STATE_FINISHED:
-			processStateFinished(oni, currentParameter);
-			return 0;
-		default: break;
-		}
-
-		oni->mStateController->processState(currentParameter);
-		Sleep(50);
 	}
 
 	return 0;
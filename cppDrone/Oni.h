@@ -3,6 +3,8 @@
 #include "bebop_video_decoder.h"
 #include "StateController.h"
 #include "OniTracker.h"
+#include "DetectionService.h"
+#include "OverlayCompositor.h"
 
 #define MONITOR_WINDOW_NAME "Drone Monitor"
 
@@ -12,16 +14,6 @@ class Oni
 {
 // Models
 public:
-	enum OniCommand
-	{
-		None = 0,
-		Emergency,
-		TakeOff,
-		Search,
-		Land,
-		Disconnect,
-	};
-
 	struct DroneStatus
 	{
 		int battery;
@@ -41,6 +33,7 @@ public:
 		int dZ;
 		int dPsi;
 		cv::Rect currentTarget;
+		int currentTargetId;
 	};
 
 // Members
@@ -48,8 +41,9 @@ private:
 	ARCONTROLLER_Device_t* mDeviceController;
 	bebop_driver::VideoDecoder* mVideoDecoder;
 	StateController* mStateController;
-	OniCommand mReceivedCommand = None;
 	OniTracker* mTracker;
+	DetectionService* mDetectionService;
+	OverlayCompositor* mOverlay;
 
 	DroneStatus* mDroneStatus;
 
@@ -65,60 +59,95 @@ public:
 	{
 		auto oni = new Oni();
 
-		auto startError = start_bebop2(&oni->mDeviceController, oni->cEvent, oni->mVideoDecoder, oni->cFrame, (void *)oni->mDroneStatus);
+		auto startError = start_bebop2(&oni->mDeviceController, oni->cEvent, oniEventKeys, oniEventKeysCount, oni->mVideoDecoder, oni->cFrame, (void *)oni);
 		if(startError != ARCONTROLLER_OK)
 		{
 			return nullptr;
 		}
-		oni->mStateController = new StateController(oni->mDeviceController);
+		// Events received during the connection wait in the queue until the state loop starts.
+		oni->mStateController->setDeviceController(oni->mDeviceController);
 
 		return oni;
 	}
 
 	void startOni()
 	{
+		mDetectionService->start();
+
 		hThread[0] = CreateThread(nullptr, 0, user_command_loop, this, 0, &hThreadId[0]);
 		hThread[1] = CreateThread(nullptr, 0, oni_state_loop, this, 0, &hThreadId[1]);
 
 		WaitForMultipleObjects(2, hThread, TRUE, INFINITE);
 
+		mDetectionService->stop();
+
 		CloseHandle(hThread[0]);
 		CloseHandle(hThread[1]);
 	}
 
 	cv::Mat getCameraImage(double ratioX, double ratioY) const;
 
+	// Wraps a decoded frame without copying. The caller must keep 'frame' alive while using the Mat.
+	static cv::Mat wrapFrame(const bebop_driver::VideoFramePtr& frame);
+
 private:
 	static DWORD WINAPI user_command_loop(LPVOID lpParam);
 
 	static DWORD WINAPI oni_state_loop(LPVOID lpParam);
 
 	static void oni_event_loop(eARCONTROLLER_DICTIONARY_KEY commandKey, ARCONTROLLER_DICTIONARY_ELEMENT_t *elementDictionary, void *customData);
+	// The commands handled by oni_event_loop; the others are not built.
+	static const eARCONTROLLER_DICTIONARY_KEY oniEventKeys[];
+	static const int oniEventKeysCount;
 
 	static eARCONTROLLER_ERROR oni_image_loop(ARCONTROLLER_Frame_t *frame, void *customData);
 
+	// Copies the periodic states of the drone into mDroneStatus; called from oni_event_loop.
+	static void updateTelemetry(Oni* oni);
+
 private:
-	static void processCoolScreen(Oni * oni, const cv::Mat& wanted_base);
-
-	static void processStateStart(StateController::STATE_PARAMETER*& currentParameter);
-	static void processStateReady(StateController::STATE_PARAMETER*& currentParameter, Oni::OniCommand command);
-	static void processStateTakingOff(StateController::STATE_PARAMETER*& currentParameter);
-	static void processStateHovering(StateController::STATE_PARAMETER*& currentParameter, Oni::OniCommand command);
-	static void processStateSearching(Oni* oni, StateController::STATE_PARAMETER*& currentParameter);
-	static void processStateTracking(Oni* oni, StateController::STATE_PARAMETER*& currentParameter);
-	static void processStateMissing(Oni* oni, StateController::STATE_PARAMETER*& currentParameter);
-	static void processStateCaptured(Oni* oni, StateController::STATE_PARAMETER*& currentParameter);
-	static void processStateLanding(Oni* oni, StateController::STATE_PARAMETER*& currentParameter);
-	static void processStateFinished(Oni* oni, StateController::STATE_PARAMETER*& currentParameter);
+	static void processCoolScreen(Oni * oni);
+	static void captureTarget(Oni* oni, const cv::Rect& person, const cv::Rect& target);
+
+	static void postCommand(Oni* oni, StateController::COMMAND command);
+
+	// Reads the latest detection result into the event for the current state; false if there is nothing new.
+	static bool classifyDetection(Oni* oni, StateController::EVENT_DETECTION_DATA& detection);
+	// Follows a state change outside of the drone: detection mode and the captured people.
+	static void onStateChanged(Oni* oni, StateController::STATE state);
 
 // Constructors
 private:
 	Oni(): mDeviceController(nullptr), cEvent(oni_event_loop), cFrame(oni_image_loop)
 	{
+		// Only keeps the captured people; detection runs in the DetectionService workers.
+		mTracker = new OniTracker(1);
 		mVideoDecoder = new bebop_driver::VideoDecoder();
+		auto workerCount = DetectionService::defaultWorkerCount();
+		// The detector reads a pre-scaled luma plane; the BGR view is only produced while the screen is shown.
+		// Every detection worker holds one gray frame while it runs.
+		mVideoDecoder->ConfigureGrayView(true, mTracker->resize_rate, bebop_driver::VideoDecoder::FRAME_RING_SIZE + workerCount);
+		mVideoDecoder->SetBGRViewEnabled(false);
+		mDetectionService = new DetectionService(mVideoDecoder, bebop_driver::VIDEO_VIEW_GRAY, workerCount);
 		mStateController = new StateController(mDeviceController);
-		mTracker = new OniTracker();
+		// Every published result wakes the state loop up at once.
+		mDetectionService->setResultCallback([this](const DetectionService::Result& result)
+		{
+			StateController::EVENT event;
+			event.type = StateController::EVENT_DETECTION;
+			event.detection.version = result.version;
+			event.detection.status = StateController::DETECTION_NONE;
+			event.detection.direction = StateController::DIRECTION_NONE;
+			event.detection.frameId = result.frameTimestamp;
+			mStateController->postEvent(event);
+		});
+		// The posters are built once, when someone is captured, rather than on every screen update.
+		mOverlay = new OverlayCompositor();
+		mTracker->setCapturedCallbacks(
+			[this](const cv::Mat& person) { mOverlay->addCaptured(person); },
+			[this] { mOverlay->clearCaptured(); });
 		mDroneStatus = new DroneStatus;
 		memset(mDroneStatus, 0, sizeof(mDroneStatus));
+		mDroneStatus->currentTargetId = -1;
 	}
 };
@@ -4,13 +4,43 @@
 
 using namespace cv;
 
+namespace
+{
+	/**
+	 * 1̃XP[ш1̃JXP[hŌoB
+	 * ш悲Ƃɕʂ̃JXP[hĝŁAXbhԂŕފLȂB
+	 */
+	class ScaleBandInvoker : public ParallelLoopBody
+	{
+	private:
+		std::vector<CascadeClassifier>& cascades;
+		const std::vector<std::pair<Size, Size>>& bands;
+		const Mat& image;
+		double scaleFactor;
+		std::vector<std::vector<Rect>>& found;
+
+	public:
+		ScaleBandInvoker(std::vector<CascadeClassifier>& cascades, const std::vector<std::pair<Size, Size>>& bands,
+			const Mat& image, double scaleFactor, std::vector<std::vector<Rect>>& found)
+			: cascades(cascades), bands(bands), image(image), scaleFactor(scaleFactor), found(found) { }
+
+		void operator()(const Range& range) const override
+		{
+			for (int i = range.start; i < range.end; ++i)
+			{
+				// minNeighbors = 0 Ő̌ԂAO[sO͑Sш܂Ƃ߂Ăs
+				cascades[i].detectMultiScale(image, found[i], scaleFactor, 0, 0, bands[i].first, bands[i].second);
+			}
+		}
+	};
+}
+
 /**
  * l苗ȓɂāAS߂܂ƔfꍇtrueԂB
  * 
- *  image ̓J摜\B
  *  person ͒ǐՒ̐l\B
  */
-bool OniTracker::isPersonInBorder(const Mat& image, const Rect person)
+bool OniTracker::isPersonInBorder(const Rect person)
 {
 	/////v/////
 	double reference_d = 2.5;	//̋(m)
@@ -25,6 +55,97 @@ bool OniTracker::isPersonInBorder(const Mat& image, const Rect person)
 	return distance <= near_range;
 }
 
+/**
+ * J摜op̃qXgORς݃O[摜ɕϊB
+ * 1`l摜ifR[_̃O[r[j͂̂܂ܕRB
+ */
+void OniTracker::toEqualizedGray(const Mat& image, Mat& gray)
+{
+	if (image.channels() == 1)
+	{
+		equalizeHist(image, gray);
+		return;
+	}
+
+	cvtColor(image, gray, CV_BGR2GRAY);
+	equalizeHist(gray, gray);
+}
+
+/**
+ * detectMultiScale Ɠŉ摜s~bhHAvZʂقړȂ悤
+ * T̑傫 count ̑шɕBeш (ŏTCY, őTCY) ŕ\B
+ */
+std::vector<std::pair<Size, Size>> OniTracker::planScaleBands(const Size& imageSize, const Size& window, double scaleFactor, int count)
+{
+	std::vector<Size> windows;
+	std::vector<double> costs;
+	double totalCost = 0;
+
+	for (double factor = 1; ; factor *= scaleFactor)
+	{
+		Size windowSize(cvRound(window.width * factor), cvRound(window.height * factor));
+		Size scaledImageSize(cvRound(imageSize.width / factor), cvRound(imageSize.height / factor));
+		if (scaledImageSize.width < window.width || scaledImageSize.height < window.height)
+		{
+			break;
+		}
+
+		windows.push_back(windowSize);
+		costs.push_back(static_cast<double>(scaledImageSize.area()));
+		totalCost += costs.back();
+	}
+
+	std::vector<std::pair<Size, Size>> bands;
+	if (windows.empty())
+	{
+		return bands;
+	}
+
+	double budget = totalCost / count;
+	double accumulated = 0;
+	size_t first = 0;
+	for (size_t i = 0; i < windows.size(); ++i)
+	{
+		accumulated += costs[i];
+		bool last = i + 1 == windows.size();
+		// ۂ߂œ傫ɂȂʁX̑шɕƌ₪d̂ŁAEɂȂ
+		bool splittable = !last && windows[i + 1] != windows[i];
+		if (last || (splittable && accumulated >= budget && static_cast<int>(bands.size()) < count - 1))
+		{
+			bands.push_back(std::make_pair(windows[first], windows[i]));
+			first = i + 1;
+			accumulated = 0;
+		}
+	}
+
+	return bands;
+}
+
+/**
+ * XP[ш悲ƂɕɌoAdetectMultiScale ƓŃO[sOB
+ * 
+ *  cascades ͑ш悲Ƃ̃JXP[h\B
+ *  gray ͕Rς݂̃O[摜\B
+ */
+std::vector<Rect> OniTracker::detectParallel(std::vector<CascadeClassifier>& cascades, const Mat& gray)
+{
+	auto bands = planScaleBands(gray.size(), cascades[0].getOriginalWindowSize(), this->scaleFactor, static_cast<int>(cascades.size()));
+
+	std::vector<std::vector<Rect>> found(bands.size());
+	parallel_for_(Range(0, static_cast<int>(bands.size())), ScaleBandInvoker(cascades, bands, gray, this->scaleFactor, found));
+
+	std::vector<Rect> people;
+	for (auto& band : found)
+	{
+		people.insert(people.end(), band.begin(), band.end());
+	}
+
+	// CascadeClassifier::detectMultiScale  GROUP_EPS Ɠl
+	groupRectangles(people, this->minNeighbors, 0.2);
+
+	return people;
+}
+
 /**
  * J摜̒ɐl邩ǂfB
  * lꍇAoꂽׂĂ̐lԂB
@@ -33,13 +154,24 @@ bool OniTracker::isPersonInBorder(const Mat& image, const Rect person)
  */
 std::vector<Rect> OniTracker::getPeople(const Mat& image)
 {
+	if (image.empty())
+	{
+		return std::vector<Rect>();
+	}
+
 	if (this->useCascade2000) {
 		Mat gray_img; //OC摜ϊ
-		cvtColor(image, gray_img, CV_BGR2GRAY);
-		equalizeHist(gray_img, gray_img);
+		toEqualizedGray(image, gray_img);
 
 		std::vector<cv::Rect> people;
-		this->cascade2000.detectMultiScale(gray_img, people); //ݒ
+		if (this->parallelBands > 1)
+		{
+			people = detectParallel(this->cascade2000Bands, gray_img);
+		}
+		else
+		{
+			this->cascade2000.detectMultiScale(gray_img, people, this->scaleFactor, this->minNeighbors); //ݒ
+		}
 		gray_img.release();
 
 		std::cout << "found:" << people.size() << std::endl;
@@ -51,11 +183,17 @@ std::vector<Rect> OniTracker::getPeople(const Mat& image)
 
 	if (this->useCascade10000) {
 		Mat gray_img; //OC摜ϊ
-		cvtColor(image, gray_img, CV_BGR2GRAY);
-		equalizeHist(gray_img, gray_img);
+		toEqualizedGray(image, gray_img);
 
 		std::vector<cv::Rect> people;
-		this->cascade10000.detectMultiScale(gray_img, people); //ݒ
+		if (this->parallelBands > 1)
+		{
+			people = detectParallel(this->cascade10000Bands, gray_img);
+		}
+		else
+		{
+			this->cascade10000.detectMultiScale(gray_img, people, this->scaleFactor, this->minNeighbors); //ݒ
+		}
 		gray_img.release();
 
 		std::cout << "found:" << people.size() << std::endl;
@@ -84,6 +222,65 @@ std::vector<Rect> OniTracker::getPeople(const Mat& image)
 	return std::vector<Rect>();
 }
 
+/**
+ * ǐՒ̐l̑Oʒu̎ӂTB
+ * T͈͂͑Ö̗ trackingRoiMargin {㉺EɍĹ͈A
+ * T̑傫͑Ȏ傫 trackingMinScale { trackingMaxScale {܂łɌB
+ * 
+ *  image ̓J摜\B
+ *  previous ͑O񌟏ol̗̈iimage ̍Wj\B
+ */
+std::vector<Rect> OniTracker::getPeopleAround(const Mat& image, const Rect& previous)
+{
+	if (image.empty() || previous.area() <= 0)
+	{
+		return std::vector<Rect>();
+	}
+
+	CascadeClassifier* cascade = nullptr;
+	if (this->useCascade2000)
+	{
+		cascade = &this->cascade2000;
+	}
+	else if (this->useCascade10000)
+	{
+		cascade = &this->cascade10000;
+	}
+	else
+	{
+		return getPeople(image);
+	}
+
+	int marginX = cvRound(previous.width * this->trackingRoiMargin);
+	int marginY = cvRound(previous.height * this->trackingRoiMargin);
+	Rect roi = Rect(previous.x - marginX, previous.y - marginY, previous.width + marginX * 2, previous.height + marginY * 2)
+		& Rect(0, 0, image.cols, image.rows);
+
+	Size minSize(cvRound(previous.width * this->trackingMinScale), cvRound(previous.height * this->trackingMinScale));
+	Size maxSize(cvRound(previous.width * this->trackingMaxScale), cvRound(previous.height * this->trackingMaxScale));
+	Size window = cascade->getOriginalWindowSize();
+	if (roi.width < window.width || roi.height < window.height)
+	{
+		return std::vector<Rect>();
+	}
+
+	Mat gray_img;
+	toEqualizedGray(image(roi), gray_img);
+
+	std::vector<Rect> people;
+	cascade->detectMultiScale(gray_img, people, this->scaleFactor, this->minNeighbors, 0, minSize, maxSize);
+	gray_img.release();
+
+	for (auto& person : people)
+	{
+		person += roi.tl();
+	}
+
+	std::sort(people.begin(), people.end(), [](cv::Rect a, cv::Rect b) { return a.area() > b.area(); });
+
+	return people;
+}
+
 void OniTracker::addCaptured(const Mat& image, const Rect person)
 {
 	Mat region(person.height, person.width, image.type());
@@ -91,14 +288,17 @@ void OniTracker::addCaptured(const Mat& image, const Rect person)
 	this->captured_mutex.lock();
 	this->captured.push_back(region);
 	this->captured_mutex.unlock();
+
+	if (this->captured_added)
+	{
+		this->captured_added(region);
+	}
 }
 
-std::vector<Mat>& OniTracker::getCaptured()
+std::vector<Mat> OniTracker::getCaptured()
 {
-	this->captured_mutex.lock();
-	auto clone = new std::vector<Mat>(this->captured);
-	this->captured_mutex.unlock();
-	return *clone;
+	std::lock_guard<std::mutex> lock(this->captured_mutex);
+	return this->captured;
 }
 
 void OniTracker::clearCaptured()
@@ -110,4 +310,15 @@ void OniTracker::clearCaptured()
 	}
 	this->captured.clear();
 	this->captured_mutex.unlock();
+
+	if (this->captured_cleared)
+	{
+		this->captured_cleared();
+	}
+}
+
+void OniTracker::setCapturedCallbacks(std::function<void(const Mat&)> added, std::function<void()> cleared)
+{
+	this->captured_added = added;
+	this->captured_cleared = cleared;
 }
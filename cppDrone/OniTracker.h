@@ -6,6 +6,7 @@
 #include <vector>
 #include <mutex>
 #include <algorithm>
+#include <functional>
 
 #include <opencv2/core.hpp>
 #include <opencv2/objdetect.hpp>
@@ -16,33 +17,72 @@ class OniTracker
 {
 public:
 	const double resize_rate = 0.7;
-	const bool useCascade2000 = false;
-	const bool useCascade10000 = true;
-	const bool useHog = false;
+	// Detectors run by getPeople; the first one enabled wins.
+	const bool useCascade2000;
+	const bool useCascade10000;
+	const bool useHog;
+	const double scaleFactor = 1.1;
+	const int minNeighbors = 3;
+	// Number of scale bands the cascade pyramid is split into; 1 runs detectMultiScale as is.
+	const int parallelBands;
+	// Region of interest used while tracking: the previous rect grown by this ratio on every side,
+	// searched only for windows between these ratios of the previous size.
+	const double trackingRoiMargin = 1.0;
+	const double trackingMinScale = 0.7;
+	const double trackingMaxScale = 1.5;
 
 private:
 	std::mutex captured_mutex;
 	cv::CascadeClassifier cascade2000;
 	cv::CascadeClassifier cascade10000;
+	std::vector<cv::CascadeClassifier> cascade2000Bands;
+	std::vector<cv::CascadeClassifier> cascade10000Bands;
 	cv::HOGDescriptor hog;
 	std::vector<cv::Mat> captured;
+	std::function<void(const cv::Mat&)> captured_added;
+	std::function<void()> captured_cleared;
+
+	static void toEqualizedGray(const cv::Mat& image, cv::Mat& gray);
+
+	static std::vector<std::pair<cv::Size, cv::Size>> planScaleBands(const cv::Size& imageSize, const cv::Size& window, double scaleFactor, int count);
+
+	std::vector<cv::Rect> detectParallel(std::vector<cv::CascadeClassifier>& cascades, const cv::Mat& gray);
 
 public:
-	bool isPersonInBorder(const cv::Mat& image, const cv::Rect person);
+	bool isPersonInBorder(const cv::Rect person);
 
 	std::vector<cv::Rect> getPeople(const cv::Mat& image);
 
+	std::vector<cv::Rect> getPeopleAround(const cv::Mat& image, const cv::Rect& previous);
+
 	void addCaptured(const cv::Mat& image, const cv::Rect person);
 
-	std::vector<cv::Mat>& getCaptured();
+	std::vector<cv::Mat> getCaptured();
 
 	void clearCaptured();
 
+	// Called on the thread of addCaptured / clearCaptured, after the list changed.
+	void setCapturedCallbacks(std::function<void(const cv::Mat&)> added, std::function<void()> cleared);
+
 public:
-	OniTracker()
+	// parallelBands <= 0 uses one band per OpenCV worker thread.
+	OniTracker(int parallelBands = 0)
+		: OniTracker(parallelBands, false, true, false)
+	{
+	}
+
+	OniTracker(int parallelBands, bool useCascade2000, bool useCascade10000, bool useHog)
+		: useCascade2000(useCascade2000), useCascade10000(useCascade10000), useHog(useHog),
+		parallelBands(parallelBands > 0 ? parallelBands : cv::getNumThreads())
 	{
 		cascade2000.load("lbpcascade2000.xml");
 		cascade10000.load("lbpcascade10000.xml");
+		// A cascade must not be used by two threads at once, so each band gets its own copy.
+		for (int i = 0; this->parallelBands > 1 && i < this->parallelBands; ++i)
+		{
+			if (useCascade2000) cascade2000Bands.emplace_back("lbpcascade2000.xml");
+			if (useCascade10000) cascade10000Bands.emplace_back("lbpcascade10000.xml");
+		}
 		hog.setSVMDetector(cv::HOGDescriptor::getDefaultPeopleDetector());
 	}
 };
@@ -0,0 +1,210 @@
+#define TAG "OverlayCompositor"
+
+#include <algorithm>
+
+#include <opencv2/highgui.hpp>
+#include <opencv2/imgproc.hpp>
+
+extern "C" {
+#include <libARSAL/ARSAL_Print.h>
+}
+
+#include "OverlayCompositor.h"
+
+OverlayCompositor::OverlayCompositor(const std::string& posterPath)
+{
+	mPosterBase = cv::imread(posterPath);
+	if (mPosterBase.empty())
+	{
+		ARSAL_PRINT(ARSAL_PRINT_WARNING, TAG, "Can not read %s, the captured people are not shown.", posterPath.c_str());
+	}
+}
+
+cv::Mat& OverlayCompositor::beginFrame(const cv::Mat& frame)
+{
+	tintRed(frame, mCanvas);
+	return mCanvas;
+}
+
+void OverlayCompositor::tintRed(const cv::Mat& src, cv::Mat& dst)
+{
+	CV_Assert(src.type() == CV_8UC3);
+
+	dst.create(src.size(), CV_8UC3);
+
+	for (int y = 0; y < src.rows; ++y)
+	{
+		const uint8_t* in = src.ptr<uint8_t>(y);
+		uint8_t* out = dst.ptr<uint8_t>(y);
+
+		for (int x = 0; x < src.cols; ++x, in += 3, out += 3)
+		{
+			uint8_t low = (std::min)(in[0], (std::min)(in[1], in[2]));
+			uint8_t high = (std::max)(in[0], (std::max)(in[1], in[2]));
+			out[0] = low;
+			out[1] = low;
+			out[2] = high;
+		}
+	}
+}
+
+void OverlayCompositor::drawText(size_t layer, const std::string& text, const cv::Point& origin, const TextStyle& style)
+{
+	if (layer >= mTextLayers.size())
+	{
+		TextLayer empty;
+		empty.rendered = false;
+		mTextLayers.resize(layer + 1, empty);
+	}
+
+	auto& textLayer = mTextLayers[layer];
+	bool changed = !textLayer.rendered || textLayer.text != text || textLayer.origin != origin ||
+		textLayer.style.fontFace != style.fontFace || textLayer.style.fontScale != style.fontScale ||
+		textLayer.style.thickness != style.thickness || textLayer.style.color != style.color;
+
+	if (changed)
+	{
+		textLayer.text = text;
+		textLayer.origin = origin;
+		textLayer.style = style;
+		renderText(textLayer);
+	}
+
+	blendText(textLayer);
+}
+
+void OverlayCompositor::renderText(TextLayer& layer)
+{
+	layer.rendered = true;
+	layer.alpha.release();
+	layer.box = cv::Rect();
+
+	if (layer.text.empty())
+	{
+		return;
+	}
+
+	int baseline = 0;
+	auto size = cv::getTextSize(layer.text, layer.style.fontFace, layer.style.fontScale, layer.style.thickness, &baseline);
+
+	// Thick and anti-aliased strokes spill out of the text size.
+	int margin = layer.style.thickness + 2;
+	layer.box = cv::Rect(layer.origin.x - margin, layer.origin.y - size.height - margin,
+		size.width + 2 * margin, size.height + baseline + 2 * margin);
+
+	layer.alpha = cv::Mat::zeros(layer.box.size(), CV_8UC1);
+	cv::putText(layer.alpha, layer.text, layer.origin - layer.box.tl(), layer.style.fontFace, layer.style.fontScale, cv::Scalar(255), layer.style.thickness, CV_AA);
+}
+
+void OverlayCompositor::blendText(const TextLayer& layer)
+{
+	auto visible = layer.box & cv::Rect(0, 0, mCanvas.cols, mCanvas.rows);
+	if (layer.alpha.empty() || visible.area() == 0)
+	{
+		return;
+	}
+
+	const int color[3] = {
+		cv::saturate_cast<uint8_t>(layer.style.color[0]),
+		cv::saturate_cast<uint8_t>(layer.style.color[1]),
+		cv::saturate_cast<uint8_t>(layer.style.color[2]) };
+	auto alphaOrigin = visible.tl() - layer.box.tl();
+
+	for (int y = 0; y < visible.height; ++y)
+	{
+		const uint8_t* alpha = layer.alpha.ptr<uint8_t>(alphaOrigin.y + y) + alphaOrigin.x;
+		uint8_t* out = mCanvas.ptr<uint8_t>(visible.y + y) + visible.x * 3;
+
+		for (int x = 0; x < visible.width; ++x, out += 3)
+		{
+			int a = alpha[x];
+			if (a == 0)
+			{
+				continue;
+			}
+			for (int c = 0; c < 3; ++c)
+			{
+				out[c] = static_cast<uint8_t>((out[c] * (255 - a) + color[c] * a + 127) / 255);
+			}
+		}
+	}
+}
+
+void OverlayCompositor::drawPosterRow(const cv::Point& origin, int spacing)
+{
+	std::vector<Poster> posters;
+	{
+		std::lock_guard<std::mutex> lock(mPosterMutex);
+		posters = mPosters;
+	}
+
+	auto canvasRect = cv::Rect(0, 0, mCanvas.cols, mCanvas.rows);
+	auto position = origin;
+	for (const auto& poster : posters)
+	{
+		cv::Rect target(position, poster.thumbnail.size());
+		if ((target & canvasRect) != target)
+		{
+			break;
+		}
+		poster.thumbnail.copyTo(mCanvas(target));
+		position.x += target.width + spacing;
+	}
+}
+
+bool OverlayCompositor::drawLastPoster()
+{
+	cv::Mat large;
+	{
+		std::lock_guard<std::mutex> lock(mPosterMutex);
+		if (mPosters.empty())
+		{
+			return false;
+		}
+		large = mPosters.back().large;
+	}
+
+	cv::Rect target(cv::Point((mCanvas.cols - large.cols) / 2, (mCanvas.rows - large.rows) / 2), large.size());
+	if ((target & cv::Rect(0, 0, mCanvas.cols, mCanvas.rows)) != target)
+	{
+		return false;
+	}
+	large.copyTo(mCanvas(target));
+	return true;
+}
+
+void OverlayCompositor::addCaptured(const cv::Mat& person)
+{
+	if (mPosterBase.empty() || person.empty())
+	{
+		return;
+	}
+
+	cv::Mat photo;
+	if (person.type() == CV_8UC3)
+	{
+		photo = person;
+	}
+	else
+	{
+		cv::cvtColor(person, photo, CV_GRAY2BGR);
+	}
+
+	cv::Mat wanted = mPosterBase.clone();
+	auto photoRect = OVERLAY_POSTER_PHOTO_RECT & cv::Rect(0, 0, wanted.cols, wanted.rows);
+	cv::resize(photo, wanted(photoRect), photoRect.size());
+	tintRed(wanted, wanted);
+
+	Poster poster;
+	cv::resize(wanted, poster.thumbnail, OVERLAY_POSTER_THUMBNAIL_SIZE);
+	cv::resize(wanted, poster.large, OVERLAY_POSTER_LARGE_SIZE);
+
+	std::lock_guard<std::mutex> lock(mPosterMutex);
+	mPosters.push_back(poster);
+}
+
+void OverlayCompositor::clearCaptured()
+{
+	std::lock_guard<std::mutex> lock(mPosterMutex);
+	mPosters.clear();
+}
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <opencv2/core.hpp>
+
+// Wanted poster background; the captured person is pasted into its photo frame.
+#define OVERLAY_POSTER_PATH "tehai.png"
+#define OVERLAY_POSTER_PHOTO_RECT cv::Rect(40, 140, 325, 270)
+// Sizes the posters are shown at: in the row of captured people, and alone once someone is captured.
+#define OVERLAY_POSTER_THUMBNAIL_SIZE cv::Size(135, 240)
+#define OVERLAY_POSTER_LARGE_SIZE cv::Size(180, 320)
+
+/**
+ * Composes the cool screen from cached layers on top of the red-tinted
+ * frame, so the UI thread leaves the CPU to detection.
+ *
+ * - The tint runs in a single pass over the frame (tintRed).
+ * - Each text layer keeps the coverage of its text and only runs putText
+ *   again when its text, position or style changed; otherwise the cached
+ *   coverage is blended onto the canvas.
+ * - The posters of the captured people are built once, when
+ *   OniTracker::addCaptured fires, at the sizes they are shown at.
+ */
+class OverlayCompositor
+{
+public:
+	struct TextStyle
+	{
+		int fontFace;
+		double fontScale;
+		int thickness;
+		cv::Scalar color;
+	};
+
+private:
+	struct TextLayer
+	{
+		std::string text;
+		cv::Point origin;          // bottom-left corner of the text, as given to putText
+		TextStyle style;
+		cv::Rect box;              // canvas area covered by the text
+		cv::Mat alpha;             // CV_8UC1 coverage of the text inside box
+		bool rendered;
+	};
+
+	struct Poster
+	{
+		cv::Mat thumbnail;
+		cv::Mat large;
+	};
+
+	cv::Mat mPosterBase;
+	cv::Mat mCanvas;
+	std::vector<TextLayer> mTextLayers;
+
+	// Posters are added from the state loop and drawn from the UI thread.
+	std::mutex mPosterMutex;
+	std::vector<Poster> mPosters;
+
+public:
+	explicit OverlayCompositor(const std::string& posterPath = OVERLAY_POSTER_PATH);
+
+	// Tints the frame into the canvas the layers are then drawn on.
+	cv::Mat& beginFrame(const cv::Mat& frame);
+
+	cv::Mat& getCanvas() { return mCanvas; }
+
+	// Draws the text of a layer. Layers are numbered by the caller and keep their cache between frames.
+	void drawText(size_t layer, const std::string& text, const cv::Point& origin, const TextStyle& style);
+
+	// Draws the thumbnails of the captured people in a row starting at origin, as long as they fit.
+	void drawPosterRow(const cv::Point& origin, int spacing);
+
+	// Draws the poster of the last captured person at the center; false if nobody was captured.
+	bool drawLastPoster();
+
+	// Builds the posters of a captured person; safe from any thread.
+	void addCaptured(const cv::Mat& person);
+	void clearCaptured();
+
+	// Same result as BGR -> HSV, hue set to 0, HSV -> BGR, in one pass: with a zero hue the
+	// conversion back gives B = G = min(B, G, R) and R = max(B, G, R). src and dst may be the same.
+	static void tintRed(const cv::Mat& src, cv::Mat& dst);
+
+private:
+	void renderText(TextLayer& layer);
+	void blendText(const TextLayer& layer);
+};
@@ -0,0 +1,215 @@
+#include "PersonTracker.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+
+#include <opencv2/imgproc.hpp>
+
+namespace
+{
+	double intersectionRate(const cv::Rect2d& a, const cv::Rect2d& b)
+	{
+		auto united = (a | b).area();
+		return united > 0 ? (a & b).area() / united : 0.0;
+	}
+
+	cv::Point2d center(const cv::Rect2d& rect)
+	{
+		return cv::Point2d(rect.x + rect.width / 2, rect.y + rect.height / 2);
+	}
+}
+
+void PersonTracker::predict(Track& track, uint64_t sequence) const
+{
+	if (sequence <= track.lastSequence)
+	{
+		return;
+	}
+
+	auto frames = static_cast<double>(sequence - track.lastSequence);
+	track.rect.x += track.velocity.x * frames;
+	track.rect.y += track.velocity.y * frames;
+	track.lastSequence = sequence;
+}
+
+bool PersonTracker::match(Track& track, const cv::Mat& gray) const
+{
+	if (track.templ.empty())
+	{
+		return false;
+	}
+
+	// Search as far as the person could have moved, but at least a quarter of its size.
+	double marginX = std::max(std::abs(track.velocity.x) * 2, track.rect.width / 4);
+	double marginY = std::max(std::abs(track.velocity.y) * 2, track.rect.height / 4);
+	cv::Rect window = cv::Rect(
+		cvRound(track.rect.x - marginX), cvRound(track.rect.y - marginY),
+		cvRound(track.rect.width + marginX * 2), cvRound(track.rect.height + marginY * 2))
+		& cv::Rect(0, 0, gray.cols, gray.rows);
+
+	if (window.width < track.templ.cols || window.height < track.templ.rows)
+	{
+		return false;
+	}
+
+	cv::Mat scores;
+	cv::matchTemplate(gray(window), track.templ, scores, cv::TM_CCOEFF_NORMED);
+
+	double best;
+	cv::Point bestLocation;
+	cv::minMaxLoc(scores, nullptr, &best, nullptr, &bestLocation);
+	if (best < minMatchScore)
+	{
+		return false;
+	}
+
+	track.rect.x = window.x + bestLocation.x;
+	track.rect.y = window.y + bestLocation.y;
+	return true;
+}
+
+void PersonTracker::measure(Track& track, const cv::Rect2d& rect, uint64_t sequence) const
+{
+	// track.rect is the prediction for 'sequence'; the difference is the velocity error
+	// accumulated over every frame since the last measurement.
+	auto frames = static_cast<double>(std::max<uint64_t>(sequence - track.measuredSequence, 1));
+	auto innovation = center(rect) - center(track.rect);
+	track.velocity += innovation * (velocityGain / frames);
+	track.rect = rect;
+	track.misses = 0;
+	track.lastSequence = sequence;
+	track.measuredSequence = sequence;
+}
+
+void PersonTracker::update(const cv::Mat& gray, uint64_t sequence)
+{
+	if (sequence <= lastSequence)
+	{
+		return;
+	}
+	lastSequence = sequence;
+
+	for (auto it = tracks.begin(); it != tracks.end();)
+	{
+		predict(*it, sequence);
+		auto predicted = it->rect;
+
+		if (match(*it, gray))
+		{
+			auto matched = it->rect;
+			it->rect = predicted;
+			measure(*it, matched, sequence);
+		}
+		else
+		{
+			it->rect = predicted;
+			it->misses++;
+		}
+
+		it = it->misses > maxMisses ? tracks.erase(it) : std::next(it);
+	}
+}
+
+void PersonTracker::correct(const cv::Mat& gray, const std::vector<cv::Rect>& detections, uint64_t sequence)
+{
+	lastSequence = std::max(lastSequence, sequence);
+
+	for (auto& track : tracks)
+	{
+		predict(track, sequence);
+	}
+
+	// Greedy association, best overlapping pairs first.
+	struct Candidate { double rate; size_t track; size_t detection; };
+	std::vector<Candidate> candidates;
+	for (size_t t = 0; t < tracks.size(); ++t)
+	{
+		// Another worker may have moved the track past this frame: compare with the detection moved to the track's frame.
+		auto ahead = static_cast<double>(tracks[t].lastSequence - sequence);
+		auto shift = tracks[t].velocity * ahead;
+
+		for (size_t d = 0; d < detections.size(); ++d)
+		{
+			auto detection = cv::Rect2d(detections[d]);
+			detection.x += shift.x;
+			detection.y += shift.y;
+			auto rate = intersectionRate(tracks[t].rect, detection);
+			if (rate > minIntersectionRate)
+			{
+				candidates.push_back(Candidate{ rate, t, d });
+			}
+		}
+	}
+	std::sort(candidates.begin(), candidates.end(), [](const Candidate& a, const Candidate& b) { return a.rate > b.rate; });
+
+	std::vector<bool> trackUsed(tracks.size(), false);
+	std::vector<bool> detectionUsed(detections.size(), false);
+	for (auto& candidate : candidates)
+	{
+		if (trackUsed[candidate.track] || detectionUsed[candidate.detection])
+		{
+			continue;
+		}
+		trackUsed[candidate.track] = true;
+		detectionUsed[candidate.detection] = true;
+
+		auto& track = tracks[candidate.track];
+		if (track.lastSequence > sequence)
+		{
+			// The track is newer than the detection; measuring it would move it back in time.
+			continue;
+		}
+		measure(track, cv::Rect2d(detections[candidate.detection]), sequence);
+		track.templ = gray(detections[candidate.detection] & cv::Rect(0, 0, gray.cols, gray.rows)).clone();
+	}
+
+	for (size_t t = 0; t < tracks.size(); ++t)
+	{
+		// Newer frames already counted the misses of the tracks ahead of this one.
+		if (!trackUsed[t] && tracks[t].lastSequence <= sequence)
+		{
+			tracks[t].misses++;
+		}
+	}
+	tracks.erase(std::remove_if(tracks.begin(), tracks.end(), [this](const Track& track) { return track.misses > maxMisses; }), tracks.end());
+
+	for (size_t d = 0; d < detections.size(); ++d)
+	{
+		if (detectionUsed[d])
+		{
+			continue;
+		}
+
+		Track track;
+		track.id = nextId++;
+		track.rect = cv::Rect2d(detections[d]);
+		track.velocity = cv::Point2d(0, 0);
+		track.templ = gray(detections[d] & cv::Rect(0, 0, gray.cols, gray.rows)).clone();
+		track.misses = 0;
+		track.lastSequence = sequence;
+		track.measuredSequence = sequence;
+		tracks.push_back(track);
+	}
+}
+
+void PersonTracker::getVisible(std::vector<cv::Rect>& people, std::vector<int>& ids) const
+{
+	std::vector<size_t> order;
+	for (size_t i = 0; i < tracks.size(); ++i)
+	{
+		if (tracks[i].misses == 0)
+		{
+			order.push_back(i);
+		}
+	}
+	std::sort(order.begin(), order.end(), [this](size_t a, size_t b) { return tracks[a].rect.area() > tracks[b].rect.area(); });
+
+	people.clear();
+	ids.clear();
+	for (auto i : order)
+	{
+		people.push_back(cv::Rect(tracks[i].rect));
+		ids.push_back(tracks[i].id);
+	}
+}
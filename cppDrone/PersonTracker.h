@@ -0,0 +1,74 @@
+#pragma once
+
+#undef min
+#undef max
+
+#include <cstdint>
+#include <vector>
+
+#include <opencv2/core.hpp>
+
+/**
+ * Follows detected people between cascade runs.
+ *
+ * Every track keeps a constant-velocity motion model and a grayscale
+ * template cut at its last detection. On frames without detection the
+ * position is predicted from the velocity and refined by normalized
+ * cross-correlation in a small window around the prediction. Detections
+ * are associated to tracks by intersection over union, so a person keeps
+ * the same id for as long as it is followed.
+ */
+class PersonTracker
+{
+public:
+	struct Track
+	{
+		int id;
+		cv::Rect2d rect;
+		cv::Point2d velocity;    // pixels per frame
+		cv::Mat templ;           // gray patch taken at the last detection
+		int misses;              // consecutive frames the person was not found
+		uint64_t lastSequence;   // frame the rect refers to
+		uint64_t measuredSequence; // frame of the last detection or template match
+	};
+
+	// Minimum intersection over union for a detection to be associated with a track.
+	const double minIntersectionRate = 0.3;
+	// Minimum normalized correlation for a template match to be accepted.
+	const double minMatchScore = 0.6;
+	// Tracks not found for this many frames are dropped.
+	const int maxMisses = 10;
+	// Weight of a new measurement in the velocity estimate.
+	const double velocityGain = 0.5;
+
+private:
+	int nextId = 0;
+	uint64_t lastSequence = 0;
+	std::vector<Track> tracks;
+
+	void predict(Track& track, uint64_t sequence) const;
+	bool match(Track& track, const cv::Mat& gray) const;
+	void measure(Track& track, const cv::Rect2d& rect, uint64_t sequence) const;
+
+public:
+	/**
+	 * Moves every track to the given frame using prediction and template matching only.
+	 * Frames older than the last one seen are ignored.
+	 */
+	void update(const cv::Mat& gray, uint64_t sequence);
+
+	/**
+	 * Associates cascade detections of a frame with the tracks, starting new tracks
+	 * for unmatched detections and dropping tracks missed for too long.
+	 * Tracks already moved past the frame by update() are not measured again; their
+	 * detections only keep a duplicate track from being started.
+	 */
+	void correct(const cv::Mat& gray, const std::vector<cv::Rect>& detections, uint64_t sequence);
+
+	// People found on the last frame, largest first, with their ids.
+	void getVisible(std::vector<cv::Rect>& people, std::vector<int>& ids) const;
+
+	bool empty() const { return tracks.empty(); }
+
+	void clear() { tracks.clear(); lastSequence = 0; }
+};
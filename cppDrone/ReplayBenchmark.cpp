@@ -0,0 +1,355 @@
+#define TAG "ReplayBenchmark"
+
+#include <WinSock2.h>
+#include <Windows.h>
+#include <psapi.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <thread>
+
+extern "C" {
+#include <libARSAL/ARSAL_Print.h>
+#include <libARController/ARCONTROLLER_Frame.h>
+#include <libARStream2/arstream2_h264_parser.h>
+}
+
+#include "ReplayBenchmark.h"
+#include "bebop_video_decoder.h"
+#include "DetectionService.h"
+#include "OniTracker.h"
+#include "Oni.h"
+
+const ReplayBenchmark::DetectorSetting ReplayBenchmark::detectorSettings[] =
+{
+	{ "cascade2000", true, false, false },
+	{ "cascade10000", false, true, false },
+	{ "hog", false, false, true },
+};
+
+const int ReplayBenchmark::detectorSettingsCount = sizeof(detectorSettings) / sizeof(detectorSettings[0]);
+
+namespace
+{
+	typedef std::chrono::steady_clock Clock;
+
+	double elapsedMs(const Clock::time_point& start, const Clock::time_point& end)
+	{
+		return std::chrono::duration<double, std::milli>(end - start).count();
+	}
+
+	size_t peakWorkingSet()
+	{
+		PROCESS_MEMORY_COUNTERS counters;
+		if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+		{
+			return 0;
+		}
+		return counters.PeakWorkingSetSize;
+	}
+}
+
+ReplayBenchmark::ReplayBenchmark(const std::string& path, double fps, bool realtime)
+	: mPath(path), mFps(fps > 0 ? fps : REPLAY_DEFAULT_FPS), mRealtime(realtime)
+{
+}
+
+bool ReplayBenchmark::load()
+{
+	// The whole recording is read up front so the replay does not measure the disk.
+	if (!loadAccessUnits(mPath, mData, mNalus, mAccessUnits))
+	{
+		return false;
+	}
+
+	ARSAL_PRINT(ARSAL_PRINT_INFO, TAG, "%s: %u bytes, %u access units.", mPath.c_str(), static_cast<unsigned>(mData.size()), static_cast<unsigned>(mAccessUnits.size()));
+
+	return true;
+}
+
+bool ReplayBenchmark::loadAccessUnits(const std::string& path, std::vector<uint8_t>& data, std::vector<Nalu>& nalus, std::vector<AccessUnit>& accessUnits)
+{
+	nalus.clear();
+	accessUnits.clear();
+
+	std::ifstream file(path, std::ios::binary | std::ios::ate);
+	if (!file)
+	{
+		ARSAL_PRINT(ARSAL_PRINT_ERROR, TAG, "Can not open %s.", path.c_str());
+		return false;
+	}
+
+	data.resize(static_cast<size_t>(file.tellg()));
+	file.seekg(0);
+	if (data.empty() || !file.read(reinterpret_cast<char*>(&data[0]), data.size()))
+	{
+		ARSAL_PRINT(ARSAL_PRINT_ERROR, TAG, "Can not read %s.", path.c_str());
+		return false;
+	}
+
+	ARSTREAM2_H264Parser_Config_t config;
+	memset(&config, 0, sizeof(config));
+	ARSTREAM2_H264Parser_Handle parser = nullptr;
+	if (ARSTREAM2_H264Parser_Init(&parser, &config) != ARSTREAM2_OK)
+	{
+		ARSAL_PRINT(ARSAL_PRINT_ERROR, TAG, "Can not create the H.264 parser.");
+		return false;
+	}
+
+	AccessUnit current = { 0, 0, false };
+	bool currentHasSlice = false;
+	size_t offset = 0;
+
+	while (offset < data.size())
+	{
+		unsigned int naluStart = 0;
+		unsigned int nextStartCode = 0;
+		if (ARSTREAM2_H264Parser_ReadNextNalu_buffer(parser, &data[offset], static_cast<unsigned int>(data.size() - offset), &naluStart, &nextStartCode) != ARSTREAM2_OK)
+		{
+			break;
+		}
+
+		// The decoder takes the access units with their start codes, the RTP sender takes the NAL units without.
+		Nalu nalu = { offset, offset + naluStart, ((nextStartCode != 0) ? offset + nextStartCode : data.size()) - (offset + naluStart) };
+
+		int naluType = -1;
+		bool isSlice = false;
+		bool firstSlice = false;
+		bool isIntra = false;
+		if (ARSTREAM2_H264Parser_ParseNalu(parser, nullptr) == ARSTREAM2_OK)
+		{
+			naluType = ARSTREAM2_H264Parser_GetLastNaluType(parser);
+		}
+		if ((naluType == 1) || (naluType == 5))
+		{
+			ARSTREAM2_H264Parser_SliceInfo_t sliceInfo;
+			isSlice = true;
+			if (ARSTREAM2_H264Parser_GetSliceInfo(parser, &sliceInfo) == ARSTREAM2_OK)
+			{
+				firstSlice = (sliceInfo.first_mb_in_slice == 0);
+				isIntra = (sliceInfo.idrPicFlag != 0) || (sliceInfo.sliceTypeMod5 == 2);
+			}
+		}
+
+		// After the slices of a picture, an AUD, SEI, SPS or PPS or the first slice of the next picture starts a new access unit.
+		if (currentHasSlice && (isSlice ? firstSlice : ((naluType >= 6) && (naluType <= 9))))
+		{
+			accessUnits.push_back(current);
+			current.firstNalu = nalus.size();
+			current.naluCount = 0;
+			current.isIFrame = false;
+			currentHasSlice = false;
+		}
+
+		nalus.push_back(nalu);
+		++current.naluCount;
+		current.isIFrame = current.isIFrame || isIntra;
+		currentHasSlice = currentHasSlice || isSlice;
+
+		offset = nalu.offset + nalu.size;
+	}
+
+	if (currentHasSlice)
+	{
+		accessUnits.push_back(current);
+	}
+
+	ARSTREAM2_H264Parser_Free(parser);
+
+	return !accessUnits.empty();
+}
+
+ReplayBenchmark::Report ReplayBenchmark::run(const DetectorSetting& setting)
+{
+	// Same split of the cores as a DetectionService worker.
+	auto cores = std::max<size_t>(1, std::thread::hardware_concurrency());
+	auto bands = static_cast<int>(std::max<size_t>(1, cores / DetectionService::defaultWorkerCount()));
+
+	OniTracker tracker(bands, setting.useCascade2000, setting.useCascade10000, setting.useHog);
+	bebop_driver::VideoDecoder decoder;
+	decoder.ConfigureGrayView(true, tracker.resize_rate);
+	decoder.SetBGRViewEnabled(false);
+
+	std::vector<double> decodeMs, resizeMs, detectMs, totalMs;
+	decodeMs.reserve(mAccessUnits.size());
+	resizeMs.reserve(mAccessUnits.size());
+	detectMs.reserve(mAccessUnits.size());
+	totalMs.reserve(mAccessUnits.size());
+
+	Report report;
+	report.detector = setting.name;
+	report.accessUnits = 0;
+	report.detections = 0;
+
+	ARCONTROLLER_Frame_t frame;
+	memset(&frame, 0, sizeof(frame));
+
+	uint64_t lastSequence = 0;
+	const auto begin = Clock::now();
+
+	for (size_t i = 0; i < mAccessUnits.size(); ++i)
+	{
+		const auto& accessUnit = mAccessUnits[i];
+		const auto& firstNalu = mNalus[accessUnit.firstNalu];
+		const auto& lastNalu = mNalus[accessUnit.firstNalu + accessUnit.naluCount - 1];
+
+		if (mRealtime)
+		{
+			std::this_thread::sleep_until(begin + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(i / mFps)));
+		}
+
+		frame.data = &mData[firstNalu.startCode];
+		frame.capacity = frame.used = static_cast<uint32_t>(lastNalu.offset + lastNalu.size - firstNalu.startCode);
+		frame.isIFrame = accessUnit.isIFrame ? 1 : 0;
+		frame.timestamp = static_cast<uint64_t>(i * 1000000.0 / mFps);
+
+		const auto decodeStart = Clock::now();
+		decoder.Decode(&frame);
+		const auto decodeEnd = Clock::now();
+		++report.accessUnits;
+
+		auto gray = decoder.GetLatestFrame(bebop_driver::VIDEO_VIEW_GRAY);
+		if (gray == nullptr || gray->sequence == lastSequence)
+		{
+			// No picture out of this access unit
+			continue;
+		}
+		lastSequence = gray->sequence;
+
+		auto people = tracker.getPeople(Oni::wrapFrame(gray));
+		const auto detectEnd = Clock::now();
+
+		if (!people.empty())
+		{
+			++report.detections;
+		}
+
+		const double convertMs = decoder.GetLastConvertTimeUs() / 1000.0;
+		decodeMs.push_back(std::max(0.0, elapsedMs(decodeStart, decodeEnd) - convertMs));
+		resizeMs.push_back(convertMs);
+		detectMs.push_back(elapsedMs(decodeEnd, detectEnd));
+		totalMs.push_back(elapsedMs(decodeStart, detectEnd));
+	}
+
+	report.seconds = elapsedMs(begin, Clock::now()) / 1000.0;
+	report.pictures = totalMs.size();
+	report.fps = report.seconds > 0 ? report.pictures / report.seconds : 0;
+	report.decode = computeStats(decodeMs);
+	report.resize = computeStats(resizeMs);
+	report.detect = computeStats(detectMs);
+	report.total = computeStats(totalMs);
+	report.peakWorkingSetBytes = peakWorkingSet();
+
+	return report;
+}
+
+ReplayBenchmark::StageStats ReplayBenchmark::computeStats(std::vector<double>& durationsMs)
+{
+	StageStats stats = { 0, 0, 0, 0 };
+	if (durationsMs.empty())
+	{
+		return stats;
+	}
+
+	std::sort(durationsMs.begin(), durationsMs.end());
+
+	// Nearest-rank percentiles
+	auto percentile = [&durationsMs](double p)
+	{
+		size_t rank = static_cast<size_t>(std::ceil(p / 100.0 * durationsMs.size()));
+		return durationsMs[std::min(durationsMs.size(), std::max<size_t>(1, rank)) - 1];
+	};
+
+	stats.p50Ms = percentile(50);
+	stats.p90Ms = percentile(90);
+	stats.p99Ms = percentile(99);
+	stats.maxMs = durationsMs.back();
+
+	return stats;
+}
+
+void ReplayBenchmark::printReport(const Report& report)
+{
+	printf("\n== %s ==\n", report.detector.c_str());
+	printf("access units %u, pictures %u, with people %u, %.2f s, %.2f fps\n",
+		static_cast<unsigned>(report.accessUnits), static_cast<unsigned>(report.pictures), static_cast<unsigned>(report.detections), report.seconds, report.fps);
+	printf("%-8s %9s %9s %9s %9s\n", "stage", "p50 ms", "p90 ms", "p99 ms", "max ms");
+
+	const struct { const char* name; const StageStats* stats; } stages[] =
+	{
+		{ "decode", &report.decode },
+		{ "resize", &report.resize },
+		{ "detect", &report.detect },
+		{ "total", &report.total },
+	};
+	for (const auto& stage : stages)
+	{
+		printf("%-8s %9.2f %9.2f %9.2f %9.2f\n", stage.name, stage.stats->p50Ms, stage.stats->p90Ms, stage.stats->p99Ms, stage.stats->maxMs);
+	}
+
+	printf("peak working set %.1f MB\n", report.peakWorkingSetBytes / (1024.0 * 1024.0));
+}
+
+int ReplayBenchmark::runFromCommandLine(int argc, char* argv[])
+{
+	const char* path = nullptr;
+	const char* detector = "all";
+	double fps = REPLAY_DEFAULT_FPS;
+	bool realtime = false;
+
+	for (int i = 0; i < argc; ++i)
+	{
+		if (strcmp(argv[i], "--fps") == 0 && i + 1 < argc)
+		{
+			fps = atof(argv[++i]);
+		}
+		else if (strcmp(argv[i], "--realtime") == 0)
+		{
+			realtime = true;
+		}
+		else if (strcmp(argv[i], "--detector") == 0 && i + 1 < argc)
+		{
+			detector = argv[++i];
+		}
+		else if (argv[i][0] != '-')
+		{
+			path = argv[i];
+		}
+	}
+
+	if (path == nullptr)
+	{
+		printf("usage: cppDrone --replay <file.h264> [--fps <n>] [--realtime] [--detector cascade2000|cascade10000|hog|all]\n");
+		return 1;
+	}
+
+	ReplayBenchmark benchmark(path, fps, realtime);
+	if (!benchmark.load())
+	{
+		return 1;
+	}
+
+	// The peak working set only grows, so run a single detector to measure its own.
+	int runs = 0;
+	for (int i = 0; i < detectorSettingsCount; ++i)
+	{
+		if (strcmp(detector, "all") == 0 || strcmp(detector, detectorSettings[i].name) == 0)
+		{
+			printReport(benchmark.run(detectorSettings[i]));
+			++runs;
+		}
+	}
+
+	if (runs == 0)
+	{
+		printf("unknown detector: %s\n", detector);
+		return 1;
+	}
+
+	return 0;
+}
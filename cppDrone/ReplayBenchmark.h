@@ -0,0 +1,109 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Frame rate of the recordings when replayed at their original rate; the Bebop 2 streams at 30 fps.
+#define REPLAY_DEFAULT_FPS 30.0
+
+/**
+ * Replays a raw H.264 recording through the decode -> resize -> detect path
+ * of Oni, without a drone, and measures it.
+ *
+ * The recording is an Annex B byte stream, as written by
+ * ARSTREAM2_StreamRecorder to a .h264 file. It is split into access units
+ * with ARSTREAM2_H264Parser by loadAccessUnits(), which Bebop2Simulator
+ * uses too, and each access unit is given to
+ * VideoDecoder::Decode as an ARCONTROLLER_Frame_t, like the stream
+ * controller does. The decoder produces the scaled luma view and
+ * OniTracker::getPeople runs on it.
+ *
+ * The access units are replayed either as fast as possible or at the
+ * original frame rate. Every detector setting gets its own run, with
+ * per-stage latency percentiles, the sustained frame rate and the peak
+ * working set of the process.
+ */
+class ReplayBenchmark
+{
+public:
+	struct DetectorSetting
+	{
+		const char* name;
+		bool useCascade2000;
+		bool useCascade10000;
+		bool useHog;
+	};
+
+	struct StageStats
+	{
+		double p50Ms;
+		double p90Ms;
+		double p99Ms;
+		double maxMs;
+	};
+
+	struct Report
+	{
+		std::string detector;
+		size_t accessUnits;        // access units given to the decoder
+		size_t pictures;           // pictures decoded and run through the detector
+		size_t detections;         // pictures where at least one person was found
+		double seconds;
+		double fps;                // pictures per second over the whole run
+		StageStats decode;         // avcodec decoding, without the views
+		StageStats resize;         // scaling into the detector's luma view
+		StageStats detect;         // OniTracker::getPeople
+		StageStats total;
+		size_t peakWorkingSetBytes; // peak of the process so far, so it includes the previous runs
+	};
+
+	struct Nalu
+	{
+		size_t startCode;          // first byte of the start code
+		size_t offset;             // first byte after the start code
+		size_t size;               // without the start code
+	};
+
+	// The NAL units of one picture, with the AUD, SEI and parameter sets before it.
+	struct AccessUnit
+	{
+		size_t firstNalu;
+		size_t naluCount;
+		bool isIFrame;
+	};
+
+	static const DetectorSetting detectorSettings[];
+	static const int detectorSettingsCount;
+
+private:
+	std::string mPath;
+	double mFps;
+	bool mRealtime;
+
+	std::vector<uint8_t> mData;
+	std::vector<Nalu> mNalus;
+	std::vector<AccessUnit> mAccessUnits;
+
+public:
+	// fps paces the replay when realtime is set, and dates the frames in both cases.
+	ReplayBenchmark(const std::string& path, double fps = REPLAY_DEFAULT_FPS, bool realtime = false);
+
+	// Reads the recording and splits it into access units.
+	bool load();
+
+	size_t getAccessUnitCount() const { return mAccessUnits.size(); }
+
+	Report run(const DetectorSetting& setting);
+
+	static void printReport(const Report& report);
+
+	// Entry point of "cppDrone --replay <file.h264> [--fps <n>] [--realtime] [--detector <name>|all]".
+	static int runFromCommandLine(int argc, char* argv[]);
+
+	// Reads an Annex B recording and splits it into NAL units grouped by access unit; false if it holds no picture.
+	static bool loadAccessUnits(const std::string& path, std::vector<uint8_t>& data, std::vector<Nalu>& nalus, std::vector<AccessUnit>& accessUnits);
+
+private:
+	static StageStats computeStats(std::vector<double>& durationsMs);
+};
@@ -1,392 +1,447 @@
 #define TAG "StateController"
 
+extern "C" {
+#include <libARSAL/ARSAL_Trace.h>
+}
+
 #include "StateController.h"
 
-void StateController::processStateEmergency()
+bool StateController::postEvent(const EVENT& event)
 {
-	ARSAL_PRINT(ARSAL_PRINT_FATAL, TAG, "State[Emergency]: Stop!!!!!!!!!!!!!");
-	deviceController->aRDrone3->sendPilotingEmergency(deviceController->aRDrone3);
-	setState(STATE_FINISHED);
+	{
+		std::lock_guard<std::mutex> lock(eventMutex);
+
+		// The state loop reads the latest result when it takes the event, so one pending detection is enough.
+		if (event.type == EVENT_DETECTION && detectionPending)
+		{
+			return true;
+		}
+
+		bool emergency = event.type == EVENT_COMMAND && event.command == COMMAND_EMERGENCY;
+		if (eventCount == STATE_EVENT_QUEUE_SIZE)
+		{
+			if (!emergency)
+			{
+				ARSAL_PRINT(ARSAL_PRINT_WARNING, TAG, "Event queue is full, event %d is dropped.", event.type);
+				return false;
+			}
+
+			// Never lose an emergency: it replaces the newest event.
+			if (events[(eventHead + eventCount - 1) % STATE_EVENT_QUEUE_SIZE].type == EVENT_DETECTION)
+			{
+				detectionPending = false;
+			}
+			eventCount--;
+		}
+
+		if (emergency)
+		{
+			eventHead = (eventHead + STATE_EVENT_QUEUE_SIZE - 1) % STATE_EVENT_QUEUE_SIZE;
+			events[eventHead] = event;
+		}
+		else
+		{
+			events[(eventHead + eventCount) % STATE_EVENT_QUEUE_SIZE] = event;
+		}
+		eventCount++;
+
+		if (event.type == EVENT_DETECTION)
+		{
+			detectionPending = true;
+		}
+	}
+	eventCondition.notify_one();
+
+	return true;
 }
 
-void StateController::processStateStart(STATE_PARAMETER_START * param)
+void StateController::waitEvent(EVENT& event)
 {
-	if (param == nullptr)
-	{
-		ARSAL_PRINT(ARSAL_PRINT_WARNING, TAG, "State[Start]: No parameters!");
-		return;
-	}
+	std::unique_lock<std::mutex> lock(eventMutex);
 
-	if (param->connected)
+	while (true)
 	{
-		ARSAL_PRINT(ARSAL_PRINT_INFO, TAG, "State[Start => Ready]: Oni is connected. Waiting for a command");
-		setState(STATE_READY);
+		if (eventCount > 0)
+		{
+			event = events[eventHead];
+			eventHead = (eventHead + 1) % STATE_EVENT_QUEUE_SIZE;
+			eventCount--;
+
+			if (event.type == EVENT_DETECTION)
+			{
+				detectionPending = false;
+			}
+			return;
+		}
+
+		if (!deadlineArmed)
+		{
+			eventCondition.wait(lock);
+		}
+		else if (eventCondition.wait_until(lock, deadline) == std::cv_status::timeout && eventCount == 0)
+		{
+			deadlineArmed = false;
+			event.type = EVENT_TIMEOUT;
+			event.timeout.state = deadlineState;
+			return;
+		}
 	}
 }
 
-void StateController::processStateReady(STATE_PARAMETER_READY * param)
+void StateController::dispatch(const EVENT& event)
 {
-	if (param == nullptr)
+	switch (event.type)
 	{
-		ARSAL_PRINT(ARSAL_PRINT_WARNING, TAG, "State[Ready]: No parameters!");
-		return;
+	case EVENT_CONNECTED:
+	{
+		if (getState() == STATE_START)
+		{
+			ARSAL_PRINT(ARSAL_PRINT_INFO, TAG, "State[Start => Ready]: Oni is connected. Waiting for a command");
+			setState(STATE_READY);
+		}
 	}
-
-	switch (param->command)
+	break;
+	case EVENT_COMMAND:
 	{
-	case STATE_PARAMETER_READY::COMMAND_NONE:
+		dispatchCommand(event.command);
+	}
+	break;
+	case EVENT_DETECTION:
 	{
-		// Ready. do nothing.
+		dispatchDetection(event.detection);
 	}
 	break;
-	case STATE_PARAMETER_READY::COMMAND_TAKEOFF:
+	case EVENT_TELEMETRY:
 	{
-		ARSAL_PRINT(ARSAL_PRINT_INFO, TAG, "State[Ready => TakingOff]: Received the 'take-off' command.");
-		setState(STATE_TAKINGOFF);
+		dispatchTelemetry(event.telemetry);
 	}
 	break;
-	case STATE_PARAMETER_READY::COMMAND_DISCONNECT:
+	case EVENT_TIMEOUT:
 	{
-		ARSAL_PRINT(ARSAL_PRINT_INFO, TAG, "State[Ready => Finished]: Try to disconnect.");
-		setState(STATE_FINISHED);
+		dispatchTimeout(event.timeout);
 	}
 	break;
+	case EVENT_NONE:
 	default: break;
 	}
 }
 
-void StateController::processStateTakingOff(STATE_PARAMETER_TAKINGOFF * param)
+void StateController::setState(STATE state)
 {
-	if (param == nullptr)
-	{
-		ARSAL_PRINT(ARSAL_PRINT_WARNING, TAG, "State[TakingOff]: No parameters!");
-		return;
-	}
-
-	if (!param->status_takenOff)
-	{
-		ARSAL_PRINT(ARSAL_PRINT_INFO, TAG, "State[TakingOff]: Try to take off...");
-		deviceController->aRDrone3->sendPilotingTakeOff(deviceController->aRDrone3);
-		param->status_takenOff = true;
-	}
+	currentState = state;
+	enterState(state);
+}
 
-	if (GetTickCount64() - param->takenOffTick >= TAKING_OFF_WAIT_TICK)
-	{
-		ARSAL_PRINT(ARSAL_PRINT_INFO, TAG, "State[TakingOff => Hovering]: Completed taking off.");
-		setState(STATE_HOVERING);
-	}
-	else
-	{
-		// Go up!
-		deviceController->aRDrone3->setPilotingPCMDGaz(deviceController->aRDrone3, 100);
-	}
+void StateController::armDeadline(int milliseconds)
+{
+	deadlineArmed = true;
+	deadlineState = getState();
+	deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(milliseconds);
 }
 
-void StateController::processStateHovering(STATE_PARAMETER_HOVERING * param)
+void StateController::dispatchCommand(COMMAND command)
 {
-	if (param == nullptr)
-	{
-		ARSAL_PRINT(ARSAL_PRINT_WARNING, TAG, "State[Hovering]: No parameters!");
-		return;
-	}
+	auto state = getState();
 
-	if (!param->status_hovered)
+	if (command == COMMAND_EMERGENCY)
 	{
-		ARSAL_PRINT(ARSAL_PRINT_INFO, TAG, "State[Hovering]: Hovering. Waiting for a command...");
-		param->status_hovered = true;
+		if (state != STATE_EMERGENCY && state != STATE_FINISHED)
+		{
+			setState(STATE_EMERGENCY);
+		}
+		return;
 	}
 
-	switch (param->command)
-	{
-	case STATE_PARAMETER_HOVERING::COMMAND_NONE:
+	switch (state)
 	{
-		// Do nothing.
-		// waiting for a command...
-	}
-	break;
-	case STATE_PARAMETER_HOVERING::COMMAND_SEARCH:
+	case STATE_READY:
 	{
-		ARSAL_PRINT(ARSAL_PRINT_INFO, TAG, "State[Hovering => Searching]: Received the 'search' command.");
-		setState(STATE_SEARCHING);
+		if (command == COMMAND_TAKEOFF)
+		{
+			ARSAL_PRINT(ARSAL_PRINT_INFO, TAG, "State[Ready => TakingOff]: Received the 'take-off' command.");
+			setState(STATE_TAKINGOFF);
+		}
+		else if (command == COMMAND_DISCONNECT)
+		{
+			ARSAL_PRINT(ARSAL_PRINT_INFO, TAG, "State[Ready => Finished]: Try to disconnect.");
+			setState(STATE_FINISHED);
+		}
 	}
 	break;
-	case STATE_PARAMETER_HOVERING::COMMAND_LAND:
+	case STATE_HOVERING:
 	{
-		ARSAL_PRINT(ARSAL_PRINT_INFO, TAG, "State[Hovering => Landing]: Received the 'land' command.");
-		setState(STATE_LANDING);
+		if (command == COMMAND_SEARCH)
+		{
+			ARSAL_PRINT(ARSAL_PRINT_INFO, TAG, "State[Hovering => Searching]: Received the 'search' command.");
+			setState(STATE_SEARCHING);
+		}
+		else if (command == COMMAND_LAND)
+		{
+			ARSAL_PRINT(ARSAL_PRINT_INFO, TAG, "State[Hovering => Landing]: Received the 'land' command.");
+			setState(STATE_LANDING);
+		}
 	}
 	break;
-	default:
+	case STATE_SEARCHING:
+	case STATE_TRACKING:
+	case STATE_MISSING:
+	case STATE_CAPTURED:
 	{
+		if (command == COMMAND_LAND)
+		{
+			ARSAL_PRINT(ARSAL_PRINT_INFO, TAG, "State[=> Landing]: Received the 'land' command.");
+			setState(STATE_LANDING);
+		}
 	}
 	break;
+	default: break;
 	}
 }
 
-void StateController::processStateSearching(STATE_PARAMETER_SEARCHING * param)
+void StateController::dispatchDetection(const EVENT_DETECTION_DATA& detection)
 {
-	if (param == nullptr)
+	// The same result must not steer twice, whoever reads it again.
+	if (detection.version <= lastDetectionVersion)
 	{
-		ARSAL_PRINT(ARSAL_PRINT_WARNING, TAG, "State[Searching]: No parameters!");
 		return;
 	}
+	lastDetectionVersion = detection.version;
 
-	if (param->found)
+	switch (getState())
 	{
-		ARSAL_PRINT(ARSAL_PRINT_INFO, TAG, "State[Searching => Tracking]: Oni found a person! Try to track.");
-		deviceController->aRDrone3->setPilotingPCMD(deviceController->aRDrone3, 0, 0, 0, 0, 0, 0);
-		setState(STATE_TRACKING);
-	}
-	else
+	case STATE_SEARCHING:
 	{
-		if (GetTickCount64() - param->startedTick >= SEARCHING_WAIT_TICK)
-		{
-			ARSAL_PRINT(ARSAL_PRINT_INFO, TAG, "State[Searching => Hovering]: No more people. Stop searching.");
-			deviceController->aRDrone3->setPilotingPCMD(deviceController->aRDrone3, 0, 0, 0, 0, 0, 0);
-			setState(STATE_HOVERING);
-		}
-		else
+		if (detection.status == DETECTION_FOUND)
 		{
-			if (!param->status_rotating)
-			{
-				ARSAL_PRINT(ARSAL_PRINT_INFO, TAG, "State[Searching]: Started to rotate to find people...");
-				param->status_rotating = true;
-			}
-
-			// Rotate to right
-			if (!DRONE_DEBUG_MODE) {
-				deviceController->aRDrone3->setPilotingPCMDYaw(deviceController->aRDrone3, 20);
-			}
+			ARSAL_PRINT(ARSAL_PRINT_INFO, TAG, "State[Searching => Tracking]: Oni found a person! Try to track.");
+			setState(STATE_TRACKING);
 		}
 	}
-}
-
-void StateController::processStateTracking(STATE_PARAMETER_TRACKING * param)
-{
-	if (param == nullptr)
-	{
-		ARSAL_PRINT(ARSAL_PRINT_WARNING, TAG, "State[Tracking]: No parameters!");
-		return;
-	}
-
-	switch (param->status)
-	{
-	case STATE_PARAMETER_TRACKING::STATUS_NONE:
-	{
-		ARSAL_PRINT(ARSAL_PRINT_WARNING, TAG, "State[Tracking]: Status is None!");
-		deviceController->aRDrone3->setPilotingPCMD(deviceController->aRDrone3, 0, 0, 0, 0, 0, 0);
-	}
 	break;
-	case STATE_PARAMETER_TRACKING::STATUS_FOUND:
+	case STATE_TRACKING:
 	{
-		switch (param->direction)
+		// A frame is only decided once; the drone already follows the command sent for it.
+		if (detection.frameId != 0 && detection.frameId == parameter.tracking.lastDecidedFrameId)
 		{
-		case STATE_PARAMETER_TRACKING::DIRECTION_NONE:
+			break;
+		}
+		parameter.tracking.lastDecidedFrameId = detection.frameId;
+
+		switch (detection.status)
 		{
-			// do nothing
-			ARSAL_PRINT(ARSAL_PRINT_WARNING, TAG, "State[Tracking]: Found, but no direction.");
-			deviceController->aRDrone3->setPilotingPCMD(deviceController->aRDrone3, 0, 0, 0, 0, 0, 0);
+		case DETECTION_FOUND:
+		{
+			steerTracking(detection.direction);
 		}
 		break;
-		case STATE_PARAMETER_TRACKING::DIRECTION_FORWARD:
+		case DETECTION_MISSED:
 		{
-			// go forward
-			ARSAL_PRINT(ARSAL_PRINT_INFO, TAG, "State[Tracking]: Found, go forward");
-			deviceController->aRDrone3->setPilotingPCMDFlag(deviceController->aRDrone3, 1);
-			deviceController->aRDrone3->setPilotingPCMDPitch(deviceController->aRDrone3, 20);
+			ARSAL_PRINT(ARSAL_PRINT_INFO, TAG, "State[Tracking => Missing]: Missed a person!");
+			setState(STATE_MISSING);
+			parameter.missing.missedFrameId = detection.frameId;
 		}
 		break;
-		case STATE_PARAMETER_TRACKING::DIRECTION_LEFT:
+		case DETECTION_CAPTURED:
 		{
-			// turn left
-			ARSAL_PRINT(ARSAL_PRINT_DEBUG, TAG, "State[Tracking]: Found, turn left");
-			deviceController->aRDrone3->setPilotingPCMDYaw(deviceController->aRDrone3, -20);
+			ARSAL_PRINT(ARSAL_PRINT_INFO, TAG, "State[Tracking => Captured]: Captured a person!");
+			setState(STATE_CAPTURED);
 		}
 		break;
-		case STATE_PARAMETER_TRACKING::DIRECTION_RIGHT:
+		case DETECTION_NONE:
+		default:
 		{
-			// turn right
-			ARSAL_PRINT(ARSAL_PRINT_DEBUG, TAG, "State[Tracking]: Found, turn right");
-			deviceController->aRDrone3->setPilotingPCMDYaw(deviceController->aRDrone3, 20);
+			ARSAL_PRINT(ARSAL_PRINT_WARNING, TAG, "State[Tracking]: Status is None!");
+			deviceController->aRDrone3->setPilotingPCMD(deviceController->aRDrone3, 0, 0, 0, 0, 0, 0);
 		}
 		break;
-		default: break;
+		}
+
+		if (detection.frameId != 0)
+		{
+			ARSAL_Trace_Record(ARSAL_TRACE_STAGE_DECIDED, detection.frameId);
+			ARSAL_Trace_SetPendingCommand(detection.frameId);
 		}
 	}
 	break;
-	case STATE_PARAMETER_TRACKING::STATUS_MISSED:
-	{
-		ARSAL_PRINT(ARSAL_PRINT_INFO, TAG, "State[Tracking => Missing]: Missed a person!");
-		// deviceController->aRDrone3->setPilotingPCMD(deviceController->aRDrone3, 0, 0, 0, 0, 0, 0);
-		setState(STATE_MISSING);
-	}
-	break;
-	case STATE_PARAMETER_TRACKING::STATUS_CAPTURED:
+	case STATE_MISSING:
 	{
-		ARSAL_PRINT(ARSAL_PRINT_INFO, TAG, "State[Tracking => Captured]: Captured a person!");
-		deviceController->aRDrone3->setPilotingPCMD(deviceController->aRDrone3, 0, 0, 0, 0, 0, 0);
-
-		setState(STATE_CAPTURED);
+		if (detection.status == DETECTION_FOUND)
+		{
+			ARSAL_PRINT(ARSAL_PRINT_INFO, TAG, "State[Missing => Tracking]: Found the person. Back to tracking");
+			setState(STATE_TRACKING);
+		}
 	}
 	break;
 	default: break;
 	}
 }
 
-void StateController::processStateCaptured(STATE_PARAMETER_CAPTURED * param)
+void StateController::dispatchTelemetry(const EVENT_TELEMETRY_DATA& telemetry)
 {
-	if (param == nullptr)
+	if (getState() == STATE_LANDING && telemetry.flyingState == ARCOMMANDS_ARDRONE3_PILOTINGSTATE_FLYINGSTATECHANGED_STATE_LANDED)
 	{
-		ARSAL_PRINT(ARSAL_PRINT_WARNING, TAG, "State[Captured]: No parameters!");
-		return;
-	}
-
-	if (GetTickCount64() - param->capturedTick >= CAPTURED_WAIT_TICK)
-	{
-		ARSAL_PRINT(ARSAL_PRINT_INFO, TAG, "State[Captured => Hovering]: Captured timeout. Back to hovering.");
-		setState(STATE_HOVERING);
+		ARSAL_PRINT(ARSAL_PRINT_INFO, TAG, "State[Landing => Ready]: Landed. Get ready.");
+		setState(STATE_READY);
 	}
 }
 
-void StateController::processStateMissing(STATE_PARAMETER_MISSING * param)
+void StateController::dispatchTimeout(const EVENT_TIMEOUT_DATA& timeout)
 {
-	if (param == nullptr)
+	// A deadline only belongs to the state that armed it.
+	if (timeout.state != getState())
 	{
-		ARSAL_PRINT(ARSAL_PRINT_WARNING, TAG, "State[Missing]: No parameters!");
 		return;
 	}
 
-	if (param->found)
+	switch (timeout.state)
 	{
-		ARSAL_PRINT(ARSAL_PRINT_INFO, TAG, "State[Missing => Tracking]: Found the person. Back to tracking");
-		setState(STATE_TRACKING);
+	case STATE_TAKINGOFF:
+	{
+		ARSAL_PRINT(ARSAL_PRINT_INFO, TAG, "State[TakingOff => Hovering]: Completed taking off.");
+		setState(STATE_HOVERING);
 	}
-	else
+	break;
+	case STATE_SEARCHING:
 	{
-		if (GetTickCount64() - param->missedTick >= MISSING_WAIT_TICK)
-		{
-			ARSAL_PRINT(ARSAL_PRINT_INFO, TAG, "State[Missing => Searching]: Failed to find the person. Back to searching");
-			setState(STATE_SEARCHING);
-		}
-		else
-		{
-			// waiting for finding the person...
-		}
+		ARSAL_PRINT(ARSAL_PRINT_INFO, TAG, "State[Searching => Hovering]: No more people. Stop searching.");
+		setState(STATE_HOVERING);
 	}
-}
-
-void StateController::processStateLanding(STATE_PARAMETER_LANDING * param)
-{
-	if (param == nullptr)
+	break;
+	case STATE_MISSING:
 	{
-		ARSAL_PRINT(ARSAL_PRINT_WARNING, TAG, "State[Landing]: No parameters!");
-		return;
+		ARSAL_PRINT(ARSAL_PRINT_INFO, TAG, "State[Missing => Searching]: Failed to find the person lost on frame %llu. Back to searching", (unsigned long long)parameter.missing.missedFrameId);
+		setState(STATE_SEARCHING);
 	}
-
-	if (!param->status_landed)
+	break;
+	case STATE_CAPTURED:
 	{
-		ARSAL_PRINT(ARSAL_PRINT_INFO, TAG, "State[Landing]: Try to land...");
-		deviceController->aRDrone3->sendPilotingLanding(deviceController->aRDrone3);
-		param->status_landed = true;
+		ARSAL_PRINT(ARSAL_PRINT_INFO, TAG, "State[Captured => Hovering]: Captured timeout. Back to hovering.");
+		setState(STATE_HOVERING);
 	}
-
-	if (GetTickCount64() - param->landedTick >= LANDING_WAIT_TICK)
+	break;
+	case STATE_LANDING:
 	{
 		ARSAL_PRINT(ARSAL_PRINT_INFO, TAG, "State[Landing => Ready]: Completed landing. Get ready.");
 		setState(STATE_READY);
 	}
-	else
-	{
-		// wait for landing...
+	break;
+	default: break;
 	}
 }
 
-void StateController::processStateFinished(STATE_PARAMETER_FINISHED * param)
+void StateController::enterState(STATE state)
 {
-	if (param == nullptr)
-	{
-		ARSAL_PRINT(ARSAL_PRINT_WARNING, TAG, "State[Finished]: No parameters!");
-		return;
-	}
+	deadlineArmed = false;
+	memset(&parameter, 0, sizeof(parameter));
 
-	ARSAL_PRINT(ARSAL_PRINT_INFO, TAG, "State[Finished]: Disconnected. Bye-bye!");
-}
-
-void StateController::processState(STATE_PARAMETER* arg)
-{
-	auto state = getState();
+	// The PCMD values set here are kept by the controller and sent periodically until the next state changes them.
 	switch (state)
 	{
 	case STATE_EMERGENCY:
 	{
-		processStateEmergency();
-	}
-	break;
-	case STATE_START:
-	{
-		processStateStart(static_cast<STATE_PARAMETER_START*>(arg));
-	}
-	break;
-	case STATE_READY:
-	{
-		processStateReady(static_cast<STATE_PARAMETER_READY*>(arg));
-
+		ARSAL_PRINT(ARSAL_PRINT_FATAL, TAG, "State[Emergency]: Stop!!!!!!!!!!!!!");
+		deviceController->aRDrone3->sendPilotingEmergency(deviceController->aRDrone3);
+		setState(STATE_FINISHED);
 	}
 	break;
 	case STATE_TAKINGOFF:
 	{
-		processStateTakingOff(static_cast<STATE_PARAMETER_TAKINGOFF*>(arg));
-
+		ARSAL_PRINT(ARSAL_PRINT_INFO, TAG, "State[TakingOff]: Try to take off...");
+		deviceController->aRDrone3->sendPilotingTakeOff(deviceController->aRDrone3);
+		// Go up!
+		deviceController->aRDrone3->setPilotingPCMDGaz(deviceController->aRDrone3, 100);
+		armDeadline(TAKING_OFF_WAIT_TICK);
 	}
 	break;
 	case STATE_HOVERING:
 	{
 		// Stop Moving: Top priority behavior than any errors
 		deviceController->aRDrone3->setPilotingPCMD(deviceController->aRDrone3, 0, 0, 0, 0, 0, 0);
-
-		processStateHovering(static_cast<STATE_PARAMETER_HOVERING*>(arg));
+		ARSAL_PRINT(ARSAL_PRINT_INFO, TAG, "State[Hovering]: Hovering. Waiting for a command...");
 	}
 	break;
 	case STATE_SEARCHING:
 	{
-		processStateSearching(static_cast<STATE_PARAMETER_SEARCHING*>(arg));
+		ARSAL_PRINT(ARSAL_PRINT_INFO, TAG, "State[Searching]: Started to rotate to find people...");
+		// Rotate to right
+		if (!DRONE_DEBUG_MODE) {
+			deviceController->aRDrone3->setPilotingPCMDYaw(deviceController->aRDrone3, 20);
+		}
+		armDeadline(SEARCHING_WAIT_TICK);
 	}
 	break;
 	case STATE_TRACKING:
 	{
-		processStateTracking(static_cast<STATE_PARAMETER_TRACKING*>(arg));
+		deviceController->aRDrone3->setPilotingPCMD(deviceController->aRDrone3, 0, 0, 0, 0, 0, 0);
 	}
 	break;
 	case STATE_MISSING:
 	{
-		// Stop: Top priority behavior than any errors.
-		// deviceController->aRDrone3->setPilotingPCMD(deviceController->aRDrone3, 0, 0, 0, 0, 0, 0);
-
-		processStateMissing(static_cast<STATE_PARAMETER_MISSING*>(arg));
+		// Keep the last move: the person is likely where the drone was going.
+		armDeadline(MISSING_WAIT_TICK);
 	}
 	break;
 	case STATE_CAPTURED:
 	{
 		// Stop: Top priority behavior than any errors.
 		deviceController->aRDrone3->setPilotingPCMD(deviceController->aRDrone3, 0, 0, 0, 0, 0, 0);
-
-		processStateCaptured(static_cast<STATE_PARAMETER_CAPTURED*>(arg));
+		armDeadline(CAPTURED_WAIT_TICK);
 	}
 	break;
 	case STATE_LANDING:
 	{
 		deviceController->aRDrone3->setPilotingPCMD(deviceController->aRDrone3, 0, 0, 0, 0, 0, 0);
-		processStateLanding(static_cast<STATE_PARAMETER_LANDING*>(arg));
+		ARSAL_PRINT(ARSAL_PRINT_INFO, TAG, "State[Landing]: Try to land...");
+		deviceController->aRDrone3->sendPilotingLanding(deviceController->aRDrone3);
+		armDeadline(LANDING_WAIT_TICK);
 	}
 	break;
 	case STATE_FINISHED:
 	{
-		processStateFinished(static_cast<STATE_PARAMETER_FINISHED*>(arg));
+		ARSAL_PRINT(ARSAL_PRINT_INFO, TAG, "State[Finished]: Disconnected. Bye-bye!");
+	}
+	break;
+	case STATE_START:
+	case STATE_READY:
+	default: break;
+	}
+}
+
+void StateController::steerTracking(DIRECTION direction)
+{
+	parameter.tracking.direction = direction;
+
+	switch (direction)
+	{
+	case DIRECTION_NONE:
+	{
+		// do nothing
+		ARSAL_PRINT(ARSAL_PRINT_WARNING, TAG, "State[Tracking]: Found, but no direction.");
+		deviceController->aRDrone3->setPilotingPCMD(deviceController->aRDrone3, 0, 0, 0, 0, 0, 0);
+	}
+	break;
+	case DIRECTION_FORWARD:
+	{
+		// go forward
+		ARSAL_PRINT(ARSAL_PRINT_INFO, TAG, "State[Tracking]: Found, go forward");
+		deviceController->aRDrone3->setPilotingPCMDFlag(deviceController->aRDrone3, 1);
+		deviceController->aRDrone3->setPilotingPCMDPitch(deviceController->aRDrone3, 20);
 	}
 	break;
-	default:
+	case DIRECTION_LEFT:
 	{
+		// turn left
+		ARSAL_PRINT(ARSAL_PRINT_DEBUG, TAG, "State[Tracking]: Found, turn left");
+		deviceController->aRDrone3->setPilotingPCMDYaw(deviceController->aRDrone3, -20);
 	}
 	break;
+	case DIRECTION_RIGHT:
+	{
+		// turn right
+		ARSAL_PRINT(ARSAL_PRINT_DEBUG, TAG, "State[Tracking]: Found, turn right");
+		deviceController->aRDrone3->setPilotingPCMDYaw(deviceController->aRDrone3, 20);
+	}
+	break;
+	default: break;
 	}
 }
@@ -1,17 +1,42 @@
 #pragma once
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+
 extern "C" {
 #include "libARController/ARCONTROLLER_Device.h"
 }
 
+// Timeouts of the states, in milliseconds.
 #define TAKING_OFF_WAIT_TICK 10000
 #define SEARCHING_WAIT_TICK 30000
 #define MISSING_WAIT_TICK 5000
 #define CAPTURED_WAIT_TICK 5000
 #define LANDING_WAIT_TICK 5000
 
+// Events waiting for the state loop. Commands come from the keyboard and detection events are coalesced,
+// so the queue only fills up if the loop is stuck.
+#define STATE_EVENT_QUEUE_SIZE 64
+
 #define DRONE_DEBUG_MODE false
 
+/**
+ * State machine of Oni, driven by events instead of polling.
+ *
+ * Commands, detections and telemetry are posted from any thread with
+ * postEvent() into a fixed-size queue. The state loop takes them with
+ * waitEvent() and hands them to dispatch(), which changes the state at once
+ * and runs the actions of the new state. Every state may arm one deadline on
+ * std::chrono::steady_clock when it is entered; waitEvent() returns an
+ * EVENT_TIMEOUT when it passes, unless the state was left before.
+ *
+ * The data of the current state lives in a tagged union tagged by the state,
+ * so neither the events nor the state changes allocate.
+ */
 class StateController
 {
 public:
@@ -30,155 +55,146 @@ public:
 		STATE_FINISHED,
 	};
 
-	struct STATE_PARAMETER;
-	struct STATE_PARAMETER_START;
-	struct STATE_PARAMETER_READY;
-	struct STATE_PARAMETER_TAKINGOFF;
-	struct STATE_PARAMETER_HOVERING;
-	struct STATE_PARAMETER_SEARCHING;
-	struct STATE_PARAMETER_TRACKING;
-	struct STATE_PARAMETER_MISSING;
-	struct STATE_PARAMETER_CAPTURED;
-	struct STATE_PARAMETER_LANDING;
-	struct STATE_PARAMETER_FINISHED;
-
-private:
-	STATE currentState;
-	ARCONTROLLER_Device_t* deviceController;
-
-public:
-	STATE getState() const { return this->currentState; }
-
-	void setState(STATE state) { this->currentState = state; }
-
-	void processState(STATE_PARAMETER* arg);
-
-private:
-	void processStateEmergency();
-	void processStateStart(STATE_PARAMETER_START* param);
-	void processStateReady(STATE_PARAMETER_READY* param);
-	void processStateTakingOff(STATE_PARAMETER_TAKINGOFF* param);
-	void processStateHovering(STATE_PARAMETER_HOVERING* param);
-	void processStateSearching(STATE_PARAMETER_SEARCHING* param);
-	void processStateTracking(STATE_PARAMETER_TRACKING* param);
-	void processStateMissing(STATE_PARAMETER_MISSING* param);
-	void processStateCaptured(STATE_PARAMETER_CAPTURED* param);
-	void processStateLanding(STATE_PARAMETER_LANDING* param);
-	void processStateFinished(STATE_PARAMETER_FINISHED* param);
-
-public:
-	StateController(ARCONTROLLER_Device_t* deviceController) : deviceController(deviceController)
+	enum EVENT_TYPE
 	{
-		currentState = STATE_START;
-	}
-};
-
-struct StateController::STATE_PARAMETER
-{
-	virtual ~STATE_PARAMETER() { }
-};
-
-struct StateController::STATE_PARAMETER_START : STATE_PARAMETER
-{
-	bool connected;
-
-	STATE_PARAMETER_START(bool connected = false) : connected(connected) { }
-};
+		EVENT_NONE = 0,
+		EVENT_CONNECTED,
+		EVENT_COMMAND,
+		EVENT_DETECTION,
+		EVENT_TELEMETRY,
+		EVENT_TIMEOUT,
+	};
 
-struct StateController::STATE_PARAMETER_READY : STATE_PARAMETER
-{
-	enum STATE_PARAMETER_READY_COMMAND
+	enum COMMAND
 	{
 		COMMAND_NONE = 0,
+		COMMAND_EMERGENCY,
 		COMMAND_TAKEOFF,
+		COMMAND_SEARCH,
+		COMMAND_LAND,
 		COMMAND_DISCONNECT,
 	};
 
-	STATE_PARAMETER_READY_COMMAND command;
-
-	STATE_PARAMETER_READY(STATE_PARAMETER_READY_COMMAND command = COMMAND_NONE) : command(command) { }
-};
-
-struct StateController::STATE_PARAMETER_TAKINGOFF : STATE_PARAMETER
-{
-	bool status_takenOff;
-	ULONGLONG takenOffTick;
+	enum DETECTION_STATUS
+	{
+		DETECTION_NONE = 0,        // not classified yet
+		DETECTION_FOUND,
+		DETECTION_MISSED,
+		DETECTION_CAPTURED,
+	};
 
-	STATE_PARAMETER_TAKINGOFF(ULONGLONG takenOffTick) : status_takenOff(false), takenOffTick(takenOffTick) { }
-};
+	enum DIRECTION
+	{
+		DIRECTION_NONE = 0,
+		DIRECTION_FORWARD,
+		DIRECTION_LEFT,
+		DIRECTION_RIGHT,
+	};
 
-struct StateController::STATE_PARAMETER_HOVERING : STATE_PARAMETER
-{
-	enum STATE_PARAMETER_HOVERING_COMMAND
+	struct EVENT_DETECTION_DATA
 	{
-		COMMAND_NONE = 0,
-		COMMAND_SEARCH,
-		COMMAND_LAND,
+		uint64_t version;          // DetectionService::Result::version that was published
+		DETECTION_STATUS status;
+		DIRECTION direction;       // where the person is, when found while tracking
+		uint64_t frameId;          // timestamp of the frame the status was detected on
 	};
 
-	bool status_hovered;
-	STATE_PARAMETER_HOVERING_COMMAND command;
+	struct EVENT_TELEMETRY_DATA
+	{
+		eARCOMMANDS_ARDRONE3_PILOTINGSTATE_FLYINGSTATECHANGED_STATE flyingState;
+	};
 
-	STATE_PARAMETER_HOVERING(STATE_PARAMETER_HOVERING_COMMAND command = COMMAND_NONE) : status_hovered(false), command(command) { }
-};
+	struct EVENT_TIMEOUT_DATA
+	{
+		STATE state;               // state that armed the deadline
+	};
 
-struct StateController::STATE_PARAMETER_SEARCHING : STATE_PARAMETER
-{
-	bool status_rotating;
-	ULONGLONG startedTick;
-	bool found;
+	struct EVENT
+	{
+		EVENT_TYPE type;
+		union
+		{
+			COMMAND command;
+			EVENT_DETECTION_DATA detection;
+			EVENT_TELEMETRY_DATA telemetry;
+			EVENT_TIMEOUT_DATA timeout;
+		};
+	};
 
-	STATE_PARAMETER_SEARCHING(ULONGLONG startedTick, bool found) : status_rotating(false), startedTick(startedTick), found(found) { }
-};
+	struct STATE_PARAMETER_TRACKING
+	{
+		DIRECTION direction;       // last direction the drone was sent to
+		uint64_t lastDecidedFrameId; // frame of the last decision, 0 if none
+	};
 
-struct StateController::STATE_PARAMETER_TRACKING : STATE_PARAMETER
-{
-	enum STATE_PARAMETER_TRACKING_STATUS
+	struct STATE_PARAMETER_MISSING
 	{
-		STATUS_NONE = 0,
-		STATUS_FOUND,
-		STATUS_MISSED,
-		STATUS_CAPTURED,
+		uint64_t missedFrameId;    // frame the person was lost on
 	};
 
-	enum STATE_PARAMETER_TRACKING_DIRECTION
+	// Data of the current state, tagged by currentState; reset when the state is entered.
+	// The other states wait for events and deadlines only and carry no data.
+	union STATE_PARAMETER
 	{
-		DIRECTION_NONE = 0,
-		DIRECTION_FORWARD,
-		DIRECTION_LEFT,
-		DIRECTION_RIGHT,
+		STATE_PARAMETER_TRACKING tracking;
+		STATE_PARAMETER_MISSING missing;
 	};
 
-	void* tracker;
-	STATE_PARAMETER_TRACKING_STATUS status;
-	STATE_PARAMETER_TRACKING_DIRECTION direction;
+private:
+	std::atomic<STATE> currentState;
+	STATE_PARAMETER parameter;
+	ARCONTROLLER_Device_t* deviceController;
+
+	// Deadline of the current state; only used from the state loop.
+	bool deadlineArmed;
+	STATE deadlineState;
+	std::chrono::steady_clock::time_point deadline;
 
-	STATE_PARAMETER_TRACKING(void* tracker, STATE_PARAMETER_TRACKING_STATUS status, STATE_PARAMETER_TRACKING_DIRECTION direction) : tracker(tracker), status(status), direction(direction) { }
-};
+	std::mutex eventMutex;
+	std::condition_variable eventCondition;
+	EVENT events[STATE_EVENT_QUEUE_SIZE];
+	size_t eventHead;
+	size_t eventCount;
+	bool detectionPending;
 
-struct StateController::STATE_PARAMETER_CAPTURED : STATE_PARAMETER
-{
-	void* tracker;
-	ULONGLONG capturedTick;
+	// Version of the last detection dispatched; an older or equal one has already been acted on.
+	uint64_t lastDetectionVersion;
 
-	STATE_PARAMETER_CAPTURED(void* tracker, ULONGLONG capturedTick) : tracker(tracker), capturedTick(capturedTick) { }
-};
+public:
+	STATE getState() const { return this->currentState; }
 
-struct StateController::STATE_PARAMETER_MISSING : STATE_PARAMETER
-{
-	void* tracker;
-	ULONGLONG missedTick;
-	bool found;
+	const STATE_PARAMETER& getParameter() const { return this->parameter; }
 
-	STATE_PARAMETER_MISSING(void* tracker, ULONGLONG missedTick, bool found) : tracker(tracker), missedTick(missedTick), found(found) { }
-};
+	uint64_t getLastDetectionVersion() const { return this->lastDetectionVersion; }
 
-struct StateController::STATE_PARAMETER_LANDING : STATE_PARAMETER
-{
-	bool status_landed;
-	ULONGLONG landedTick;
+	void setDeviceController(ARCONTROLLER_Device_t* deviceController) { this->deviceController = deviceController; }
 
-	STATE_PARAMETER_LANDING(ULONGLONG landedTick) : status_landed(false), landedTick(landedTick) { }
-};
+	// Queues an event for the state loop; safe from any thread. An emergency goes before the other events.
+	bool postEvent(const EVENT& event);
+
+	// Blocks until an event is queued or the deadline of the current state passes.
+	void waitEvent(EVENT& event);
 
-struct StateController::STATE_PARAMETER_FINISHED : STATE_PARAMETER { };
+	// Runs the transition of the current state for the event. Only called from the state loop.
+	void dispatch(const EVENT& event);
+
+private:
+	void setState(STATE state);
+	void armDeadline(int milliseconds);
+
+	void dispatchCommand(COMMAND command);
+	void dispatchDetection(const EVENT_DETECTION_DATA& detection);
+	void dispatchTelemetry(const EVENT_TELEMETRY_DATA& telemetry);
+	void dispatchTimeout(const EVENT_TIMEOUT_DATA& timeout);
+
+	void enterState(STATE state);
+	void steerTracking(DIRECTION direction);
+
+public:
+	StateController(ARCONTROLLER_Device_t* deviceController) : deviceController(deviceController), deadlineArmed(false), deadlineState(STATE_START),
+		eventHead(0), eventCount(0), detectionPending(false), lastDetectionVersion(0)
+	{
+		currentState = STATE_START;
+		memset(&parameter, 0, sizeof(parameter));
+	}
+};
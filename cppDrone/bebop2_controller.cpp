@@ -7,7 +7,19 @@ extern "C" {
 
 #include "bebop2_controller.h"
 
-// called when a command has been received from the drone
+const eARCONTROLLER_DICTIONARY_KEY command_received_keys[] = {
+	ARCONTROLLER_DICTIONARY_KEY_COMMON_COMMONSTATE_BATTERYSTATECHANGED,
+	ARCONTROLLER_DICTIONARY_KEY_COMMON_COMMONSTATE_SENSORSSTATESLISTCHANGED,
+	ARCONTROLLER_DICTIONARY_KEY_ARDRONE3_PICTURESETTINGSSTATE_VIDEOFRAMERATECHANGED,
+	ARCONTROLLER_DICTIONARY_KEY_ARDRONE3_PICTURESETTINGSSTATE_VIDEORESOLUTIONSCHANGED,
+	ARCONTROLLER_DICTIONARY_KEY_ARDRONE3_MEDIASTREAMINGSTATE_VIDEOSTREAMMODECHANGED,
+	ARCONTROLLER_DICTIONARY_KEY_COMMON_CAMERASETTINGSSTATE_CAMERASETTINGSCHANGED,
+	ARCONTROLLER_DICTIONARY_KEY_ARDRONE3_CAMERASTATE_ORIENTATION,
+	ARCONTROLLER_DICTIONARY_KEY_ARDRONE3_CAMERASTATE_DEFAULTCAMERAORIENTATION,
+};
+const int command_received_keys_count = sizeof(command_received_keys) / sizeof(command_received_keys[0]);
+
+// called when one of command_received_keys has been received from the drone
 void command_received_callback(eARCONTROLLER_DICTIONARY_KEY commandKey, ARCONTROLLER_DICTIONARY_ELEMENT_t *elementDictionary, void *customData)
 {
 	auto *deviceController = static_cast<ARCONTROLLER_Device_t*>(customData);
@@ -7,4 +7,8 @@ extern "C" {
 
 void command_received_callback(eARCONTROLLER_DICTIONARY_KEY commandKey, ARCONTROLLER_DICTIONARY_ELEMENT_t *elementDictionary, void *customData);
 
+// commands handled by command_received_callback
+extern const eARCONTROLLER_DICTIONARY_KEY command_received_keys[];
+extern const int command_received_keys_count;
+
 #endif
@@ -2,6 +2,7 @@
 
 #include <stdlib.h>
 #include <string.h>
+#include <string>
 #include <opencv2/highgui.hpp>
 
 extern "C" {
@@ -13,10 +14,16 @@ extern "C" {
 #include "bebop2_device.h"
 
 static bool isBebopRunning;
+static std::string bebopAddress = BEBOP_IP_ADDRESS;
 
 ARSAL_Sem_t stateSem;
 
-eARCONTROLLER_ERROR start_bebop2(ARCONTROLLER_Device_t** aDeviceController, ARCONTROLLER_DICTIONARY_CALLBACK_t aCommandReceivedCallback, bebop_driver::VideoDecoder* aVideoDecoder, ARCONTROLLER_Stream_DidReceiveFrameCallback_t aDidReceiveFrameCallback, void* aEventCallbackData)
+void set_bebop2_address(const char* address)
+{
+	bebopAddress = (address != nullptr) ? address : BEBOP_IP_ADDRESS;
+}
+
+eARCONTROLLER_ERROR start_bebop2(ARCONTROLLER_Device_t** aDeviceController, ARCONTROLLER_DICTIONARY_CALLBACK_t aCommandReceivedCallback, const eARCONTROLLER_DICTIONARY_KEY* aCommandKeys, int aCommandKeysCount, bebop_driver::VideoDecoder* aVideoDecoder, ARCONTROLLER_Stream_DidReceiveFrameCallback_t aDidReceiveFrameCallback, void* aEventCallbackData)
 {
 	// local declarations
 	auto error = ARCONTROLLER_OK;
@@ -41,7 +48,7 @@ eARCONTROLLER_ERROR start_bebop2(ARCONTROLLER_Device_t** aDeviceController, ARCO
 			ARSAL_PRINT(ARSAL_PRINT_INFO, TAG, "    - ARDISCOVERY_Device_InitWifi ...");
 			// create a Bebop drone discovery device (ARDISCOVERY_PRODUCT_ARDRONE)
 
-			errorDiscovery = ARDISCOVERY_Device_InitWifi(device, ARDISCOVERY_PRODUCT_BEBOP_2, "bebop2", BEBOP_IP_ADDRESS, BEBOP_DISCOVERY_PORT);
+			errorDiscovery = ARDISCOVERY_Device_InitWifi(device, ARDISCOVERY_PRODUCT_BEBOP_2, "bebop2", bebopAddress.c_str(), BEBOP_DISCOVERY_PORT);
 			if (errorDiscovery != ARDISCOVERY_OK)
 			{
 				failed = 1;
@@ -89,10 +96,10 @@ eARCONTROLLER_ERROR start_bebop2(ARCONTROLLER_Device_t** aDeviceController, ARCO
 		}
 	}
 
-	// add the command received callback to be informed when a command has been received from the device
+	// add the command received callback to be informed when one of the given commands has been received from the device
 	if (!failed)
 	{
-		error = ARCONTROLLER_Device_AddCommandReceivedCallback(deviceController, aCommandReceivedCallback, aEventCallbackData);
+		error = ARCONTROLLER_Device_AddCommandReceivedCallbackForKeys(deviceController, aCommandReceivedCallback, aEventCallbackData, aCommandKeys, aCommandKeysCount);
 
 		if (error != ARCONTROLLER_OK)
 		{
@@ -137,6 +144,51 @@ eARCONTROLLER_ERROR start_bebop2(ARCONTROLLER_Device_t** aDeviceController, ARCO
 		}
 	}
 
+	// decode on a dedicated thread, only the latest frame waits so a slow decode never stalls the stream reception;
+	// when a frame has to be dropped the following ones are skipped up to the next IFrame instead of being decoded with artifacts
+	if (!failed)
+	{
+		error = ARCONTROLLER_Device_SetVideoStreamDecodeStage(deviceController, ARCONTROLLER_STREAM_DECODE_POLICY_SKIP_TO_IFRAME, BEBOP_DECODE_QUEUE_SIZE);
+
+		if (error != ARCONTROLLER_OK)
+		{
+			ARSAL_PRINT(ARSAL_PRINT_WARNING, TAG, "- decode stage not set :%s", ARCONTROLLER_Error_ToString(error));
+		}
+	}
+
+	// decode the telemetry in the network receiver thread rather than in one reader thread per buffer
+	if (!failed)
+	{
+		error = ARCONTROLLER_Device_SetDirectCommandDispatch(deviceController, 1);
+
+		if (error != ARCONTROLLER_OK)
+		{
+			ARSAL_PRINT(ARSAL_PRINT_WARNING, TAG, "- direct command dispatch not set :%s", ARCONTROLLER_Error_ToString(error));
+		}
+	}
+
+	// the other commands are not built at all
+	if (!failed)
+	{
+		error = ARCONTROLLER_Device_SetSubscribedCommandsOnly(deviceController, 1);
+
+		if (error != ARCONTROLLER_OK)
+		{
+			ARSAL_PRINT(ARSAL_PRINT_WARNING, TAG, "- subscribed commands only not set :%s", ARCONTROLLER_Error_ToString(error));
+		}
+	}
+
+	// reach the running state from the last connection, the initial settings and states are received in background
+	if (!failed)
+	{
+		error = ARCONTROLLER_Device_SetWarmStartCache(deviceController, BEBOP_WARM_START_CACHE);
+
+		if (error != ARCONTROLLER_OK)
+		{
+			ARSAL_PRINT(ARSAL_PRINT_WARNING, TAG, "- warm start not set :%s", ARCONTROLLER_Error_ToString(error));
+		}
+	}
+
 	if (!failed)
 	{
 		ARSAL_PRINT(ARSAL_PRINT_INFO, TAG, "Connecting ...");
@@ -8,8 +8,12 @@ extern "C" {
 
 #define BEBOP_IP_ADDRESS "192.168.42.1"
 #define BEBOP_DISCOVERY_PORT 44444
+#define BEBOP_WARM_START_CACHE "bebop2_warmstart.bin"
+#define BEBOP_DECODE_QUEUE_SIZE 1
 
-eARCONTROLLER_ERROR start_bebop2(ARCONTROLLER_Device_t** aDeviceController, ARCONTROLLER_DICTIONARY_CALLBACK_t aCommandCallback, bebop_driver::VideoDecoder* aVideoDecoder, ARCONTROLLER_Stream_DidReceiveFrameCallback_t aDidReceiveFrameCallback, void* aEventCallbackData);
+// Overrides BEBOP_IP_ADDRESS for the next start_bebop2, e.g. to connect to a local Bebop2Simulator.
+void set_bebop2_address(const char* address);
+eARCONTROLLER_ERROR start_bebop2(ARCONTROLLER_Device_t** aDeviceController, ARCONTROLLER_DICTIONARY_CALLBACK_t aCommandCallback, const eARCONTROLLER_DICTIONARY_KEY* aCommandKeys, int aCommandKeysCount, bebop_driver::VideoDecoder* aVideoDecoder, ARCONTROLLER_Stream_DidReceiveFrameCallback_t aDidReceiveFrameCallback, void* aEventCallbackData);
 eARCONTROLLER_ERROR finish_bebop2(ARCONTROLLER_Device_t* deviceController);
 void keyboard_controller_loop(ARCONTROLLER_Device_t *deviceController, const char *cvWindowName);
 
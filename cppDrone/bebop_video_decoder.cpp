@@ -26,11 +26,14 @@ ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSI
 
 #include <stdexcept>
 #include <algorithm>
+#include <chrono>
+#include <cmath>
 #include <string>
 
 extern "C"
 {
 #include <libARSAL/ARSAL_Print.h>
+#include <libARSAL/ARSAL_Trace.h>
 }
 
 namespace bebop_driver
@@ -38,6 +41,27 @@ namespace bebop_driver
 
 	const char* VideoDecoder::LOG_TAG = "Decoder";
 
+	VideoFrame::VideoFrame(uint32_t width, uint32_t height, uint32_t channels)
+		: sequence(0),
+		timestamp(0),
+		decoded_time_us(0),
+		width(width),
+		height(height),
+		channels(channels),
+		data(reinterpret_cast<uint8_t*>(av_malloc(width * height * channels)))
+	{
+		if (data == nullptr)
+		{
+			throw std::runtime_error(std::string("Can not allocate memory for the buffer: ") +
+				std::to_string(width) + " x " + std::to_string(height));
+		}
+	}
+
+	VideoFrame::~VideoFrame()
+	{
+		av_free(data);
+	}
+
 	// TODO(mani-monaj): Move to util, inline
 	void VideoDecoder::ThrowOnCondition(const bool cond, const std::string &message)
 	{
@@ -52,12 +76,37 @@ namespace bebop_driver
 		codec_ctx_ptr_(nullptr),
 		codec_ptr_(nullptr),
 		frame_ptr_(nullptr),
-		frame_rgb_ptr_(nullptr),
-		img_convert_ctx_ptr_(nullptr),
 		input_format_ptr_(nullptr),
-		frame_rgb_raw_ptr_(nullptr),
+		frame_sequence_(0),
+		published_sequence_(0),
+		dropped_frames_(0),
+		last_convert_time_us_(0),
 		update_codec_params_(false)
-	{}
+	{
+		views_[VIDEO_VIEW_BGR].enabled = true;
+		views_[VIDEO_VIEW_BGR].pix_fmt = AV_PIX_FMT_BGR24;
+		views_[VIDEO_VIEW_BGR].channels = 3;
+
+		views_[VIDEO_VIEW_GRAY].enabled = false;
+		views_[VIDEO_VIEW_GRAY].pix_fmt = AV_PIX_FMT_GRAY8;
+		views_[VIDEO_VIEW_GRAY].channels = 1;
+	}
+
+	void VideoDecoder::ConfigureGrayView(bool enabled, double scale, size_t ring_size)
+	{
+		ThrowOnCondition(scale <= 0.0 || scale > 1.0, "Gray view scale must be in (0, 1]");
+		ThrowOnCondition(ring_size < 3, "Gray view needs at least three frame slots");
+		views_[VIDEO_VIEW_GRAY].enabled = enabled;
+		views_[VIDEO_VIEW_GRAY].scale = scale;
+		views_[VIDEO_VIEW_GRAY].ring_size = ring_size;
+	}
+
+	bool VideoDecoder::WaitForNewFrame(uint64_t last_sequence, uint32_t timeout_ms) const
+	{
+		std::unique_lock<std::mutex> lock(publish_mutex_);
+		return publish_cond_.wait_for(lock, std::chrono::milliseconds(timeout_ms),
+			[&] { return published_sequence_.load() > last_sequence; });
+	}
 
 	bool VideoDecoder::InitCodec()
 	{
@@ -126,28 +175,32 @@ namespace bebop_driver
 
 		try
 		{
-			ThrowOnCondition(codec_ctx_ptr_->width == 0 || codec_ctx_ptr_->width == 0,
+			ThrowOnCondition(codec_ctx_ptr_->width == 0 || codec_ctx_ptr_->height == 0,
 				std::string("Invalid frame size:") +
 				std::to_string(codec_ctx_ptr_->width) +
-				" x " + std::to_string(codec_ctx_ptr_->width));
+				" x " + std::to_string(codec_ctx_ptr_->height));
 
-			const uint32_t num_bytes = avpicture_get_size(AV_PIX_FMT_BGR24, codec_ctx_ptr_->width, codec_ctx_ptr_->width);
-			frame_rgb_ptr_ = av_frame_alloc();
+			CleanupBuffers();
 
-			ThrowOnCondition(!frame_rgb_ptr_, "Can not allocate memory for frames!");
+			// Every view gets its buffers even when disabled, so that the BGR view
+			// can be switched on later without reallocating on the decode thread.
+			// Frames still referenced by consumers keep their own buffers alive,
+			// so the rings can simply be replaced.
+			for (auto& view : views_)
+			{
+				const uint32_t width = std::max(1L, std::lround(codec_ctx_ptr_->width * view.scale));
+				const uint32_t height = std::max(1L, std::lround(codec_ctx_ptr_->height * view.scale));
 
-			frame_rgb_raw_ptr_ = reinterpret_cast<uint8_t*>(av_malloc(num_bytes * sizeof(uint8_t)));
-			ThrowOnCondition(frame_rgb_raw_ptr_ == nullptr,
-				std::string("Can not allocate memory for the buffer: ") +
-				std::to_string(num_bytes));
-			ThrowOnCondition(0 == avpicture_fill(
-				reinterpret_cast<AVPicture*>(frame_rgb_ptr_), frame_rgb_raw_ptr_, AV_PIX_FMT_BGR24,
-				codec_ctx_ptr_->width, codec_ctx_ptr_->height),
-				"Failed to initialize the picture data structure.");
+				for (size_t i = 0; i < view.ring_size; ++i)
+				{
+					view.ring.push_back(std::make_shared<VideoFrame>(width, height, view.channels));
+				}
 
-			img_convert_ctx_ptr_ = sws_getContext(codec_ctx_ptr_->width, codec_ctx_ptr_->height, codec_ctx_ptr_->pix_fmt,
-				codec_ctx_ptr_->width, codec_ctx_ptr_->height, AV_PIX_FMT_BGR24,
-				SWS_FAST_BILINEAR, nullptr, nullptr, nullptr);
+				view.convert_ctx_ptr = sws_getContext(codec_ctx_ptr_->width, codec_ctx_ptr_->height, codec_ctx_ptr_->pix_fmt,
+					width, height, view.pix_fmt,
+					SWS_FAST_BILINEAR, nullptr, nullptr, nullptr);
+				ThrowOnCondition(view.convert_ctx_ptr == nullptr, "Can not create the conversion context.");
+			}
 		}
 		catch (const std::runtime_error& e)
 		{
@@ -159,21 +212,17 @@ namespace bebop_driver
 		return true;
 	}
 
-	void VideoDecoder::CleanupBuffers() const
+	void VideoDecoder::CleanupBuffers()
 	{
-		if (frame_rgb_ptr_)
+		for (auto& view : views_)
 		{
-			av_free(frame_rgb_ptr_);
-		}
+			view.ring.clear();
 
-		if (frame_rgb_raw_ptr_)
-		{
-			av_free(frame_rgb_raw_ptr_);
-		}
-
-		if (img_convert_ctx_ptr_)
-		{
-			sws_freeContext(img_convert_ctx_ptr_);
+			if (view.convert_ctx_ptr)
+			{
+				sws_freeContext(view.convert_ctx_ptr);
+				view.convert_ctx_ptr = nullptr;
+			}
 		}
 
 		ARSAL_PRINT(ARSAL_PRINT_INFO, LOG_TAG, "Buffer cleanup!");
@@ -204,11 +253,82 @@ namespace bebop_driver
 		ARSAL_PRINT(ARSAL_PRINT_INFO, LOG_TAG, "Dstr!");
 	}
 
-	void VideoDecoder::ConvertFrameToRGB() const
+	void VideoDecoder::SetBGRViewEnabled(bool enabled)
+	{
+		views_[VIDEO_VIEW_BGR].enabled = enabled;
+		if (!enabled)
+		{
+			std::atomic_store(&views_[VIDEO_VIEW_BGR].latest, VideoFramePtr());
+		}
+	}
+
+	std::shared_ptr<VideoFrame> VideoDecoder::AcquireFreeSlot(OutputView& view)
+	{
+		// A slot is free when only the ring refers to it. The published frame is
+		// referenced by view.latest too, and consumers can only obtain new
+		// references through view.latest, so a free slot cannot be grabbed
+		// behind our back while we write into it.
+		for (auto& slot : view.ring)
+		{
+			if (slot.use_count() == 1)
+			{
+				return slot;
+			}
+		}
+		return nullptr;
+	}
+
+	void VideoDecoder::ConvertFrame(OutputView& view, uint64_t timestamp)
+	{
+		if (!view.convert_ctx_ptr) return;
+
+		auto slot = AcquireFreeSlot(view);
+		if (!slot)
+		{
+			// Every slot is held by a consumer; never overwrite a frame in use.
+			++dropped_frames_;
+			return;
+		}
+
+		uint8_t* dst_data[4] = { slot->data, nullptr, nullptr, nullptr };
+		int dst_linesize[4] = { static_cast<int>(slot->width * slot->channels), 0, 0, 0 };
+		sws_scale(view.convert_ctx_ptr, frame_ptr_->data, frame_ptr_->linesize, 0,
+			codec_ctx_ptr_->height, dst_data, dst_linesize);
+
+		slot->sequence = frame_sequence_;
+		slot->timestamp = timestamp;
+		slot->decoded_time_us = std::chrono::duration_cast<std::chrono::microseconds>(
+			std::chrono::steady_clock::now().time_since_epoch()).count();
+
+		std::atomic_store(&view.latest, VideoFramePtr(slot));
+	}
+
+	void VideoDecoder::UpdateViews(uint64_t timestamp)
 	{
 		if (!codec_ctx_ptr_->width || !codec_ctx_ptr_->height) return;
-		sws_scale(img_convert_ctx_ptr_, frame_ptr_->data, frame_ptr_->linesize, 0,
-			codec_ctx_ptr_->height, frame_rgb_ptr_->data, frame_rgb_ptr_->linesize);
+
+		++frame_sequence_;
+		const auto convert_start = std::chrono::steady_clock::now();
+		for (auto& view : views_)
+		{
+			if (view.enabled)
+			{
+				ConvertFrame(view, timestamp);
+			}
+			else if (std::atomic_load(&view.latest))
+			{
+				// Disabled while a picture was being converted
+				std::atomic_store(&view.latest, VideoFramePtr());
+			}
+		}
+		last_convert_time_us_ = std::chrono::duration_cast<std::chrono::microseconds>(
+			std::chrono::steady_clock::now() - convert_start).count();
+
+		{
+			std::lock_guard<std::mutex> lock(publish_mutex_);
+			published_sequence_ = frame_sequence_;
+		}
+		publish_cond_.notify_all();
 	}
 
 	bool VideoDecoder::SetH264Params(uint8_t *sps_buffer_ptr, uint32_t sps_buffer_size,
@@ -303,7 +423,8 @@ namespace bebop_driver
 							ARSAL_PRINT(ARSAL_PRINT_ERROR, LOG_TAG, "Buffer reallocation failed!");
 						}
 					}
-					ConvertFrameToRGB();
+					UpdateViews(bebop_frame_ptr_->timestamp);
+					ARSAL_Trace_Record(ARSAL_TRACE_STAGE_DECODED, bebop_frame_ptr_->timestamp);
 				}
 
 				if (packet_.data)
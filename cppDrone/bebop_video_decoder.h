@@ -36,6 +36,10 @@ extern "C"
 #include <libavutil/pixfmt.h>
 }
 
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -58,9 +62,70 @@ extern "C"
 namespace bebop_driver
 {
 
+	/**
+	 * Output planes VideoDecoder can produce from each decoded picture.
+	 *
+	 * VIDEO_VIEW_BGR  : full resolution BGR24, meant for display.
+	 * VIDEO_VIEW_GRAY : 8-bit luma, optionally downscaled, meant for detection.
+	 *                   sws_scale converts it to GRAY8 from the Y plane only,
+	 *                   which is cheaper than the BGR conversion but still a
+	 *                   pass over the picture (and a resize when scaled).
+	 */
+	enum VideoView
+	{
+		VIDEO_VIEW_BGR = 0,
+		VIDEO_VIEW_GRAY,
+		VIDEO_VIEW_COUNT,
+	};
+
+	/**
+	 * A decoded frame published by VideoDecoder.
+	 *
+	 * Frames are owned by the decoder's frame rings and handed out as shared
+	 * pointers. As long as a consumer holds a reference the decoder will never
+	 * write into that slot, so the pixel data can be wrapped in a cv::Mat
+	 * without copying and without tearing.
+	 */
+	struct VideoFrame
+	{
+		uint64_t sequence;        // monotonically increasing, starts at 1, shared by all views of one picture
+		uint64_t timestamp;       // timestamp of the access unit (from ARCONTROLLER_Frame_t)
+		uint64_t decoded_time_us; // steady clock time when the frame was published
+		uint32_t width;
+		uint32_t height;
+		uint32_t channels;        // 3 for VIDEO_VIEW_BGR, 1 for VIDEO_VIEW_GRAY
+		uint8_t* data;            // width * height * channels bytes, tightly packed
+
+		VideoFrame(uint32_t width, uint32_t height, uint32_t channels);
+		~VideoFrame();
+
+		VideoFrame(const VideoFrame&) = delete;
+		VideoFrame& operator=(const VideoFrame&) = delete;
+	};
+
+	typedef std::shared_ptr<const VideoFrame> VideoFramePtr;
+
 	class VideoDecoder
 	{
+	public:
+		// At least three slots: one being written, one published, one held by a consumer
+		static const size_t FRAME_RING_SIZE = 4;
+
 	private:
+		struct OutputView
+		{
+			std::atomic<bool> enabled;
+			double scale;
+			size_t ring_size;
+			AVPixelFormat pix_fmt;
+			uint32_t channels;
+			SwsContext* convert_ctx_ptr;
+			std::vector<std::shared_ptr<VideoFrame>> ring;
+			VideoFramePtr latest;
+
+			OutputView() : enabled(false), scale(1.0), ring_size(FRAME_RING_SIZE), pix_fmt(AV_PIX_FMT_BGR24), channels(3), convert_ctx_ptr(nullptr) {}
+		};
+
 		static const char* LOG_TAG;
 
 		bool codec_initialized_;
@@ -69,11 +134,16 @@ namespace bebop_driver
 		AVCodecContext* codec_ctx_ptr_;
 		AVCodec* codec_ptr_;
 		AVFrame* frame_ptr_;
-		AVFrame* frame_rgb_ptr_;
 		AVPacket packet_;
-		SwsContext* img_convert_ctx_ptr_;
 		AVInputFormat* input_format_ptr_;
-		uint8_t *frame_rgb_raw_ptr_;
+
+		OutputView views_[VIDEO_VIEW_COUNT];
+		uint64_t frame_sequence_;
+		std::atomic<uint64_t> published_sequence_;
+		std::atomic<uint64_t> dropped_frames_;
+		std::atomic<uint64_t> last_convert_time_us_;
+		mutable std::mutex publish_mutex_;
+		mutable std::condition_variable publish_cond_;
 
 		bool update_codec_params_;
 		std::vector<uint8_t> codec_data_;
@@ -81,22 +151,47 @@ namespace bebop_driver
 		static void ThrowOnCondition(const bool cond, const std::string& message);
 		bool InitCodec();
 		bool ReallocateBuffers();
-		void CleanupBuffers() const;
+		void CleanupBuffers();
 		void Reset();
 
-		void ConvertFrameToRGB() const;
+		static std::shared_ptr<VideoFrame> AcquireFreeSlot(OutputView& view);
+		void ConvertFrame(OutputView& view, uint64_t timestamp);
+		void UpdateViews(uint64_t timestamp);
 
 	public:
 		VideoDecoder();
 		~VideoDecoder();
 
+		/**
+		 * Enables the downscaled luma view used by the detector.
+		 * ring_size must cover every frame consumers hold at once plus two.
+		 * Must be called before the first frame is decoded.
+		 */
+		void ConfigureGrayView(bool enabled, double scale, size_t ring_size = FRAME_RING_SIZE);
+
+		/**
+		 * Turns the full resolution BGR view on or off. It is on by default.
+		 * May be toggled at any time, e.g. only while a window shows the video.
+		 * Turning it off drops its latest frame, so GetLatestFrame returns
+		 * nullptr instead of a stale picture until it is turned on again.
+		 */
+		void SetBGRViewEnabled(bool enabled);
+
 		bool SetH264Params(uint8_t* sps_buffer_ptr, uint32_t sps_buffer_size,
 			uint8_t* pps_buffer_ptr, uint32_t pps_buffer_size);
 		bool Decode(const ARCONTROLLER_Frame_t* bebop_frame_ptr_);
 		inline uint32_t GetFrameWidth() const { return codec_initialized_ ? codec_ctx_ptr_->width : 0; }
 		inline uint32_t GetFrameHeight() const { return codec_initialized_ ? codec_ctx_ptr_->height : 0; }
 
-		inline const uint8_t* GetFrameRGBRawCstPtr() const { return frame_rgb_raw_ptr_; }
+		// Returns the most recently decoded frame of a view (or nullptr before the first one).
+		// Safe to call from any thread; the returned frame stays valid while referenced.
+		inline VideoFramePtr GetLatestFrame(VideoView view = VIDEO_VIEW_BGR) const { return std::atomic_load(&views_[view].latest); }
+		inline uint64_t GetDroppedFrameCount() const { return dropped_frames_.load(); }
+		// Time the last decoded picture spent in the color conversion and scaling of the views.
+		inline uint64_t GetLastConvertTimeUs() const { return last_convert_time_us_.load(); }
+
+		// Blocks until a frame newer than last_sequence is published or the timeout expires.
+		bool WaitForNewFrame(uint64_t last_sequence, uint32_t timeout_ms) const;
 	};
 
 }  // namespace bebop_driver
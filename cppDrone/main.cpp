@@ -33,6 +33,8 @@ extern "C" {
 #include "bebop2_controller.h"
 
 #include "Oni.h"
+#include "ReplayBenchmark.h"
+#include "Bebop2Simulator.h"
 
 using namespace std;
 using namespace cv;
@@ -149,12 +151,9 @@ eARCONTROLLER_ERROR receive_frame_callback(ARCONTROLLER_Frame_t *frame, void *cu
 			else
 			{
 				uint64_t cur_timestamp = GetTickCount64();
-				if (cur_timestamp - prev_timestamp < 1000) {
-					CvSize size;
-					size.width = decoder->GetFrameWidth();
-					size.height = decoder->GetFrameHeight();
-
-					Mat image(size, CV_8UC3, (void*)decoder->GetFrameRGBRawCstPtr());
+				auto decoded = decoder->GetLatestFrame();
+				if (cur_timestamp - prev_timestamp < 1000 && decoded != nullptr) {
+					Mat image(decoded->height, decoded->width, CV_8UC3, decoded->data);
 					imshow("video", image);
 
 					// process_opencv_from_image(image);
@@ -178,7 +177,7 @@ void process_bebop2()
 	ARCONTROLLER_Device_t* deviceController;
 	auto* videoDecoder = new VideoDecoder();
 
-	auto error = start_bebop2(&deviceController, command_received_callback, videoDecoder, receive_frame_callback, nullptr);
+	auto error = start_bebop2(&deviceController, command_received_callback, command_received_keys, command_received_keys_count, videoDecoder, receive_frame_callback, nullptr);
 
 	if (error == ARCONTROLLER_OK) {
 
@@ -859,8 +858,36 @@ void process_opencv()
 	cv::destroyAllWindows();
 }
 
-int main(void)
+int main(int argc, char* argv[])
 {
+	// cppDrone --replay <file.h264> ... benchmarks a recording instead of flying
+	if (argc > 1 && strcmp(argv[1], "--replay") == 0)
+	{
+		return ReplayBenchmark::runFromCommandLine(argc - 1, argv + 1);
+	}
+
+	// cppDrone --simulate <file.h264> ... stands in for the drone on this machine
+	if (argc > 1 && strcmp(argv[1], "--simulate") == 0)
+	{
+		return Bebop2Simulator::runFromCommandLine(argc - 1, argv + 1);
+	}
+
+	// cppDrone --drone <address> connects to another drone address, e.g. 127.0.0.1 for the simulator
+	// cppDrone --trace <file.json> traces the latency of every frame, written as a Chrome trace on exit
+	const char* tracePath = nullptr;
+	for (int i = 1; i + 1 < argc; ++i)
+	{
+		if (strcmp(argv[i], "--drone") == 0)
+		{
+			set_bebop2_address(argv[i + 1]);
+		}
+		else if (strcmp(argv[i], "--trace") == 0)
+		{
+			tracePath = argv[i + 1];
+		}
+	}
+	ARSAL_Trace_SetEnabled(tracePath != nullptr);
+
 	//process_bebop2();
 
 	auto oni = Oni::createOni();
@@ -870,6 +897,23 @@ int main(void)
 		printf("Start oni!");
 		oni->startOni();
 	}
+
+	if (tracePath != nullptr)
+	{
+		ARSAL_Trace_SetEnabled(0);
+		ARSAL_Trace_WriteHistograms(stdout);
+
+		FILE* traceFile = nullptr;
+		if (fopen_s(&traceFile, tracePath, "w") == 0)
+		{
+			ARSAL_Trace_WriteChromeJson(traceFile);
+			fclose(traceFile);
+		}
+		else
+		{
+			ARSAL_PRINT(ARSAL_PRINT_ERROR, TAG, "Can not write the trace to %s.", tracePath);
+		}
+	}
 	
 	//process_opencv();
 	return 0;